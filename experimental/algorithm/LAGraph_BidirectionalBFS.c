@@ -0,0 +1,256 @@
+//------------------------------------------------------------------------------
+// LAGraph_BidirectionalBFS: shortest path between two nodes, by hop count
+//------------------------------------------------------------------------------
+
+// LAGraph, (c) 2019-2022 by The LAGraph Contributors, All Rights Reserved.
+// SPDX-License-Identifier: BSD-2-Clause
+//
+// For additional details (including references to third party source code and
+// other files) see the LICENSE file or contact permission@sei.cmu.edu. See
+// Contributors.txt for a full list of contributors. Created, in part, with
+// funding and support from the U.S. Government (see Acknowledgments.txt file).
+// DM22-0790
+
+//------------------------------------------------------------------------------
+
+// LAGraph_BidirectionalBFS finds a path with the fewest edges from the node
+// src to the node dest.  On output, hops is the number of edges in the path,
+// and path is a GrB_INT64 vector of size hops+1, where path(0) = src,
+// path(hops) = dest, and A(path(k),path(k+1)) is an edge for each k.  If dest
+// cannot be reached from src, hops is -1 and path is returned as NULL.  The
+// path is not computed if path is NULL on input.
+
+// Two searches are done at the same time: a forward search from src along the
+// edges of A, and a backward search from dest along the edges of AT.  At each
+// step, the search with the smaller frontier is advanced by one level.  The
+// method stops as soon as the new frontier of one search contains a node
+// already seen by the other.  If the forward search has done kf levels and
+// the backward search kb levels when this happens, no path has kf+kb edges or
+// fewer (the two searches had not met), so any path through a meeting node has
+// the shortest length, kf+kb+1.  The node with the lowest index is used.  On
+// graphs with a small diameter, each search only needs to reach about half of
+// the levels, and this can touch far fewer edges than LAGr_BreadthFirstSearch.
+
+// Each search keeps a parent vector, computed with the ANY_SECONDI semiring
+// as in LG_BreadthFirstSearch_SSGrB: pf(i) is the parent of i in the forward
+// search, and pb(i) is the next node from i towards dest in the backward
+// search.  The path is traced back through both to the meeting node.
+
+// This is an Advanced algorithm.  G->AT is used by the backward search, if G
+// is directed and its structure is not known to be symmetric; if not present,
+// the backward search uses A with a dot-product-based mxv instead, which is
+// slower.  G->AT is not computed if not present.  SuiteSparse:GraphBLAS is
+// required.
+
+//------------------------------------------------------------------------------
+
+#define LG_FREE_WORK                                        \
+{                                                           \
+    GrB_free (&qf) ;                                        \
+    GrB_free (&qb) ;                                        \
+    GrB_free (&pf) ;                                        \
+    GrB_free (&pb) ;                                        \
+    GrB_free (&meet) ;                                      \
+    LAGraph_Free ((void **) &I, NULL) ;                     \
+    LAGraph_Free ((void **) &X, NULL) ;                     \
+}
+
+#define LG_FREE_ALL                                         \
+{                                                           \
+    LG_FREE_WORK ;                                          \
+    GrB_free (&P) ;                                         \
+}
+
+#include "LG_internal.h"
+#include "LAGraphX.h"
+
+int LAGraph_BidirectionalBFS
+(
+    // output:
+    int64_t *hops,          // # of edges in the path, or -1 if none
+    GrB_Vector *path,       // path(k) = kth node of the path, may be NULL
+    // input:
+    const LAGraph_Graph G,
+    GrB_Index src,          // first node of the path
+    GrB_Index dest,         // last node of the path
+    char *msg
+)
+{
+
+    //--------------------------------------------------------------------------
+    // check inputs
+    //--------------------------------------------------------------------------
+
+    LG_CLEAR_MSG ;
+    GrB_Vector qf = NULL ;      // frontier of the forward search
+    GrB_Vector qb = NULL ;      // frontier of the backward search
+    GrB_Vector pf = NULL ;      // parent vector of the forward search
+    GrB_Vector pb = NULL ;      // parent vector of the backward search
+    GrB_Vector meet = NULL ;    // nodes seen by both searches
+    GrB_Vector P = NULL ;       // the path
+    GrB_Index *I = NULL ;
+    int64_t *X = NULL ;
+
+#if !LAGRAPH_SUITESPARSE
+    LG_ASSERT (false, GrB_NOT_IMPLEMENTED) ;
+#else
+
+    bool compute_path = (path != NULL) ;
+    if (compute_path) (*path) = NULL ;
+    LG_ASSERT (hops != NULL, GrB_NULL_POINTER) ;
+    (*hops) = -1 ;
+    LG_TRY (LAGraph_CheckGraph (G, msg)) ;
+
+    GrB_Matrix A = G->A ;
+    GrB_Index n ;
+    GRB_TRY (GrB_Matrix_nrows (&n, A)) ;
+    LG_ASSERT_MSG (src < n, GrB_INVALID_INDEX, "invalid source node") ;
+    LG_ASSERT_MSG (dest < n, GrB_INVALID_INDEX, "invalid destination node") ;
+
+    GrB_Matrix AT = NULL ;
+    if (G->kind == LAGraph_ADJACENCY_UNDIRECTED ||
+       (G->kind == LAGraph_ADJACENCY_DIRECTED &&
+        G->is_symmetric_structure == LAGraph_TRUE))
+    {
+        // AT and A have the same structure and can be used in both directions
+        AT = G->A ;
+    }
+    else
+    {
+        // AT = A' is different from A.  If G->AT is NULL, then the backward
+        // search uses A instead.
+        AT = G->AT ;
+    }
+
+    //--------------------------------------------------------------------------
+    // start both searches
+    //--------------------------------------------------------------------------
+
+    // use the ANY_SECONDI_INT* semiring, so that q(i) = parent of i
+    GrB_Type int_type = (n > INT32_MAX) ? GrB_INT64 : GrB_INT32 ;
+    GrB_Semiring semiring = (n > INT32_MAX) ?
+        GxB_ANY_SECONDI_INT64 : GxB_ANY_SECONDI_INT32 ;
+
+    GRB_TRY (GrB_Vector_new (&pf, int_type, n)) ;
+    GRB_TRY (GrB_Vector_new (&pb, int_type, n)) ;
+    GRB_TRY (GrB_Vector_new (&qf, int_type, n)) ;
+    GRB_TRY (GrB_Vector_new (&qb, int_type, n)) ;
+    GRB_TRY (GrB_Vector_new (&meet, GrB_INT64, n)) ;
+    GRB_TRY (GxB_set (pf, GxB_SPARSITY_CONTROL, GxB_SPARSE + GxB_BITMAP)) ;
+    GRB_TRY (GxB_set (pb, GxB_SPARSITY_CONTROL, GxB_SPARSE + GxB_BITMAP)) ;
+    GRB_TRY (GrB_Vector_setElement (pf, src, src)) ;
+    GRB_TRY (GrB_Vector_setElement (qf, src, src)) ;
+    GRB_TRY (GrB_Vector_setElement (pb, dest, dest)) ;
+    GRB_TRY (GrB_Vector_setElement (qb, dest, dest)) ;
+
+    //--------------------------------------------------------------------------
+    // advance the smaller frontier until the searches meet
+    //--------------------------------------------------------------------------
+
+    int64_t kf = 0, kb = 0 ;    // # of levels done by each search
+    GrB_Index nqf = 1, nqb = 1 ;
+    int64_t mid = -1 ;          // the meeting node
+
+    if (src == dest)
+    {
+        // the path is just the node src
+        mid = src ;
+    }
+
+    while (mid < 0)
+    {
+        if (nqf <= nqb)
+        {
+            // forward (saxpy-based vxm):  qf'{!pf} = qf'*A
+            GRB_TRY (GrB_vxm (qf, pf, NULL, semiring, qf, A, GrB_DESC_RSC)) ;
+            GRB_TRY (GrB_Vector_nvals (&nqf, qf)) ;
+            if (nqf == 0) break ;
+            kf++ ;
+            // pf{qf} = qf
+            GRB_TRY (GrB_assign (pf, qf, NULL, qf, GrB_ALL, n, GrB_DESC_S)) ;
+            // meet{pb} = the index of each node in qf also seen by the
+            // backward search
+            GRB_TRY (GrB_apply (meet, pb, NULL, GrB_ROWINDEX_INT64, qf, 0,
+                GrB_DESC_RS)) ;
+        }
+        else
+        {
+            if (AT != NULL)
+            {
+                // backward (saxpy-based vxm):  qb'{!pb} = qb'*AT
+                GRB_TRY (GrB_vxm (qb, pb, NULL, semiring, qb, AT,
+                    GrB_DESC_RSC)) ;
+            }
+            else
+            {
+                // backward (dot-product-based mxv):  qb{!pb} = A*qb
+                GRB_TRY (GrB_mxv (qb, pb, NULL, semiring, A, qb,
+                    GrB_DESC_RSC)) ;
+            }
+            GRB_TRY (GrB_Vector_nvals (&nqb, qb)) ;
+            if (nqb == 0) break ;
+            kb++ ;
+            // pb{qb} = qb
+            GRB_TRY (GrB_assign (pb, qb, NULL, qb, GrB_ALL, n, GrB_DESC_S)) ;
+            // meet{pf} = the index of each node in qb also seen by the
+            // forward search
+            GRB_TRY (GrB_apply (meet, pf, NULL, GrB_ROWINDEX_INT64, qb, 0,
+                GrB_DESC_RS)) ;
+        }
+
+        GrB_Index nmeet ;
+        GRB_TRY (GrB_Vector_nvals (&nmeet, meet)) ;
+        if (nmeet > 0)
+        {
+            // the searches have met; use the meeting node of lowest index
+            GRB_TRY (GrB_reduce (&mid, NULL, GrB_MIN_MONOID_INT64, meet,
+                NULL)) ;
+        }
+    }
+
+    //--------------------------------------------------------------------------
+    // trace the path back from the meeting node to src and dest
+    //--------------------------------------------------------------------------
+
+    if (mid >= 0)
+    {
+        (*hops) = kf + kb ;
+        if (compute_path)
+        {
+            int64_t len = kf + kb + 1 ;
+            LG_TRY (LAGraph_Malloc ((void **) &I, len, sizeof (GrB_Index),
+                msg)) ;
+            LG_TRY (LAGraph_Malloc ((void **) &X, len, sizeof (int64_t),
+                msg)) ;
+            // the forward half: path (0:kf) = src ... mid
+            int64_t node = mid ;
+            for (int64_t k = kf ; k >= 0 ; k--)
+            {
+                X [k] = node ;
+                GRB_TRY (GrB_Vector_extractElement (&node, pf, node)) ;
+            }
+            // the backward half: path (kf:len-1) = mid ... dest
+            node = mid ;
+            for (int64_t k = kf ; k < len ; k++)
+            {
+                X [k] = node ;
+                GRB_TRY (GrB_Vector_extractElement (&node, pb, node)) ;
+            }
+            for (int64_t k = 0 ; k < len ; k++)
+            {
+                I [k] = k ;
+            }
+            GRB_TRY (GrB_Vector_new (&P, GrB_INT64, len)) ;
+            GRB_TRY (GrB_Vector_build (P, I, X, len, GrB_PLUS_INT64)) ;
+            (*path) = P ;
+        }
+    }
+
+    //--------------------------------------------------------------------------
+    // free workspace and return result
+    //--------------------------------------------------------------------------
+
+    LG_FREE_WORK ;
+    return (GrB_SUCCESS) ;
+#endif
+}
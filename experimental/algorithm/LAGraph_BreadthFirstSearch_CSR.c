@@ -0,0 +1,520 @@
+//------------------------------------------------------------------------------
+// LAGraph_BreadthFirstSearch_CSR: direction-optimized BFS on the CSR arrays
+//------------------------------------------------------------------------------
+
+// LAGraph, (c) 2019-2022 by The LAGraph Contributors, All Rights Reserved.
+// SPDX-License-Identifier: BSD-2-Clause
+//
+// For additional details (including references to third party source code and
+// other files) see the LICENSE file or contact permission@sei.cmu.edu. See
+// Contributors.txt for a full list of contributors. Created, in part, with
+// funding and support from the U.S. Government (see Acknowledgments.txt file).
+// DM22-0790
+
+//------------------------------------------------------------------------------
+
+// LAGraph_BreadthFirstSearch_CSR computes the same level and parent vectors
+// as LAGr_BreadthFirstSearch, with the same push/pull heuristic and
+// thresholds (G->bfs_alpha, G->bfs_beta1, and G->bfs_beta2, or their
+// defaults), but each level is done directly on the CSR arrays of A and AT
+// instead of with a GraphBLAS vxm or mxv.  On graphs with a large diameter,
+// such as road networks with thousands of levels, the cost of dispatching
+// and masking one GraphBLAS call per level can dominate the search; here, A
+// and AT are unpacked once, and each level costs only the edges it touches.
+
+// The search keeps an int8 visited array, and the frontier in one of two
+// forms.  A push (top-down) step takes the frontier from a sliding queue:
+// the nodes of the current level are queue [head:tail-1], and the nodes of
+// the next level are appended after them, so the queue is never copied.  A
+// node is claimed with an atomic capture on visited, and each thread gathers
+// the nodes it claims in a small buffer before appending them to the queue.
+// A pull (bottom-up) step takes the frontier as a bitmap with one bit per
+// node: each unvisited node j scans its in-neighbors in AT(j,:) and stops at
+// the first one in the frontier.  The frontier is converted between the two
+// forms only when the search changes direction.
+
+// Structural copies of A and AT are unpacked, so that G is not modified.  The
+// results are packed into bitmap vectors at the end, as computed by
+// LG_BreadthFirstSearch_SSGrB.
+
+// This is an Advanced algorithm.  G->AT is required for the pull step if G is
+// directed and its structure is not known to be symmetric; if not present, a
+// push-only method is used.  G->AT is not computed if not present.  Unlike
+// LAGr_BreadthFirstSearch, G->out_degree is not needed, since the degrees are
+// taken from the CSR row pointers of A.  SuiteSparse:GraphBLAS is required.
+
+//------------------------------------------------------------------------------
+
+#define LG_FREE_WORK                                        \
+{                                                           \
+    GrB_free (&S) ;                                         \
+    LAGraph_Free ((void **) &Ap, NULL) ;                    \
+    LAGraph_Free ((void **) &Aj, NULL) ;                    \
+    LAGraph_Free ((void **) &Ax, NULL) ;                    \
+    LAGraph_Free ((void **) &ATp, NULL) ;                   \
+    LAGraph_Free ((void **) &ATj, NULL) ;                   \
+    LAGraph_Free ((void **) &ATx, NULL) ;                   \
+    LAGraph_Free ((void **) &queue, NULL) ;                 \
+    LAGraph_Free ((void **) &front, NULL) ;                 \
+    LAGraph_Free ((void **) &next, NULL) ;                  \
+    LAGraph_Free ((void **) &visited, NULL) ;               \
+    LAGraph_Free ((void **) &Px, NULL) ;                    \
+    LAGraph_Free ((void **) &Vx, NULL) ;                    \
+    LAGraph_Free ((void **) &Pb, NULL) ;                    \
+    LAGraph_Free ((void **) &Px32, NULL) ;                  \
+    LAGraph_Free ((void **) &Vx32, NULL) ;                  \
+}
+
+#define LG_FREE_ALL                                         \
+{                                                           \
+    LG_FREE_WORK ;                                          \
+    GrB_free (&pi) ;                                        \
+    GrB_free (&v) ;                                         \
+}
+
+#include "LG_internal.h"
+#include "LAGraphX.h"
+
+// size of the buffer of each thread for the nodes it claims in a push step
+#define LG_BFS_BUFFER 1024
+
+int LAGraph_BreadthFirstSearch_CSR
+(
+    // output:
+    GrB_Vector *level,
+    GrB_Vector *parent,
+    // input:
+    const LAGraph_Graph G,
+    GrB_Index src,
+    char *msg
+)
+{
+
+    //--------------------------------------------------------------------------
+    // check inputs
+    //--------------------------------------------------------------------------
+
+    LG_CLEAR_MSG ;
+    GrB_Matrix S = NULL ;           // structural copy of A or AT, to unpack
+    GrB_Vector pi = NULL ;          // parent vector
+    GrB_Vector v = NULL ;           // level vector
+    GrB_Index *Ap = NULL, *Aj = NULL, *ATp = NULL, *ATj = NULL ;
+    void *Ax = NULL, *ATx = NULL ;
+    int64_t *queue = NULL ;         // the sliding queue, of size n
+    uint64_t *front = NULL ;        // the frontier as a bitmap, for pull
+    uint64_t *next = NULL ;         // the next frontier as a bitmap, for pull
+    int8_t *visited = NULL ;        // visited [i] = 1 if node i is visited
+    int64_t *Px = NULL ;            // Px [i] = parent of node i, if visited
+    int64_t *Vx = NULL ;            // Vx [i] = level of node i, if visited
+    int8_t *Pb = NULL ;             // bitmap of the parent vector
+    int32_t *Px32 = NULL ;          // Px and Vx, if int32 on output
+    int32_t *Vx32 = NULL ;
+
+#if !LAGRAPH_SUITESPARSE
+    LG_ASSERT (false, GrB_NOT_IMPLEMENTED) ;
+#else
+
+    bool compute_level  = (level != NULL) ;
+    bool compute_parent = (parent != NULL) ;
+    if (compute_level ) (*level ) = NULL ;
+    if (compute_parent) (*parent) = NULL ;
+    LG_ASSERT_MSG (compute_level || compute_parent, GrB_NULL_POINTER,
+        "either level or parent must be non-NULL") ;
+
+    LG_TRY (LAGraph_CheckGraph (G, msg)) ;
+
+    //--------------------------------------------------------------------------
+    // get the problem size and cached properties
+    //--------------------------------------------------------------------------
+
+    GrB_Index n, nvals ;
+    GRB_TRY (GrB_Matrix_nrows (&n, G->A)) ;
+    LG_ASSERT_MSG (src < n, GrB_INVALID_INDEX, "invalid source node") ;
+    GRB_TRY (GrB_Matrix_nvals (&nvals, G->A)) ;
+
+    GrB_Matrix AT = NULL ;
+    if (G->kind == LAGraph_ADJACENCY_UNDIRECTED ||
+       (G->kind == LAGraph_ADJACENCY_DIRECTED &&
+        G->is_symmetric_structure == LAGraph_TRUE))
+    {
+        // AT and A have the same structure and can be used in both directions
+        AT = G->A ;
+    }
+    else
+    {
+        // AT = A' is different from A.  If G->AT is NULL, then a push-only
+        // method is used.
+        AT = G->AT ;
+    }
+    bool push_pull = (AT != NULL) ;
+
+    // push/pull thresholds: use the values tuned for this graph, if known
+    double alpha = (G->bfs_alpha > 0) ? G->bfs_alpha :   8.0 ;
+    double beta1 = (G->bfs_beta1 > 0) ? G->bfs_beta1 :   8.0 ;
+    double beta2 = (G->bfs_beta2 > 0) ? G->bfs_beta2 : 512.0 ;
+    int64_t n_over_beta1 = (int64_t) (((double) n) / beta1) ;
+    int64_t n_over_beta2 = (int64_t) (((double) n) / beta2) ;
+
+    int nthreads, nthreads_outer, nthreads_inner ;
+    LG_TRY (LAGraph_GetNumThreads (&nthreads_outer, &nthreads_inner, msg)) ;
+    nthreads = nthreads_outer * nthreads_inner ;
+    nthreads = LAGRAPH_MAX (nthreads, 1) ;
+
+    //--------------------------------------------------------------------------
+    // unpack structural copies of A and AT in CSR format
+    //--------------------------------------------------------------------------
+
+    // G->A and G->AT are not unpacked, so that they remain valid for any other
+    // user thread that is reading them.  S is iso, so Ax and ATx have size 1.
+
+    GrB_Index Ap_size, Aj_size, Ax_size, ATp_size, ATj_size, ATx_size ;
+    bool iso, jumbled ;
+    LG_TRY (LAGraph_Matrix_Structure (&S, G->A, msg)) ;
+    GRB_TRY (GxB_Matrix_unpack_CSR (S, &Ap, &Aj, &Ax,
+        &Ap_size, &Aj_size, &Ax_size, &iso, &jumbled, NULL)) ;
+    GrB_free (&S) ;
+
+    const GrB_Index *Tp = Ap, *Tj = Aj ;
+    if (push_pull && AT != G->A)
+    {
+        LG_TRY (LAGraph_Matrix_Structure (&S, AT, msg)) ;
+        GRB_TRY (GxB_Matrix_unpack_CSR (S, &ATp, &ATj, &ATx,
+            &ATp_size, &ATj_size, &ATx_size, &iso, &jumbled, NULL)) ;
+        GrB_free (&S) ;
+        Tp = ATp ;
+        Tj = ATj ;
+    }
+
+    //--------------------------------------------------------------------------
+    // allocate workspace and start the search at src
+    //--------------------------------------------------------------------------
+
+    int64_t nwords = (n + 63) / 64 ;
+    LG_TRY (LAGraph_Calloc ((void **) &visited, n, sizeof (int8_t), msg)) ;
+    LG_TRY (LAGraph_Malloc ((void **) &queue, n, sizeof (int64_t), msg)) ;
+    if (push_pull)
+    {
+        LG_TRY (LAGraph_Malloc ((void **) &front, nwords, sizeof (uint64_t),
+            msg)) ;
+        LG_TRY (LAGraph_Malloc ((void **) &next, nwords, sizeof (uint64_t),
+            msg)) ;
+    }
+    if (compute_parent)
+    {
+        LG_TRY (LAGraph_Malloc ((void **) &Px, n, sizeof (int64_t), msg)) ;
+        Px [src] = src ;
+    }
+    if (compute_level)
+    {
+        LG_TRY (LAGraph_Malloc ((void **) &Vx, n, sizeof (int64_t), msg)) ;
+        Vx [src] = 0 ;
+    }
+    visited [src] = 1 ;
+    queue [0] = src ;
+
+    int64_t head = 0, tail = 1 ;    // the frontier is queue [head:tail-1]
+    bool in_queue = true ;          // true if the frontier is in the queue
+    int64_t nq = 1 ;                // number of nodes in the current level
+    int64_t last_nq = 0 ;
+    int64_t nvisited = 1 ;
+    int64_t edges_unexplored = nvals ;
+    bool do_push = true ;           // start with push
+    bool any_pull = false ;         // true if any pull phase has been done
+
+    //--------------------------------------------------------------------------
+    // BFS traversal and label the nodes
+    //--------------------------------------------------------------------------
+
+    for (int64_t k = 1 ; nvisited < (int64_t) n ; k++)
+    {
+
+        //----------------------------------------------------------------------
+        // select push vs pull, as in LG_BreadthFirstSearch_SSGrB
+        //----------------------------------------------------------------------
+
+        if (push_pull)
+        {
+            if (do_push)
+            {
+                // check for switch from push to pull
+                bool growing = nq > last_nq ;
+                bool switch_to_pull = false ;
+                if (edges_unexplored < (int64_t) n)
+                {
+                    // very little of the graph is left; disable the pull
+                    push_pull = false ;
+                }
+                else if (any_pull)
+                {
+                    switch_to_pull = (growing && nq > n_over_beta1) ;
+                }
+                else
+                {
+                    // edges_in_frontier = sum of the out-degrees of the
+                    // frontier, which is in the queue during a push phase
+                    int64_t edges_in_frontier = 0 ;
+                    int64_t p ;
+                    #pragma omp parallel for num_threads(nthreads) \
+                        schedule(static) reduction(+:edges_in_frontier)
+                    for (p = head ; p < tail ; p++)
+                    {
+                        int64_t i = queue [p] ;
+                        edges_in_frontier += Ap [i+1] - Ap [i] ;
+                    }
+                    edges_unexplored -= edges_in_frontier ;
+                    switch_to_pull = growing &&
+                        (edges_in_frontier > (edges_unexplored / alpha)) ;
+                }
+                if (switch_to_pull)
+                {
+                    // switch from push to pull
+                    do_push = false ;
+                }
+            }
+            else
+            {
+                // check for switch from pull to push
+                bool shrinking = nq < last_nq ;
+                if (shrinking && (nq <= n_over_beta2))
+                {
+                    // switch from pull to push
+                    do_push = true ;
+                }
+            }
+            any_pull = any_pull || (!do_push) ;
+        }
+
+        //----------------------------------------------------------------------
+        // convert the frontier to a queue or a bitmap, if needed
+        //----------------------------------------------------------------------
+
+        if (do_push && !in_queue)
+        {
+            // queue [0:nq-1] = the nodes in the bitmap
+            head = 0 ;
+            tail = 0 ;
+            for (int64_t w = 0 ; w < nwords ; w++)
+            {
+                uint64_t bits = front [w] ;
+                for (int64_t i = 64 * w ; bits != 0 ; bits >>= 1, i++)
+                {
+                    if (bits & 1) queue [tail++] = i ;
+                }
+            }
+            in_queue = true ;
+        }
+        else if (!do_push && in_queue)
+        {
+            // front = the nodes in queue [head:tail-1]
+            memset (front, 0, nwords * sizeof (uint64_t)) ;
+            for (int64_t p = head ; p < tail ; p++)
+            {
+                int64_t i = queue [p] ;
+                front [i / 64] |= ((uint64_t) 1) << (i % 64) ;
+            }
+            in_queue = false ;
+        }
+
+        //----------------------------------------------------------------------
+        // find the kth level of the BFS
+        //----------------------------------------------------------------------
+
+        last_nq = nq ;
+        if (do_push)
+        {
+
+            //------------------------------------------------------------------
+            // push: claim the unvisited out-neighbors of queue [head:tail-1]
+            //------------------------------------------------------------------
+
+            int64_t next_tail = tail ;
+            #pragma omp parallel num_threads(nthreads)
+            {
+                int64_t buffer [LG_BFS_BUFFER] ;
+                int64_t nbuffer = 0, start ;
+                int64_t p ;
+                #pragma omp for schedule(dynamic,64) nowait
+                for (p = head ; p < tail ; p++)
+                {
+                    int64_t i = queue [p] ;
+                    for (GrB_Index pA = Ap [i] ; pA < Ap [i+1] ; pA++)
+                    {
+                        int64_t j = Aj [pA] ;
+                        int8_t was_visited ;
+                        #pragma omp atomic read
+                        was_visited = visited [j] ;
+                        if (was_visited) continue ;
+                        #pragma omp atomic capture
+                        {
+                            was_visited = visited [j] ;
+                            visited [j] = 1 ;
+                        }
+                        if (was_visited) continue ;
+                        // this thread has claimed node j for the next level
+                        if (compute_parent) Px [j] = i ;
+                        if (compute_level ) Vx [j] = k ;
+                        if (nbuffer == LG_BFS_BUFFER)
+                        {
+                            // append the buffer to the queue
+                            #pragma omp atomic capture
+                            {
+                                start = next_tail ;
+                                next_tail += nbuffer ;
+                            }
+                            memcpy (queue + start, buffer,
+                                nbuffer * sizeof (int64_t)) ;
+                            nbuffer = 0 ;
+                        }
+                        buffer [nbuffer++] = j ;
+                    }
+                }
+                // append the rest of the buffer to the queue
+                #pragma omp atomic capture
+                {
+                    start = next_tail ;
+                    next_tail += nbuffer ;
+                }
+                memcpy (queue + start, buffer, nbuffer * sizeof (int64_t)) ;
+            }
+            head = tail ;
+            tail = next_tail ;
+            nq = tail - head ;
+
+        }
+        else
+        {
+
+            //------------------------------------------------------------------
+            // pull: each unvisited node j looks for a parent in the frontier
+            //------------------------------------------------------------------
+
+            // The chunk size is a multiple of 64, so each word of next is
+            // only written by one thread.
+
+            memset (next, 0, nwords * sizeof (uint64_t)) ;
+            int64_t nfound = 0 ;
+            int64_t j ;
+            #pragma omp parallel for num_threads(nthreads) \
+                schedule(dynamic,1024) reduction(+:nfound)
+            for (j = 0 ; j < (int64_t) n ; j++)
+            {
+                if (visited [j]) continue ;
+                for (GrB_Index pA = Tp [j] ; pA < Tp [j+1] ; pA++)
+                {
+                    int64_t i = Tj [pA] ;
+                    if ((front [i / 64] >> (i % 64)) & 1)
+                    {
+                        // node i is the parent of node j
+                        visited [j] = 1 ;
+                        if (compute_parent) Px [j] = i ;
+                        if (compute_level ) Vx [j] = k ;
+                        next [j / 64] |= ((uint64_t) 1) << (j % 64) ;
+                        nfound++ ;
+                        break ;
+                    }
+                }
+            }
+            uint64_t *t = front ;
+            front = next ;
+            next = t ;
+            nq = nfound ;
+        }
+
+        //----------------------------------------------------------------------
+        // done if the kth level is empty
+        //----------------------------------------------------------------------
+
+        if (nq == 0)
+        {
+            break ;
+        }
+        nvisited += nq ;
+    }
+
+    //--------------------------------------------------------------------------
+    // pack the level and parent vectors in bitmap form
+    //--------------------------------------------------------------------------
+
+    bool is_int64 = (n > INT32_MAX) ;
+    GrB_Type int_type = is_int64 ? GrB_INT64 : GrB_INT32 ;
+    size_t xsize = is_int64 ? sizeof (int64_t) : sizeof (int32_t) ;
+
+    if (!is_int64)
+    {
+        // typecast the results to int32
+        int64_t i ;
+        if (compute_parent)
+        {
+            LG_TRY (LAGraph_Malloc ((void **) &Px32, n, sizeof (int32_t),
+                msg)) ;
+            #pragma omp parallel for num_threads(nthreads) schedule(static)
+            for (i = 0 ; i < (int64_t) n ; i++)
+            {
+                if (visited [i]) Px32 [i] = (int32_t) Px [i] ;
+            }
+        }
+        if (compute_level)
+        {
+            LG_TRY (LAGraph_Malloc ((void **) &Vx32, n, sizeof (int32_t),
+                msg)) ;
+            #pragma omp parallel for num_threads(nthreads) schedule(static)
+            for (i = 0 ; i < (int64_t) n ; i++)
+            {
+                if (visited [i]) Vx32 [i] = (int32_t) Vx [i] ;
+            }
+        }
+    }
+
+    if (compute_parent)
+    {
+        // the parent vector takes a copy of visited, or visited itself
+        if (compute_level)
+        {
+            LG_TRY (LAGraph_Malloc ((void **) &Pb, n, sizeof (int8_t), msg)) ;
+            memcpy (Pb, visited, n * sizeof (int8_t)) ;
+        }
+        else
+        {
+            Pb = visited ;
+            visited = NULL ;
+        }
+        GRB_TRY (GrB_Vector_new (&pi, int_type, n)) ;
+        if (is_int64)
+        {
+            GRB_TRY (GxB_Vector_pack_Bitmap (pi, &Pb, (void **) &Px,
+                n * sizeof (int8_t), n * xsize, false, nvisited, NULL)) ;
+        }
+        else
+        {
+            GRB_TRY (GxB_Vector_pack_Bitmap (pi, &Pb, (void **) &Px32,
+                n * sizeof (int8_t), n * xsize, false, nvisited, NULL)) ;
+        }
+        GRB_TRY (GxB_set (pi, GxB_SPARSITY_CONTROL, GxB_BITMAP + GxB_FULL)) ;
+    }
+
+    if (compute_level)
+    {
+        GRB_TRY (GrB_Vector_new (&v, int_type, n)) ;
+        if (is_int64)
+        {
+            GRB_TRY (GxB_Vector_pack_Bitmap (v, &visited, (void **) &Vx,
+                n * sizeof (int8_t), n * xsize, false, nvisited, NULL)) ;
+        }
+        else
+        {
+            GRB_TRY (GxB_Vector_pack_Bitmap (v, &visited, (void **) &Vx32,
+                n * sizeof (int8_t), n * xsize, false, nvisited, NULL)) ;
+        }
+        GRB_TRY (GxB_set (v, GxB_SPARSITY_CONTROL, GxB_BITMAP + GxB_FULL)) ;
+    }
+
+    //--------------------------------------------------------------------------
+    // free workspace and return result
+    //--------------------------------------------------------------------------
+
+    if (compute_parent) (*parent) = pi ;
+    if (compute_level ) (*level ) = v ;
+    LG_FREE_WORK ;
+    return (GrB_SUCCESS) ;
+#endif
+}
@@ -0,0 +1,69 @@
+//------------------------------------------------------------------------------
+// LAGraph_BreadthFirstSearch_Options: BFS with explicit push/pull thresholds
+//------------------------------------------------------------------------------
+
+// LAGraph, (c) 2019-2022 by The LAGraph Contributors, All Rights Reserved.
+// SPDX-License-Identifier: BSD-2-Clause
+//
+// For additional details (including references to third party source code and
+// other files) see the LICENSE file or contact permission@sei.cmu.edu. See
+// Contributors.txt for a full list of contributors. Created, in part, with
+// funding and support from the U.S. Government (see Acknowledgments.txt file).
+// DM22-0790
+
+//------------------------------------------------------------------------------
+
+// LAGraph_BreadthFirstSearch_Options is identical to LAGr_BreadthFirstSearch,
+// except that the push/pull thresholds alpha, beta1, and beta2 are given by
+// the options struct.  Any threshold that is <= 0 (or all of them, if options
+// is NULL) is taken from G->bfs_alpha, G->bfs_beta1, or G->bfs_beta2 instead,
+// or from the defaults (8, 8, and 512) if those are not known.
+
+// G is not modified.  The search is done on a shallow copy of the graph
+// struct, which shares all of the matrices and vectors of G but has its own
+// thresholds, so that other user threads can search G at the same time.
+
+// This is an Advanced algorithm, with the same requirements as
+// LAGr_BreadthFirstSearch: G->AT and G->out_degree are needed for push/pull
+// (which requires SuiteSparse:GraphBLAS), and are not computed if not present.
+// The thresholds have no effect on a push-only search.
+
+//------------------------------------------------------------------------------
+
+#include "LG_internal.h"
+#include "LAGraphX.h"
+
+int LAGraph_BreadthFirstSearch_Options
+(
+    // output:
+    GrB_Vector *level,
+    GrB_Vector *parent,
+    // input:
+    const LAGraph_Graph G,
+    GrB_Index src,
+    const LAGraph_BFS_Options *options,     // may be NULL
+    char *msg
+)
+{
+
+    //--------------------------------------------------------------------------
+    // check inputs
+    //--------------------------------------------------------------------------
+
+    LG_CLEAR_MSG ;
+    LG_ASSERT (G != NULL, GrB_NULL_POINTER) ;
+
+    //--------------------------------------------------------------------------
+    // search a shallow copy of G with the requested thresholds
+    //--------------------------------------------------------------------------
+
+    struct LAGraph_Graph_struct G2 = (*G) ;
+    if (options != NULL)
+    {
+        if (options->alpha > 0) G2.bfs_alpha = options->alpha ;
+        if (options->beta1 > 0) G2.bfs_beta1 = options->beta1 ;
+        if (options->beta2 > 0) G2.bfs_beta2 = options->beta2 ;
+    }
+
+    return (LAGr_BreadthFirstSearch (level, parent, &G2, src, msg)) ;
+}
@@ -0,0 +1,450 @@
+//------------------------------------------------------------------------------
+// LAGraph_MultiSourceBFS: breadth-first search from many sources at once
+//------------------------------------------------------------------------------
+
+// LAGraph, (c) 2019-2022 by The LAGraph Contributors, All Rights Reserved.
+// SPDX-License-Identifier: BSD-2-Clause
+//
+// For additional details (including references to third party source code and
+// other files) see the LICENSE file or contact permission@sei.cmu.edu. See
+// Contributors.txt for a full list of contributors. Created, in part, with
+// funding and support from the U.S. Government (see Acknowledgments.txt file).
+// DM22-0790
+
+//------------------------------------------------------------------------------
+
+// LAGraph_MultiSourceBFS computes a BFS from each of ns source nodes at the
+// same time.  The frontiers of all the searches are held as the rows of one
+// ns-by-n sparse matrix Q, which is advanced one level at a time with a single
+// matrix-matrix multiply, Q*A, as in LAGr_Betweenness.  On output, row s of
+// the level matrix is the level vector of the BFS from sources [s], and row s
+// of the parent matrix is its parent vector, as computed by
+// LAGr_BreadthFirstSearch.  Entries for nodes not reachable from sources [s]
+// are not present.  Either level or parent may be NULL, but not both.
+
+// Each search makes its own push/pull decision at each level, with the same
+// heuristic as LG_BreadthFirstSearch_SSGrB.  If all active searches agree,
+// the whole frontier is advanced with one push (saxpy) or pull (dot product)
+// multiply.  Otherwise, the frontier is split by rows: the rows that push are
+// advanced with Q*A, and the rows that pull are extracted and advanced with
+// a dot product with G->AT, and then the two are combined.
+
+// This is an Advanced algorithm.  G->AT (if G is directed) and G->out_degree
+// are required for push/pull optimization; otherwise, all searches are
+// push-only.  They are not computed if not present.  SuiteSparse:GraphBLAS is
+// required.
+
+//------------------------------------------------------------------------------
+
+#define LG_FREE_ALL ;
+
+#include "LG_internal.h"
+#include "LAGraphX.h"
+
+//------------------------------------------------------------------------------
+// row_counts: x(s) = sum of the entries in row s of Q*y, for each source s
+//------------------------------------------------------------------------------
+
+// x [0..ns-1] is cleared first, so sources with empty rows have x [s] = 0.
+
+static int row_counts
+(
+    int64_t *x,             // output array of size ns
+    GrB_Vector count,       // workspace vector of size ns
+    GrB_Matrix Q,           // ns-by-n frontier
+    GrB_Semiring semiring,  // LAGraph_plus_one_int64 or plus_second_int64
+    GrB_Vector y,           // vector of size n
+    GrB_Index *Ci,          // workspace of size ns
+    int64_t *Cx,            // workspace of size ns
+    int64_t ns,
+    char *msg
+)
+{
+    GRB_TRY (GrB_mxv (count, NULL, NULL, semiring, Q, y, NULL)) ;
+    GrB_Index nvals = ns ;
+    GRB_TRY (GrB_Vector_extractTuples_INT64 (Ci, Cx, &nvals, count)) ;
+    memset (x, 0, ns * sizeof (int64_t)) ;
+    for (GrB_Index k = 0 ; k < nvals ; k++)
+    {
+        x [Ci [k]] = Cx [k] ;
+    }
+    return (GrB_SUCCESS) ;
+}
+
+//------------------------------------------------------------------------------
+// LAGraph_MultiSourceBFS
+//------------------------------------------------------------------------------
+
+#undef  LG_FREE_WORK
+#define LG_FREE_WORK                                        \
+{                                                           \
+    GrB_free (&Q) ;                                         \
+    GrB_free (&T) ;                                         \
+    GrB_free (&Tpull) ;                                     \
+    GrB_free (&Qpull) ;                                     \
+    GrB_free (&Mpull) ;                                     \
+    GrB_free (&Empty) ;                                     \
+    GrB_free (&ones) ;                                      \
+    GrB_free (&count) ;                                     \
+    LAGraph_Free ((void **) &nq, NULL) ;                    \
+    LAGraph_Free ((void **) &last_nq, NULL) ;               \
+    LAGraph_Free ((void **) &edges_unexplored, NULL) ;      \
+    LAGraph_Free ((void **) &edges_in_frontier, NULL) ;     \
+    LAGraph_Free ((void **) &do_push, NULL) ;               \
+    LAGraph_Free ((void **) &any_pull, NULL) ;              \
+    LAGraph_Free ((void **) &push_pull, NULL) ;             \
+    LAGraph_Free ((void **) &pull_list, NULL) ;             \
+    LAGraph_Free ((void **) &Ci, NULL) ;                    \
+    LAGraph_Free ((void **) &Cx, NULL) ;                    \
+}
+
+#undef  LG_FREE_ALL
+#define LG_FREE_ALL                                         \
+{                                                           \
+    LG_FREE_WORK ;                                          \
+    GrB_free (&Pi) ;                                        \
+    GrB_free (&V) ;                                         \
+}
+
+int LAGraph_MultiSourceBFS
+(
+    // output:
+    GrB_Matrix *level,          // level(s,i): level of node i in BFS s
+    GrB_Matrix *parent,         // parent(s,i): parent of node i in BFS s
+    // input:
+    const LAGraph_Graph G,
+    const GrB_Index *sources,   // source node of each BFS
+    int64_t ns,                 // number of sources
+    char *msg
+)
+{
+
+    //--------------------------------------------------------------------------
+    // check inputs
+    //--------------------------------------------------------------------------
+
+    LG_CLEAR_MSG ;
+    GrB_Matrix Q = NULL ;       // the current frontiers, one per row
+    GrB_Matrix T = NULL ;       // the next frontiers, when split
+    GrB_Matrix Tpull = NULL ;   // next frontiers of the rows that pull
+    GrB_Matrix Qpull = NULL ;   // current frontiers of the rows that pull
+    GrB_Matrix Mpull = NULL ;   // visited nodes of the rows that pull
+    GrB_Matrix Empty = NULL ;   // an empty matrix, to delete rows of Q
+    GrB_Matrix Pi = NULL ;      // parent matrix
+    GrB_Matrix V = NULL ;       // level matrix
+    GrB_Vector ones = NULL ;    // ones (n)
+    GrB_Vector count = NULL ;   // workspace of size ns
+    int64_t *nq = NULL ;        // size of each frontier
+    int64_t *last_nq = NULL ;   // size of each frontier at the last level
+    int64_t *edges_unexplored = NULL ;
+    int64_t *edges_in_frontier = NULL ;
+    bool *do_push = NULL ;      // true if BFS s does a push step
+    bool *any_pull = NULL ;     // true if BFS s has done any pull step
+    bool *push_pull = NULL ;    // true if BFS s can still switch to pull
+    GrB_Index *pull_list = NULL ;
+    GrB_Index *Ci = NULL ;
+    int64_t *Cx = NULL ;
+
+#if !LAGRAPH_SUITESPARSE
+    LG_ASSERT (false, GrB_NOT_IMPLEMENTED) ;
+#else
+
+    bool compute_level  = (level != NULL) ;
+    bool compute_parent = (parent != NULL) ;
+    if (compute_level ) (*level ) = NULL ;
+    if (compute_parent) (*parent) = NULL ;
+    LG_ASSERT_MSG (compute_level || compute_parent, GrB_NULL_POINTER,
+        "either level or parent must be non-NULL") ;
+    LG_ASSERT (sources != NULL, GrB_NULL_POINTER) ;
+    LG_ASSERT_MSG (ns > 0, GrB_INVALID_VALUE, "ns must be > 0") ;
+    LG_TRY (LAGraph_CheckGraph (G, msg)) ;
+
+    //--------------------------------------------------------------------------
+    // get the problem size and cached properties
+    //--------------------------------------------------------------------------
+
+    GrB_Matrix A = G->A ;
+    GrB_Index n, nvals ;
+    GRB_TRY (GrB_Matrix_nrows (&n, A)) ;
+    GRB_TRY (GrB_Matrix_nvals (&nvals, A)) ;
+    for (int64_t s = 0 ; s < ns ; s++)
+    {
+        LG_ASSERT_MSG (sources [s] < n, GrB_INVALID_INDEX,
+            "invalid source node") ;
+    }
+
+    GrB_Matrix AT = NULL ;
+    GrB_Vector Degree = G->out_degree ;
+    if (G->kind == LAGraph_ADJACENCY_UNDIRECTED ||
+       (G->kind == LAGraph_ADJACENCY_DIRECTED &&
+        G->is_symmetric_structure == LAGraph_TRUE))
+    {
+        // AT and A have the same structure and can be used in both directions
+        AT = G->A ;
+    }
+    else
+    {
+        // AT = A' is different from A.  If G->AT is NULL, then a push-only
+        // method is used.
+        AT = G->AT ;
+    }
+    bool can_pull = (Degree != NULL && AT != NULL) ;
+
+    // determine the semiring type
+    GrB_Type int_type = (n > INT32_MAX) ? GrB_INT64 : GrB_INT32 ;
+    GrB_Semiring semiring ;
+
+    if (compute_parent)
+    {
+        // use the ANY_SECONDI_INT* semiring, so that Q(s,i) = parent of i
+        semiring = (n > INT32_MAX) ?
+            GxB_ANY_SECONDI_INT64 : GxB_ANY_SECONDI_INT32 ;
+        GRB_TRY (GrB_Matrix_new (&Pi, int_type, ns, n)) ;
+        GRB_TRY (GxB_set (Pi, GxB_SPARSITY_CONTROL, GxB_BITMAP + GxB_FULL)) ;
+        GRB_TRY (GrB_Matrix_new (&Q, int_type, ns, n)) ;
+    }
+    else
+    {
+        // only the level is needed, use the LAGraph_any_one_bool semiring
+        semiring = LAGraph_any_one_bool ;
+        GRB_TRY (GrB_Matrix_new (&Q, GrB_BOOL, ns, n)) ;
+    }
+
+    if (compute_level)
+    {
+        GRB_TRY (GrB_Matrix_new (&V, int_type, ns, n)) ;
+        GRB_TRY (GxB_set (V, GxB_SPARSITY_CONTROL, GxB_BITMAP + GxB_FULL)) ;
+    }
+
+    for (int64_t s = 0 ; s < ns ; s++)
+    {
+        // Q (s,src) = src (or true), Pi (s,src) = src, and V (s,src) = 0
+        GrB_Index src = sources [s] ;
+        if (compute_parent)
+        {
+            GRB_TRY (GrB_Matrix_setElement (Q, src, s, src)) ;
+            GRB_TRY (GrB_Matrix_setElement (Pi, src, s, src)) ;
+        }
+        else
+        {
+            GRB_TRY (GrB_Matrix_setElement (Q, true, s, src)) ;
+        }
+        if (compute_level)
+        {
+            GRB_TRY (GrB_Matrix_setElement (V, 0, s, src)) ;
+        }
+    }
+
+    // {!M} is the set of unvisited nodes of each BFS
+    GrB_Matrix M = (compute_parent) ? Pi : V ;
+
+    //--------------------------------------------------------------------------
+    // allocate workspace for the push/pull state of each BFS
+    //--------------------------------------------------------------------------
+
+    LG_TRY (LAGraph_Malloc ((void **) &nq, ns, sizeof (int64_t), msg)) ;
+    LG_TRY (LAGraph_Calloc ((void **) &last_nq, ns, sizeof (int64_t), msg)) ;
+    LG_TRY (LAGraph_Malloc ((void **) &edges_unexplored, ns, sizeof (int64_t),
+        msg)) ;
+    LG_TRY (LAGraph_Malloc ((void **) &edges_in_frontier, ns,
+        sizeof (int64_t), msg)) ;
+    LG_TRY (LAGraph_Malloc ((void **) &do_push, ns, sizeof (bool), msg)) ;
+    LG_TRY (LAGraph_Calloc ((void **) &any_pull, ns, sizeof (bool), msg)) ;
+    LG_TRY (LAGraph_Malloc ((void **) &push_pull, ns, sizeof (bool), msg)) ;
+    LG_TRY (LAGraph_Malloc ((void **) &pull_list, ns, sizeof (GrB_Index),
+        msg)) ;
+    LG_TRY (LAGraph_Malloc ((void **) &Ci, ns, sizeof (GrB_Index), msg)) ;
+    LG_TRY (LAGraph_Malloc ((void **) &Cx, ns, sizeof (int64_t), msg)) ;
+    for (int64_t s = 0 ; s < ns ; s++)
+    {
+        nq [s] = 1 ;
+        edges_unexplored [s] = nvals ;
+        do_push [s] = true ;
+        push_pull [s] = can_pull ;
+    }
+
+    GRB_TRY (GrB_Vector_new (&count, GrB_INT64, ns)) ;
+    GRB_TRY (GrB_Vector_new (&ones, GrB_BOOL, n)) ;
+    GRB_TRY (GrB_assign (ones, NULL, NULL, true, GrB_ALL, n, NULL)) ;
+
+    double alpha = 8.0 ;
+    double beta1 = 8.0 ;
+    double beta2 = 512.0 ;
+    int64_t n_over_beta1 = (int64_t) (((double) n) / beta1) ;
+    int64_t n_over_beta2 = (int64_t) (((double) n) / beta2) ;
+
+    //--------------------------------------------------------------------------
+    // BFS traversal and label the nodes
+    //--------------------------------------------------------------------------
+
+    for (int64_t k = 1 ; k <= (int64_t) n ; k++)
+    {
+
+        //----------------------------------------------------------------------
+        // select push vs pull for each BFS
+        //----------------------------------------------------------------------
+
+        bool need_edges = false ;
+        for (int64_t s = 0 ; s < ns ; s++)
+        {
+            need_edges = need_edges ||
+                (push_pull [s] && do_push [s] && !any_pull [s]) ;
+        }
+        if (need_edges)
+        {
+            // edges_in_frontier (s) = sum of the out-degrees of nodes in Q(s,:)
+            LG_TRY (row_counts (edges_in_frontier, count, Q,
+                LAGraph_plus_second_int64, Degree, Ci, Cx, ns, msg)) ;
+        }
+
+        int64_t npull = 0, npush = 0 ;
+        for (int64_t s = 0 ; s < ns ; s++)
+        {
+            if (nq [s] == 0)
+            {
+                // BFS s is done
+                continue ;
+            }
+            if (push_pull [s])
+            {
+                if (do_push [s])
+                {
+                    // check for switch from push to pull
+                    bool growing = nq [s] > last_nq [s] ;
+                    bool switch_to_pull = false ;
+                    if (edges_unexplored [s] < (int64_t) n)
+                    {
+                        // very little of the graph is left; disable the pull
+                        push_pull [s] = false ;
+                    }
+                    else if (any_pull [s])
+                    {
+                        switch_to_pull = (growing && nq [s] > n_over_beta1) ;
+                    }
+                    else
+                    {
+                        edges_unexplored [s] -= edges_in_frontier [s] ;
+                        switch_to_pull = growing && (edges_in_frontier [s] >
+                            (edges_unexplored [s] / alpha)) ;
+                    }
+                    if (switch_to_pull)
+                    {
+                        do_push [s] = false ;
+                    }
+                }
+                else
+                {
+                    // check for switch from pull to push
+                    bool shrinking = nq [s] < last_nq [s] ;
+                    if (shrinking && (nq [s] <= n_over_beta2))
+                    {
+                        do_push [s] = true ;
+                    }
+                }
+                any_pull [s] = any_pull [s] || (!do_push [s]) ;
+            }
+            if (do_push [s])
+            {
+                npush++ ;
+            }
+            else
+            {
+                pull_list [npull++] = s ;
+            }
+        }
+
+        //----------------------------------------------------------------------
+        // Q = kth level of each BFS
+        //----------------------------------------------------------------------
+
+        if (npull == 0)
+        {
+            // all searches push (saxpy-based mxm):  Q{!M} = Q*A
+            GRB_TRY (GxB_set (Q, GxB_SPARSITY_CONTROL, GxB_SPARSE)) ;
+            GRB_TRY (GrB_mxm (Q, M, NULL, semiring, Q, A, GrB_DESC_RSC)) ;
+        }
+        else if (npush == 0)
+        {
+            // all searches pull (dot-product-based mxm):  Q{!M} = Q*AT'
+            GRB_TRY (GxB_set (Q, GxB_SPARSITY_CONTROL, GxB_BITMAP)) ;
+            GRB_TRY (GrB_mxm (Q, M, NULL, semiring, Q, AT, GrB_DESC_RSCT1)) ;
+        }
+        else
+        {
+            // Qpull = Q (pull_list,:), and Mpull = M (pull_list,:)
+            GrB_Type qtype = (compute_parent) ? int_type : GrB_BOOL ;
+            GRB_TRY (GrB_Matrix_new (&Qpull, qtype, npull, n)) ;
+            GRB_TRY (GxB_set (Qpull, GxB_SPARSITY_CONTROL, GxB_BITMAP)) ;
+            GRB_TRY (GrB_extract (Qpull, NULL, NULL, Q, pull_list, npull,
+                GrB_ALL, n, NULL)) ;
+            GRB_TRY (GrB_Matrix_new (&Mpull, int_type, npull, n)) ;
+            GRB_TRY (GrB_extract (Mpull, NULL, NULL, M, pull_list, npull,
+                GrB_ALL, n, NULL)) ;
+
+            // pull:  Tpull{!Mpull} = Qpull*AT'
+            GRB_TRY (GrB_Matrix_new (&Tpull, qtype, npull, n)) ;
+            GRB_TRY (GrB_mxm (Tpull, Mpull, NULL, semiring, Qpull, AT,
+                GrB_DESC_RSCT1)) ;
+
+            // push:  T{!M} = Q*A, with the rows that pull deleted from Q
+            GRB_TRY (GrB_Matrix_new (&Empty, GrB_BOOL, npull, n)) ;
+            GRB_TRY (GrB_assign (Q, NULL, NULL, Empty, pull_list, npull,
+                GrB_ALL, n, NULL)) ;
+            GRB_TRY (GxB_set (Q, GxB_SPARSITY_CONTROL, GxB_SPARSE)) ;
+            GRB_TRY (GrB_Matrix_new (&T, qtype, ns, n)) ;
+            GRB_TRY (GrB_mxm (T, M, NULL, semiring, Q, A, GrB_DESC_RSC)) ;
+
+            // Q = T, with T (pull_list,:) = Tpull
+            GRB_TRY (GrB_assign (T, NULL, NULL, Tpull, pull_list, npull,
+                GrB_ALL, n, NULL)) ;
+            GrB_free (&Q) ;
+            Q = T ;
+            T = NULL ;
+            GrB_free (&Qpull) ;
+            GrB_free (&Mpull) ;
+            GrB_free (&Tpull) ;
+            GrB_free (&Empty) ;
+        }
+
+        //----------------------------------------------------------------------
+        // done if all frontiers are empty
+        //----------------------------------------------------------------------
+
+        GrB_Index nq_total ;
+        GRB_TRY (GrB_Matrix_nvals (&nq_total, Q)) ;
+        if (nq_total == 0)
+        {
+            break ;
+        }
+        memcpy (last_nq, nq, ns * sizeof (int64_t)) ;
+        LG_TRY (row_counts (nq, count, Q, LAGraph_plus_one_int64, ones,
+            Ci, Cx, ns, msg)) ;
+
+        //----------------------------------------------------------------------
+        // assign parents/levels
+        //----------------------------------------------------------------------
+
+        if (compute_parent)
+        {
+            // Pi{Q} = Q
+            GRB_TRY (GrB_assign (Pi, Q, NULL, Q, GrB_ALL, ns, GrB_ALL, n,
+                GrB_DESC_S)) ;
+        }
+        if (compute_level)
+        {
+            // V{Q} = k, the kth level of each BFS
+            GRB_TRY (GrB_assign (V, Q, NULL, k, GrB_ALL, ns, GrB_ALL, n,
+                GrB_DESC_S)) ;
+        }
+    }
+
+    //--------------------------------------------------------------------------
+    // free workspace and return result
+    //--------------------------------------------------------------------------
+
+    if (compute_parent) (*parent) = Pi ;
+    if (compute_level ) (*level ) = V ;
+    LG_FREE_WORK ;
+    return (GrB_SUCCESS) ;
+#endif
+}
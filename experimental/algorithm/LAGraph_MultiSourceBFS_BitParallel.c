@@ -0,0 +1,372 @@
+//------------------------------------------------------------------------------
+// LAGraph_MultiSourceBFS_BitParallel: bit-parallel BFS levels from many sources
+//------------------------------------------------------------------------------
+
+// LAGraph, (c) 2019-2022 by The LAGraph Contributors, All Rights Reserved.
+// SPDX-License-Identifier: BSD-2-Clause
+//
+// For additional details (including references to third party source code and
+// other files) see the LICENSE file or contact permission@sei.cmu.edu. See
+// Contributors.txt for a full list of contributors. Created, in part, with
+// funding and support from the U.S. Government (see Acknowledgments.txt file).
+// DM22-0790
+
+//------------------------------------------------------------------------------
+
+// LAGraph_MultiSourceBFS_BitParallel computes the BFS level of each node from
+// each of ns source nodes, with the same result as the level matrix of
+// LAGraph_MultiSourceBFS.  Row s of the ns-by-n level matrix is the level
+// vector of the BFS from sources [s]; entries for nodes not reachable from
+// sources [s] are not present.  Parents are not computed.
+
+// The searches are done in passes of up to 64*LG_MSBFS_WORDS sources each.
+// Within a pass, each node i owns nwords 64-bit words for each of its three
+// sets (seen, frontier, and next), with bit b of word w for the BFS from
+// sources [s0 + 64*w + b].  All the searches of a pass are advanced with a
+// single sweep of the graph, in which each edge moves up to 64 searches with
+// one bitwise OR.  The kernel works directly on the CSR form of structural
+// copies of G->A and G->AT; G itself is not modified.
+
+// Each level is done by push (scatter the frontier of node i to the
+// out-neighbors of i, with atomic OR) or pull (gather the frontier of the
+// in-neighbors of each node j not yet seen by all searches).  The pull is
+// selected when the frontier is dense, with the same heuristic as
+// LAGr_Betweenness.
+
+// This is an Advanced algorithm.  G->AT is required for the pull step if G is
+// directed and its structure is not known to be symmetric; if not present, a
+// push-only method is used.  G->AT is not computed if not present.
+// SuiteSparse:GraphBLAS is required.
+
+//------------------------------------------------------------------------------
+
+#define LG_FREE_WORK                                        \
+{                                                           \
+    GrB_free (&S) ;                                         \
+    LAGraph_Free ((void **) &Ap, NULL) ;                    \
+    LAGraph_Free ((void **) &Aj, NULL) ;                    \
+    LAGraph_Free ((void **) &Ax, NULL) ;                    \
+    LAGraph_Free ((void **) &ATp, NULL) ;                   \
+    LAGraph_Free ((void **) &ATj, NULL) ;                   \
+    LAGraph_Free ((void **) &ATx, NULL) ;                   \
+    LAGraph_Free ((void **) &seen, NULL) ;                  \
+    LAGraph_Free ((void **) &frontier, NULL) ;              \
+    LAGraph_Free ((void **) &next, NULL) ;                  \
+}
+
+#define LG_FREE_ALL                                         \
+{                                                           \
+    LG_FREE_WORK ;                                          \
+    LAGraph_Free ((void **) &Lb, NULL) ;                    \
+    LAGraph_Free ((void **) &Lx, NULL) ;                    \
+    GrB_free (&V) ;                                         \
+}
+
+#include "LG_internal.h"
+#include "LAGraphX.h"
+
+// maximum number of 64-bit words per node in each pass
+#define LG_MSBFS_WORDS 8
+
+int LAGraph_MultiSourceBFS_BitParallel
+(
+    // output:
+    GrB_Matrix *level,          // level(s,i): level of node i in BFS s
+    // input:
+    const LAGraph_Graph G,
+    const GrB_Index *sources,   // source node of each BFS
+    int64_t ns,                 // number of sources
+    char *msg
+)
+{
+
+    //--------------------------------------------------------------------------
+    // check inputs
+    //--------------------------------------------------------------------------
+
+    LG_CLEAR_MSG ;
+    GrB_Matrix S = NULL ;       // structural copy of A or AT, to unpack
+    GrB_Matrix V = NULL ;       // level matrix
+    GrB_Index *Ap = NULL, *Aj = NULL, *ATp = NULL, *ATj = NULL ;
+    void *Ax = NULL, *ATx = NULL ;
+    uint64_t *seen = NULL ;     // seen [i*nwords+w]: searches that reached i
+    uint64_t *frontier = NULL ; // frontier [i*nwords+w]: current level
+    uint64_t *next = NULL ;     // next [i*nwords+w]: next level
+    int8_t *Lb = NULL ;         // bitmap of the level matrix
+    void *Lx = NULL ;           // values of the level matrix
+
+#if !LAGRAPH_SUITESPARSE
+    LG_ASSERT (false, GrB_NOT_IMPLEMENTED) ;
+#else
+
+    LG_ASSERT (level != NULL, GrB_NULL_POINTER) ;
+    (*level) = NULL ;
+    LG_ASSERT (sources != NULL, GrB_NULL_POINTER) ;
+    LG_ASSERT_MSG (ns > 0, GrB_INVALID_VALUE, "ns must be > 0") ;
+    LG_TRY (LAGraph_CheckGraph (G, msg)) ;
+
+    GrB_Index n ;
+    GRB_TRY (GrB_Matrix_nrows (&n, G->A)) ;
+    for (int64_t s = 0 ; s < ns ; s++)
+    {
+        LG_ASSERT_MSG (sources [s] < n, GrB_INVALID_INDEX,
+            "invalid source node") ;
+    }
+
+    GrB_Matrix AT = NULL ;
+    if (G->kind == LAGraph_ADJACENCY_UNDIRECTED ||
+       (G->kind == LAGraph_ADJACENCY_DIRECTED &&
+        G->is_symmetric_structure == LAGraph_TRUE))
+    {
+        // AT and A have the same structure and can be used in both directions
+        AT = G->A ;
+    }
+    else
+    {
+        // AT = A' is different from A.  If G->AT is NULL, then a push-only
+        // method is used.
+        AT = G->AT ;
+    }
+
+    int nthreads, nthreads_outer, nthreads_inner ;
+    LG_TRY (LAGraph_GetNumThreads (&nthreads_outer, &nthreads_inner, msg)) ;
+    nthreads = nthreads_outer * nthreads_inner ;
+    nthreads = LAGRAPH_MAX (nthreads, 1) ;
+
+    //--------------------------------------------------------------------------
+    // unpack structural copies of A and AT in CSR format
+    //--------------------------------------------------------------------------
+
+    // G->A and G->AT are not unpacked, so that they remain valid for any other
+    // user thread that is reading them.  S is iso, so Ax and ATx have size 1.
+
+    GrB_Index Ap_size, Aj_size, Ax_size, ATp_size, ATj_size, ATx_size ;
+    bool iso, jumbled ;
+    LG_TRY (LAGraph_Matrix_Structure (&S, G->A, msg)) ;
+    GRB_TRY (GxB_Matrix_unpack_CSR (S, &Ap, &Aj, &Ax,
+        &Ap_size, &Aj_size, &Ax_size, &iso, &jumbled, NULL)) ;
+    GrB_free (&S) ;
+
+    const GrB_Index *Tp = Ap, *Tj = Aj ;
+    if (AT != NULL && AT != G->A)
+    {
+        LG_TRY (LAGraph_Matrix_Structure (&S, AT, msg)) ;
+        GRB_TRY (GxB_Matrix_unpack_CSR (S, &ATp, &ATj, &ATx,
+            &ATp_size, &ATj_size, &ATx_size, &iso, &jumbled, NULL)) ;
+        GrB_free (&S) ;
+        Tp = ATp ;
+        Tj = ATj ;
+    }
+    bool can_pull = (AT != NULL) ;
+
+    //--------------------------------------------------------------------------
+    // allocate the level matrix, held in bitmap-by-row form
+    //--------------------------------------------------------------------------
+
+    bool is_int64 = (n > INT32_MAX) ;
+    size_t xsize = is_int64 ? sizeof (int64_t) : sizeof (int32_t) ;
+    LG_TRY (LAGraph_Calloc ((void **) &Lb, ns * n, sizeof (int8_t), msg)) ;
+    LG_TRY (LAGraph_Malloc (&Lx, ns * n, xsize, msg)) ;
+    int32_t *Lx32 = (int32_t *) Lx ;
+    int64_t *Lx64 = (int64_t *) Lx ;
+
+    // workspace for a full pass
+    int64_t maxwords = LAGRAPH_MIN ((ns + 63) / 64, LG_MSBFS_WORDS) ;
+    LG_TRY (LAGraph_Malloc ((void **) &seen, n * maxwords, sizeof (uint64_t),
+        msg)) ;
+    LG_TRY (LAGraph_Malloc ((void **) &frontier, n * maxwords,
+        sizeof (uint64_t), msg)) ;
+    LG_TRY (LAGraph_Malloc ((void **) &next, n * maxwords, sizeof (uint64_t),
+        msg)) ;
+
+    int64_t nvals = 0 ;
+
+    //--------------------------------------------------------------------------
+    // do the searches, up to 64*LG_MSBFS_WORDS at a time
+    //--------------------------------------------------------------------------
+
+    for (int64_t s0 = 0 ; s0 < ns ; s0 += 64 * LG_MSBFS_WORDS)
+    {
+
+        //----------------------------------------------------------------------
+        // start the searches sources [s0 ... s0+nb-1]
+        //----------------------------------------------------------------------
+
+        int64_t nb = LAGRAPH_MIN (ns - s0, 64 * LG_MSBFS_WORDS) ;
+        int64_t nwords = (nb + 63) / 64 ;
+        memset (seen, 0, n * nwords * sizeof (uint64_t)) ;
+        memset (frontier, 0, n * nwords * sizeof (uint64_t)) ;
+
+        // lanes [w]: the bits of word w in use by this pass
+        uint64_t lanes [LG_MSBFS_WORDS] ;
+        for (int64_t w = 0 ; w < nwords ; w++)
+        {
+            int64_t nbits = LAGRAPH_MIN (nb - 64 * w, 64) ;
+            lanes [w] = (nbits == 64) ? (~((uint64_t) 0)) :
+                ((((uint64_t) 1) << nbits) - 1) ;
+        }
+
+        for (int64_t b = 0 ; b < nb ; b++)
+        {
+            int64_t s = s0 + b ;
+            GrB_Index src = sources [s] ;
+            uint64_t bit = ((uint64_t) 1) << (b % 64) ;
+            seen [src * nwords + b / 64] |= bit ;
+            frontier [src * nwords + b / 64] |= bit ;
+            Lb [s * n + src] = 1 ;
+            if (is_int64) Lx64 [s * n + src] = 0 ; else Lx32 [s * n + src] = 0 ;
+        }
+        nvals += nb ;
+        double frontier_density = ((double) nb) / ((double) (nb * n)) ;
+        bool last_was_pull = false ;
+
+        for (int64_t k = 1 ; k <= (int64_t) n ; k++)
+        {
+
+            //------------------------------------------------------------------
+            // next = all nodes one step from the frontier, not yet seen
+            //------------------------------------------------------------------
+
+            bool do_pull = can_pull &&
+                frontier_density > (last_was_pull ? 0.06 : 0.10) ;
+            int64_t i ;
+
+            if (do_pull)
+            {
+                // pull: next (j) = OR of frontier (i) for each in-neighbor i
+                // of node j, for each node j not yet seen by all searches
+                #pragma omp parallel for num_threads(nthreads) \
+                    schedule(dynamic,1024)
+                for (i = 0 ; i < (int64_t) n ; i++)
+                {
+                    uint64_t unseen [LG_MSBFS_WORDS], acc [LG_MSBFS_WORDS] ;
+                    uint64_t *restrict seen_i = seen + i * nwords ;
+                    uint64_t *restrict next_i = next + i * nwords ;
+                    bool any_unseen = false ;
+                    for (int64_t w = 0 ; w < nwords ; w++)
+                    {
+                        unseen [w] = lanes [w] & ~seen_i [w] ;
+                        acc [w] = 0 ;
+                        any_unseen = any_unseen || (unseen [w] != 0) ;
+                    }
+                    if (any_unseen)
+                    {
+                        for (GrB_Index p = Tp [i] ; p < Tp [i+1] ; p++)
+                        {
+                            // node i can be reached from node Tj [p]
+                            const uint64_t *restrict f = frontier
+                                + Tj [p] * nwords ;
+                            bool all_found = true ;
+                            for (int64_t w = 0 ; w < nwords ; w++)
+                            {
+                                acc [w] |= f [w] ;
+                                all_found = all_found &&
+                                    ((acc [w] & unseen [w]) == unseen [w]) ;
+                            }
+                            // early exit once all the searches find node i
+                            if (all_found) break ;
+                        }
+                    }
+                    for (int64_t w = 0 ; w < nwords ; w++)
+                    {
+                        next_i [w] = acc [w] & unseen [w] ;
+                    }
+                }
+            }
+            else
+            {
+                // push: scatter frontier (i) to all out-neighbors of node i
+                memset (next, 0, n * nwords * sizeof (uint64_t)) ;
+                #pragma omp parallel for num_threads(nthreads) \
+                    schedule(dynamic,1024)
+                for (i = 0 ; i < (int64_t) n ; i++)
+                {
+                    const uint64_t *restrict f = frontier + i * nwords ;
+                    bool any_frontier = false ;
+                    for (int64_t w = 0 ; w < nwords ; w++)
+                    {
+                        any_frontier = any_frontier || (f [w] != 0) ;
+                    }
+                    if (!any_frontier) continue ;
+                    for (GrB_Index p = Ap [i] ; p < Ap [i+1] ; p++)
+                    {
+                        GrB_Index j = Aj [p] ;
+                        for (int64_t w = 0 ; w < nwords ; w++)
+                        {
+                            uint64_t bits = f [w] & ~seen [j * nwords + w] ;
+                            if (bits != 0)
+                            {
+                                #pragma omp atomic update
+                                next [j * nwords + w] |= bits ;
+                            }
+                        }
+                    }
+                }
+            }
+
+            //------------------------------------------------------------------
+            // seen |= next, and level (s,i) = k for each new (s,i) in next
+            //------------------------------------------------------------------
+
+            int64_t nfound = 0 ;
+            #pragma omp parallel for num_threads(nthreads) \
+                schedule(static) reduction(+:nfound)
+            for (i = 0 ; i < (int64_t) n ; i++)
+            {
+                for (int64_t w = 0 ; w < nwords ; w++)
+                {
+                    uint64_t bits = next [i * nwords + w] ;
+                    if (bits == 0) continue ;
+                    seen [i * nwords + w] |= bits ;
+                    int64_t s = s0 + 64 * w ;
+                    for ( ; bits != 0 ; bits >>= 1, s++)
+                    {
+                        if (bits & 1)
+                        {
+                            Lb [s * n + i] = 1 ;
+                            if (is_int64)
+                            {
+                                Lx64 [s * n + i] = k ;
+                            }
+                            else
+                            {
+                                Lx32 [s * n + i] = (int32_t) k ;
+                            }
+                            nfound++ ;
+                        }
+                    }
+                }
+            }
+
+            //------------------------------------------------------------------
+            // advance to the next level, or stop if no node was found
+            //------------------------------------------------------------------
+
+            if (nfound == 0) break ;
+            nvals += nfound ;
+            uint64_t *t = frontier ;
+            frontier = next ;
+            next = t ;
+            last_was_pull = do_pull ;
+            frontier_density = ((double) nfound) / ((double) (nb * n)) ;
+        }
+    }
+
+    //--------------------------------------------------------------------------
+    // pack the level matrix
+    //--------------------------------------------------------------------------
+
+    GRB_TRY (GrB_Matrix_new (&V, is_int64 ? GrB_INT64 : GrB_INT32, ns, n)) ;
+    GRB_TRY (GxB_Matrix_pack_BitmapR (V, &Lb, &Lx, ns * n * sizeof (int8_t),
+        ns * n * xsize, false, nvals, NULL)) ;
+    GRB_TRY (GxB_set (V, GxB_SPARSITY_CONTROL, GxB_BITMAP + GxB_FULL)) ;
+
+    //--------------------------------------------------------------------------
+    // free workspace and return result
+    //--------------------------------------------------------------------------
+
+    (*level) = V ;
+    LG_FREE_WORK ;
+    return (GrB_SUCCESS) ;
+#endif
+}
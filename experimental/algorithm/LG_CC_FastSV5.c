@@ -35,9 +35,10 @@
 // The matrix A must have dimension 2^32 or less.
 // todo: Need a 64-bit version of this method.
 
-// todo: this function is not thread-safe, since it exports G->A and then
-// reimports it back.  G->A is unchanged when the function returns, but during
-// execution G->A is invalid.
+// G is not modified, so any number of user threads may call this function at
+// the same time on the same graph G, if G->A has no pending work (see
+// LAGraph_Freeze).  The sample phase exports a structural copy of G->A, not
+// G->A itself.
 
 // A note about "todo" and "fixme" in this file:  these do not need to be fixed
 // or changed for this method, since the revised version appears as
@@ -311,7 +312,11 @@ static inline int Reduce_assign32
     LAGraph_Free ((void **) &V32, NULL) ;       \
     LAGraph_Free ((void **) &ht_key, NULL) ;    \
     LAGraph_Free ((void **) &ht_val, NULL) ;    \
+    LAGraph_Free ((void **) &Sp, NULL) ;        \
+    LAGraph_Free ((void **) &Sj, NULL) ;        \
+    LAGraph_Free ((void **) &Sx, NULL) ;        \
     /* todo why is T not freed?? */             \
+    GrB_free (&S) ;                             \
     GrB_free (&f) ;                             \
     GrB_free (&gp) ;                            \
     GrB_free (&mngp) ;                          \
@@ -326,7 +331,7 @@ int LG_CC_FastSV5           // SuiteSparse:GraphBLAS method, with GxB extensions
     // output
     GrB_Vector *component,  // component(i)=s if node is in the component s
     // inputs
-    LAGraph_Graph G,        // input graph, G->A can change
+    const LAGraph_Graph G,  // input graph (not modified)
     char *msg
 )
 {
@@ -345,7 +350,9 @@ int LG_CC_FastSV5           // SuiteSparse:GraphBLAS method, with GxB extensions
     int32_t *ht_key = NULL, *ht_val = NULL ;
     GrB_Index n, nnz, *I = NULL ;
     GrB_Vector f = NULL, gp_new = NULL, mngp = NULL, mod = NULL, gp = NULL ;
-    GrB_Matrix T = NULL ;
+    GrB_Matrix T = NULL, S = NULL ;
+    GrB_Index *Sp = NULL, *Sj = NULL ;
+    void *Sx = NULL ;
 
     LG_TRY (LAGraph_CheckGraph (G, msg)) ;
     LG_ASSERT (component != NULL, GrB_NULL_POINTER) ;
@@ -355,9 +362,8 @@ int LG_CC_FastSV5           // SuiteSparse:GraphBLAS method, with GxB extensions
         G->is_symmetric_structure == LAGraph_TRUE)),
         -1001, "G->A must be known to be symmetric") ;
 
-    GrB_Matrix S = G->A ;
-    GRB_TRY (GrB_Matrix_nrows (&n, S)) ;
-    GRB_TRY (GrB_Matrix_nvals (&nnz, S)) ;
+    GRB_TRY (GrB_Matrix_nrows (&n, G->A)) ;
+    GRB_TRY (GrB_Matrix_nvals (&nnz, G->A)) ;
 
     LG_ASSERT_MSG (n <= UINT32_MAX, -1, "problem too large (fixme)") ;
 
@@ -421,28 +427,27 @@ int LG_CC_FastSV5           // SuiteSparse:GraphBLAS method, with GxB extensions
     {
 
         //----------------------------------------------------------------------
-        // export S = G->A in CSR format
+        // export S, the structure of G->A, in CSR format
         //----------------------------------------------------------------------
 
-        // S is not modified.  It is only exported so that its contents can be
-        // read by the parallel loops below.
+        // S is an iso boolean copy of the structure of G->A.  It is exported
+        // so that its contents can be read by the parallel loops below, while
+        // G->A itself is left untouched.
 
         GrB_Type type ;
         GrB_Index nrows, ncols, nvals ;
         size_t typesize ;
         int64_t nonempty ;
-        GrB_Index *Sp, *Sj ;
-        void *Sx ;
         bool S_jumbled = false ;
         GrB_Index Sp_size, Sj_size, Sx_size ;
         bool S_iso = false ;
 
+        LG_TRY (LAGraph_Matrix_Structure (&S, G->A, msg)) ;
         GRB_TRY (GrB_Matrix_nvals (&nvals, S)) ;
         GRB_TRY (GxB_Matrix_export_CSR (&S, &type, &nrows, &ncols, &Sp, &Sj,
             &Sx, &Sp_size, &Sj_size, &Sx_size,
             &S_iso, &S_jumbled, NULL)) ;
         GRB_TRY (GxB_Type_size (&typesize, type)) ;
-        G->A = NULL ;
 
         //----------------------------------------------------------------------
         // allocate space to construct T
@@ -713,25 +718,22 @@ int LG_CC_FastSV5           // SuiteSparse:GraphBLAS method, with GxB extensions
         LAGraph_Free ((void **) &count, NULL) ;
         LAGraph_Free ((void **) &range, NULL) ;
 
-        // import S (unchanged since last export)
-        GRB_TRY (GxB_Matrix_import_CSR (&S, type, nrows, ncols,
-                &Sp, &Sj, &Sx, Sp_size, Sj_size, Sx_size,
-                S_iso, S_jumbled, NULL)) ;
+        // free the structural copy of G->A
+        LAGraph_Free ((void **) &Sp, NULL) ;
+        LAGraph_Free ((void **) &Sj, NULL) ;
+        LAGraph_Free ((void **) &Sx, NULL) ;
 
         // import T for the final phase
         GRB_TRY (GxB_Matrix_import_CSR (&T, type, nrows, ncols,
                 &Tp, &Tj, &Tx, Tp_siz, Tj_siz, Tx_siz,
                 T_iso, /* T is jumbled: */ true, NULL)) ;
 
-        // restore G->A
-        G->A = S ;
-
     }
     else
     {
 
         // no sampling; the final phase operates on the whole graph
-        T = S ;
+        T = G->A ;
 
     }
 
@@ -0,0 +1,179 @@
+//------------------------------------------------------------------------------
+// LAGraph/experimental/benchmark/pool_demo.c: benchmark LAGraph_Pool_*
+//------------------------------------------------------------------------------
+
+// LAGraph, (c) 2019-2022 by The LAGraph Contributors, All Rights Reserved.
+// SPDX-License-Identifier: BSD-2-Clause
+//
+// For additional details (including references to third party source code and
+// other files) see the LICENSE file or contact permission@sei.cmu.edu. See
+// Contributors.txt for a full list of contributors. Created, in part, with
+// funding and support from the U.S. Government (see Acknowledgments.txt file).
+// DM22-0790
+
+//------------------------------------------------------------------------------
+
+// This demo measures the effect of the LAGraph_Pool_* memory pool, and of an
+// LAGraph_Arena, on a workload of many small queries on a small graph, where
+// the time spent in malloc and free is a large part of the total.  LAGr_Init
+// can only be called once, so the demo must be run twice, once with the
+// system malloc/free and once with the pool:
+//
+//      ./experimental/benchmark/pool_demo 0 < ../data/karate.mtx
+//      ./experimental/benchmark/pool_demo 1 < ../data/karate.mtx
+//
+// The first argument selects the memory manager (0: malloc/calloc/realloc/
+// free, 1: LAGraph_Pool_*), and the optional second argument is the number
+// of queries (default 10000).  The demo reports the queries per second for
+// LAGr_BreadthFirstSearch and LAGr_Betweenness (4 sources), each query on a
+// different source node.  It then times an algorithm-like loop that allocates
+// and frees the same workspace on each iteration, with LAGraph_Malloc/Free and
+// then with an LAGraph_Arena.
+
+#include "LAGraphX.h"
+
+#define LAGRAPH_CATCH(info)                     \
+{                                               \
+    GrB_free (&level) ;                         \
+    GrB_free (&parent) ;                        \
+    GrB_free (&centrality) ;                    \
+    GrB_free (&A) ;                             \
+    LAGraph_Delete (&G, msg) ;                  \
+    LAGraph_Arena_Delete (&arena, msg) ;        \
+    return (info) ;                             \
+}
+
+#define GRB_CATCH(info) LAGRAPH_CATCH(info)
+
+int main (int argc, char **argv)
+{
+
+    //--------------------------------------------------------------------------
+    // startup LAGraph and GraphBLAS
+    //--------------------------------------------------------------------------
+
+    char msg [LAGRAPH_MSG_LEN] ;
+    LAGraph_Graph G = NULL ;
+    GrB_Matrix A = NULL ;
+    GrB_Vector level = NULL, parent = NULL, centrality = NULL ;
+    LAGraph_Arena arena = NULL ;
+
+    bool use_pool = (argc > 1) ? (atoi (argv [1]) != 0) : true ;
+    int nq = (argc > 2) ? atoi (argv [2]) : 10000 ;
+    nq = LAGRAPH_MAX (nq, 1) ;
+
+    if (use_pool)
+    {
+        LAGRAPH_TRY (LAGr_Init (GrB_NONBLOCKING, LAGraph_Pool_malloc,
+            LAGraph_Pool_calloc, LAGraph_Pool_realloc, LAGraph_Pool_free,
+            msg)) ;
+    }
+    else
+    {
+        LAGRAPH_TRY (LAGr_Init (GrB_NONBLOCKING, malloc, calloc, realloc,
+            free, msg)) ;
+    }
+    printf ("memory manager: %s, queries: %d\n",
+        use_pool ? "LAGraph_Pool" : "malloc", nq) ;
+
+    //--------------------------------------------------------------------------
+    // read in the graph via a Matrix Market file from stdin
+    //--------------------------------------------------------------------------
+
+    LAGRAPH_TRY (LAGraph_MMRead (&A, stdin, msg)) ;
+    LAGRAPH_TRY (LAGraph_New (&G, &A, LAGraph_ADJACENCY_DIRECTED, msg)) ;
+    LAGRAPH_TRY (LAGraph_Cached_AT (G, msg)) ;
+    LAGRAPH_TRY (LAGraph_Cached_OutDegree (G, msg)) ;
+    LAGRAPH_TRY (LAGraph_Cached_InDegree (G, msg)) ;
+    GrB_Index n ;
+    GRB_TRY (GrB_Matrix_nrows (&n, G->A)) ;
+    printf ("n: %g\n", (double) n) ;
+
+    //--------------------------------------------------------------------------
+    // many BFS queries
+    //--------------------------------------------------------------------------
+
+    double t = LAGraph_WallClockTime ( ) ;
+    for (int q = 0 ; q < nq ; q++)
+    {
+        GrB_Index src = ((GrB_Index) q) % n ;
+        LAGRAPH_TRY (LAGr_BreadthFirstSearch (&level, &parent, G, src, msg)) ;
+        GrB_free (&level) ;
+        GrB_free (&parent) ;
+    }
+    t = LAGraph_WallClockTime ( ) - t ;
+    printf ("BFS:         %12.1f queries/sec (%g sec)\n", nq / t, t) ;
+
+    //--------------------------------------------------------------------------
+    // many betweenness-centrality queries, 4 sources each
+    //--------------------------------------------------------------------------
+
+    int nbc = LAGRAPH_MAX (nq / 10, 1) ;
+    t = LAGraph_WallClockTime ( ) ;
+    for (int q = 0 ; q < nbc ; q++)
+    {
+        GrB_Index sources [4] ;
+        for (int k = 0 ; k < 4 ; k++)
+        {
+            sources [k] = ((GrB_Index) (4*q + k)) % n ;
+        }
+        LAGRAPH_TRY (LAGr_Betweenness (&centrality, G, sources, 4, msg)) ;
+        GrB_free (&centrality) ;
+    }
+    t = LAGraph_WallClockTime ( ) - t ;
+    printf ("Betweenness: %12.1f queries/sec (%g sec)\n", nbc / t, t) ;
+
+    //--------------------------------------------------------------------------
+    // per-iteration workspace: LAGraph_Malloc/Free vs an LAGraph_Arena
+    //--------------------------------------------------------------------------
+
+    // each iteration allocates 8 blocks of workspace of size n, as an
+    // algorithm would on each step, and frees them at the end of the step
+    int64_t *W [8] ;
+    t = LAGraph_WallClockTime ( ) ;
+    for (int q = 0 ; q < nq ; q++)
+    {
+        for (int k = 0 ; k < 8 ; k++)
+        {
+            LAGRAPH_TRY (LAGraph_Malloc ((void **) &(W [k]), n,
+                sizeof (int64_t), msg)) ;
+            W [k][q % n] = q ;
+        }
+        for (int k = 0 ; k < 8 ; k++)
+        {
+            LAGRAPH_TRY (LAGraph_Free ((void **) &(W [k]), msg)) ;
+        }
+    }
+    t = LAGraph_WallClockTime ( ) - t ;
+    printf ("LAGraph_Malloc workspace: %12.1f iterations/sec (%g sec)\n",
+        nq / t, t) ;
+
+    LAGRAPH_TRY (LAGraph_Arena_New (&arena, 0, msg)) ;
+    t = LAGraph_WallClockTime ( ) ;
+    for (int q = 0 ; q < nq ; q++)
+    {
+        for (int k = 0 ; k < 8 ; k++)
+        {
+            LAGRAPH_TRY (LAGraph_Arena_Malloc ((void **) &(W [k]), arena, n,
+                sizeof (int64_t), msg)) ;
+            W [k][q % n] = q ;
+        }
+        LAGRAPH_TRY (LAGraph_Arena_Reset (arena, msg)) ;
+    }
+    t = LAGraph_WallClockTime ( ) - t ;
+    printf ("LAGraph_Arena workspace:  %12.1f iterations/sec (%g sec)\n",
+        nq / t, t) ;
+
+    //--------------------------------------------------------------------------
+    // free everything and finish
+    //--------------------------------------------------------------------------
+
+    LAGRAPH_TRY (LAGraph_Arena_Delete (&arena, msg)) ;
+    LAGRAPH_TRY (LAGraph_Delete (&G, msg)) ;
+    LAGRAPH_TRY (LAGraph_Finalize (msg)) ;
+    if (use_pool)
+    {
+        LAGRAPH_TRY (LAGraph_Pool_Release (msg)) ;
+    }
+    return (GrB_SUCCESS) ;
+}
@@ -0,0 +1,180 @@
+//----------------------------------------------------------------------------
+// LAGraph/experimental/test/test_BFS_Options.c: test
+// LAGraph_BreadthFirstSearch_Options and LAGraph_Cached_BFSThresholds
+// ----------------------------------------------------------------------------
+
+// LAGraph, (c) 2019-2022 by The LAGraph Contributors, All Rights Reserved.
+// SPDX-License-Identifier: BSD-2-Clause
+//
+// For additional details (including references to third party source code and
+// other files) see the LICENSE file or contact permission@sei.cmu.edu. See
+// Contributors.txt for a full list of contributors. Created, in part, with
+// funding and support from the U.S. Government (see Acknowledgments.txt file).
+// DM22-0790
+
+//-----------------------------------------------------------------------------
+
+#include <stdio.h>
+#include <acutest.h>
+#include <LAGraphX.h>
+#include <LAGraph_test.h>
+
+char msg [LAGRAPH_MSG_LEN] ;
+LAGraph_Graph G = NULL ;
+GrB_Matrix A = NULL ;
+GrB_Vector level = NULL, parent = NULL, level0 = NULL ;
+
+#define LEN 512
+char filename [LEN+1] ;
+
+typedef struct
+{
+    LAGraph_Kind kind ;
+    const char *name ;
+}
+matrix_info ;
+
+const matrix_info files [ ] =
+{
+    { LAGraph_ADJACENCY_UNDIRECTED, "A.mtx" },
+    { LAGraph_ADJACENCY_DIRECTED,   "cover.mtx" },
+    { LAGraph_ADJACENCY_UNDIRECTED, "jagmesh7.mtx" },
+    { LAGraph_ADJACENCY_DIRECTED,   "ldbc-directed-example.mtx" },
+    { LAGraph_ADJACENCY_DIRECTED,   "olm1000.mtx" },
+    { LAGraph_ADJACENCY_UNDIRECTED, "bcsstk13.mtx" },
+    { LAGraph_ADJACENCY_DIRECTED,   "cryg2500.mtx" },
+    { LAGraph_ADJACENCY_UNDIRECTED, "karate.mtx" },
+    { LAGraph_ADJACENCY_UNDIRECTED, "pushpull.mtx" },
+    { LAGRAPH_UNKNOWN, "" },
+} ;
+
+// thresholds to try: defaults, never pull, pull at once, and GAP
+#define NOPTIONS 5
+const LAGraph_BFS_Options options [NOPTIONS] =
+{
+    { 0, 0, 0 },
+    { 1e-9, 1e-9, 1e9 },
+    { 1e9, 1e9, 1e9 },
+    { 1e9, 1e9, 1 },
+    { 15, 8, 18 },
+} ;
+
+//------------------------------------------------------------------------------
+// test_BFS_Options: compare with LAGr_BreadthFirstSearch
+//------------------------------------------------------------------------------
+
+void test_BFS_Options (void)
+{
+    LAGraph_Init (msg) ;
+
+    for (int k = 0 ; ; k++)
+    {
+        const char *aname = files [k].name ;
+        if (strlen (aname) == 0) break ;
+        LAGraph_Kind kind = files [k].kind ;
+        TEST_CASE (aname) ;
+        printf ("\nMatrix: %s\n", aname) ;
+        snprintf (filename, LEN, LG_DATA_DIR "%s", aname) ;
+        FILE *f = fopen (filename, "r") ;
+        TEST_CHECK (f != NULL) ;
+        OK (LAGraph_MMRead (&A, f, msg)) ;
+        OK (fclose (f)) ;
+        OK (LAGraph_New (&G, &A, kind, msg)) ;
+        OK (LAGraph_Cached_Ensure (G, LAGRAPH_CACHE_AT |
+            LAGRAPH_CACHE_OUT_DEGREE, msg)) ;
+        GrB_Index n ;
+        OK (GrB_Matrix_nrows (&n, G->A)) ;
+
+        for (int tuned = 0 ; tuned < 2 ; tuned++)
+        {
+            if (tuned == 1)
+            {
+                // tune the thresholds for G, and check them
+                OK (LAGraph_Cached_BFSThresholds (G, 2, msg)) ;
+                printf ("alpha %g beta1 %g beta2 %g\n", G->bfs_alpha,
+                    G->bfs_beta1, G->bfs_beta2) ;
+                TEST_CHECK (G->bfs_alpha > 0) ;
+                TEST_CHECK (G->bfs_beta1 > 0) ;
+                TEST_CHECK (G->bfs_beta2 > 0) ;
+            }
+
+            for (GrB_Index src = 0 ; src < n ; src += (n/4 + 1))
+            {
+                OK (LAGr_BreadthFirstSearch (&level0, NULL, G, src, msg)) ;
+                for (int j = 0 ; j < NOPTIONS ; j++)
+                {
+                    // the level and parent must be valid, and the levels
+                    // must not depend on the thresholds
+                    OK (LAGraph_BreadthFirstSearch_Options (&level, &parent,
+                        G, src, &options [j], msg)) ;
+                    OK (LG_check_bfs (level, parent, G, src, msg)) ;
+                    bool ok ;
+                    OK (LAGraph_Vector_IsEqual (&ok, level, level0, msg)) ;
+                    TEST_CHECK (ok) ;
+                    OK (GrB_free (&level)) ;
+                    OK (GrB_free (&parent)) ;
+                }
+                OK (LAGraph_BreadthFirstSearch_Options (NULL, &parent, G, src,
+                    NULL, msg)) ;
+                OK (LG_check_bfs (NULL, parent, G, src, msg)) ;
+                OK (GrB_free (&parent)) ;
+                OK (GrB_free (&level0)) ;
+            }
+        }
+
+        // the thresholds are cleared with the other cached properties
+        OK (LAGraph_DeleteCached (G, msg)) ;
+        TEST_CHECK (G->bfs_alpha == LAGRAPH_UNKNOWN) ;
+        TEST_CHECK (G->bfs_beta1 == LAGRAPH_UNKNOWN) ;
+        TEST_CHECK (G->bfs_beta2 == LAGRAPH_UNKNOWN) ;
+
+        // tuning without timing computes G->out_degree if needed
+        OK (LAGraph_Cached_BFSThresholds (G, 0, msg)) ;
+        TEST_CHECK (G->out_degree != NULL) ;
+        TEST_CHECK (G->bfs_alpha > 0) ;
+
+        OK (LAGraph_Delete (&G, msg)) ;
+    }
+
+    LAGraph_Finalize (msg) ;
+}
+
+//------------------------------------------------------------------------------
+// test_BFS_Options_errors
+//------------------------------------------------------------------------------
+
+void test_BFS_Options_errors (void)
+{
+    LAGraph_Init (msg) ;
+    snprintf (filename, LEN, LG_DATA_DIR "%s", "karate.mtx") ;
+    FILE *f = fopen (filename, "r") ;
+    TEST_CHECK (f != NULL) ;
+    OK (LAGraph_MMRead (&A, f, msg)) ;
+    OK (fclose (f)) ;
+    OK (LAGraph_New (&G, &A, LAGraph_ADJACENCY_UNDIRECTED, msg)) ;
+
+    int result = LAGraph_Cached_BFSThresholds (G, -1, msg) ;
+    TEST_CHECK (result == GrB_INVALID_VALUE) ;
+    result = LAGraph_Cached_BFSThresholds (NULL, 0, msg) ;
+    TEST_CHECK (result == GrB_NULL_POINTER) ;
+    result = LAGraph_BreadthFirstSearch_Options (&level, NULL, NULL, 0,
+        NULL, msg) ;
+    TEST_CHECK (result == GrB_NULL_POINTER) ;
+    result = LAGraph_BreadthFirstSearch_Options (NULL, NULL, G, 0,
+        NULL, msg) ;
+    TEST_CHECK (result == GrB_NULL_POINTER) ;
+    result = LAGraph_BreadthFirstSearch_Options (&level, NULL, G, 34,
+        &options [0], msg) ;
+    TEST_CHECK (result == GrB_INVALID_INDEX) ;
+
+    OK (LAGraph_Delete (&G, msg)) ;
+    LAGraph_Finalize (msg) ;
+}
+
+//****************************************************************************
+
+TEST_LIST = {
+    {"BFS_Options", test_BFS_Options},
+    {"BFS_Options_errors", test_BFS_Options_errors},
+    {NULL, NULL}
+};
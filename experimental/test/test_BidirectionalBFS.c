@@ -0,0 +1,184 @@
+//----------------------------------------------------------------------------
+// LAGraph/experimental/test/test_BidirectionalBFS.c: test
+// LAGraph_BidirectionalBFS
+// ----------------------------------------------------------------------------
+
+// LAGraph, (c) 2019-2022 by The LAGraph Contributors, All Rights Reserved.
+// SPDX-License-Identifier: BSD-2-Clause
+//
+// For additional details (including references to third party source code and
+// other files) see the LICENSE file or contact permission@sei.cmu.edu. See
+// Contributors.txt for a full list of contributors. Created, in part, with
+// funding and support from the U.S. Government (see Acknowledgments.txt file).
+// DM22-0790
+
+//-----------------------------------------------------------------------------
+
+#include <stdio.h>
+#include <acutest.h>
+#include <LAGraphX.h>
+#include <LAGraph_test.h>
+
+char msg [LAGRAPH_MSG_LEN] ;
+LAGraph_Graph G = NULL ;
+GrB_Matrix A = NULL ;
+GrB_Vector level = NULL, path = NULL ;
+
+#define LEN 512
+char filename [LEN+1] ;
+
+typedef struct
+{
+    LAGraph_Kind kind ;
+    const char *name ;
+}
+matrix_info ;
+
+const matrix_info files [ ] =
+{
+    { LAGraph_ADJACENCY_UNDIRECTED, "A.mtx" },
+    { LAGraph_ADJACENCY_DIRECTED,   "cover.mtx" },
+    { LAGraph_ADJACENCY_UNDIRECTED, "jagmesh7.mtx" },
+    { LAGraph_ADJACENCY_DIRECTED,   "ldbc-directed-example.mtx" },
+    { LAGraph_ADJACENCY_DIRECTED,   "msf1.mtx" },
+    { LAGraph_ADJACENCY_DIRECTED,   "olm1000.mtx" },
+    { LAGraph_ADJACENCY_UNDIRECTED, "bcsstk13.mtx" },
+    { LAGraph_ADJACENCY_DIRECTED,   "cryg2500.mtx" },
+    { LAGraph_ADJACENCY_DIRECTED,   "west0067.mtx" },
+    { LAGraph_ADJACENCY_UNDIRECTED, "karate.mtx" },
+    { LAGRAPH_UNKNOWN, "" },
+} ;
+
+//------------------------------------------------------------------------------
+// check_path: check the result against the levels of a BFS from src
+//------------------------------------------------------------------------------
+
+static void check_path (GrB_Index src, GrB_Index dest, int64_t hops)
+{
+    // the # of hops must be the level of dest in a BFS from src
+    int64_t level_dest = -1 ;
+    OK (LAGr_BreadthFirstSearch (&level, NULL, G, src, msg)) ;
+    int info = GrB_Vector_extractElement (&level_dest, level, dest) ;
+    TEST_CHECK (info == GrB_SUCCESS || info == GrB_NO_VALUE) ;
+    OK (GrB_free (&level)) ;
+    TEST_CHECK (hops == level_dest) ;
+
+    if (hops < 0)
+    {
+        TEST_CHECK (path == NULL) ;
+        return ;
+    }
+
+    // the path must go from src to dest along the edges of A
+    GrB_Index len, nvals ;
+    OK (GrB_Vector_size (&len, path)) ;
+    OK (GrB_Vector_nvals (&nvals, path)) ;
+    TEST_CHECK (len == (GrB_Index) (hops + 1)) ;
+    TEST_CHECK (nvals == len) ;
+    int64_t i, j ;
+    OK (GrB_Vector_extractElement (&i, path, 0)) ;
+    TEST_CHECK (i == (int64_t) src) ;
+    for (int64_t k = 1 ; k <= hops ; k++)
+    {
+        OK (GrB_Vector_extractElement (&j, path, k)) ;
+        double x ;
+        OK (GrB_Matrix_extractElement (&x, G->A, i, j)) ;
+        i = j ;
+    }
+    TEST_CHECK (i == (int64_t) dest) ;
+}
+
+//------------------------------------------------------------------------------
+// test_BidirectionalBFS: compare with LAGr_BreadthFirstSearch
+//------------------------------------------------------------------------------
+
+void test_BidirectionalBFS (void)
+{
+    LAGraph_Init (msg) ;
+
+    for (int k = 0 ; ; k++)
+    {
+        const char *aname = files [k].name ;
+        if (strlen (aname) == 0) break ;
+        LAGraph_Kind kind = files [k].kind ;
+        TEST_CASE (aname) ;
+        printf ("\nMatrix: %s\n", aname) ;
+        snprintf (filename, LEN, LG_DATA_DIR "%s", aname) ;
+        FILE *f = fopen (filename, "r") ;
+        TEST_CHECK (f != NULL) ;
+        OK (LAGraph_MMRead (&A, f, msg)) ;
+        OK (fclose (f)) ;
+        OK (LAGraph_New (&G, &A, kind, msg)) ;
+        GrB_Index n ;
+        OK (GrB_Matrix_nrows (&n, G->A)) ;
+
+        for (int how = 0 ; how < 2 ; how++)
+        {
+            if (how == 1)
+            {
+                // with G->AT for the backward search
+                int result = LAGraph_Cached_AT (G, msg) ;
+                TEST_CHECK (result >= 0) ;
+            }
+
+            for (GrB_Index src = 0 ; src < n ; src += (n/5 + 1))
+            {
+                for (GrB_Index dest = 0 ; dest < n ; dest += (n/7 + 1))
+                {
+                    int64_t hops ;
+                    OK (LAGraph_BidirectionalBFS (&hops, &path, G, src, dest,
+                        msg)) ;
+                    check_path (src, dest, hops) ;
+                    OK (GrB_free (&path)) ;
+
+                    // hops only
+                    int64_t hops2 ;
+                    OK (LAGraph_BidirectionalBFS (&hops2, NULL, G, src, dest,
+                        msg)) ;
+                    TEST_CHECK (hops == hops2) ;
+                }
+            }
+        }
+
+        OK (LAGraph_Delete (&G, msg)) ;
+    }
+
+    LAGraph_Finalize (msg) ;
+}
+
+//------------------------------------------------------------------------------
+// test_BidirectionalBFS_errors
+//------------------------------------------------------------------------------
+
+void test_BidirectionalBFS_errors (void)
+{
+    LAGraph_Init (msg) ;
+    snprintf (filename, LEN, LG_DATA_DIR "%s", "karate.mtx") ;
+    FILE *f = fopen (filename, "r") ;
+    TEST_CHECK (f != NULL) ;
+    OK (LAGraph_MMRead (&A, f, msg)) ;
+    OK (fclose (f)) ;
+    OK (LAGraph_New (&G, &A, LAGraph_ADJACENCY_UNDIRECTED, msg)) ;
+
+    int64_t hops ;
+    int result = LAGraph_BidirectionalBFS (NULL, &path, G, 0, 1, msg) ;
+    TEST_CHECK (result == GrB_NULL_POINTER) ;
+    TEST_CHECK (path == NULL) ;
+    result = LAGraph_BidirectionalBFS (&hops, &path, G, 34, 1, msg) ;
+    TEST_CHECK (result == GrB_INVALID_INDEX) ;
+    result = LAGraph_BidirectionalBFS (&hops, &path, G, 0, 34, msg) ;
+    TEST_CHECK (result == GrB_INVALID_INDEX) ;
+    TEST_CHECK (hops == -1) ;
+    TEST_CHECK (path == NULL) ;
+
+    OK (LAGraph_Delete (&G, msg)) ;
+    LAGraph_Finalize (msg) ;
+}
+
+//****************************************************************************
+
+TEST_LIST = {
+    {"BidirectionalBFS", test_BidirectionalBFS},
+    {"BidirectionalBFS_errors", test_BidirectionalBFS_errors},
+    {NULL, NULL}
+};
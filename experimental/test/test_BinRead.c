@@ -0,0 +1,236 @@
+//----------------------------------------------------------------------------
+// LAGraph/experimental/test/test_BinRead.c: test cases for LAGraph_BinRead
+// ----------------------------------------------------------------------------
+
+// LAGraph, (c) 2019-2022 by The LAGraph Contributors, All Rights Reserved.
+// SPDX-License-Identifier: BSD-2-Clause
+//
+// For additional details (including references to third party source code and
+// other files) see the LICENSE file or contact permission@sei.cmu.edu. See
+// Contributors.txt for a full list of contributors. Created, in part, with
+// funding and support from the U.S. Government (see Acknowledgments.txt file).
+// DM22-0790
+
+//-----------------------------------------------------------------------------
+
+#include <stdio.h>
+#include <acutest.h>
+#include <LAGraphX.h>
+#include <LAGraph_test.h>
+
+char msg [LAGRAPH_MSG_LEN] ;
+GrB_Matrix A = NULL, B = NULL, C = NULL ;
+
+#define LEN 512
+char filename [LEN+1] ;
+
+const char *files [ ] =
+{
+    "A.mtx",
+    "cover.mtx",
+    "jagmesh7.mtx",
+    "west0067.mtx",
+    "karate.mtx",
+    "matrix_bool.mtx",
+    "matrix_int8.mtx",
+    "matrix_uint16.mtx",
+    "matrix_int32.mtx",
+    "matrix_uint64.mtx",
+    "matrix_fp32.mtx",
+    "matrix_fp64.mtx",
+    "structure.mtx",
+    "empty.mtx",
+    "",
+} ;
+
+#if LAGRAPH_SUITESPARSE
+
+//------------------------------------------------------------------------------
+// write_grb: write a sparse matrix to a *.grb file
+//------------------------------------------------------------------------------
+
+// This writes the same file format as binwrite in src/benchmark/LAGraph_demo.h,
+// for a matrix held in sparse CSR or CSC format.
+
+static void write_grb (GrB_Matrix A, bool by_row, const char *name)
+{
+    GrB_Type type ;
+    GrB_Index nrows, ncols, nvals, *Ap = NULL, *Ai = NULL ;
+    GrB_Index Ap_size, Ai_size, Ax_size ;
+    void *Ax = NULL ;
+    bool iso ;
+    size_t typesize ;
+    OK (GxB_Matrix_type (&type, A)) ;
+    OK (GxB_Type_size (&typesize, type)) ;
+    OK (GrB_Matrix_nrows (&nrows, A)) ;
+    OK (GrB_Matrix_ncols (&ncols, A)) ;
+    OK (GrB_Matrix_nvals (&nvals, A)) ;
+    OK (GrB_Matrix_dup (&C, A)) ;
+    OK (GxB_set (C, GxB_SPARSITY_CONTROL, GxB_SPARSE)) ;
+    OK (GxB_set (C, GxB_FORMAT, by_row ? GxB_BY_ROW : GxB_BY_COL)) ;
+    if (by_row)
+    {
+        OK (GxB_Matrix_unpack_CSR (C, &Ap, &Ai, &Ax, &Ap_size, &Ai_size,
+            &Ax_size, &iso, NULL, NULL)) ;
+    }
+    else
+    {
+        OK (GxB_Matrix_unpack_CSC (C, &Ap, &Ai, &Ax, &Ap_size, &Ai_size,
+            &Ax_size, &iso, NULL, NULL)) ;
+    }
+
+    GrB_Type types [11] = { GrB_BOOL, GrB_INT8, GrB_INT16, GrB_INT32,
+        GrB_INT64, GrB_UINT8, GrB_UINT16, GrB_UINT32, GrB_UINT64, GrB_FP32,
+        GrB_FP64 } ;
+    int32_t typecode = -1 ;
+    for (int k = 0 ; k < 11 ; k++)
+    {
+        if (type == types [k]) typecode = k ;
+    }
+    TEST_CHECK (typecode >= 0) ;
+
+    GxB_Format_Value fmt = by_row ? GxB_BY_ROW : GxB_BY_COL ;
+    int32_t kind = GxB_SPARSE + (iso ? 100 : 0) ;
+    double hyper = 0.0625 ;
+    int64_t nonempty = -1 ;
+    GrB_Index nvec = by_row ? nrows : ncols ;
+    char header [512] ;
+    memset (header, ' ', 512) ;
+    header [511] = '\0' ;
+
+    FILE *f = fopen (name, "wb") ;
+    TEST_CHECK (f != NULL) ;
+    fwrite (header,    sizeof (char), 512, f) ;
+    fwrite (&fmt,      sizeof (GxB_Format_Value), 1, f) ;
+    fwrite (&kind,     sizeof (int32_t), 1, f) ;
+    fwrite (&hyper,    sizeof (double), 1, f) ;
+    fwrite (&nrows,    sizeof (GrB_Index), 1, f) ;
+    fwrite (&ncols,    sizeof (GrB_Index), 1, f) ;
+    fwrite (&nonempty, sizeof (int64_t), 1, f) ;
+    fwrite (&nvec,     sizeof (GrB_Index), 1, f) ;
+    fwrite (&nvals,    sizeof (GrB_Index), 1, f) ;
+    fwrite (&typecode, sizeof (int32_t), 1, f) ;
+    fwrite (&typesize, sizeof (size_t), 1, f) ;
+    fwrite (Ap, sizeof (GrB_Index), nvec+1, f) ;
+    fwrite (Ai, sizeof (GrB_Index), nvals, f) ;
+    fwrite (Ax, typesize, iso ? 1 : nvals, f) ;
+    fclose (f) ;
+
+    if (by_row)
+    {
+        OK (GxB_Matrix_pack_CSR (C, &Ap, &Ai, &Ax, Ap_size, Ai_size,
+            Ax_size, iso, false, NULL)) ;
+    }
+    else
+    {
+        OK (GxB_Matrix_pack_CSC (C, &Ap, &Ai, &Ax, Ap_size, Ai_size,
+            Ax_size, iso, false, NULL)) ;
+    }
+    OK (GrB_free (&C)) ;
+}
+
+#endif
+
+//------------------------------------------------------------------------------
+// test_BinRead: read matrices from *.grb files
+//------------------------------------------------------------------------------
+
+void test_BinRead (void)
+{
+    LAGraph_Init (msg) ;
+
+    #if LAGRAPH_SUITESPARSE
+    for (int k = 0 ; ; k++)
+    {
+        const char *aname = files [k] ;
+        if (strlen (aname) == 0) break ;
+        TEST_CASE (aname) ;
+        snprintf (filename, LEN, LG_DATA_DIR "%s", aname) ;
+        FILE *f = fopen (filename, "r") ;
+        TEST_CHECK (f != NULL) ;
+        OK (LAGraph_MMRead (&A, f, msg)) ;
+        fclose (f) ;
+
+        for (int by_row = 0 ; by_row <= 1 ; by_row++)
+        {
+            // write the matrix to a *.grb file and read it back in
+            write_grb (A, by_row, "matrix.grb") ;
+            OK (LAGraph_BinRead (&B, "matrix.grb", msg)) ;
+            bool ok ;
+            OK (LAGraph_Matrix_IsEqual (&ok, A, B, msg)) ;
+            TEST_CHECK (ok) ;
+            GxB_Format_Value fmt ;
+            OK (GxB_get (B, GxB_FORMAT, &fmt)) ;
+            TEST_CHECK (fmt == (by_row ? GxB_BY_ROW : GxB_BY_COL)) ;
+            OK (GrB_free (&B)) ;
+        }
+        OK (GrB_free (&A)) ;
+    }
+    remove ("matrix.grb") ;
+    #endif
+
+    LAGraph_Finalize (msg) ;
+}
+
+//------------------------------------------------------------------------------
+// test_BinRead_failures: check error handling
+//------------------------------------------------------------------------------
+
+void test_BinRead_failures (void)
+{
+    LAGraph_Init (msg) ;
+
+    int result = LAGraph_BinRead (NULL, "matrix.grb", msg) ;
+    TEST_CHECK (result == GrB_NULL_POINTER) ;
+    result = LAGraph_BinRead (&A, NULL, msg) ;
+    TEST_CHECK (result == GrB_NULL_POINTER) ;
+    TEST_CHECK (A == NULL) ;
+
+    #if LAGRAPH_SUITESPARSE
+
+    // file does not exist
+    result = LAGraph_BinRead (&A, "no_such_file.grb", msg) ;
+    TEST_CHECK (result == LAGRAPH_IO_ERROR) ;
+    TEST_CHECK (A == NULL) ;
+
+    // truncated file
+    snprintf (filename, LEN, LG_DATA_DIR "%s", "west0067.mtx") ;
+    FILE *f = fopen (filename, "r") ;
+    TEST_CHECK (f != NULL) ;
+    OK (LAGraph_MMRead (&A, f, msg)) ;
+    fclose (f) ;
+    write_grb (A, true, "matrix.grb") ;
+    f = fopen ("matrix.grb", "rb") ;
+    TEST_CHECK (f != NULL) ;
+    char buffer [1024] ;
+    size_t n = fread (buffer, sizeof (char), 1024, f) ;
+    fclose (f) ;
+    TEST_CHECK (n == 1024) ;
+    f = fopen ("matrix.grb", "wb") ;
+    TEST_CHECK (f != NULL) ;
+    fwrite (buffer, sizeof (char), 1024, f) ;
+    fclose (f) ;
+    result = LAGraph_BinRead (&B, "matrix.grb", msg) ;
+    printf ("\nresult: %d msg: %s\n", result, msg) ;
+    TEST_CHECK (result == LAGRAPH_IO_ERROR) ;
+    TEST_CHECK (B == NULL) ;
+    remove ("matrix.grb") ;
+    OK (GrB_free (&A)) ;
+
+    #else
+
+    result = LAGraph_BinRead (&A, "matrix.grb", msg) ;
+    TEST_CHECK (result == GrB_NOT_IMPLEMENTED) ;
+
+    #endif
+
+    LAGraph_Finalize (msg) ;
+}
+
+//****************************************************************************
+
+TEST_LIST = {
+    {"BinRead", test_BinRead},
+    {"BinRead_failures", test_BinRead_failures},
+    {NULL, NULL}
+};
@@ -0,0 +1,168 @@
+//----------------------------------------------------------------------------
+// LAGraph/experimental/test/test_BreadthFirstSearch_CSR.c: test
+// LAGraph_BreadthFirstSearch_CSR
+// ----------------------------------------------------------------------------
+
+// LAGraph, (c) 2019-2022 by The LAGraph Contributors, All Rights Reserved.
+// SPDX-License-Identifier: BSD-2-Clause
+//
+// For additional details (including references to third party source code and
+// other files) see the LICENSE file or contact permission@sei.cmu.edu. See
+// Contributors.txt for a full list of contributors. Created, in part, with
+// funding and support from the U.S. Government (see Acknowledgments.txt file).
+// DM22-0790
+
+//-----------------------------------------------------------------------------
+
+#include <stdio.h>
+#include <acutest.h>
+#include <LAGraphX.h>
+#include <LAGraph_test.h>
+
+char msg [LAGRAPH_MSG_LEN] ;
+LAGraph_Graph G = NULL ;
+GrB_Matrix A = NULL ;
+GrB_Vector level = NULL, parent = NULL, level0 = NULL ;
+
+#define LEN 512
+char filename [LEN+1] ;
+
+typedef struct
+{
+    LAGraph_Kind kind ;
+    const char *name ;
+}
+matrix_info ;
+
+const matrix_info files [ ] =
+{
+    { LAGraph_ADJACENCY_UNDIRECTED, "A.mtx" },
+    { LAGraph_ADJACENCY_DIRECTED,   "cover.mtx" },
+    { LAGraph_ADJACENCY_UNDIRECTED, "jagmesh7.mtx" },
+    { LAGraph_ADJACENCY_DIRECTED,   "ldbc-directed-example.mtx" },
+    { LAGraph_ADJACENCY_DIRECTED,   "msf1.mtx" },
+    { LAGraph_ADJACENCY_DIRECTED,   "olm1000.mtx" },
+    { LAGraph_ADJACENCY_UNDIRECTED, "bcsstk13.mtx" },
+    { LAGraph_ADJACENCY_DIRECTED,   "cryg2500.mtx" },
+    { LAGraph_ADJACENCY_DIRECTED,   "west0067.mtx" },
+    { LAGraph_ADJACENCY_UNDIRECTED, "karate.mtx" },
+    { LAGraph_ADJACENCY_UNDIRECTED, "pushpull.mtx" },
+    { LAGRAPH_UNKNOWN, "" },
+} ;
+
+// push/pull thresholds to try: defaults, never pull, and pull at once
+#define NTHRESHOLDS 3
+const double thresholds [NTHRESHOLDS][3] =
+{
+    { LAGRAPH_UNKNOWN, LAGRAPH_UNKNOWN, LAGRAPH_UNKNOWN },
+    { 1e-9, 1e-9, 1e9 },
+    { 1e9, 1e9, 1 },
+} ;
+
+//------------------------------------------------------------------------------
+// test_BreadthFirstSearch_CSR: compare with LAGr_BreadthFirstSearch
+//------------------------------------------------------------------------------
+
+void test_BreadthFirstSearch_CSR (void)
+{
+    LAGraph_Init (msg) ;
+
+    for (int k = 0 ; ; k++)
+    {
+        const char *aname = files [k].name ;
+        if (strlen (aname) == 0) break ;
+        LAGraph_Kind kind = files [k].kind ;
+        TEST_CASE (aname) ;
+        printf ("\nMatrix: %s\n", aname) ;
+        snprintf (filename, LEN, LG_DATA_DIR "%s", aname) ;
+        FILE *f = fopen (filename, "r") ;
+        TEST_CHECK (f != NULL) ;
+        OK (LAGraph_MMRead (&A, f, msg)) ;
+        OK (fclose (f)) ;
+        OK (LAGraph_New (&G, &A, kind, msg)) ;
+        GrB_Index n ;
+        OK (GrB_Matrix_nrows (&n, G->A)) ;
+
+        for (int how = 0 ; how < 2 ; how++)
+        {
+            if (how == 1)
+            {
+                // with push/pull
+                OK (LAGraph_Cached_Ensure (G, LAGRAPH_CACHE_AT |
+                    LAGRAPH_CACHE_OUT_DEGREE, msg)) ;
+            }
+
+            for (int t = 0 ; t < NTHRESHOLDS ; t++)
+            {
+                G->bfs_alpha = thresholds [t][0] ;
+                G->bfs_beta1 = thresholds [t][1] ;
+                G->bfs_beta2 = thresholds [t][2] ;
+                for (GrB_Index src = 0 ; src < n ; src += (n/4 + 1))
+                {
+                    // the levels must match LAGr_BreadthFirstSearch, and the
+                    // parents must be valid
+                    OK (LAGr_BreadthFirstSearch (&level0, NULL, G, src, msg)) ;
+                    OK (LAGraph_BreadthFirstSearch_CSR (&level, &parent, G,
+                        src, msg)) ;
+                    OK (LG_check_bfs (level, parent, G, src, msg)) ;
+                    bool ok ;
+                    OK (LAGraph_Vector_IsEqual (&ok, level, level0, msg)) ;
+                    TEST_CHECK (ok) ;
+                    OK (GrB_free (&level)) ;
+                    OK (GrB_free (&parent)) ;
+
+                    // level only
+                    OK (LAGraph_BreadthFirstSearch_CSR (&level, NULL, G, src,
+                        msg)) ;
+                    OK (LAGraph_Vector_IsEqual (&ok, level, level0, msg)) ;
+                    TEST_CHECK (ok) ;
+                    OK (GrB_free (&level)) ;
+
+                    // parent only
+                    OK (LAGraph_BreadthFirstSearch_CSR (NULL, &parent, G, src,
+                        msg)) ;
+                    OK (LG_check_bfs (NULL, parent, G, src, msg)) ;
+                    OK (GrB_free (&parent)) ;
+                    OK (GrB_free (&level0)) ;
+                }
+            }
+        }
+
+        OK (LAGraph_Delete (&G, msg)) ;
+    }
+
+    LAGraph_Finalize (msg) ;
+}
+
+//------------------------------------------------------------------------------
+// test_BreadthFirstSearch_CSR_errors
+//------------------------------------------------------------------------------
+
+void test_BreadthFirstSearch_CSR_errors (void)
+{
+    LAGraph_Init (msg) ;
+    snprintf (filename, LEN, LG_DATA_DIR "%s", "karate.mtx") ;
+    FILE *f = fopen (filename, "r") ;
+    TEST_CHECK (f != NULL) ;
+    OK (LAGraph_MMRead (&A, f, msg)) ;
+    OK (fclose (f)) ;
+    OK (LAGraph_New (&G, &A, LAGraph_ADJACENCY_UNDIRECTED, msg)) ;
+
+    int result = LAGraph_BreadthFirstSearch_CSR (NULL, NULL, G, 0, msg) ;
+    TEST_CHECK (result == GrB_NULL_POINTER) ;
+    result = LAGraph_BreadthFirstSearch_CSR (&level, &parent, G, 34, msg) ;
+    TEST_CHECK (result == GrB_INVALID_INDEX) ;
+    TEST_CHECK (level == NULL) ;
+    TEST_CHECK (parent == NULL) ;
+
+    OK (LAGraph_Delete (&G, msg)) ;
+    LAGraph_Finalize (msg) ;
+}
+
+//****************************************************************************
+
+TEST_LIST = {
+    {"BreadthFirstSearch_CSR", test_BreadthFirstSearch_CSR},
+    {"BreadthFirstSearch_CSR_errors", test_BreadthFirstSearch_CSR_errors},
+    {NULL, NULL}
+};
@@ -0,0 +1,220 @@
+//----------------------------------------------------------------------------
+// LAGraph/experimental/test/test_Cached_Budget.c: test LAGraph_Cached_Trim
+// ----------------------------------------------------------------------------
+
+// LAGraph, (c) 2019-2022 by The LAGraph Contributors, All Rights Reserved.
+// SPDX-License-Identifier: BSD-2-Clause
+//
+// For additional details (including references to third party source code and
+// other files) see the LICENSE file or contact permission@sei.cmu.edu. See
+// Contributors.txt for a full list of contributors. Created, in part, with
+// funding and support from the U.S. Government (see Acknowledgments.txt file).
+// DM22-0790
+
+//-----------------------------------------------------------------------------
+
+#include <stdio.h>
+#include <acutest.h>
+#include <LAGraphX.h>
+#include <LAGraph_test.h>
+
+char msg [LAGRAPH_MSG_LEN] ;
+LAGraph_Graph G = NULL ;
+GrB_Matrix A = NULL ;
+
+#define LEN 512
+char filename [LEN+1] ;
+
+//------------------------------------------------------------------------------
+// load: load a directed graph, with all of its cached properties
+//------------------------------------------------------------------------------
+
+static void load (const char *name)
+{
+    snprintf (filename, LEN, LG_DATA_DIR "%s", name) ;
+    FILE *f = fopen (filename, "r") ;
+    TEST_CHECK (f != NULL) ;
+    OK (LAGraph_MMRead (&A, f, msg)) ;
+    fclose (f) ;
+    OK (LAGraph_New (&G, &A, LAGraph_ADJACENCY_DIRECTED, msg)) ;
+    OK (LAGraph_Cached_Ensure (G, LAGRAPH_CACHE_ALL, msg)) ;
+    TEST_CHECK (G->AT != NULL) ;
+    TEST_CHECK (G->out_degree != NULL) ;
+    TEST_CHECK (G->in_degree != NULL) ;
+}
+
+//------------------------------------------------------------------------------
+// test_Cached_Footprint: check the bytes held by the cached properties
+//------------------------------------------------------------------------------
+
+void test_Cached_Footprint (void)
+{
+    LAGraph_Init (msg) ;
+    load ("west0067.mtx") ;
+
+    size_t total, AT_bytes, out_bytes, in_bytes, emin_bytes, emax_bytes ;
+    OK (LAGraph_Cached_Footprint (&total, G, LAGRAPH_CACHE_ALL, msg)) ;
+    OK (LAGraph_Cached_Footprint (&AT_bytes, G, LAGRAPH_CACHE_AT, msg)) ;
+    OK (LAGraph_Cached_Footprint (&out_bytes, G, LAGRAPH_CACHE_OUT_DEGREE,
+        msg)) ;
+    OK (LAGraph_Cached_Footprint (&in_bytes, G, LAGRAPH_CACHE_IN_DEGREE,
+        msg)) ;
+    OK (LAGraph_Cached_Footprint (&emin_bytes, G, LAGRAPH_CACHE_EMIN, msg)) ;
+    OK (LAGraph_Cached_Footprint (&emax_bytes, G, LAGRAPH_CACHE_EMAX, msg)) ;
+    TEST_CHECK (total ==
+        AT_bytes + out_bytes + in_bytes + emin_bytes + emax_bytes) ;
+
+    // AT holds all the entries of A
+    GrB_Index nvals ;
+    OK (GrB_Matrix_nvals (&nvals, G->A)) ;
+    TEST_CHECK (AT_bytes >= nvals * sizeof (double)) ;
+    TEST_CHECK (out_bytes > 0 && in_bytes > 0) ;
+
+    // no scalar properties have a footprint of their own
+    size_t b ;
+    OK (LAGraph_Cached_Footprint (&b, G, LAGRAPH_CACHE_NSELF_EDGES |
+        LAGRAPH_CACHE_SYMMETRIC_STRUCTURE, msg)) ;
+    TEST_CHECK (b == 0) ;
+
+    OK (LAGraph_DeleteCached (G, msg)) ;
+    OK (LAGraph_Cached_Footprint (&b, G, LAGRAPH_CACHE_ALL, msg)) ;
+    TEST_CHECK (b == 0) ;
+
+    int result = LAGraph_Cached_Footprint (NULL, G, LAGRAPH_CACHE_ALL, msg) ;
+    TEST_CHECK (result == GrB_NULL_POINTER) ;
+    OK (LAGraph_Delete (&G, msg)) ;
+    LAGraph_Finalize (msg) ;
+}
+
+//------------------------------------------------------------------------------
+// test_Cached_Trim: delete cached properties to meet a budget
+//------------------------------------------------------------------------------
+
+void test_Cached_Trim (void)
+{
+    LAGraph_Init (msg) ;
+    load ("west0067.mtx") ;
+
+    size_t total, AT_bytes ;
+    OK (LAGraph_Cached_Footprint (&total, G, LAGRAPH_CACHE_ALL, msg)) ;
+    OK (LAGraph_Cached_Footprint (&AT_bytes, G, LAGRAPH_CACHE_AT, msg)) ;
+
+    // a large enough budget deletes nothing
+    OK (LAGraph_Cached_Trim (G, total, 0, msg)) ;
+    TEST_CHECK (G->AT != NULL) ;
+    TEST_CHECK (G->out_degree != NULL) ;
+    TEST_CHECK (G->in_degree != NULL) ;
+
+    // keep AT, and delete everything else that can be deleted
+    OK (LAGraph_Cached_Trim (G, 0, LAGRAPH_CACHE_AT, msg)) ;
+    TEST_CHECK (G->AT != NULL) ;
+    TEST_CHECK (G->out_degree == NULL) ;
+    TEST_CHECK (G->in_degree == NULL) ;
+    TEST_CHECK (G->emin != NULL && G->emax != NULL) ;
+    TEST_CHECK (G->nself_edges != LAGRAPH_UNKNOWN) ;
+
+    // a budget just less than the total deletes one property
+    OK (LAGraph_Cached_Ensure (G, LAGRAPH_CACHE_ALL, msg)) ;
+    OK (LAGraph_Cached_Footprint (&total, G, LAGRAPH_CACHE_ALL, msg)) ;
+    OK (LAGraph_Cached_Trim (G, total - 1, 0, msg)) ;
+    int nleft = (G->AT != NULL) + (G->out_degree != NULL) +
+        (G->in_degree != NULL) ;
+    TEST_CHECK (nleft == 2) ;
+    size_t b ;
+    OK (LAGraph_Cached_Footprint (&b, G, LAGRAPH_CACHE_ALL, msg)) ;
+    TEST_CHECK (b < total) ;
+
+    // delete all that can be deleted
+    OK (LAGraph_Cached_Trim (G, 0, 0, msg)) ;
+    TEST_CHECK (G->AT == NULL) ;
+    TEST_CHECK (G->out_degree == NULL) ;
+    TEST_CHECK (G->in_degree == NULL) ;
+    TEST_CHECK (G->emin != NULL && G->emax != NULL) ;
+    OK (LAGraph_CheckGraph (G, msg)) ;
+
+    //--------------------------------------------------------------------------
+    // global budget, applied by LAGraph_Cached_Ensure
+    //--------------------------------------------------------------------------
+
+    size_t budget ;
+    OK (LAGraph_Cached_GetBudget (&budget, msg)) ;
+    TEST_CHECK (budget == SIZE_MAX) ;
+    OK (LAGraph_Cached_SetBudget (AT_bytes, msg)) ;
+    OK (LAGraph_Cached_GetBudget (&budget, msg)) ;
+    TEST_CHECK (budget == AT_bytes) ;
+
+    // the properties requested are kept, even if over the budget
+    OK (LAGraph_Cached_Ensure (G, LAGRAPH_CACHE_AT |
+        LAGRAPH_CACHE_OUT_DEGREE, msg)) ;
+    TEST_CHECK (G->AT != NULL) ;
+    TEST_CHECK (G->out_degree != NULL) ;
+
+    // the in-degree is computed, and other properties are deleted
+    OK (LAGraph_Cached_Ensure (G, LAGRAPH_CACHE_IN_DEGREE, msg)) ;
+    TEST_CHECK (G->in_degree != NULL) ;
+    OK (LAGraph_Cached_Footprint (&b, G, LAGRAPH_CACHE_AT |
+        LAGRAPH_CACHE_OUT_DEGREE | LAGRAPH_CACHE_IN_DEGREE, msg)) ;
+    TEST_CHECK (b <= AT_bytes) ;
+    OK (LAGraph_CheckGraph (G, msg)) ;
+
+    //--------------------------------------------------------------------------
+    // global budget, applied by the core LAGraph_Cached_* methods
+    //--------------------------------------------------------------------------
+
+    // each method keeps only the property it computes
+    OK (LAGraph_Cached_SetBudget (0, msg)) ;
+    OK (LAGraph_DeleteCached (G, msg)) ;
+    OK (LAGraph_Cached_AT (G, msg)) ;
+    TEST_CHECK (G->AT != NULL) ;
+    OK (LAGraph_Cached_InDegree (G, msg)) ;
+    TEST_CHECK (G->AT == NULL) ;
+    TEST_CHECK (G->in_degree != NULL) ;
+    OK (LAGraph_Cached_OutDegree (G, msg)) ;
+    TEST_CHECK (G->in_degree == NULL) ;
+    TEST_CHECK (G->out_degree != NULL) ;
+
+    // a property already present is not recomputed, and nothing is trimmed
+    OK (LAGraph_Cached_SetBudget (SIZE_MAX, msg)) ;
+    OK (LAGraph_Cached_AT (G, msg)) ;
+    OK (LAGraph_Cached_SetBudget (0, msg)) ;
+    OK (LAGraph_Cached_AT (G, msg)) ;
+    OK (LAGraph_Cached_OutDegree (G, msg)) ;
+    TEST_CHECK (G->AT != NULL) ;
+    TEST_CHECK (G->out_degree != NULL) ;
+
+    // LAGraph_Cached_TrimToBudget keeps only the properties asked for
+    OK (LAGraph_Cached_TrimToBudget (G, LAGRAPH_CACHE_OUT_DEGREE, msg)) ;
+    TEST_CHECK (G->AT == NULL) ;
+    TEST_CHECK (G->out_degree != NULL) ;
+
+    // LAGraph_Cached_SSSPDelta keeps the G->out_degree that was present
+    OK (LAGraph_Cached_SSSPDelta (G, 4, msg)) ;
+    TEST_CHECK (G->sssp_delta > 0) ;
+    TEST_CHECK (G->out_degree != NULL) ;
+
+    // but deletes the one it computes itself
+    OK (LAGraph_DeleteCached (G, msg)) ;
+    OK (LAGraph_Cached_SSSPDelta (G, 4, msg)) ;
+    TEST_CHECK (G->sssp_delta > 0) ;
+    TEST_CHECK (G->out_degree == NULL) ;
+    OK (LAGraph_CheckGraph (G, msg)) ;
+
+    OK (LAGraph_Cached_SetBudget (SIZE_MAX, msg)) ;
+    int result = LAGraph_Cached_GetBudget (NULL, msg) ;
+    TEST_CHECK (result == GrB_NULL_POINTER) ;
+    result = LAGraph_Cached_Trim (NULL, 0, 0, msg) ;
+    TEST_CHECK (result == GrB_NULL_POINTER) ;
+    result = LAGraph_Cached_TrimToBudget (NULL, 0, msg) ;
+    TEST_CHECK (result == GrB_NULL_POINTER) ;
+
+    OK (LAGraph_Delete (&G, msg)) ;
+    LAGraph_Finalize (msg) ;
+}
+
+//****************************************************************************
+
+TEST_LIST = {
+    {"Cached_Footprint", test_Cached_Footprint},
+    {"Cached_Trim", test_Cached_Trim},
+    {NULL, NULL}
+};
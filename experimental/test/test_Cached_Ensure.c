@@ -0,0 +1,238 @@
+//----------------------------------------------------------------------------
+// LAGraph/experimental/test/test_Cached_Ensure.c: test LAGraph_Cached_Ensure
+// ----------------------------------------------------------------------------
+
+// LAGraph, (c) 2019-2022 by The LAGraph Contributors, All Rights Reserved.
+// SPDX-License-Identifier: BSD-2-Clause
+//
+// For additional details (including references to third party source code and
+// other files) see the LICENSE file or contact permission@sei.cmu.edu. See
+// Contributors.txt for a full list of contributors. Created, in part, with
+// funding and support from the U.S. Government (see Acknowledgments.txt file).
+// DM22-0790
+
+//-----------------------------------------------------------------------------
+
+#include <stdio.h>
+#include <acutest.h>
+#include <LAGraphX.h>
+#include <LAGraph_test.h>
+
+char msg [LAGRAPH_MSG_LEN] ;
+LAGraph_Graph G = NULL, G2 = NULL ;
+GrB_Matrix A = NULL, B = NULL ;
+
+#define LEN 512
+char filename [LEN+1] ;
+
+//------------------------------------------------------------------------------
+// check_cached: compare the cached properties of G with those of G2
+//------------------------------------------------------------------------------
+
+// G2 has the same adjacency matrix as G, with its cached properties computed
+// by the individual LAGraph_Cached_* methods.
+
+static void check_cached (void)
+{
+    bool ok ;
+    OK (LAGraph_CheckGraph (G, msg)) ;
+    TEST_CHECK ((G->AT == NULL) == (G2->AT == NULL)) ;
+    if (G->AT != NULL)
+    {
+        OK (LAGraph_Matrix_IsEqual (&ok, G->AT, G2->AT, msg)) ;
+        TEST_CHECK (ok) ;
+    }
+    TEST_CHECK ((G->out_degree == NULL) == (G2->out_degree == NULL)) ;
+    if (G->out_degree != NULL)
+    {
+        OK (LAGraph_Vector_IsEqual (&ok, G->out_degree, G2->out_degree, msg)) ;
+        TEST_CHECK (ok) ;
+    }
+    TEST_CHECK ((G->in_degree == NULL) == (G2->in_degree == NULL)) ;
+    if (G->in_degree != NULL)
+    {
+        OK (LAGraph_Vector_IsEqual (&ok, G->in_degree, G2->in_degree, msg)) ;
+        TEST_CHECK (ok) ;
+    }
+    TEST_CHECK (G->is_symmetric_structure == G2->is_symmetric_structure) ;
+    TEST_CHECK (G->nself_edges == G2->nself_edges) ;
+    TEST_CHECK (G->emin_state == G2->emin_state) ;
+    TEST_CHECK (G->emax_state == G2->emax_state) ;
+    if (G->emin != NULL)
+    {
+        double x, y ;
+        OK (GrB_Scalar_extractElement_FP64 (&x, G->emin)) ;
+        OK (GrB_Scalar_extractElement_FP64 (&y, G2->emin)) ;
+        TEST_CHECK (x == y) ;
+        OK (GrB_Scalar_extractElement_FP64 (&x, G->emax)) ;
+        OK (GrB_Scalar_extractElement_FP64 (&y, G2->emax)) ;
+        TEST_CHECK (x == y) ;
+    }
+    TEST_CHECK ((G->sssp_delta > 0) == (G2->sssp_delta > 0)) ;
+    TEST_CHECK (fabs (G->sssp_delta - G2->sssp_delta) <=
+        1e-12 * fabs (G2->sssp_delta)) ;
+}
+
+//------------------------------------------------------------------------------
+// test_Cached_Ensure: compute all cached properties at once
+//------------------------------------------------------------------------------
+
+void test_Cached_Ensure (void)
+{
+    LAGraph_Init (msg) ;
+
+    const char *files [4] =
+    {
+        "west0067.mtx", "karate.mtx", "bcsstk13.mtx", "cover.mtx"
+    } ;
+    GrB_Type types [4] = { GrB_FP64, GrB_BOOL, GrB_INT32, GrB_UINT8 } ;
+    #if LAGRAPH_SUITESPARSE
+    int sparsity [2] = { GxB_SPARSE, GxB_HYPERSPARSE } ;
+    #endif
+
+    for (int k = 0 ; k < 4 ; k++)
+    {
+        TEST_CASE (files [k]) ;
+        snprintf (filename, LEN, LG_DATA_DIR "%s", files [k]) ;
+        FILE *f = fopen (filename, "r") ;
+        TEST_CHECK (f != NULL) ;
+        OK (LAGraph_MMRead (&B, f, msg)) ;
+        fclose (f) ;
+        GrB_Index n ;
+        OK (GrB_Matrix_nrows (&n, B)) ;
+        // karate and bcsstk13 are undirected
+        bool directed = (k == 0 || k == 3) ;
+        LAGraph_Kind kind = directed ? LAGraph_ADJACENCY_DIRECTED :
+            LAGraph_ADJACENCY_UNDIRECTED ;
+
+        for (int s = 0 ; s < 2 ; s++)
+        {
+            for (int t = 0 ; t < 4 ; t++)
+            {
+                // A = (type) B, in sparse or hypersparse form
+                OK (GrB_Matrix_new (&A, types [t], n, n)) ;
+                OK (GrB_assign (A, NULL, NULL, B, GrB_ALL, n, GrB_ALL, n,
+                    NULL)) ;
+                #if LAGRAPH_SUITESPARSE
+                OK (GxB_set (A, GxB_SPARSITY_CONTROL, sparsity [s])) ;
+                #endif
+
+                // G2: compute each property on its own
+                OK (LAGraph_New (&G2, &A, kind, msg)) ;
+                if (directed)
+                {
+                    OK (LAGraph_Cached_AT (G2, msg)) ;
+                    OK (LAGraph_Cached_InDegree (G2, msg)) ;
+                }
+                OK (LAGraph_Cached_OutDegree (G2, msg)) ;
+                OK (LAGraph_Cached_IsSymmetricStructure (G2, msg)) ;
+                OK (LAGraph_Cached_NSelfEdges (G2, msg)) ;
+                OK (LAGraph_Cached_EMin (G2, msg)) ;
+                OK (LAGraph_Cached_EMax (G2, msg)) ;
+                OK (LAGraph_Cached_SSSPDelta (G2, 8, msg)) ;
+
+                // G: compute all properties at once
+                OK (GrB_Matrix_dup (&A, G2->A)) ;
+                OK (LAGraph_New (&G, &A, kind, msg)) ;
+                OK (LAGraph_Cached_Ensure (G, LAGRAPH_CACHE_ALL, msg)) ;
+                check_cached ( ) ;
+
+                // G->A is unchanged
+                bool ok ;
+                OK (LAGraph_Matrix_IsEqual (&ok, G->A, G2->A, msg)) ;
+                TEST_CHECK (ok) ;
+
+                // nothing to do
+                OK (LAGraph_Cached_Ensure (G, LAGRAPH_CACHE_ALL, msg)) ;
+                check_cached ( ) ;
+                OK (LAGraph_Delete (&G, msg)) ;
+                OK (LAGraph_Delete (&G2, msg)) ;
+            }
+        }
+        OK (GrB_free (&B)) ;
+    }
+
+    LAGraph_Finalize (msg) ;
+}
+
+//------------------------------------------------------------------------------
+// test_Cached_Ensure_subset: compute some of the cached properties
+//------------------------------------------------------------------------------
+
+void test_Cached_Ensure_subset (void)
+{
+    LAGraph_Init (msg) ;
+
+    snprintf (filename, LEN, LG_DATA_DIR "%s", "west0067.mtx") ;
+    FILE *f = fopen (filename, "r") ;
+    TEST_CHECK (f != NULL) ;
+    OK (LAGraph_MMRead (&A, f, msg)) ;
+    fclose (f) ;
+    OK (LAGraph_New (&G, &A, LAGraph_ADJACENCY_DIRECTED, msg)) ;
+
+    // only the out-degree and the number of self-edges
+    OK (LAGraph_Cached_Ensure (G, LAGRAPH_CACHE_OUT_DEGREE |
+        LAGRAPH_CACHE_NSELF_EDGES, msg)) ;
+    TEST_CHECK (G->out_degree != NULL) ;
+    TEST_CHECK (G->nself_edges != LAGRAPH_UNKNOWN) ;
+    TEST_CHECK (G->AT == NULL) ;
+    TEST_CHECK (G->in_degree == NULL) ;
+    TEST_CHECK (G->is_symmetric_structure == LAGRAPH_UNKNOWN) ;
+    TEST_CHECK (G->emin == NULL && G->emax == NULL) ;
+    TEST_CHECK (G->sssp_delta == LAGRAPH_UNKNOWN) ;
+
+    // west0067 is unsymmetric; its degrees show this, so AT is not needed
+    OK (LAGraph_Cached_Ensure (G, LAGRAPH_CACHE_SYMMETRIC_STRUCTURE, msg)) ;
+    TEST_CHECK (G->is_symmetric_structure == LAGraph_FALSE) ;
+    OK (LAGraph_Cached_Ensure (G, LAGRAPH_CACHE_EMAX, msg)) ;
+    TEST_CHECK (G->emax_state == LAGraph_VALUE) ;
+    TEST_CHECK (G->emin == NULL) ;
+
+    // G->sssp_delta needs G->emin, which is then computed as well
+    OK (LAGraph_Cached_Ensure (G, LAGRAPH_CACHE_SSSP_DELTA, msg)) ;
+    TEST_CHECK (G->sssp_delta > 0) ;
+    TEST_CHECK (G->emin_state == LAGraph_VALUE) ;
+    OK (LAGraph_CheckGraph (G, msg)) ;
+    OK (LAGraph_Delete (&G, msg)) ;
+
+    // an undirected graph has no need of AT or in_degree
+    snprintf (filename, LEN, LG_DATA_DIR "%s", "karate.mtx") ;
+    f = fopen (filename, "r") ;
+    TEST_CHECK (f != NULL) ;
+    OK (LAGraph_MMRead (&A, f, msg)) ;
+    fclose (f) ;
+    OK (LAGraph_New (&G, &A, LAGraph_ADJACENCY_UNDIRECTED, msg)) ;
+    OK (LAGraph_Cached_Ensure (G, LAGRAPH_CACHE_AT | LAGRAPH_CACHE_IN_DEGREE |
+        LAGRAPH_CACHE_SYMMETRIC_STRUCTURE, msg)) ;
+    TEST_CHECK (G->AT == NULL) ;
+    TEST_CHECK (G->in_degree == NULL) ;
+    TEST_CHECK (G->is_symmetric_structure == LAGraph_TRUE) ;
+    OK (LAGraph_Delete (&G, msg)) ;
+
+    // a directed graph with a symmetric structure needs AT to determine this,
+    // but AT is not kept unless it is requested as well
+    snprintf (filename, LEN, LG_DATA_DIR "%s", "bcsstk13.mtx") ;
+    f = fopen (filename, "r") ;
+    TEST_CHECK (f != NULL) ;
+    OK (LAGraph_MMRead (&A, f, msg)) ;
+    fclose (f) ;
+    OK (LAGraph_New (&G, &A, LAGraph_ADJACENCY_DIRECTED, msg)) ;
+    OK (LAGraph_Cached_Ensure (G, LAGRAPH_CACHE_SYMMETRIC_STRUCTURE, msg)) ;
+    TEST_CHECK (G->is_symmetric_structure == LAGraph_TRUE) ;
+    TEST_CHECK (G->AT == NULL) ;
+    OK (LAGraph_CheckGraph (G, msg)) ;
+    OK (LAGraph_Delete (&G, msg)) ;
+
+    int result = LAGraph_Cached_Ensure (NULL, LAGRAPH_CACHE_ALL, msg) ;
+    TEST_CHECK (result == GrB_NULL_POINTER) ;
+
+    LAGraph_Finalize (msg) ;
+}
+
+//****************************************************************************
+
+TEST_LIST = {
+    {"Cached_Ensure", test_Cached_Ensure},
+    {"Cached_Ensure_subset", test_Cached_Ensure_subset},
+    {NULL, NULL}
+};
@@ -0,0 +1,265 @@
+//----------------------------------------------------------------------------
+// LAGraph/experimental/test/test_EdgeListRead.c: test LAGraph_EdgeListRead
+// ----------------------------------------------------------------------------
+
+// LAGraph, (c) 2019-2022 by The LAGraph Contributors, All Rights Reserved.
+// SPDX-License-Identifier: BSD-2-Clause
+//
+// For additional details (including references to third party source code and
+// other files) see the LICENSE file or contact permission@sei.cmu.edu. See
+// Contributors.txt for a full list of contributors. Created, in part, with
+// funding and support from the U.S. Government (see Acknowledgments.txt file).
+// DM22-0790
+
+//-----------------------------------------------------------------------------
+
+#include <stdio.h>
+#include <acutest.h>
+#include <LAGraphX.h>
+#include <LAGraph_test.h>
+
+char msg [LAGRAPH_MSG_LEN] ;
+GrB_Matrix A = NULL, B = NULL, C = NULL ;
+GrB_Vector ids = NULL ;
+char **names = NULL ;
+
+#define LEN 512
+char filename [LEN+1] ;
+
+//------------------------------------------------------------------------------
+// write_file: write a string to a file
+//------------------------------------------------------------------------------
+
+static void write_file (const char *name, const char *contents)
+{
+    FILE *f = fopen (name, "wb") ;
+    TEST_CHECK (f != NULL) ;
+    fputs (contents, f) ;
+    fclose (f) ;
+}
+
+//------------------------------------------------------------------------------
+// write_edges: write the entries of a matrix as an edge list, with 1-based IDs
+//------------------------------------------------------------------------------
+
+static void write_edges (GrB_Matrix A, bool csv, bool weighted,
+    const char *name)
+{
+    GrB_Index nvals ;
+    OK (GrB_Matrix_nvals (&nvals, A)) ;
+    GrB_Index *I = NULL, *J = NULL ;
+    double *X = NULL ;
+    OK (LAGraph_Malloc ((void **) &I, nvals, sizeof (GrB_Index), msg)) ;
+    OK (LAGraph_Malloc ((void **) &J, nvals, sizeof (GrB_Index), msg)) ;
+    OK (LAGraph_Malloc ((void **) &X, nvals, sizeof (double), msg)) ;
+    OK (GrB_Matrix_extractTuples_FP64 (I, J, X, &nvals, A)) ;
+    FILE *f = fopen (name, "wb") ;
+    TEST_CHECK (f != NULL) ;
+    fprintf (f, csv ? "source,target%s\n" : "# edges\n# src\tdst%s\n",
+        weighted ? (csv ? ",weight" : "\tweight") : "") ;
+    for (GrB_Index k = 0 ; k < nvals ; k++)
+    {
+        fprintf (f, "%" PRIu64 "%c%" PRIu64, I [k] + 1, csv ? ',' : '\t',
+            J [k] + 1) ;
+        if (weighted) fprintf (f, "%c%.17g", csv ? ',' : '\t', X [k]) ;
+        fprintf (f, "\n") ;
+    }
+    fclose (f) ;
+    LAGraph_Free ((void **) &I, NULL) ;
+    LAGraph_Free ((void **) &J, NULL) ;
+    LAGraph_Free ((void **) &X, NULL) ;
+}
+
+//------------------------------------------------------------------------------
+// test_EdgeListRead: read edge lists with integer IDs
+//------------------------------------------------------------------------------
+
+void test_EdgeListRead (void)
+{
+    LAGraph_Init (msg) ;
+
+    // karate is unweighted; west0067 is weighted.  In both, each node has at
+    // least one edge, so node k has the ID k+1 in the edge list.
+    const char *files [2] = { "karate.mtx", "west0067.mtx" } ;
+    for (int k = 0 ; k < 2 ; k++)
+    {
+        bool weighted = (k == 1) ;
+        TEST_CASE (files [k]) ;
+        snprintf (filename, LEN, LG_DATA_DIR "%s", files [k]) ;
+        FILE *f = fopen (filename, "r") ;
+        TEST_CHECK (f != NULL) ;
+        OK (LAGraph_MMRead (&A, f, msg)) ;
+        fclose (f) ;
+        GrB_Index n ;
+        OK (GrB_Matrix_nrows (&n, A)) ;
+        if (weighted)
+        {
+            OK (GrB_Matrix_dup (&C, A)) ;
+        }
+        else
+        {
+            OK (LAGraph_Matrix_Structure (&C, A, msg)) ;
+        }
+
+        for (int csv = 0 ; csv <= 1 ; csv++)
+        {
+            write_edges (A, csv, weighted, "edges.txt") ;
+            f = fopen ("edges.txt", "r") ;
+            TEST_CHECK (f != NULL) ;
+            OK (LAGraph_EdgeListRead (&B, &ids, &names, f, msg)) ;
+            fclose (f) ;
+
+            bool ok ;
+            OK (LAGraph_Matrix_IsEqual (&ok, B, C, msg)) ;
+            TEST_CHECK (ok) ;
+            GrB_Index nids ;
+            OK (GrB_Vector_size (&nids, ids)) ;
+            TEST_CHECK (nids == n) ;
+            for (GrB_Index i = 0 ; i < n ; i++)
+            {
+                uint64_t id = 0 ;
+                OK (GrB_Vector_extractElement (&id, ids, i)) ;
+                TEST_CHECK (id == i + 1) ;
+                char s [64] ;
+                snprintf (s, 64, "%" PRIu64, i + 1) ;
+                TEST_CHECK (strcmp (names [i], s) == 0) ;
+            }
+            OK (GrB_free (&B)) ;
+            OK (GrB_free (&ids)) ;
+            OK (LAGraph_Free ((void **) &names, msg)) ;
+        }
+        OK (GrB_free (&A)) ;
+        OK (GrB_free (&C)) ;
+    }
+    remove ("edges.txt") ;
+
+    // sparse 64-bit IDs, and duplicate edges
+    write_file ("edges.txt",
+        "18446744073709551615 7\n"
+        "7 1000000000000\n"
+        "\n"
+        "% comment\n"
+        "7 1000000000000\n") ;
+    FILE *f = fopen ("edges.txt", "r") ;
+    TEST_CHECK (f != NULL) ;
+    OK (LAGraph_EdgeListRead (&B, &ids, NULL, f, msg)) ;
+    fclose (f) ;
+    GrB_Index n, nvals ;
+    OK (GrB_Matrix_nrows (&n, B)) ;
+    OK (GrB_Matrix_nvals (&nvals, B)) ;
+    TEST_CHECK (n == 3) ;
+    TEST_CHECK (nvals == 2) ;
+    uint64_t id ;
+    OK (GrB_Vector_extractElement (&id, ids, 0)) ;
+    TEST_CHECK (id == 7) ;
+    OK (GrB_Vector_extractElement (&id, ids, 1)) ;
+    TEST_CHECK (id == 1000000000000) ;
+    OK (GrB_Vector_extractElement (&id, ids, 2)) ;
+    TEST_CHECK (id == UINT64_MAX) ;
+    bool x = false ;
+    OK (GrB_Matrix_extractElement (&x, B, 2, 0)) ;
+    TEST_CHECK (x) ;
+    OK (GrB_Matrix_extractElement (&x, B, 0, 1)) ;
+    TEST_CHECK (x) ;
+    OK (GrB_free (&B)) ;
+    OK (GrB_free (&ids)) ;
+    remove ("edges.txt") ;
+
+    LAGraph_Finalize (msg) ;
+}
+
+//------------------------------------------------------------------------------
+// test_EdgeListRead_strings: read an edge list with string IDs
+//------------------------------------------------------------------------------
+
+void test_EdgeListRead_strings (void)
+{
+    LAGraph_Init (msg) ;
+
+    write_file ("edges.csv",
+        "source,target,weight\n"
+        "\"carol\", alice ,2\n"
+        "alice,bob,1.5\r\n"
+        "bob,carol,3\n"
+        "alice,bob,1") ;
+    FILE *f = fopen ("edges.csv", "r") ;
+    TEST_CHECK (f != NULL) ;
+    OK (LAGraph_EdgeListRead (&B, &ids, &names, f, msg)) ;
+    fclose (f) ;
+    TEST_CHECK (ids == NULL) ;
+    TEST_CHECK (strcmp (names [0], "alice") == 0) ;
+    TEST_CHECK (strcmp (names [1], "bob") == 0) ;
+    TEST_CHECK (strcmp (names [2], "carol") == 0) ;
+
+    // alice = 0, bob = 1, carol = 2
+    OK (GrB_Matrix_new (&C, GrB_FP64, 3, 3)) ;
+    OK (GrB_Matrix_setElement (C, 2.0, 2, 0)) ;
+    OK (GrB_Matrix_setElement (C, 2.5, 0, 1)) ;
+    OK (GrB_Matrix_setElement (C, 3.0, 1, 2)) ;
+    bool ok ;
+    OK (LAGraph_Matrix_IsEqual (&ok, B, C, msg)) ;
+    TEST_CHECK (ok) ;
+
+    OK (GrB_free (&B)) ;
+    OK (GrB_free (&C)) ;
+    OK (LAGraph_Free ((void **) &names, msg)) ;
+    remove ("edges.csv") ;
+
+    LAGraph_Finalize (msg) ;
+}
+
+//------------------------------------------------------------------------------
+// test_EdgeListRead_failures: check error handling
+//------------------------------------------------------------------------------
+
+void test_EdgeListRead_failures (void)
+{
+    LAGraph_Init (msg) ;
+
+    int result = LAGraph_EdgeListRead (NULL, NULL, NULL, stdin, msg) ;
+    TEST_CHECK (result == GrB_NULL_POINTER) ;
+    result = LAGraph_EdgeListRead (&A, NULL, NULL, NULL, msg) ;
+    TEST_CHECK (result == GrB_NULL_POINTER) ;
+
+    const char *bad [3] =
+    {
+        "1 2\n3\n",             // missing node ID
+        "1 2\n3 x\n",           // node ID is not an integer
+        "1 2 0.5\n3 4 w\n",     // weight is not a number
+    } ;
+    for (int k = 0 ; k < 3 ; k++)
+    {
+        write_file ("edges.txt", bad [k]) ;
+        FILE *f = fopen ("edges.txt", "r") ;
+        TEST_CHECK (f != NULL) ;
+        result = LAGraph_EdgeListRead (&A, &ids, &names, f, msg) ;
+        fclose (f) ;
+        printf ("\nresult: %d msg: %s\n", result, msg) ;
+        TEST_CHECK (result == LAGRAPH_IO_ERROR) ;
+        TEST_CHECK (A == NULL && ids == NULL && names == NULL) ;
+    }
+
+    // a file with no edges
+    write_file ("edges.txt", "# no edges\n\n") ;
+    FILE *f = fopen ("edges.txt", "r") ;
+    TEST_CHECK (f != NULL) ;
+    OK (LAGraph_EdgeListRead (&A, &ids, NULL, f, msg)) ;
+    fclose (f) ;
+    GrB_Index n ;
+    OK (GrB_Matrix_nrows (&n, A)) ;
+    TEST_CHECK (n == 0) ;
+    OK (GrB_free (&A)) ;
+    OK (GrB_free (&ids)) ;
+    remove ("edges.txt") ;
+
+    LAGraph_Finalize (msg) ;
+}
+
+//****************************************************************************
+
+TEST_LIST = {
+    {"EdgeListRead", test_EdgeListRead},
+    {"EdgeListRead_strings", test_EdgeListRead_strings},
+    {"EdgeListRead_failures", test_EdgeListRead_failures},
+    {NULL, NULL}
+};
@@ -0,0 +1,171 @@
+//----------------------------------------------------------------------------
+// LAGraph/experimental/test/test_Freeze.c: test LAGraph_Freeze
+// ----------------------------------------------------------------------------
+
+// LAGraph, (c) 2019-2022 by The LAGraph Contributors, All Rights Reserved.
+// SPDX-License-Identifier: BSD-2-Clause
+//
+// For additional details (including references to third party source code and
+// other files) see the LICENSE file or contact permission@sei.cmu.edu. See
+// Contributors.txt for a full list of contributors. Created, in part, with
+// funding and support from the U.S. Government (see Acknowledgments.txt file).
+// DM22-0790
+
+//-----------------------------------------------------------------------------
+
+#include <stdio.h>
+#include <acutest.h>
+#include <LAGraphX.h>
+#include <LAGraph_test.h>
+
+char msg [LAGRAPH_MSG_LEN] ;
+LAGraph_Graph G = NULL ;
+GrB_Matrix A = NULL, A2 = NULL ;
+
+#define LEN 512
+char filename [LEN+1] ;
+
+// # of user threads sharing the frozen graph
+#define NUSERS 4
+
+//------------------------------------------------------------------------------
+// test_Freeze: compute all cached properties of a graph
+//------------------------------------------------------------------------------
+
+void test_Freeze (void)
+{
+    LAGraph_Init (msg) ;
+
+    const char *files [2] = { "west0067.mtx", "karate.mtx" } ;
+    for (int k = 0 ; k < 2 ; k++)
+    {
+        TEST_CASE (files [k]) ;
+        snprintf (filename, LEN, LG_DATA_DIR "%s", files [k]) ;
+        FILE *f = fopen (filename, "r") ;
+        TEST_CHECK (f != NULL) ;
+        OK (LAGraph_MMRead (&A, f, msg)) ;
+        fclose (f) ;
+        bool directed = (k == 0) ;
+        OK (LAGraph_New (&G, &A, directed ? LAGraph_ADJACENCY_DIRECTED :
+            LAGraph_ADJACENCY_UNDIRECTED, msg)) ;
+
+        OK (LAGraph_Freeze (G, msg)) ;
+        TEST_CHECK (G->is_symmetric_structure != LAGRAPH_UNKNOWN) ;
+        TEST_CHECK (G->nself_edges != LAGRAPH_UNKNOWN) ;
+        TEST_CHECK (G->out_degree != NULL) ;
+        TEST_CHECK (G->emin_state == LAGraph_VALUE) ;
+        TEST_CHECK (G->emax_state == LAGraph_VALUE) ;
+        TEST_CHECK (G->sssp_delta > 0) ;
+        if (directed)
+        {
+            // west0067 is unsymmetric
+            TEST_CHECK (G->AT != NULL) ;
+            TEST_CHECK (G->in_degree != NULL) ;
+        }
+        else
+        {
+            TEST_CHECK (G->AT == NULL) ;
+            TEST_CHECK (G->in_degree == NULL) ;
+        }
+        OK (LAGraph_CheckGraph (G, msg)) ;
+
+        // freezing a frozen graph does nothing
+        GrB_Matrix AT = G->AT ;
+        GrB_Vector out_degree = G->out_degree ;
+        OK (LAGraph_Freeze (G, msg)) ;
+        TEST_CHECK (G->AT == AT) ;
+        TEST_CHECK (G->out_degree == out_degree) ;
+        OK (LAGraph_Delete (&G, msg)) ;
+    }
+
+    LAGraph_Finalize (msg) ;
+}
+
+//------------------------------------------------------------------------------
+// test_Freeze_shared: connected components of a graph shared by many threads
+//------------------------------------------------------------------------------
+
+void test_Freeze_shared (void)
+{
+    #if LAGRAPH_SUITESPARSE
+    LAGraph_Init (msg) ;
+
+    // bcsstk13 is large enough to trigger the sample phase of FastSV
+    const char *files [2] = { "karate.mtx", "bcsstk13.mtx" } ;
+    for (int k = 0 ; k < 2 ; k++)
+    {
+        TEST_CASE (files [k]) ;
+        snprintf (filename, LEN, LG_DATA_DIR "%s", files [k]) ;
+        FILE *f = fopen (filename, "r") ;
+        TEST_CHECK (f != NULL) ;
+        OK (LAGraph_MMRead (&A, f, msg)) ;
+        fclose (f) ;
+        OK (GrB_Matrix_dup (&A2, A)) ;
+        OK (LAGraph_New (&G, &A, LAGraph_ADJACENCY_UNDIRECTED, msg)) ;
+        OK (LAGraph_Freeze (G, msg)) ;
+
+        // each user thread finds the components with FastSV6 and FastSV5
+        GrB_Vector C6 [NUSERS], C5 [NUSERS] ;
+        int result6 [NUSERS], result5 [NUSERS] ;
+        int user ;
+        #pragma omp parallel for num_threads(NUSERS) schedule(static,1)
+        for (user = 0 ; user < NUSERS ; user++)
+        {
+            char user_msg [LAGRAPH_MSG_LEN] ;
+            C6 [user] = NULL ;
+            C5 [user] = NULL ;
+            result6 [user] = LAGr_ConnectedComponents (&C6 [user], G,
+                user_msg) ;
+            result5 [user] = LG_CC_FastSV5 (&C5 [user], G, user_msg) ;
+        }
+
+        // all threads must get the same result
+        for (user = 0 ; user < NUSERS ; user++)
+        {
+            bool ok ;
+            OK (result6 [user]) ;
+            OK (result5 [user]) ;
+            OK (LAGraph_Vector_IsEqual (&ok, C6 [user], C6 [0], msg)) ;
+            TEST_CHECK (ok) ;
+            OK (LAGraph_Vector_IsEqual (&ok, C5 [user], C5 [0], msg)) ;
+            TEST_CHECK (ok) ;
+        }
+        for (user = 0 ; user < NUSERS ; user++)
+        {
+            OK (GrB_free (&C6 [user])) ;
+            OK (GrB_free (&C5 [user])) ;
+        }
+
+        // G->A is unchanged
+        bool ok ;
+        OK (LAGraph_Matrix_IsEqual (&ok, G->A, A2, msg)) ;
+        TEST_CHECK (ok) ;
+        OK (LAGraph_CheckGraph (G, msg)) ;
+        OK (GrB_free (&A2)) ;
+        OK (LAGraph_Delete (&G, msg)) ;
+    }
+
+    LAGraph_Finalize (msg) ;
+    #endif
+}
+
+//------------------------------------------------------------------------------
+// test_Freeze_failures: check error handling
+//------------------------------------------------------------------------------
+
+void test_Freeze_failures (void)
+{
+    LAGraph_Init (msg) ;
+    int result = LAGraph_Freeze (NULL, msg) ;
+    TEST_CHECK (result == GrB_NULL_POINTER) ;
+    LAGraph_Finalize (msg) ;
+}
+
+//****************************************************************************
+
+TEST_LIST = {
+    {"Freeze", test_Freeze},
+    {"Freeze_shared", test_Freeze_shared},
+    {"Freeze_failures", test_Freeze_failures},
+    {NULL, NULL}
+};
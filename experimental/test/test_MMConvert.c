@@ -0,0 +1,247 @@
+//----------------------------------------------------------------------------
+// LAGraph/experimental/test/test_MMConvert.c: test cases for LAGraph_MMConvert
+// ----------------------------------------------------------------------------
+
+// LAGraph, (c) 2019-2022 by The LAGraph Contributors, All Rights Reserved.
+// SPDX-License-Identifier: BSD-2-Clause
+//
+// For additional details (including references to third party source code and
+// other files) see the LICENSE file or contact permission@sei.cmu.edu. See
+// Contributors.txt for a full list of contributors. Created, in part, with
+// funding and support from the U.S. Government (see Acknowledgments.txt file).
+// DM22-0790
+
+//-----------------------------------------------------------------------------
+
+#include <stdio.h>
+#include <acutest.h>
+#include <LAGraphX.h>
+#include <LAGraph_test.h>
+
+char msg [LAGRAPH_MSG_LEN] ;
+GrB_Matrix A = NULL, B = NULL, C = NULL, *Set = NULL ;
+GrB_Index nmatrices = 0 ;
+char *collection = NULL ;
+
+#define LEN 512
+char filename [LEN+1] ;
+
+const char *files [ ] =
+{
+    "A.mtx",
+    "cover.mtx",
+    "west0067.mtx",
+    "karate.mtx",
+    "matrix_bool.mtx",
+    "matrix_int8.mtx",
+    "matrix_uint16.mtx",
+    "matrix_fp32.mtx",
+    "matrix_fp64.mtx",
+    "structure.mtx",
+    "empty.mtx",
+    "",
+} ;
+
+//------------------------------------------------------------------------------
+// read_back: read the converted matrix from a *.grb or *.lagraph file
+//------------------------------------------------------------------------------
+
+static void read_back (GrB_Matrix *M, bool to_grb, const char *name)
+{
+    if (to_grb)
+    {
+        OK (LAGraph_BinRead (M, name, msg)) ;
+    }
+    else
+    {
+        OK (LAGraph_SLoadSet ((char *) name, &Set, &nmatrices, &collection,
+            msg)) ;
+        TEST_CHECK (nmatrices == 1) ;
+        (*M) = Set [0] ;
+        Set [0] = NULL ;
+        LAGraph_SFreeSet (&Set, nmatrices) ;
+        LAGraph_Free ((void **) &collection, NULL) ;
+    }
+}
+
+//------------------------------------------------------------------------------
+// test_MMConvert: convert matrices with no changes
+//------------------------------------------------------------------------------
+
+void test_MMConvert (void)
+{
+    LAGraph_Init (msg) ;
+
+    #if LAGRAPH_SUITESPARSE
+    for (int k = 0 ; ; k++)
+    {
+        const char *aname = files [k] ;
+        if (strlen (aname) == 0) break ;
+        TEST_CASE (aname) ;
+        snprintf (filename, LEN, LG_DATA_DIR "%s", aname) ;
+        FILE *f = fopen (filename, "r") ;
+        TEST_CHECK (f != NULL) ;
+        OK (LAGraph_MMRead (&A, f, msg)) ;
+        fclose (f) ;
+
+        for (int to_grb = 0 ; to_grb <= 1 ; to_grb++)
+        {
+            const char *outfile = to_grb ? "matrix.grb" : "matrix.lagraph" ;
+            OK (LAGraph_MMConvert (outfile, filename, false, false, false,
+                NULL, msg)) ;
+            read_back (&B, to_grb, outfile) ;
+            bool ok ;
+            OK (LAGraph_Matrix_IsEqual (&ok, A, B, msg)) ;
+            TEST_CHECK (ok) ;
+            OK (GrB_free (&B)) ;
+        }
+        OK (GrB_free (&A)) ;
+    }
+    remove ("matrix.grb") ;
+    remove ("matrix.lagraph") ;
+    #endif
+
+    LAGraph_Finalize (msg) ;
+}
+
+//------------------------------------------------------------------------------
+// test_MMConvert_options: convert matrices with readproblem options
+//------------------------------------------------------------------------------
+
+void test_MMConvert_options (void)
+{
+    LAGraph_Init (msg) ;
+
+    #if LAGRAPH_SUITESPARSE
+    snprintf (filename, LEN, LG_DATA_DIR "%s", "west0067.mtx") ;
+    FILE *f = fopen (filename, "r") ;
+    TEST_CHECK (f != NULL) ;
+    OK (LAGraph_MMRead (&A, f, msg)) ;
+    fclose (f) ;
+    GrB_Index n ;
+    OK (GrB_Matrix_nrows (&n, A)) ;
+
+    for (int to_grb = 0 ; to_grb <= 1 ; to_grb++)
+    {
+        const char *outfile = to_grb ? "matrix.grb" : "matrix.lagraph" ;
+        bool ok ;
+
+        // remove self-edges
+        OK (LAGraph_MMConvert (outfile, filename, false, true, false, NULL,
+            msg)) ;
+        read_back (&B, to_grb, outfile) ;
+        OK (GrB_Matrix_new (&C, GrB_FP64, n, n)) ;
+        OK (GrB_select (C, NULL, NULL, GrB_OFFDIAG, A, 0, NULL)) ;
+        OK (LAGraph_Matrix_IsEqual (&ok, B, C, msg)) ;
+        TEST_CHECK (ok) ;
+        OK (GrB_free (&B)) ;
+        OK (GrB_free (&C)) ;
+
+        // structural
+        OK (LAGraph_MMConvert (outfile, filename, false, false, true, NULL,
+            msg)) ;
+        read_back (&B, to_grb, outfile) ;
+        OK (LAGraph_Matrix_Structure (&C, A, msg)) ;
+        OK (LAGraph_Matrix_IsEqual (&ok, B, C, msg)) ;
+        TEST_CHECK (ok) ;
+        OK (GrB_free (&B)) ;
+        OK (GrB_free (&C)) ;
+
+        // typecast to GrB_FP32, and remove self-edges
+        OK (LAGraph_MMConvert (outfile, filename, false, true, false, GrB_FP32,
+            msg)) ;
+        read_back (&B, to_grb, outfile) ;
+        OK (GrB_Matrix_new (&C, GrB_FP32, n, n)) ;
+        OK (GrB_select (C, NULL, NULL, GrB_OFFDIAG, A, 0, NULL)) ;
+        OK (LAGraph_Matrix_IsEqual (&ok, B, C, msg)) ;
+        TEST_CHECK (ok) ;
+        OK (GrB_free (&B)) ;
+        OK (GrB_free (&C)) ;
+
+        // make symmetric
+        OK (LAGraph_MMConvert (outfile, filename, true, false, false, NULL,
+            msg)) ;
+        read_back (&B, to_grb, outfile) ;
+        OK (GrB_Matrix_new (&C, GrB_FP64, n, n)) ;
+        OK (GrB_eWiseAdd (C, NULL, NULL, GrB_PLUS_FP64, A, A, GrB_DESC_T1)) ;
+        OK (LAGraph_Matrix_IsEqual (&ok, B, C, msg)) ;
+        TEST_CHECK (ok) ;
+        OK (GrB_free (&B)) ;
+        OK (GrB_free (&C)) ;
+    }
+    OK (GrB_free (&A)) ;
+
+    // a matrix stored as "symmetric" is left as-is
+    snprintf (filename, LEN, LG_DATA_DIR "%s", "karate.mtx") ;
+    f = fopen (filename, "r") ;
+    TEST_CHECK (f != NULL) ;
+    OK (LAGraph_MMRead (&A, f, msg)) ;
+    fclose (f) ;
+    for (int to_grb = 0 ; to_grb <= 1 ; to_grb++)
+    {
+        const char *outfile = to_grb ? "matrix.grb" : "matrix.lagraph" ;
+        bool ok ;
+        OK (LAGraph_MMConvert (outfile, filename, true, false, false, NULL,
+            msg)) ;
+        read_back (&B, to_grb, outfile) ;
+        OK (LAGraph_Matrix_IsEqual (&ok, B, A, msg)) ;
+        TEST_CHECK (ok) ;
+        OK (GrB_free (&B)) ;
+    }
+
+    OK (GrB_free (&A)) ;
+    remove ("matrix.grb") ;
+    remove ("matrix.lagraph") ;
+    #endif
+
+    LAGraph_Finalize (msg) ;
+}
+
+//------------------------------------------------------------------------------
+// test_MMConvert_failures: check error handling
+//------------------------------------------------------------------------------
+
+void test_MMConvert_failures (void)
+{
+    LAGraph_Init (msg) ;
+
+    int result = LAGraph_MMConvert (NULL, "A.mtx", false, false, false, NULL,
+        msg) ;
+    TEST_CHECK (result == GrB_NULL_POINTER) ;
+    result = LAGraph_MMConvert ("matrix.grb", NULL, false, false, false, NULL,
+        msg) ;
+    TEST_CHECK (result == GrB_NULL_POINTER) ;
+
+    #if LAGRAPH_SUITESPARSE
+
+    // input file does not exist
+    result = LAGraph_MMConvert ("matrix.grb", "no_such_file.mtx", false, false,
+        false, NULL, msg) ;
+    TEST_CHECK (result == LAGRAPH_IO_ERROR) ;
+
+    // a rectangular matrix cannot be made symmetric
+    snprintf (filename, LEN, LG_DATA_DIR "%s", "lp_afiro.mtx") ;
+    result = LAGraph_MMConvert ("matrix.grb", filename, true, false, false,
+        NULL, msg) ;
+    TEST_CHECK (result == GrB_DIMENSION_MISMATCH) ;
+    remove ("matrix.grb") ;
+
+    #else
+
+    result = LAGraph_MMConvert ("matrix.grb", "A.mtx", false, false, false,
+        NULL, msg) ;
+    TEST_CHECK (result == GrB_NOT_IMPLEMENTED) ;
+
+    #endif
+
+    LAGraph_Finalize (msg) ;
+}
+
+//****************************************************************************
+
+TEST_LIST = {
+    {"MMConvert", test_MMConvert},
+    {"MMConvert_options", test_MMConvert_options},
+    {"MMConvert_failures", test_MMConvert_failures},
+    {NULL, NULL}
+};
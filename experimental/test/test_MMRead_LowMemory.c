@@ -0,0 +1,152 @@
+//----------------------------------------------------------------------------
+// LAGraph/experimental/test/test_MMRead_LowMemory.c: test cases for
+// LAGraph_MMRead_LowMemory
+// ----------------------------------------------------------------------------
+
+// LAGraph, (c) 2019-2022 by The LAGraph Contributors, All Rights Reserved.
+// SPDX-License-Identifier: BSD-2-Clause
+//
+// For additional details (including references to third party source code and
+// other files) see the LICENSE file or contact permission@sei.cmu.edu. See
+// Contributors.txt for a full list of contributors. Created, in part, with
+// funding and support from the U.S. Government (see Acknowledgments.txt file).
+// DM22-0790
+
+//-----------------------------------------------------------------------------
+
+#include <stdio.h>
+#include <acutest.h>
+#include <LAGraphX.h>
+#include <LAGraph_test.h>
+
+char msg [LAGRAPH_MSG_LEN] ;
+GrB_Matrix A = NULL, B = NULL ;
+
+#define LEN 512
+char filename [LEN+1] ;
+
+const char *files [ ] =
+{
+    "A.mtx",
+    "cover.mtx",
+    "cover_structure.mtx",
+    "jagmesh7.mtx",
+    "ldbc-cdlp-undirected-example.mtx",
+    "ldbc-directed-example.mtx",
+    "LFAT5.mtx",
+    "sources_7.mtx",
+    "olm1000.mtx",
+    "bcsstk13.mtx",
+    "cryg2500.mtx",
+    "west0067.mtx",
+    "west0067_jumbled.mtx",
+    "lp_afiro.mtx",
+    "lp_afiro_structure.mtx",
+    "karate.mtx",
+    "matrix_bool.mtx",
+    "matrix_int8.mtx",
+    "matrix_uint16.mtx",
+    "matrix_int32.mtx",
+    "matrix_uint64.mtx",
+    "matrix_fp32.mtx",
+    "matrix_fp32_structure.mtx",
+    "matrix_fp64.mtx",
+    "skew_fp32.mtx",
+    "skew_int8.mtx",
+    "structure.mtx",
+    "full.mtx",
+    "full_symmetric.mtx",
+    "empty.mtx",
+    "",
+} ;
+
+//------------------------------------------------------------------------------
+// test_MMRead_LowMemory: compare with LAGraph_MMRead
+//------------------------------------------------------------------------------
+
+void test_MMRead_LowMemory (void)
+{
+    LAGraph_Init (msg) ;
+
+    for (int k = 0 ; ; k++)
+    {
+        const char *aname = files [k] ;
+        if (strlen (aname) == 0) break ;
+        TEST_CASE (aname) ;
+        snprintf (filename, LEN, LG_DATA_DIR "%s", aname) ;
+        FILE *f = fopen (filename, "r") ;
+        TEST_CHECK (f != NULL) ;
+        OK (LAGraph_MMRead (&A, f, msg)) ;
+        fclose (f) ;
+        f = fopen (filename, "r") ;
+        TEST_CHECK (f != NULL) ;
+        OK (LAGraph_MMRead_LowMemory (&B, f, msg)) ;
+        fclose (f) ;
+        bool ok ;
+        OK (LAGraph_Matrix_IsEqual (&ok, A, B, msg)) ;
+        TEST_CHECK (ok) ;
+        OK (GrB_free (&A)) ;
+        OK (GrB_free (&B)) ;
+    }
+
+    LAGraph_Finalize (msg) ;
+}
+
+//------------------------------------------------------------------------------
+// test_MMRead_LowMemory_failures: check error handling
+//------------------------------------------------------------------------------
+
+typedef struct
+{
+    int error ;
+    const char *name ;
+}
+mangled_matrix_info ;
+
+const mangled_matrix_info mangled_files [ ] =
+{
+//  error             filename              how the matrix is mangled
+    LAGRAPH_IO_ERROR, "mangled10.mtx",      // truncated
+    LAGRAPH_IO_ERROR, "mangled11.mtx",      // entries mangled
+    LAGRAPH_IO_ERROR, "mangled12.mtx",      // entries mangled
+    GrB_INDEX_OUT_OF_BOUNDS, "mangled13.mtx",// indices out of range
+    GrB_INVALID_VALUE, "mangled14.mtx",     // duplicate entries
+    LAGRAPH_IO_ERROR, "mangled_int8.mtx",   // entry value out of range
+    0, "",
+} ;
+
+void test_MMRead_LowMemory_failures (void)
+{
+    LAGraph_Init (msg) ;
+
+    TEST_CHECK (LAGraph_MMRead_LowMemory (NULL, NULL, msg)
+        == GrB_NULL_POINTER) ;
+    TEST_CHECK (LAGraph_MMRead_LowMemory (&A, NULL, msg)
+        == GrB_NULL_POINTER) ;
+
+    for (int k = 0 ; ; k++)
+    {
+        const char *aname = mangled_files [k].name ;
+        if (strlen (aname) == 0) break ;
+        TEST_CASE (aname) ;
+        int error = mangled_files [k].error ;
+        snprintf (filename, LEN, LG_DATA_DIR "%s", aname) ;
+        FILE *f = fopen (filename, "r") ;
+        TEST_CHECK (f != NULL) ;
+        int status = LAGraph_MMRead_LowMemory (&A, f, msg) ;
+        printf ("\nerror expected: %d %d [%s]", error, status, msg) ;
+        TEST_CHECK (status == error) ;
+        fclose (f) ;
+        TEST_CHECK (A == NULL) ;
+    }
+
+    LAGraph_Finalize (msg) ;
+}
+
+//****************************************************************************
+
+TEST_LIST = {
+    {"MMRead_LowMemory", test_MMRead_LowMemory},
+    {"MMRead_LowMemory_failures", test_MMRead_LowMemory_failures},
+    {NULL, NULL}
+};
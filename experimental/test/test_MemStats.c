@@ -0,0 +1,159 @@
+//----------------------------------------------------------------------------
+// LAGraph/experimental/test/test_MemStats.c: test LAGraph_MemStats
+// ----------------------------------------------------------------------------
+
+// LAGraph, (c) 2019-2022 by The LAGraph Contributors, All Rights Reserved.
+// SPDX-License-Identifier: BSD-2-Clause
+//
+// For additional details (including references to third party source code and
+// other files) see the LICENSE file or contact permission@sei.cmu.edu. See
+// Contributors.txt for a full list of contributors. Created, in part, with
+// funding and support from the U.S. Government (see Acknowledgments.txt file).
+// DM22-0790
+
+//-----------------------------------------------------------------------------
+
+#include <stdio.h>
+#include <acutest.h>
+#include <LAGraphX.h>
+#include <LAGraph_test.h>
+
+char msg [LAGRAPH_MSG_LEN] ;
+LAGraph_Graph G = NULL ;
+GrB_Matrix A = NULL ;
+GrB_Vector level = NULL, parent = NULL ;
+
+#define LEN 512
+char filename [LEN+1] ;
+
+//------------------------------------------------------------------------------
+// test_MemStats_scope: statistics of nested scopes
+//------------------------------------------------------------------------------
+
+void test_MemStats_scope (void)
+{
+    LAGraph_MemStats outer, inner, s ;
+    OK (LAGraph_MemStats_Begin (&outer, msg)) ;
+
+    void *p = LAGraph_MemStats_malloc (1000) ;
+    TEST_CHECK (p != NULL) ;
+
+    OK (LAGraph_MemStats_Begin (&inner, msg)) ;
+    void *q = LAGraph_MemStats_calloc (10, 300) ;
+    TEST_CHECK (q != NULL) ;
+    q = LAGraph_MemStats_realloc (q, 5000) ;
+    TEST_CHECK (q != NULL) ;
+    LAGraph_MemStats_free (q) ;
+    OK (LAGraph_MemStats_End (&inner, "inner", msg)) ;
+
+    TEST_CHECK (inner.ncalls == 1) ;
+    TEST_CHECK (inner.nmalloc == 1) ;
+    TEST_CHECK (inner.nfree == 1) ;
+    TEST_CHECK (inner.bytes == 5000) ;
+    TEST_CHECK (inner.in_use == 0) ;
+    TEST_CHECK (inner.peak == 5000) ;
+
+    LAGraph_MemStats_free (p) ;
+    OK (LAGraph_MemStats_End (&outer, "outer", msg)) ;
+
+    TEST_CHECK (outer.nmalloc == 2) ;
+    TEST_CHECK (outer.nfree == 2) ;
+    TEST_CHECK (outer.bytes == 6000) ;
+    TEST_CHECK (outer.in_use == 0) ;
+    TEST_CHECK (outer.peak == 6000) ;
+
+    // the same scope, again
+    OK (LAGraph_MemStats_Begin (&inner, msg)) ;
+    q = LAGraph_MemStats_malloc (100) ;
+    LAGraph_MemStats_free (q) ;
+    OK (LAGraph_MemStats_End (&inner, "inner", msg)) ;
+    TEST_CHECK (inner.peak == 100) ;
+
+    OK (LAGraph_MemStats_Query (&s, "inner", msg)) ;
+    TEST_CHECK (s.ncalls == 2) ;
+    TEST_CHECK (s.nmalloc == 2) ;
+    TEST_CHECK (s.bytes == 5100) ;
+    TEST_CHECK (s.peak == 5000) ;
+    OK (LAGraph_MemStats_Query (&s, "nothing", msg)) ;
+    TEST_CHECK (s.ncalls == 0) ;
+    OK (LAGraph_MemStats_Query (&s, NULL, msg)) ;
+    TEST_CHECK (s.nmalloc == 3) ;
+    TEST_CHECK (s.in_use == 0) ;
+    TEST_CHECK (s.peak == 6000) ;
+
+    OK (LAGraph_MemStats_Reset (msg)) ;
+    OK (LAGraph_MemStats_Query (&s, NULL, msg)) ;
+    TEST_CHECK (s.nmalloc == 0 && s.peak == 0) ;
+    OK (LAGraph_MemStats_Query (&s, "inner", msg)) ;
+    TEST_CHECK (s.ncalls == 0) ;
+
+    // errors
+    TEST_CHECK (LAGraph_MemStats_calloc (SIZE_MAX, 16) == NULL) ;
+    int result = LAGraph_MemStats_Begin (NULL, msg) ;
+    TEST_CHECK (result == GrB_NULL_POINTER) ;
+    result = LAGraph_MemStats_End (NULL, NULL, msg) ;
+    TEST_CHECK (result == GrB_NULL_POINTER) ;
+    result = LAGraph_MemStats_SetAllocator (NULL, realloc, free, msg) ;
+    TEST_CHECK (result == GrB_NULL_POINTER) ;
+}
+
+//------------------------------------------------------------------------------
+// test_MemStats_Init: statistics of LAGraph and GraphBLAS, with the pool
+//------------------------------------------------------------------------------
+
+void test_MemStats_Init (void)
+{
+    OK (LAGraph_MemStats_SetAllocator (LAGraph_Pool_malloc,
+        LAGraph_Pool_realloc, LAGraph_Pool_free, msg)) ;
+    OK (LAGr_Init (GrB_NONBLOCKING, LAGraph_MemStats_malloc,
+        LAGraph_MemStats_calloc, LAGraph_MemStats_realloc,
+        LAGraph_MemStats_free, msg)) ;
+
+    snprintf (filename, LEN, LG_DATA_DIR "%s", "karate.mtx") ;
+    FILE *f = fopen (filename, "r") ;
+    TEST_CHECK (f != NULL) ;
+    OK (LAGraph_MMRead (&A, f, msg)) ;
+    fclose (f) ;
+    OK (LAGraph_New (&G, &A, LAGraph_ADJACENCY_UNDIRECTED, msg)) ;
+
+    // the allocator cannot be changed while blocks are in use
+    int result = LAGraph_MemStats_SetAllocator (malloc, realloc, free, msg) ;
+    TEST_CHECK (result == GrB_INVALID_VALUE) ;
+
+    GrB_Index n ;
+    OK (GrB_Matrix_nrows (&n, G->A)) ;
+    for (GrB_Index src = 0 ; src < n ; src++)
+    {
+        LAGraph_MemStats stats ;
+        OK (LAGraph_MemStats_Begin (&stats, msg)) ;
+        OK (LAGr_BreadthFirstSearch (&level, &parent, G, src, msg)) ;
+        OK (LAGraph_MemStats_End (&stats, "bfs", msg)) ;
+        TEST_CHECK (stats.nmalloc > 0) ;
+        TEST_CHECK (stats.peak > 0) ;
+        TEST_CHECK (stats.peak <= stats.bytes) ;
+        // level and parent are still allocated
+        TEST_CHECK (stats.in_use > 0) ;
+        OK (GrB_free (&level)) ;
+        OK (GrB_free (&parent)) ;
+    }
+
+    LAGraph_MemStats s ;
+    OK (LAGraph_MemStats_Query (&s, "bfs", msg)) ;
+    TEST_CHECK (s.ncalls == (int64_t) n) ;
+    TEST_CHECK (s.nmalloc > 0) ;
+    OK (LAGraph_MemStats_Query (&s, NULL, msg)) ;
+    TEST_CHECK (s.peak > 0) ;
+    TEST_CHECK (s.in_use > 0) ;
+
+    OK (LAGraph_Delete (&G, msg)) ;
+    OK (LAGraph_Finalize (msg)) ;
+    OK (LAGraph_Pool_Release (msg)) ;
+}
+
+//****************************************************************************
+
+TEST_LIST = {
+    {"MemStats_scope", test_MemStats_scope},
+    {"MemStats_Init", test_MemStats_Init},
+    {NULL, NULL}
+};
@@ -0,0 +1,192 @@
+//----------------------------------------------------------------------------
+// LAGraph/experimental/test/test_MultiSourceBFS.c: test LAGraph_MultiSourceBFS
+// ----------------------------------------------------------------------------
+
+// LAGraph, (c) 2019-2022 by The LAGraph Contributors, All Rights Reserved.
+// SPDX-License-Identifier: BSD-2-Clause
+//
+// For additional details (including references to third party source code and
+// other files) see the LICENSE file or contact permission@sei.cmu.edu. See
+// Contributors.txt for a full list of contributors. Created, in part, with
+// funding and support from the U.S. Government (see Acknowledgments.txt file).
+// DM22-0790
+
+//-----------------------------------------------------------------------------
+
+#include <stdio.h>
+#include <acutest.h>
+#include <LAGraphX.h>
+#include <LAGraph_test.h>
+
+char msg [LAGRAPH_MSG_LEN] ;
+LAGraph_Graph G = NULL ;
+GrB_Matrix A = NULL, level = NULL, parent = NULL ;
+GrB_Vector level1 = NULL, w = NULL, v = NULL, p = NULL ;
+
+#define LEN 512
+char filename [LEN+1] ;
+
+typedef struct
+{
+    LAGraph_Kind kind ;
+    const char *name ;
+}
+matrix_info ;
+
+const matrix_info files [ ] =
+{
+    { LAGraph_ADJACENCY_UNDIRECTED, "A.mtx" },
+    { LAGraph_ADJACENCY_DIRECTED,   "cover.mtx" },
+    { LAGraph_ADJACENCY_UNDIRECTED, "jagmesh7.mtx" },
+    { LAGraph_ADJACENCY_DIRECTED,   "ldbc-directed-example.mtx" },
+    { LAGraph_ADJACENCY_DIRECTED,   "msf1.mtx" },
+    { LAGraph_ADJACENCY_DIRECTED,   "olm1000.mtx" },
+    { LAGraph_ADJACENCY_UNDIRECTED, "bcsstk13.mtx" },
+    { LAGraph_ADJACENCY_DIRECTED,   "cryg2500.mtx" },
+    { LAGraph_ADJACENCY_DIRECTED,   "west0067.mtx" },
+    { LAGraph_ADJACENCY_UNDIRECTED, "karate.mtx" },
+    { LAGraph_ADJACENCY_UNDIRECTED, "pushpull.mtx" },
+    { LAGRAPH_UNKNOWN, "" },
+} ;
+
+//------------------------------------------------------------------------------
+// check_rows: check each row of level and parent against a single-source BFS
+//------------------------------------------------------------------------------
+
+static void check_rows (GrB_Index *sources, int64_t ns, GrB_Index n)
+{
+    for (int64_t s = 0 ; s < ns ; s++)
+    {
+        // v = level (s,:) and p = parent (s,:)
+        OK (GrB_Vector_new (&v, GrB_INT64, n)) ;
+        OK (GrB_Vector_new (&p, GrB_INT64, n)) ;
+        if (level != NULL)
+        {
+            OK (GrB_Col_extract (v, NULL, NULL, level, GrB_ALL, n, s,
+                GrB_DESC_T0)) ;
+        }
+        if (parent != NULL)
+        {
+            OK (GrB_Col_extract (p, NULL, NULL, parent, GrB_ALL, n, s,
+                GrB_DESC_T0)) ;
+        }
+        OK (LG_check_bfs ((level == NULL) ? NULL : v,
+            (parent == NULL) ? NULL : p, G, sources [s], msg)) ;
+
+        // the levels are unique, and must match a single-source BFS
+        if (level != NULL)
+        {
+            bool ok ;
+            OK (LAGr_BreadthFirstSearch (&level1, NULL, G, sources [s], msg)) ;
+            // w = (int64) level1
+            OK (GrB_Vector_new (&w, GrB_INT64, n)) ;
+            OK (GrB_assign (w, NULL, NULL, level1, GrB_ALL, n, NULL)) ;
+            OK (LAGraph_Vector_IsEqual (&ok, v, w, msg)) ;
+            TEST_CHECK (ok) ;
+            OK (GrB_free (&level1)) ;
+            OK (GrB_free (&w)) ;
+        }
+        OK (GrB_free (&v)) ;
+        OK (GrB_free (&p)) ;
+    }
+}
+
+//------------------------------------------------------------------------------
+// test_MultiSourceBFS: compare with LAGr_BreadthFirstSearch
+//------------------------------------------------------------------------------
+
+void test_MultiSourceBFS (void)
+{
+    LAGraph_Init (msg) ;
+
+    for (int k = 0 ; ; k++)
+    {
+        const char *aname = files [k].name ;
+        if (strlen (aname) == 0) break ;
+        LAGraph_Kind kind = files [k].kind ;
+        TEST_CASE (aname) ;
+        printf ("\nMatrix: %s\n", aname) ;
+        snprintf (filename, LEN, LG_DATA_DIR "%s", aname) ;
+        FILE *f = fopen (filename, "r") ;
+        TEST_CHECK (f != NULL) ;
+        OK (LAGraph_MMRead (&A, f, msg)) ;
+        OK (fclose (f)) ;
+        OK (LAGraph_New (&G, &A, kind, msg)) ;
+        GrB_Index n ;
+        OK (GrB_Matrix_nrows (&n, G->A)) ;
+
+        // sources spread over the graph, with a duplicate
+        GrB_Index sources [17] ;
+        int64_t ns = 16 ;
+        for (int64_t s = 0 ; s < ns ; s++)
+        {
+            sources [s] = (s * n) / ns ;
+        }
+        sources [ns++] = sources [3] ;
+
+        for (int how = 0 ; how < 2 ; how++)
+        {
+            if (how == 1)
+            {
+                // with push/pull
+                OK (LAGraph_Cached_Ensure (G, LAGRAPH_CACHE_AT |
+                    LAGRAPH_CACHE_OUT_DEGREE, msg)) ;
+            }
+
+            OK (LAGraph_MultiSourceBFS (&level, &parent, G, sources, ns,
+                msg)) ;
+            check_rows (sources, ns, n) ;
+            OK (GrB_free (&level)) ;
+            OK (GrB_free (&parent)) ;
+
+            OK (LAGraph_MultiSourceBFS (&level, NULL, G, sources, ns, msg)) ;
+            check_rows (sources, ns, n) ;
+            OK (GrB_free (&level)) ;
+
+            OK (LAGraph_MultiSourceBFS (NULL, &parent, G, sources, 1, msg)) ;
+            check_rows (sources, 1, n) ;
+            OK (GrB_free (&parent)) ;
+        }
+
+        OK (LAGraph_Delete (&G, msg)) ;
+    }
+
+    LAGraph_Finalize (msg) ;
+}
+
+//------------------------------------------------------------------------------
+// test_MultiSourceBFS_errors
+//------------------------------------------------------------------------------
+
+void test_MultiSourceBFS_errors (void)
+{
+    LAGraph_Init (msg) ;
+    snprintf (filename, LEN, LG_DATA_DIR "%s", "karate.mtx") ;
+    FILE *f = fopen (filename, "r") ;
+    TEST_CHECK (f != NULL) ;
+    OK (LAGraph_MMRead (&A, f, msg)) ;
+    OK (fclose (f)) ;
+    OK (LAGraph_New (&G, &A, LAGraph_ADJACENCY_UNDIRECTED, msg)) ;
+
+    GrB_Index sources [2] = { 0, 34 } ;
+    int result = LAGraph_MultiSourceBFS (NULL, NULL, G, sources, 1, msg) ;
+    TEST_CHECK (result == GrB_NULL_POINTER) ;
+    result = LAGraph_MultiSourceBFS (&level, NULL, G, NULL, 1, msg) ;
+    TEST_CHECK (result == GrB_NULL_POINTER) ;
+    result = LAGraph_MultiSourceBFS (&level, NULL, G, sources, 0, msg) ;
+    TEST_CHECK (result == GrB_INVALID_VALUE) ;
+    result = LAGraph_MultiSourceBFS (&level, NULL, G, sources, 2, msg) ;
+    TEST_CHECK (result == GrB_INVALID_INDEX) ;
+    TEST_CHECK (level == NULL) ;
+
+    OK (LAGraph_Delete (&G, msg)) ;
+    LAGraph_Finalize (msg) ;
+}
+
+//****************************************************************************
+
+TEST_LIST = {
+    {"MultiSourceBFS", test_MultiSourceBFS},
+    {"MultiSourceBFS_errors", test_MultiSourceBFS_errors},
+    {NULL, NULL}
+};
@@ -0,0 +1,165 @@
+//----------------------------------------------------------------------------
+// LAGraph/experimental/test/test_MultiSourceBFS_BitParallel.c: test
+// LAGraph_MultiSourceBFS_BitParallel
+// ----------------------------------------------------------------------------
+
+// LAGraph, (c) 2019-2022 by The LAGraph Contributors, All Rights Reserved.
+// SPDX-License-Identifier: BSD-2-Clause
+//
+// For additional details (including references to third party source code and
+// other files) see the LICENSE file or contact permission@sei.cmu.edu. See
+// Contributors.txt for a full list of contributors. Created, in part, with
+// funding and support from the U.S. Government (see Acknowledgments.txt file).
+// DM22-0790
+
+//-----------------------------------------------------------------------------
+
+#include <stdio.h>
+#include <acutest.h>
+#include <LAGraphX.h>
+#include <LAGraph_test.h>
+
+char msg [LAGRAPH_MSG_LEN] ;
+LAGraph_Graph G = NULL ;
+GrB_Matrix A = NULL, level = NULL, level2 = NULL ;
+GrB_Vector v = NULL ;
+
+#define LEN 512
+char filename [LEN+1] ;
+
+typedef struct
+{
+    LAGraph_Kind kind ;
+    const char *name ;
+}
+matrix_info ;
+
+const matrix_info files [ ] =
+{
+    { LAGraph_ADJACENCY_UNDIRECTED, "A.mtx" },
+    { LAGraph_ADJACENCY_DIRECTED,   "cover.mtx" },
+    { LAGraph_ADJACENCY_UNDIRECTED, "jagmesh7.mtx" },
+    { LAGraph_ADJACENCY_DIRECTED,   "ldbc-directed-example.mtx" },
+    { LAGraph_ADJACENCY_DIRECTED,   "msf1.mtx" },
+    { LAGraph_ADJACENCY_DIRECTED,   "olm1000.mtx" },
+    { LAGraph_ADJACENCY_UNDIRECTED, "bcsstk13.mtx" },
+    { LAGraph_ADJACENCY_DIRECTED,   "cryg2500.mtx" },
+    { LAGraph_ADJACENCY_DIRECTED,   "west0067.mtx" },
+    { LAGraph_ADJACENCY_UNDIRECTED, "karate.mtx" },
+    { LAGraph_ADJACENCY_UNDIRECTED, "pushpull.mtx" },
+    { LAGRAPH_UNKNOWN, "" },
+} ;
+
+//------------------------------------------------------------------------------
+// test_MultiSourceBFS_BitParallel: compare with LAGraph_MultiSourceBFS
+//------------------------------------------------------------------------------
+
+void test_MultiSourceBFS_BitParallel (void)
+{
+    LAGraph_Init (msg) ;
+
+    for (int k = 0 ; ; k++)
+    {
+        const char *aname = files [k].name ;
+        if (strlen (aname) == 0) break ;
+        LAGraph_Kind kind = files [k].kind ;
+        TEST_CASE (aname) ;
+        printf ("\nMatrix: %s\n", aname) ;
+        snprintf (filename, LEN, LG_DATA_DIR "%s", aname) ;
+        FILE *f = fopen (filename, "r") ;
+        TEST_CHECK (f != NULL) ;
+        OK (LAGraph_MMRead (&A, f, msg)) ;
+        OK (fclose (f)) ;
+        OK (LAGraph_New (&G, &A, kind, msg)) ;
+        GrB_Index n ;
+        OK (GrB_Matrix_nrows (&n, G->A)) ;
+
+        // 600 sources, so that more than one pass is done, and with
+        // duplicates if n < 600
+        #define NS 600
+        GrB_Index sources [NS] ;
+        for (int64_t s = 0 ; s < NS ; s++)
+        {
+            sources [s] = (s * 7919) % n ;
+        }
+
+        for (int how = 0 ; how < 2 ; how++)
+        {
+            if (how == 1)
+            {
+                // with push/pull
+                OK (LAGraph_Cached_Ensure (G, LAGRAPH_CACHE_AT |
+                    LAGRAPH_CACHE_OUT_DEGREE, msg)) ;
+            }
+
+            for (int64_t ns = 1 ; ns <= NS ; ns += 131)
+            {
+                // compare with the level matrix of LAGraph_MultiSourceBFS
+                OK (LAGraph_MultiSourceBFS_BitParallel (&level, G, sources,
+                    ns, msg)) ;
+                OK (LAGraph_MultiSourceBFS (&level2, NULL, G, sources, ns,
+                    msg)) ;
+                bool ok ;
+                OK (LAGraph_Matrix_IsEqual (&ok, level, level2, msg)) ;
+                TEST_CHECK (ok) ;
+
+                // check the first and last rows with LG_check_bfs
+                int64_t rows [2] = { 0, ns-1 } ;
+                for (int r = 0 ; r < 2 ; r++)
+                {
+                    int64_t s = rows [r] ;
+                    OK (GrB_Vector_new (&v, GrB_INT64, n)) ;
+                    OK (GrB_Col_extract (v, NULL, NULL, level, GrB_ALL, n, s,
+                        GrB_DESC_T0)) ;
+                    OK (LG_check_bfs (v, NULL, G, sources [s], msg)) ;
+                    OK (GrB_free (&v)) ;
+                }
+                OK (GrB_free (&level)) ;
+                OK (GrB_free (&level2)) ;
+            }
+        }
+
+        OK (LAGraph_Delete (&G, msg)) ;
+    }
+
+    LAGraph_Finalize (msg) ;
+}
+
+//------------------------------------------------------------------------------
+// test_MultiSourceBFS_BitParallel_errors
+//------------------------------------------------------------------------------
+
+void test_MultiSourceBFS_BitParallel_errors (void)
+{
+    LAGraph_Init (msg) ;
+    snprintf (filename, LEN, LG_DATA_DIR "%s", "karate.mtx") ;
+    FILE *f = fopen (filename, "r") ;
+    TEST_CHECK (f != NULL) ;
+    OK (LAGraph_MMRead (&A, f, msg)) ;
+    OK (fclose (f)) ;
+    OK (LAGraph_New (&G, &A, LAGraph_ADJACENCY_UNDIRECTED, msg)) ;
+
+    GrB_Index sources [2] = { 0, 34 } ;
+    int result = LAGraph_MultiSourceBFS_BitParallel (NULL, G, sources, 1,
+        msg) ;
+    TEST_CHECK (result == GrB_NULL_POINTER) ;
+    result = LAGraph_MultiSourceBFS_BitParallel (&level, G, NULL, 1, msg) ;
+    TEST_CHECK (result == GrB_NULL_POINTER) ;
+    result = LAGraph_MultiSourceBFS_BitParallel (&level, G, sources, 0, msg) ;
+    TEST_CHECK (result == GrB_INVALID_VALUE) ;
+    result = LAGraph_MultiSourceBFS_BitParallel (&level, G, sources, 2, msg) ;
+    TEST_CHECK (result == GrB_INVALID_INDEX) ;
+    TEST_CHECK (level == NULL) ;
+
+    OK (LAGraph_Delete (&G, msg)) ;
+    LAGraph_Finalize (msg) ;
+}
+
+//****************************************************************************
+
+TEST_LIST = {
+    {"MultiSourceBFS_BitParallel", test_MultiSourceBFS_BitParallel},
+    {"MultiSourceBFS_BitParallel_errors",
+        test_MultiSourceBFS_BitParallel_errors},
+    {NULL, NULL}
+};
@@ -0,0 +1,240 @@
+//----------------------------------------------------------------------------
+// LAGraph/experimental/test/test_Pool.c: test LAGraph_Pool_* and LAGraph_Arena
+// ----------------------------------------------------------------------------
+
+// LAGraph, (c) 2019-2022 by The LAGraph Contributors, All Rights Reserved.
+// SPDX-License-Identifier: BSD-2-Clause
+//
+// For additional details (including references to third party source code and
+// other files) see the LICENSE file or contact permission@sei.cmu.edu. See
+// Contributors.txt for a full list of contributors. Created, in part, with
+// funding and support from the U.S. Government (see Acknowledgments.txt file).
+// DM22-0790
+
+//-----------------------------------------------------------------------------
+
+#include <stdio.h>
+#include <acutest.h>
+#include <LAGraphX.h>
+#include <LAGraph_test.h>
+
+char msg [LAGRAPH_MSG_LEN] ;
+LAGraph_Graph G = NULL ;
+GrB_Matrix A = NULL ;
+GrB_Vector level = NULL, parent = NULL ;
+
+#define LEN 512
+char filename [LEN+1] ;
+
+//------------------------------------------------------------------------------
+// test_Pool: allocate and free blocks from the pool
+//------------------------------------------------------------------------------
+
+void test_Pool (void)
+{
+    // malloc and free blocks of many sizes, each size many times so that
+    // blocks are reused
+    for (int trial = 0 ; trial < 4 ; trial++)
+    {
+        for (size_t size = 0 ; size <= (4 << 20) ; size = 2*size + 7)
+        {
+            uint8_t *p [20] ;
+            for (int k = 0 ; k < 20 ; k++)
+            {
+                p [k] = LAGraph_Pool_malloc (size) ;
+                TEST_CHECK (p [k] != NULL) ;
+                TEST_CHECK (((size_t) p [k]) % 16 == 0) ;
+                memset (p [k], k, size) ;
+            }
+            for (int k = 0 ; k < 20 ; k++)
+            {
+                // each block is intact
+                for (size_t i = 0 ; i < size ; i += 61)
+                {
+                    TEST_CHECK (p [k][i] == (uint8_t) k) ;
+                }
+                LAGraph_Pool_free (p [k]) ;
+            }
+        }
+    }
+
+    // calloc
+    int64_t *x = LAGraph_Pool_calloc (1000, sizeof (int64_t)) ;
+    TEST_CHECK (x != NULL) ;
+    for (int k = 0 ; k < 1000 ; k++)
+    {
+        TEST_CHECK (x [k] == 0) ;
+        x [k] = k ;
+    }
+
+    // realloc: grow within the same size class, then to larger ones
+    for (size_t n = 1000 ; n <= 1000000 ; n = (n * 3) / 2)
+    {
+        x = LAGraph_Pool_realloc (x, n * sizeof (int64_t)) ;
+        TEST_CHECK (x != NULL) ;
+        for (int k = 0 ; k < 1000 ; k++)
+        {
+            TEST_CHECK (x [k] == k) ;
+        }
+    }
+
+    // realloc: shrink
+    x = LAGraph_Pool_realloc (x, 10 * sizeof (int64_t)) ;
+    TEST_CHECK (x != NULL) ;
+    for (int k = 0 ; k < 10 ; k++)
+    {
+        TEST_CHECK (x [k] == k) ;
+    }
+    LAGraph_Pool_free (x) ;
+
+    // realloc of NULL, free of NULL, and calloc with integer overflow
+    x = LAGraph_Pool_realloc (NULL, 100) ;
+    TEST_CHECK (x != NULL) ;
+    LAGraph_Pool_free (x) ;
+    LAGraph_Pool_free (NULL) ;
+    x = LAGraph_Pool_calloc (SIZE_MAX, 16) ;
+    TEST_CHECK (x == NULL) ;
+
+    // blocks allocated by one thread and freed by another, enough of them to
+    // spill over from the thread caches to the global free lists
+    #define NBLOCKS 4096
+    void *P [NBLOCKS] ;
+    #pragma omp parallel for num_threads(4) schedule(static,1)
+    for (int k = 0 ; k < NBLOCKS ; k++)
+    {
+        P [k] = LAGraph_Pool_malloc (8 * (k % 300)) ;
+    }
+    for (int k = 0 ; k < NBLOCKS ; k++)
+    {
+        TEST_CHECK (P [k] != NULL) ;
+    }
+    #pragma omp parallel for num_threads(4) schedule(static,3)
+    for (int k = 0 ; k < NBLOCKS ; k++)
+    {
+        LAGraph_Pool_free (P [k]) ;
+    }
+
+    OK (LAGraph_Pool_Release (msg)) ;
+
+    // the pool can still be used after it is released
+    x = LAGraph_Pool_malloc (100) ;
+    TEST_CHECK (x != NULL) ;
+    LAGraph_Pool_free (x) ;
+    OK (LAGraph_Pool_Release (msg)) ;
+}
+
+//------------------------------------------------------------------------------
+// test_Pool_Init: use the pool for all of LAGraph and GraphBLAS
+//------------------------------------------------------------------------------
+
+void test_Pool_Init (void)
+{
+    OK (LAGr_Init (GrB_NONBLOCKING, LAGraph_Pool_malloc, LAGraph_Pool_calloc,
+        LAGraph_Pool_realloc, LAGraph_Pool_free, msg)) ;
+
+    snprintf (filename, LEN, LG_DATA_DIR "%s", "karate.mtx") ;
+    FILE *f = fopen (filename, "r") ;
+    TEST_CHECK (f != NULL) ;
+    OK (LAGraph_MMRead (&A, f, msg)) ;
+    fclose (f) ;
+    OK (LAGraph_New (&G, &A, LAGraph_ADJACENCY_UNDIRECTED, msg)) ;
+
+    // many BFS queries, reusing the same workspace from the pool
+    GrB_Index n ;
+    OK (GrB_Matrix_nrows (&n, G->A)) ;
+    for (int trial = 0 ; trial < 4 ; trial++)
+    {
+        for (GrB_Index src = 0 ; src < n ; src++)
+        {
+            OK (LAGr_BreadthFirstSearch (&level, &parent, G, src, msg)) ;
+            OK (LG_check_bfs (level, parent, G, src, msg)) ;
+            OK (GrB_free (&level)) ;
+            OK (GrB_free (&parent)) ;
+        }
+    }
+
+    OK (LAGraph_Delete (&G, msg)) ;
+    OK (LAGraph_Finalize (msg)) ;
+    OK (LAGraph_Pool_Release (msg)) ;
+}
+
+//------------------------------------------------------------------------------
+// test_Arena: allocate workspace from an arena
+//------------------------------------------------------------------------------
+
+void test_Arena (void)
+{
+    LAGraph_Init (msg) ;
+    LAGraph_Arena arena = NULL ;
+    OK (LAGraph_Arena_New (&arena, 1000, msg)) ;
+
+    for (int iter = 0 ; iter < 10 ; iter++)
+    {
+        // allocate blocks, some larger than a chunk
+        int64_t *W [50] ;
+        for (int k = 0 ; k < 50 ; k++)
+        {
+            size_t n = (k % 7 == 0) ? 500 : (k + iter) ;
+            OK (LAGraph_Arena_Malloc ((void **) &(W [k]), arena, n,
+                sizeof (int64_t), msg)) ;
+            TEST_CHECK (((size_t) W [k]) % 16 == 0) ;
+            for (size_t i = 0 ; i < n ; i++)
+            {
+                W [k][i] = k ;
+            }
+        }
+
+        // blocks do not overlap
+        for (int k = 0 ; k < 50 ; k++)
+        {
+            size_t n = (k % 7 == 0) ? 500 : (k + iter) ;
+            for (size_t i = 0 ; i < n ; i++)
+            {
+                TEST_CHECK (W [k][i] == k) ;
+            }
+        }
+
+        bool *Z ;
+        OK (LAGraph_Arena_Calloc ((void **) &Z, arena, 3000, sizeof (bool),
+            msg)) ;
+        for (int i = 0 ; i < 3000 ; i++)
+        {
+            TEST_CHECK (!Z [i]) ;
+        }
+
+        // release all the workspace at once
+        OK (LAGraph_Arena_Reset (arena, msg)) ;
+    }
+
+    OK (LAGraph_Arena_Delete (&arena, msg)) ;
+    TEST_CHECK (arena == NULL) ;
+    OK (LAGraph_Arena_Delete (&arena, msg)) ;
+    OK (LAGraph_Arena_Delete (NULL, msg)) ;
+
+    // default chunk size, and errors
+    OK (LAGraph_Arena_New (&arena, 0, msg)) ;
+    void *p = NULL ;
+    int result = LAGraph_Arena_Malloc (&p, arena, SIZE_MAX, 16, msg) ;
+    TEST_CHECK (result == GrB_OUT_OF_MEMORY) ;
+    TEST_CHECK (p == NULL) ;
+    result = LAGraph_Arena_Malloc (NULL, arena, 1, 1, msg) ;
+    TEST_CHECK (result == GrB_NULL_POINTER) ;
+    result = LAGraph_Arena_Malloc (&p, NULL, 1, 1, msg) ;
+    TEST_CHECK (result == GrB_NULL_POINTER) ;
+    result = LAGraph_Arena_Reset (NULL, msg) ;
+    TEST_CHECK (result == GrB_NULL_POINTER) ;
+    result = LAGraph_Arena_New (NULL, 0, msg) ;
+    TEST_CHECK (result == GrB_NULL_POINTER) ;
+    OK (LAGraph_Arena_Delete (&arena, msg)) ;
+
+    LAGraph_Finalize (msg) ;
+}
+
+//****************************************************************************
+
+TEST_LIST = {
+    {"Pool", test_Pool},
+    {"Pool_Init", test_Pool_Init},
+    {"Arena", test_Arena},
+    {NULL, NULL}
+};
@@ -160,9 +160,310 @@ void test_SSaveSet (void)
     LAGraph_Finalize (msg) ;
 }
 
+//****************************************************************************
+void test_SIndex (void)
+{
+    LAGraph_Init (msg) ;
+
+    // save a few matrices in a single file
+    #define NSET 4
+    GrB_Matrix Set [NSET] ;
+    for (int k = 0 ; k < NSET ; k++)
+    {
+        snprintf (filename, LEN, LG_DATA_DIR "%s", files [k]) ;
+        FILE *f = fopen (filename, "r") ;
+        TEST_CHECK (f != NULL) ;
+        OK (LAGraph_MMRead (&(Set [k]), f, msg)) ;
+        fclose (f) ;
+    }
+    OK (LAGraph_SSaveSet ("index.lagraph", Set, NSET, "indexed", msg)) ;
+
+    // open the file and check its index
+    LAGraph_SIndex Index = NULL ;
+    OK (LAGraph_SOpen (&Index, "index.lagraph", msg)) ;
+    TEST_CHECK (Index != NULL) ;
+    TEST_CHECK (Index->ncontents == NSET) ;
+    TEST_CHECK (strcmp (Index->collection, "indexed") == 0) ;
+    TEST_CHECK (Index->offset [NSET] == Index->file_size) ;
+
+    // load the matrices in reverse order, by name and by index
+    for (int k = NSET-1 ; k >= 0 ; k--)
+    {
+        char name [64] ;
+        snprintf (name, 64, "A_%d", k) ;
+        int64_t kfound = -1 ;
+        OK (LAGraph_SFind (&kfound, Index, name, msg)) ;
+        TEST_CHECK (kfound == k) ;
+        OK (LAGraph_SLoadItem (&A, Index, kfound, msg)) ;
+        bool ok = false ;
+        OK (LAGraph_Matrix_IsEqual (&ok, A, Set [k], msg)) ;
+        TEST_CHECK (ok) ;
+        OK (GrB_free (&A)) ;
+
+        // read the blob and deserialize it
+        void *blob = NULL ;
+        GrB_Index blob_size = 0 ;
+        OK (LAGraph_SReadItem (&blob, &blob_size, Index, k, msg)) ;
+        TEST_CHECK (blob_size == Index->Contents [k].blob_size) ;
+        GrB_Type type = NULL ;
+        OK (LAGraph_TypeFromName (&type, Index->Contents [k].type_name, msg)) ;
+        OK (GrB_Matrix_deserialize (&A, type, blob, blob_size)) ;
+        OK (LAGraph_Matrix_IsEqual (&ok, A, Set [k], msg)) ;
+        TEST_CHECK (ok) ;
+        OK (GrB_free (&A)) ;
+        LAGraph_Free (&blob, NULL) ;
+    }
+
+    // error handling
+    int64_t kfound ;
+    int result = LAGraph_SFind (&kfound, Index, "no such matrix", msg) ;
+    TEST_CHECK (result == GrB_INVALID_INDEX) ;
+    TEST_CHECK (kfound == -1) ;
+    result = LAGraph_SLoadItem (&A, Index, NSET, msg) ;
+    TEST_CHECK (result == GrB_INVALID_INDEX) ;
+    TEST_CHECK (A == NULL) ;
+    result = LAGraph_SOpen (NULL, "index.lagraph", msg) ;
+    TEST_CHECK (result == GrB_NULL_POINTER) ;
+
+    size_t file_size = Index->file_size ;
+    OK (LAGraph_SClose (&Index, msg)) ;
+    TEST_CHECK (Index == NULL) ;
+
+    result = LAGraph_SOpen (&Index, "no_such_file.lagraph", msg) ;
+    TEST_CHECK (result == LAGRAPH_IO_ERROR) ;
+    TEST_CHECK (Index == NULL) ;
+
+    // truncated file: remove the last byte
+    char *buffer = malloc (file_size) ;
+    TEST_CHECK (buffer != NULL) ;
+    FILE *f = fopen ("index.lagraph", "rb") ;
+    TEST_CHECK (f != NULL) ;
+    TEST_CHECK (fread (buffer, sizeof (char), file_size, f) == file_size) ;
+    fclose (f) ;
+    f = fopen ("index.lagraph", "wb") ;
+    TEST_CHECK (f != NULL) ;
+    fwrite (buffer, sizeof (char), file_size - 1, f) ;
+    fclose (f) ;
+    free (buffer) ;
+    result = LAGraph_SOpen (&Index, "index.lagraph", msg) ;
+    printf ("\nresult %d, [%s]\n", result, msg) ;
+    TEST_CHECK (result == LAGRAPH_IO_ERROR) ;
+    TEST_CHECK (Index == NULL) ;
+    remove ("index.lagraph") ;
+
+    for (int k = 0 ; k < NSET ; k++)
+    {
+        OK (GrB_free (&(Set [k]))) ;
+    }
+    LAGraph_Finalize (msg) ;
+}
+
+//****************************************************************************
+void test_SLoadSet_Timed (void)
+{
+    LAGraph_Init (msg) ;
+    int save_nthreads_outer, save_nthreads_inner ;
+    OK (LAGraph_GetNumThreads (&save_nthreads_outer, &save_nthreads_inner,
+        msg)) ;
+
+    // save a set of matrices in a single file
+    GrB_Matrix *Set = NULL ;
+    OK (LAGraph_Malloc ((void **) &Set, NFILES, sizeof (GrB_Matrix), msg)) ;
+    for (int k = 0 ; k < NFILES ; k++)
+    {
+        snprintf (filename, LEN, LG_DATA_DIR "%s", files [k]) ;
+        FILE *f = fopen (filename, "r") ;
+        TEST_CHECK (f != NULL) ;
+        OK (LAGraph_MMRead (&(Set [k]), f, msg)) ;
+        fclose (f) ;
+    }
+    OK (LAGraph_SSaveSet ("timed.lagraph", Set, NFILES, "timed", msg)) ;
+
+    // load the set back in, deserializing 4 matrices at a time
+    OK (LAGraph_SetNumThreads (4, 1, msg)) ;
+    GrB_Matrix *Set2 = NULL ;
+    GrB_Index nmatrices = 0 ;
+    char *collection = NULL ;
+    double *Time = NULL ;
+    OK (LAGraph_SLoadSet_Timed ("timed.lagraph", &Set2, &nmatrices,
+        &collection, &Time, msg)) ;
+    TEST_CHECK (nmatrices == NFILES) ;
+    TEST_CHECK (Time != NULL) ;
+    TEST_CHECK (strcmp (collection, "timed") == 0) ;
+    for (int k = 0 ; k < NFILES ; k++)
+    {
+        bool ok ;
+        OK (LAGraph_Matrix_IsEqual (&ok, Set [k], Set2 [k], msg)) ;
+        TEST_CHECK (ok) ;
+        TEST_CHECK (Time [k] >= 0) ;
+    }
+
+    // error handling
+    int result = LAGraph_SLoadSet_Timed ("timed.lagraph", &Set2, &nmatrices,
+        &collection, NULL, msg) ;
+    TEST_CHECK (result == GrB_NULL_POINTER) ;
+    remove ("timed.lagraph") ;
+
+    LAGraph_SFreeSet (&Set, NFILES) ;
+    LAGraph_SFreeSet (&Set2, NFILES) ;
+    LAGraph_Free ((void **) &collection, NULL) ;
+    LAGraph_Free ((void **) &Time, NULL) ;
+    OK (LAGraph_SetNumThreads (save_nthreads_outer, save_nthreads_inner,
+        msg)) ;
+    LAGraph_Finalize (msg) ;
+}
+
+//****************************************************************************
+
+// check_scalar: check if two scalars are equal
+static void check_scalar (GrB_Scalar s1, GrB_Scalar s2)
+{
+    TEST_CHECK ((s1 == NULL) == (s2 == NULL)) ;
+    if (s1 == NULL || s2 == NULL) return ;
+    char type1 [LAGRAPH_MAX_NAME_LEN], type2 [LAGRAPH_MAX_NAME_LEN] ;
+    OK (LAGraph_Scalar_TypeName (type1, s1, msg)) ;
+    OK (LAGraph_Scalar_TypeName (type2, s2, msg)) ;
+    TEST_CHECK (strcmp (type1, type2) == 0) ;
+    double x1 = 0, x2 = 0 ;
+    OK (GrB_Scalar_extractElement_FP64 (&x1, s1)) ;
+    OK (GrB_Scalar_extractElement_FP64 (&x2, s2)) ;
+    TEST_CHECK (x1 == x2) ;
+}
+
+void test_SSaveGraph (void)
+{
+    LAGraph_Init (msg) ;
+
+    #if LAGRAPH_SUITESPARSE
+    const char *graphs [4] =
+        { "west0067.mtx", "karate.mtx", "matrix_int8.mtx", "LFAT5.mtx" } ;
+    for (int k = 0 ; k < 4 ; k++)
+    {
+        for (int cached = 0 ; cached <= 1 ; cached++)
+        {
+            // create the graph; west0067 and matrix_int8 are directed
+            TEST_CASE (graphs [k]) ;
+            snprintf (filename, LEN, LG_DATA_DIR "%s", graphs [k]) ;
+            FILE *f = fopen (filename, "r") ;
+            TEST_CHECK (f != NULL) ;
+            OK (LAGraph_MMRead (&A, f, msg)) ;
+            fclose (f) ;
+            LAGraph_Kind kind = (k == 0 || k == 2) ?
+                LAGraph_ADJACENCY_DIRECTED : LAGraph_ADJACENCY_UNDIRECTED ;
+            OK (LAGraph_New (&G, &A, kind, msg)) ;
+
+            // compute all cached properties of G, or none of them
+            if (cached)
+            {
+                if (kind == LAGraph_ADJACENCY_DIRECTED)
+                {
+                    OK (LAGraph_Cached_AT (G, msg)) ;
+                    OK (LAGraph_Cached_InDegree (G, msg)) ;
+                }
+                OK (LAGraph_Cached_OutDegree (G, msg)) ;
+                OK (LAGraph_Cached_IsSymmetricStructure (G, msg)) ;
+                OK (LAGraph_Cached_NSelfEdges (G, msg)) ;
+                OK (LAGraph_Cached_EMin (G, msg)) ;
+                OK (LAGraph_Cached_EMax (G, msg)) ;
+                OK (LAGraph_Cached_BFSThresholds (G, 0, msg)) ;
+                // a value that needs all 17 digits to be restored exactly
+                G->bfs_alpha /= 3 ;
+                OK (LAGraph_Cached_SSSPDelta (G, 4, msg)) ;
+            }
+
+            // save the graph and load it back in
+            OK (LAGraph_SSaveGraph ("graph.lagraph", G, "graph", msg)) ;
+            LAGraph_Graph G2 = NULL ;
+            OK (LAGraph_SLoadGraph (&G2, "graph.lagraph", msg)) ;
+            TEST_CHECK (G2 != NULL) ;
+
+            // check the graph and its cached properties
+            bool ok = false ;
+            TEST_CHECK (G2->kind == G->kind) ;
+            OK (LAGraph_Matrix_IsEqual (&ok, G2->A, G->A, msg)) ;
+            TEST_CHECK (ok) ;
+            TEST_CHECK ((G2->AT == NULL) == (G->AT == NULL)) ;
+            if (G->AT != NULL)
+            {
+                OK (LAGraph_Matrix_IsEqual (&ok, G2->AT, G->AT, msg)) ;
+                TEST_CHECK (ok) ;
+            }
+            TEST_CHECK ((G2->out_degree == NULL) == (G->out_degree == NULL)) ;
+            if (G->out_degree != NULL)
+            {
+                OK (LAGraph_Vector_IsEqual (&ok, G2->out_degree,
+                    G->out_degree, msg)) ;
+                TEST_CHECK (ok) ;
+            }
+            TEST_CHECK ((G2->in_degree == NULL) == (G->in_degree == NULL)) ;
+            if (G->in_degree != NULL)
+            {
+                OK (LAGraph_Vector_IsEqual (&ok, G2->in_degree,
+                    G->in_degree, msg)) ;
+                TEST_CHECK (ok) ;
+            }
+            TEST_CHECK (G2->is_symmetric_structure ==
+                G->is_symmetric_structure) ;
+            TEST_CHECK (G2->nself_edges == G->nself_edges) ;
+            TEST_CHECK (G2->emin_state == G->emin_state) ;
+            TEST_CHECK (G2->emax_state == G->emax_state) ;
+            check_scalar (G2->emin, G->emin) ;
+            check_scalar (G2->emax, G->emax) ;
+            TEST_CHECK (G2->bfs_alpha == G->bfs_alpha) ;
+            TEST_CHECK (G2->bfs_beta1 == G->bfs_beta1) ;
+            TEST_CHECK (G2->bfs_beta2 == G->bfs_beta2) ;
+            TEST_CHECK (G2->sssp_delta == G->sssp_delta) ;
+
+            OK (LAGraph_Delete (&G, msg)) ;
+            OK (LAGraph_Delete (&G2, msg)) ;
+        }
+    }
+
+    // a set of matrices is not a graph
+    GrB_Matrix Set [1] ;
+    snprintf (filename, LEN, LG_DATA_DIR "%s", "A.mtx") ;
+    FILE *f = fopen (filename, "r") ;
+    TEST_CHECK (f != NULL) ;
+    OK (LAGraph_MMRead (&(Set [0]), f, msg)) ;
+    fclose (f) ;
+    OK (LAGraph_SSaveSet ("graph.lagraph", Set, 1, "set", msg)) ;
+    int result = LAGraph_SLoadGraph (&G, "graph.lagraph", msg) ;
+    TEST_CHECK (result == LAGRAPH_IO_ERROR) ;
+    TEST_CHECK (G == NULL) ;
+
+    // a graph cannot be loaded as a set of matrices
+    OK (LAGraph_New (&G, &(Set [0]), LAGraph_ADJACENCY_DIRECTED, msg)) ;
+    OK (LAGraph_Cached_OutDegree (G, msg)) ;
+    OK (LAGraph_SSaveGraph ("graph.lagraph", G, "graph", msg)) ;
+    GrB_Matrix *Set2 = NULL ;
+    GrB_Index nmatrices = 0 ;
+    char *collection = NULL ;
+    result = LAGraph_SLoadSet ("graph.lagraph", &Set2, &nmatrices,
+        &collection, msg) ;
+    TEST_CHECK (result == GrB_NOT_IMPLEMENTED) ;
+    TEST_CHECK (Set2 == NULL && collection == NULL) ;
+    OK (LAGraph_Delete (&G, msg)) ;
+    remove ("graph.lagraph") ;
+    #endif
+
+    // error handling
+    int status = LAGraph_SSaveGraph ("graph.lagraph", NULL, "graph", msg) ;
+    TEST_CHECK (status == GrB_NULL_POINTER) ;
+    status = LAGraph_SLoadGraph (NULL, "graph.lagraph", msg) ;
+    TEST_CHECK (status == GrB_NULL_POINTER) ;
+    status = LAGraph_SLoadGraph (&G, "no_such_file.lagraph", msg) ;
+    TEST_CHECK (status == LAGRAPH_IO_ERROR || status == GrB_NOT_IMPLEMENTED) ;
+    TEST_CHECK (G == NULL) ;
+
+    LAGraph_Finalize (msg) ;
+}
+
 //****************************************************************************
 
 TEST_LIST = {
     {"SSaveSet", test_SSaveSet},
+    {"SIndex", test_SIndex},
+    {"SLoadSet_Timed", test_SLoadSet_Timed},
+    {"SSaveGraph", test_SSaveGraph},
     {NULL, NULL}
 };
@@ -310,15 +310,32 @@ void test_SWrite_errors (void)
     OK (LAGraph_SWrite_HeaderItem (f, LAGraph_matrix_kind, "A",
         "float", 0, blob_size, msg)) ;
 
+    // write a second copy of the matrix, with its size written later
+    int64_t pos = -1 ;
+    result = LAGraph_SWrite_HeaderItemReserve (f, LAGraph_matrix_kind, "B",
+        "float", 0, NULL, msg) ;
+    TEST_CHECK (result == GrB_NULL_POINTER) ;
+    OK (LAGraph_SWrite_HeaderItemReserve (f, LAGraph_matrix_kind, "B",
+        "float", 0, &pos, msg)) ;
+    TEST_CHECK (pos > 0) ;
+
     result = LAGraph_SWrite_HeaderEnd (NULL, msg) ;
     TEST_CHECK (result == GrB_NULL_POINTER) ;
 
     OK (LAGraph_SWrite_HeaderEnd (f, msg)) ;
 
-    // write the binary blob to the file then free the blob
+    // write the binary blob to the file twice then free the blob
+    OK (LAGraph_SWrite_Item (f, blob, blob_size, msg)) ;
     OK (LAGraph_SWrite_Item (f, blob, blob_size, msg)) ;
     LAGraph_Free (&blob, NULL) ;
 
+    // write the size of the second copy into the header
+    result = LAGraph_SWrite_HeaderItemSize (NULL, pos, blob_size, msg) ;
+    TEST_CHECK (result == GrB_NULL_POINTER) ;
+    result = LAGraph_SWrite_HeaderItemSize (f, -1, blob_size, msg) ;
+    TEST_CHECK (result == GrB_INVALID_VALUE) ;
+    OK (LAGraph_SWrite_HeaderItemSize (f, pos, blob_size, msg)) ;
+
     result = LAGraph_SWrite_Item (NULL, blob, blob_size, msg) ;
     TEST_CHECK (result == GrB_NULL_POINTER) ;
 
@@ -355,11 +372,14 @@ void test_SWrite_errors (void)
         msg)) ;
     TEST_CHECK (Set != NULL) ;
     TEST_CHECK (collection != NULL) ;
-    TEST_CHECK (nmatrices == 1) ;
+    TEST_CHECK (nmatrices == 2) ;
 
     ok = false ;
     OK (LAGraph_Matrix_IsEqual (&ok, A, Set [0], msg)) ;
     TEST_CHECK (ok) ;
+    ok = false ;
+    OK (LAGraph_Matrix_IsEqual (&ok, A, Set [1], msg)) ;
+    TEST_CHECK (ok) ;
 
     // free everything
     LAGraph_SFreeSet (&Set, nmatrices) ;
@@ -0,0 +1,301 @@
+//----------------------------------------------------------------------------
+// LAGraph/experimental/test/test_UpdateEdges.c: test LAGraph_UpdateEdges
+// ----------------------------------------------------------------------------
+
+// LAGraph, (c) 2019-2022 by The LAGraph Contributors, All Rights Reserved.
+// SPDX-License-Identifier: BSD-2-Clause
+//
+// For additional details (including references to third party source code and
+// other files) see the LICENSE file or contact permission@sei.cmu.edu. See
+// Contributors.txt for a full list of contributors. Created, in part, with
+// funding and support from the U.S. Government (see Acknowledgments.txt file).
+// DM22-0790
+
+//-----------------------------------------------------------------------------
+
+#include <stdio.h>
+#include <acutest.h>
+#include <LAGraphX.h>
+#include <LAGraph_test.h>
+
+char msg [LAGRAPH_MSG_LEN] ;
+LAGraph_Graph G = NULL, G2 = NULL ;
+GrB_Matrix A = NULL, Insert = NULL, Delete = NULL, R = NULL, T = NULL ;
+
+#define LEN 512
+char filename [LEN+1] ;
+
+//------------------------------------------------------------------------------
+// check_cached: check the cached properties of G against those of G2
+//------------------------------------------------------------------------------
+
+// G2 is a new graph, constructed from a copy of G->A, with all of its cached
+// properties computed from scratch.
+
+static void check_cached (void)
+{
+    bool ok ;
+    OK (GrB_Matrix_dup (&A, G->A)) ;
+    OK (LAGraph_New (&G2, &A, G->kind, msg)) ;
+    if (G->kind == LAGraph_ADJACENCY_DIRECTED)
+    {
+        OK (LAGraph_Cached_AT (G2, msg)) ;
+        OK (LAGraph_Cached_InDegree (G2, msg)) ;
+    }
+    OK (LAGraph_Cached_OutDegree (G2, msg)) ;
+    OK (LAGraph_Cached_IsSymmetricStructure (G2, msg)) ;
+    OK (LAGraph_Cached_NSelfEdges (G2, msg)) ;
+    OK (LAGraph_Cached_EMin (G2, msg)) ;
+    OK (LAGraph_Cached_EMax (G2, msg)) ;
+    OK (LAGraph_CheckGraph (G, msg)) ;
+
+    if (G->AT != NULL)
+    {
+        OK (LAGraph_Matrix_IsEqual (&ok, G->AT, G2->AT, msg)) ;
+        TEST_CHECK (ok) ;
+    }
+    if (G->out_degree != NULL)
+    {
+        OK (LAGraph_Vector_IsEqual (&ok, G->out_degree, G2->out_degree, msg)) ;
+        TEST_CHECK (ok) ;
+    }
+    if (G->in_degree != NULL)
+    {
+        OK (LAGraph_Vector_IsEqual (&ok, G->in_degree, G2->in_degree, msg)) ;
+        TEST_CHECK (ok) ;
+    }
+    if (G->nself_edges != LAGRAPH_UNKNOWN)
+    {
+        TEST_CHECK (G->nself_edges == G2->nself_edges) ;
+    }
+    if (G->is_symmetric_structure != LAGRAPH_UNKNOWN)
+    {
+        TEST_CHECK (G->is_symmetric_structure ==
+            G2->is_symmetric_structure) ;
+    }
+
+    // emin and emax must be exact if a VALUE, or valid bounds if a BOUND
+    double x, y ;
+    if (G->emin_state != LAGRAPH_UNKNOWN)
+    {
+        OK (GrB_Scalar_extractElement_FP64 (&x, G->emin)) ;
+        OK (GrB_Scalar_extractElement_FP64 (&y, G2->emin)) ;
+        TEST_CHECK ((G->emin_state == LAGraph_VALUE) ? (x == y) : (x <= y)) ;
+    }
+    if (G->emax_state != LAGRAPH_UNKNOWN)
+    {
+        OK (GrB_Scalar_extractElement_FP64 (&x, G->emax)) ;
+        OK (GrB_Scalar_extractElement_FP64 (&y, G2->emax)) ;
+        TEST_CHECK ((G->emax_state == LAGraph_VALUE) ? (x == y) : (x >= y)) ;
+    }
+    OK (LAGraph_Delete (&G2, msg)) ;
+}
+
+//------------------------------------------------------------------------------
+// test_UpdateEdges: apply random batches of updates to a graph
+//------------------------------------------------------------------------------
+
+void test_UpdateEdges (void)
+{
+    LAGraph_Init (msg) ;
+    OK (LAGraph_Random_Init (msg)) ;
+
+    const char *files [3] = { "west0067.mtx", "karate.mtx", "bcsstk13.mtx" } ;
+    for (int k = 0 ; k < 3 ; k++)
+    {
+        // west0067 is directed; the others are undirected
+        TEST_CASE (files [k]) ;
+        snprintf (filename, LEN, LG_DATA_DIR "%s", files [k]) ;
+        FILE *f = fopen (filename, "r") ;
+        TEST_CHECK (f != NULL) ;
+        OK (LAGraph_MMRead (&A, f, msg)) ;
+        fclose (f) ;
+        bool directed = (k == 0) ;
+        OK (LAGraph_New (&G, &A, directed ? LAGraph_ADJACENCY_DIRECTED :
+            LAGraph_ADJACENCY_UNDIRECTED, msg)) ;
+        GrB_Index n ;
+        OK (GrB_Matrix_nrows (&n, G->A)) ;
+
+        // compute all cached properties of G
+        if (directed)
+        {
+            OK (LAGraph_Cached_AT (G, msg)) ;
+            OK (LAGraph_Cached_InDegree (G, msg)) ;
+        }
+        OK (LAGraph_Cached_OutDegree (G, msg)) ;
+        OK (LAGraph_Cached_IsSymmetricStructure (G, msg)) ;
+        OK (LAGraph_Cached_NSelfEdges (G, msg)) ;
+        OK (LAGraph_Cached_EMin (G, msg)) ;
+        OK (LAGraph_Cached_EMax (G, msg)) ;
+
+        for (int trial = 0 ; trial < 20 ; trial++)
+        {
+            uint64_t seed = 42 + 100 * trial + k ;
+
+            // Insert: a few random edges, some of them already in A
+            OK (LAGraph_Random_Matrix (&Insert, GrB_FP64, n, n,
+                (trial % 4 == 0) ? 0 : 0.002, seed, msg)) ;
+
+            // Delete: about a tenth of the edges of A, and a few others
+            OK (LAGraph_Random_Matrix (&R, GrB_BOOL, n, n,
+                (trial % 4 == 1) ? 0 : 0.1, seed + 1, msg)) ;
+            OK (GrB_Matrix_new (&Delete, GrB_BOOL, n, n)) ;
+            OK (GrB_eWiseMult (Delete, NULL, NULL, GrB_ONEB_BOOL, R, G->A,
+                NULL)) ;
+            OK (GrB_free (&R)) ;
+            OK (LAGraph_Random_Matrix (&R, GrB_BOOL, n, n, 0.001, seed + 2,
+                msg)) ;
+            OK (GrB_eWiseAdd (Delete, NULL, NULL, GrB_LOR, Delete, R, NULL)) ;
+            OK (GrB_free (&R)) ;
+
+            if (!directed)
+            {
+                // the updates of an undirected graph must be symmetric
+                OK (GrB_eWiseAdd (Insert, NULL, NULL, GrB_PLUS_FP64, Insert,
+                    Insert, GrB_DESC_T1)) ;
+                OK (GrB_eWiseAdd (Delete, NULL, NULL, GrB_LOR, Delete, Delete,
+                    GrB_DESC_T1)) ;
+            }
+
+            // expected result: T<Insert or Delete> = Insert
+            OK (GrB_Matrix_dup (&T, G->A)) ;
+            OK (GrB_assign (T, Delete, NULL, Insert, GrB_ALL, n, GrB_ALL, n,
+                GrB_DESC_S)) ;
+            OK (GrB_assign (T, Insert, NULL, Insert, GrB_ALL, n, GrB_ALL, n,
+                GrB_DESC_S)) ;
+
+            // apply the updates and check the result
+            OK (LAGraph_UpdateEdges (G, Insert, Delete, msg)) ;
+            bool ok ;
+            OK (LAGraph_Matrix_IsEqual (&ok, G->A, T, msg)) ;
+            TEST_CHECK (ok) ;
+            check_cached ( ) ;
+
+            OK (GrB_free (&Insert)) ;
+            OK (GrB_free (&Delete)) ;
+            OK (GrB_free (&T)) ;
+        }
+
+        // a batch of updates to the diagonal only
+        OK (GrB_Matrix_new (&Insert, GrB_FP64, n, n)) ;
+        OK (GrB_Matrix_setElement (Insert, -1000, 0, 0)) ;
+        OK (GrB_Matrix_setElement (Insert, 1000, 1, 1)) ;
+        OK (LAGraph_UpdateEdges (G, Insert, NULL, msg)) ;
+        check_cached ( ) ;
+        OK (LAGraph_UpdateEdges (G, NULL, Insert, msg)) ;
+        check_cached ( ) ;
+        TEST_CHECK (G->emin_state == LAGraph_BOUND) ;
+        OK (GrB_free (&Insert)) ;
+
+        // nothing to do
+        OK (LAGraph_UpdateEdges (G, NULL, NULL, msg)) ;
+        check_cached ( ) ;
+        OK (LAGraph_Delete (&G, msg)) ;
+    }
+
+    OK (LAGraph_Random_Finalize (msg)) ;
+    LAGraph_Finalize (msg) ;
+}
+
+//------------------------------------------------------------------------------
+// test_UpdateEdges_symmetry: check the updates of is_symmetric_structure
+//------------------------------------------------------------------------------
+
+void test_UpdateEdges_symmetry (void)
+{
+    LAGraph_Init (msg) ;
+
+    // a directed graph with a symmetric structure: 0 <-> 1
+    OK (GrB_Matrix_new (&A, GrB_INT32, 3, 3)) ;
+    OK (GrB_Matrix_setElement (A, 1, 0, 1)) ;
+    OK (GrB_Matrix_setElement (A, 2, 1, 0)) ;
+    OK (LAGraph_New (&G, &A, LAGraph_ADJACENCY_DIRECTED, msg)) ;
+    OK (LAGraph_Cached_IsSymmetricStructure (G, msg)) ;
+    TEST_CHECK (G->is_symmetric_structure == true) ;
+
+    // insert 1 -> 2: no longer symmetric
+    OK (GrB_Matrix_new (&Insert, GrB_INT32, 3, 3)) ;
+    OK (GrB_Matrix_setElement (Insert, 3, 1, 2)) ;
+    OK (LAGraph_UpdateEdges (G, Insert, NULL, msg)) ;
+    TEST_CHECK (G->is_symmetric_structure == false) ;
+    OK (GrB_free (&Insert)) ;
+
+    // insert 2 -> 1: symmetric again, but this cannot be determined from
+    // the updated entries alone
+    OK (GrB_Matrix_new (&Insert, GrB_INT32, 3, 3)) ;
+    OK (GrB_Matrix_setElement (Insert, 4, 2, 1)) ;
+    OK (LAGraph_UpdateEdges (G, Insert, NULL, msg)) ;
+    TEST_CHECK (G->is_symmetric_structure == LAGRAPH_UNKNOWN) ;
+    OK (LAGraph_Cached_IsSymmetricStructure (G, msg)) ;
+    TEST_CHECK (G->is_symmetric_structure == true) ;
+
+    // replace the value of 2 -> 1: still symmetric
+    OK (GrB_Matrix_setElement (Insert, 5, 2, 1)) ;
+    OK (LAGraph_UpdateEdges (G, Insert, NULL, msg)) ;
+    TEST_CHECK (G->is_symmetric_structure == true) ;
+
+    // delete 2 -> 1 and 1 -> 2: still symmetric
+    OK (GrB_Matrix_setElement (Insert, 5, 1, 2)) ;
+    OK (LAGraph_UpdateEdges (G, NULL, Insert, msg)) ;
+    TEST_CHECK (G->is_symmetric_structure == true) ;
+    GrB_Index nvals ;
+    OK (GrB_Matrix_nvals (&nvals, G->A)) ;
+    TEST_CHECK (nvals == 2) ;
+    OK (GrB_free (&Insert)) ;
+    OK (LAGraph_Delete (&G, msg)) ;
+
+    LAGraph_Finalize (msg) ;
+}
+
+//------------------------------------------------------------------------------
+// test_UpdateEdges_failures: check error handling
+//------------------------------------------------------------------------------
+
+void test_UpdateEdges_failures (void)
+{
+    LAGraph_Init (msg) ;
+
+    int result = LAGraph_UpdateEdges (NULL, NULL, NULL, msg) ;
+    TEST_CHECK (result == GrB_NULL_POINTER) ;
+
+    OK (GrB_Matrix_new (&A, GrB_FP64, 4, 4)) ;
+    OK (GrB_Matrix_setElement (A, 1, 0, 1)) ;
+    OK (GrB_Matrix_setElement (A, 1, 1, 0)) ;
+    OK (LAGraph_New (&G, &A, LAGraph_ADJACENCY_UNDIRECTED, msg)) ;
+    OK (LAGraph_Cached_OutDegree (G, msg)) ;
+
+    // wrong dimensions
+    OK (GrB_Matrix_new (&Insert, GrB_FP64, 5, 4)) ;
+    result = LAGraph_UpdateEdges (G, Insert, NULL, msg) ;
+    TEST_CHECK (result == GrB_DIMENSION_MISMATCH) ;
+    result = LAGraph_UpdateEdges (G, NULL, Insert, msg) ;
+    TEST_CHECK (result == GrB_DIMENSION_MISMATCH) ;
+    OK (GrB_free (&Insert)) ;
+
+    // unsymmetric updates of an undirected graph
+    OK (GrB_Matrix_new (&Insert, GrB_FP64, 4, 4)) ;
+    OK (GrB_Matrix_setElement (Insert, 1, 2, 3)) ;
+    result = LAGraph_UpdateEdges (G, Insert, NULL, msg) ;
+    TEST_CHECK (result == GrB_INVALID_VALUE) ;
+    result = LAGraph_UpdateEdges (G, NULL, Insert, msg) ;
+    TEST_CHECK (result == GrB_INVALID_VALUE) ;
+    OK (GrB_free (&Insert)) ;
+
+    // the graph and its cached properties are unchanged
+    TEST_CHECK (G->out_degree != NULL) ;
+    GrB_Index nvals ;
+    OK (GrB_Matrix_nvals (&nvals, G->A)) ;
+    TEST_CHECK (nvals == 2) ;
+    OK (LAGraph_Delete (&G, msg)) ;
+
+    LAGraph_Finalize (msg) ;
+}
+
+//****************************************************************************
+
+TEST_LIST = {
+    {"UpdateEdges", test_UpdateEdges},
+    {"UpdateEdges_symmetry", test_UpdateEdges_symmetry},
+    {"UpdateEdges_failures", test_UpdateEdges_failures},
+    {NULL, NULL}
+};
@@ -0,0 +1,230 @@
+//------------------------------------------------------------------------------
+// LAGraph_Arena: scoped workspace, released all at once
+//------------------------------------------------------------------------------
+
+// LAGraph, (c) 2019-2022 by The LAGraph Contributors, All Rights Reserved.
+// SPDX-License-Identifier: BSD-2-Clause
+//
+// For additional details (including references to third party source code and
+// other files) see the LICENSE file or contact permission@sei.cmu.edu. See
+// Contributors.txt for a full list of contributors. Created, in part, with
+// funding and support from the U.S. Government (see Acknowledgments.txt file).
+// DM22-0790
+
+//------------------------------------------------------------------------------
+
+// An LAGraph_Arena holds the workspace of an algorithm that allocates many
+// blocks of memory and frees them all at the same time, at the end of each
+// iteration or at the end of the algorithm.  Blocks are carved out of large
+// chunks obtained from LAGraph_Malloc, and are never freed one at a time.
+// LAGraph_Arena_Reset releases all blocks in O(1) time, and keeps the chunks
+// for the next use of the arena.  LAGraph_Arena_Delete frees all the chunks.
+//
+//      LAGraph_Arena arena = NULL ;
+//      LAGraph_Arena_New (&arena, 0, msg) ;
+//      for (iteration = 0 ; ... ; iteration++)
+//      {
+//          LAGraph_Arena_Malloc ((void **) &W, arena, n, sizeof (int64_t), msg);
+//          ... use W and other workspace from the arena
+//          LAGraph_Arena_Reset (arena, msg) ;  // release all workspace
+//      }
+//      LAGraph_Arena_Delete (&arena, msg) ;
+//
+// Each block is 16-byte aligned.  An arena must not be used by more than one
+// thread at a time.  GrB_Matrix and GrB_Vector objects are allocated by
+// GraphBLAS, not in an arena; see LAGraph_Pool_malloc for a pool for those.
+
+//------------------------------------------------------------------------------
+
+#define LG_FREE_ALL ;
+
+#include "LG_internal.h"
+#include "LAGraphX.h"
+
+// default size of each chunk
+#define LG_ARENA_CHUNK (256 * 1024)
+
+// alignment of each block
+#define LG_ARENA_ALIGN 16
+
+// a chunk of memory; its blocks follow the header
+typedef struct LG_arena_chunk_struct
+{
+    struct LG_arena_chunk_struct *next ;    // next chunk in the arena
+    size_t size ;                           // # of bytes in the chunk
+}
+LG_arena_chunk ;
+
+#define LG_ARENA_HEADER \
+    (((sizeof (LG_arena_chunk) + LG_ARENA_ALIGN - 1) / LG_ARENA_ALIGN) \
+    * LG_ARENA_ALIGN)
+
+struct LAGraph_Arena_struct
+{
+    LG_arena_chunk *first ;     // first chunk in the arena
+    LG_arena_chunk *current ;   // chunk in use
+    size_t used ;               // # of bytes used in the current chunk
+    size_t chunk_size ;         // default size of a new chunk
+} ;
+
+//------------------------------------------------------------------------------
+// LAGraph_Arena_New: create an arena
+//------------------------------------------------------------------------------
+
+int LAGraph_Arena_New
+(
+    // output:
+    LAGraph_Arena *arena,   // the arena to create
+    // input:
+    size_t chunk_size,      // bytes in each chunk; 0 for the default (256 KB)
+    char *msg
+)
+{
+    LG_CLEAR_MSG ;
+    LG_ASSERT (arena != NULL, GrB_NULL_POINTER) ;
+    LG_TRY (LAGraph_Calloc ((void **) arena, 1,
+        sizeof (struct LAGraph_Arena_struct), msg)) ;
+    (*arena)->chunk_size = (chunk_size == 0) ? LG_ARENA_CHUNK : chunk_size ;
+    return (GrB_SUCCESS) ;
+}
+
+//------------------------------------------------------------------------------
+// LAGraph_Arena_Malloc: allocate a block from an arena
+//------------------------------------------------------------------------------
+
+int LAGraph_Arena_Malloc
+(
+    // output:
+    void **p,               // pointer to allocated block of memory
+    // input/output:
+    LAGraph_Arena arena,    // arena to allocate the block from
+    // input:
+    size_t nitems,          // number of items
+    size_t size_of_item,    // size of each item
+    char *msg
+)
+{
+
+    //--------------------------------------------------------------------------
+    // check inputs
+    //--------------------------------------------------------------------------
+
+    LG_CLEAR_MSG ;
+    LG_ASSERT (p != NULL && arena != NULL, GrB_NULL_POINTER) ;
+    (*p) = NULL ;
+    nitems = LAGRAPH_MAX (1, nitems) ;
+    size_of_item = LAGRAPH_MAX (1, size_of_item) ;
+    size_t size ;
+    if (!LG_Multiply_size_t (&size, nitems, size_of_item)
+        || size > SIZE_MAX - LG_ARENA_HEADER - LG_ARENA_ALIGN)
+    {
+        // overflow
+        return (GrB_OUT_OF_MEMORY) ;
+    }
+    size = ((size + LG_ARENA_ALIGN - 1) / LG_ARENA_ALIGN) * LG_ARENA_ALIGN ;
+
+    //--------------------------------------------------------------------------
+    // find a chunk with enough space
+    //--------------------------------------------------------------------------
+
+    LG_arena_chunk *chunk = arena->current ;
+    if (chunk == NULL || arena->used + size > chunk->size)
+    {
+        // the current chunk is full; reuse the next one if it is large enough
+        LG_arena_chunk *next = (chunk == NULL) ? arena->first : chunk->next ;
+        if (next != NULL && size <= next->size)
+        {
+            chunk = next ;
+        }
+        else
+        {
+            // allocate a new chunk, and place it after the current one
+            size_t chunk_size = LAGRAPH_MAX (arena->chunk_size, size) ;
+            LG_TRY (LAGraph_Malloc ((void **) &chunk, 1,
+                LG_ARENA_HEADER + chunk_size, msg)) ;
+            chunk->size = chunk_size ;
+            chunk->next = next ;
+            if (arena->current == NULL)
+            {
+                arena->first = chunk ;
+            }
+            else
+            {
+                arena->current->next = chunk ;
+            }
+        }
+        arena->current = chunk ;
+        arena->used = 0 ;
+    }
+
+    //--------------------------------------------------------------------------
+    // carve the block out of the chunk
+    //--------------------------------------------------------------------------
+
+    (*p) = ((uint8_t *) chunk) + LG_ARENA_HEADER + arena->used ;
+    arena->used += size ;
+    return (GrB_SUCCESS) ;
+}
+
+//------------------------------------------------------------------------------
+// LAGraph_Arena_Calloc: allocate a block from an arena and set it to zero
+//------------------------------------------------------------------------------
+
+int LAGraph_Arena_Calloc
+(
+    // output:
+    void **p,               // pointer to allocated block of memory
+    // input/output:
+    LAGraph_Arena arena,    // arena to allocate the block from
+    // input:
+    size_t nitems,          // number of items
+    size_t size_of_item,    // size of each item
+    char *msg
+)
+{
+    LG_TRY (LAGraph_Arena_Malloc (p, arena, nitems, size_of_item, msg)) ;
+    memset (*p, 0, LAGRAPH_MAX (1, nitems) * LAGRAPH_MAX (1, size_of_item)) ;
+    return (GrB_SUCCESS) ;
+}
+
+//------------------------------------------------------------------------------
+// LAGraph_Arena_Reset: release all blocks in an arena
+//------------------------------------------------------------------------------
+
+int LAGraph_Arena_Reset
+(
+    // input/output:
+    LAGraph_Arena arena,    // arena to reset
+    char *msg
+)
+{
+    LG_CLEAR_MSG ;
+    LG_ASSERT (arena != NULL, GrB_NULL_POINTER) ;
+    arena->current = NULL ;
+    arena->used = 0 ;
+    return (GrB_SUCCESS) ;
+}
+
+//------------------------------------------------------------------------------
+// LAGraph_Arena_Delete: free an arena and all of its chunks
+//------------------------------------------------------------------------------
+
+int LAGraph_Arena_Delete
+(
+    // input/output:
+    LAGraph_Arena *arena,   // arena to free; does nothing if NULL
+    char *msg
+)
+{
+    LG_CLEAR_MSG ;
+    if (arena == NULL || (*arena) == NULL) return (GrB_SUCCESS) ;
+    LG_arena_chunk *chunk = (*arena)->first ;
+    while (chunk != NULL)
+    {
+        LG_arena_chunk *next = chunk->next ;
+        LG_TRY (LAGraph_Free ((void **) &chunk, msg)) ;
+        chunk = next ;
+    }
+    LG_TRY (LAGraph_Free ((void **) arena, msg)) ;
+    return (GrB_SUCCESS) ;
+}
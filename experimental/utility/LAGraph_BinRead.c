@@ -0,0 +1,480 @@
+//------------------------------------------------------------------------------
+// LAGraph_BinRead: read a matrix from a binary *.grb file
+//------------------------------------------------------------------------------
+
+// LAGraph, (c) 2019-2022 by The LAGraph Contributors, All Rights Reserved.
+// SPDX-License-Identifier: BSD-2-Clause
+//
+// For additional details (including references to third party source code and
+// other files) see the LICENSE file or contact permission@sei.cmu.edu. See
+// Contributors.txt for a full list of contributors. Created, in part, with
+// funding and support from the U.S. Government (see Acknowledgments.txt file).
+// DM22-0790
+
+//------------------------------------------------------------------------------
+
+// LAGraph_BinRead reads a matrix from a *.grb file, created by binwrite in
+// src/benchmark/LAGraph_demo.h (see also src/benchmark/mtx2bin_demo.c).  The
+// file has a 512-byte ASCII header, followed by a set of scalars that describe
+// the matrix, and then the arrays of the matrix (Ap, Ah, Ab, Ai, and Ax,
+// depending on its format) in binary.  The arrays are given to the matrix
+// with GxB_Matrix_pack_*, so the file can only be read when using
+// SuiteSparse:GraphBLAS.
+
+// On POSIX systems, the file is mapped into memory with mmap, and the arrays
+// are copied from the page cache into the matrix by all threads in parallel.
+// The pages of the mapping are released as soon as each array is copied, so
+// the peak memory usage is the size of the matrix itself, not twice that.
+// The arrays cannot be used in place, since GraphBLAS takes ownership of the
+// arrays of a packed matrix and frees them when the matrix is freed.  On
+// other systems, the arrays are read with fread.
+
+// The file may also be compressed with gzip or zstd (a *.grb.gz or *.grb.zst
+// file, for example).  This is detected from the contents of the file, not
+// its name.  A compressed file is decompressed on the fly with an LG_stream,
+// directly into the arrays of the matrix; it is not mapped into memory.
+
+// Return values:
+//  GrB_SUCCESS: input file and output matrix are valid
+//  LAGRAPH_IO_ERROR: the file cannot be opened, or is truncated or invalid
+//  GrB_NULL_POINTER: A or filename are NULL on input
+//  GrB_NOT_IMPLEMENTED: the type of the matrix is not supported,
+//      SuiteSparse:GraphBLAS is not in use, or the file is compressed and
+//      LAGraph was compiled without zlib (for gzip) or libzstd (for zstd)
+//  other: return values directly from GrB_* and GxB_* methods
+
+#if defined ( __linux__ ) || defined ( __APPLE__ ) || defined ( __unix__ )
+#define LG_BINREAD_MMAP 1
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <fcntl.h>
+#include <unistd.h>
+#else
+#define LG_BINREAD_MMAP 0
+#endif
+
+#define LG_FREE_WORK                            \
+{                                               \
+    LAGraph_Free ((void **) &Ap, NULL) ;        \
+    LAGraph_Free ((void **) &Ah, NULL) ;        \
+    LAGraph_Free ((void **) &Ab, NULL) ;        \
+    LAGraph_Free ((void **) &Ai, NULL) ;        \
+    LAGraph_Free ((void **) &Ax, NULL) ;        \
+    close_file (&src) ;                         \
+}
+
+#define LG_FREE_ALL                             \
+{                                               \
+    LG_FREE_WORK ;                              \
+    GrB_free (A) ;                              \
+}
+
+#include "LG_internal.h"
+#include "LAGraphX.h"
+
+// size of the ASCII header of a *.grb file
+#define LAGRAPH_BIN_HEADER 512
+
+//------------------------------------------------------------------------------
+// bin_source: the contents of the *.grb file
+//------------------------------------------------------------------------------
+
+typedef struct
+{
+    FILE *f ;           // the file, if not mapped
+    LG_stream stream ;  // the decompressed file, if compressed
+    uint8_t *map ;      // the file mapped into memory, or NULL
+    size_t size ;       // size of the file, in bytes (if mapped)
+    size_t pos ;        // current position in the file
+    #if LG_BINREAD_MMAP
+    int fd ;            // file descriptor, or -1
+    #endif
+}
+bin_source ;
+
+//------------------------------------------------------------------------------
+// open_file: open the file and map it into memory, if possible
+//------------------------------------------------------------------------------
+
+static int open_file (bin_source *src, const char *filename, char *msg)
+{
+    src->f = NULL ;
+    src->stream = NULL ;
+    src->map = NULL ;
+    src->size = 0 ;
+    src->pos = 0 ;
+
+    // check if the file is compressed
+    src->f = fopen (filename, "rb") ;
+    if (src->f == NULL) return (LAGRAPH_IO_ERROR) ;
+    int status = LG_stream_open (&(src->stream), src->f, msg) ;
+    if (status != GrB_SUCCESS || LG_stream_compressed (src->stream))
+    {
+        // read the compressed file with src->stream, or return an error
+        return (status) ;
+    }
+    LG_stream_close (&(src->stream)) ;
+    fclose (src->f) ;
+    src->f = NULL ;
+
+    #if LG_BINREAD_MMAP
+    src->fd = open (filename, O_RDONLY) ;
+    if (src->fd < 0) return (LAGRAPH_IO_ERROR) ;
+    struct stat st ;
+    if (fstat (src->fd, &st) == 0 && st.st_size > 0)
+    {
+        void *map = mmap (NULL, (size_t) st.st_size, PROT_READ, MAP_PRIVATE,
+            src->fd, 0) ;
+        if (map != MAP_FAILED)
+        {
+            src->map = (uint8_t *) map ;
+            src->size = (size_t) st.st_size ;
+            // the file is read just once, from start to finish
+            madvise (map, src->size, MADV_SEQUENTIAL) ;
+            return (GrB_SUCCESS) ;
+        }
+    }
+    // mmap failed; use fread instead
+    src->f = fdopen (src->fd, "rb") ;
+    if (src->f == NULL) return (LAGRAPH_IO_ERROR) ;
+    src->fd = -1 ;      // now owned by src->f
+    #else
+    src->f = fopen (filename, "rb") ;
+    if (src->f == NULL) return (LAGRAPH_IO_ERROR) ;
+    #endif
+    return (GrB_SUCCESS) ;
+}
+
+//------------------------------------------------------------------------------
+// close_file: unmap and close the file
+//------------------------------------------------------------------------------
+
+static void close_file (bin_source *src)
+{
+    #if LG_BINREAD_MMAP
+    if (src->map != NULL) munmap (src->map, src->size) ;
+    if (src->fd >= 0) close (src->fd) ;
+    src->fd = -1 ;
+    #endif
+    LG_stream_close (&(src->stream)) ;
+    if (src->f != NULL) fclose (src->f) ;
+    src->f = NULL ;
+    src->map = NULL ;
+}
+
+//------------------------------------------------------------------------------
+// read_bytes: read the next n bytes of the file
+//------------------------------------------------------------------------------
+
+// Returns false if the file is truncated.  Large arrays are copied from the
+// mapped file in parallel.
+
+static bool read_bytes (bin_source *src, void *dest, size_t n)
+{
+    if (n == 0) return (true) ;
+
+    if (src->stream != NULL)
+    {
+        return (LG_stream_read (dest, n, src->stream) == n) ;
+    }
+
+    if (src->map == NULL)
+    {
+        return (fread (dest, sizeof (uint8_t), n, src->f) == n) ;
+    }
+
+    if (n > src->size - src->pos) return (false) ;
+    uint8_t *p = src->map + src->pos ;
+
+    #define CHUNK (1024*1024)
+    int nthreads = LG_nthreads_outer * LG_nthreads_inner ;
+    nthreads = LAGRAPH_MIN (nthreads, (int64_t) (n / CHUNK)) ;
+    nthreads = LAGRAPH_MAX (nthreads, 1) ;
+    int tid ;
+    #pragma omp parallel for num_threads(nthreads) schedule(static)
+    for (tid = 0 ; tid < nthreads ; tid++)
+    {
+        size_t k1, k2 ;
+        LG_PARTITION (k1, k2, n, tid, nthreads) ;
+        memcpy (((uint8_t *) dest) + k1, p + k1, k2 - k1) ;
+    }
+
+    #if LG_BINREAD_MMAP
+    if (n >= CHUNK)
+    {
+        // release the pages of the mapping that have just been copied
+        size_t pagesize = (size_t) sysconf (_SC_PAGESIZE) ;
+        size_t first = ((src->pos + pagesize - 1) / pagesize) * pagesize ;
+        size_t last = ((src->pos + n) / pagesize) * pagesize ;
+        if (last > first)
+        {
+            madvise (src->map + first, last - first, MADV_DONTNEED) ;
+        }
+    }
+    #endif
+
+    src->pos += n ;
+    return (true) ;
+}
+
+//------------------------------------------------------------------------------
+// LAGraph_BinRead
+//------------------------------------------------------------------------------
+
+#define READ(p,n)                                                       \
+{                                                                       \
+    LG_ASSERT_MSG (read_bytes (&src, p, n), LAGRAPH_IO_ERROR,           \
+        "file is truncated") ;                                          \
+}
+
+int LAGraph_BinRead
+(
+    // output:
+    GrB_Matrix *A,          // matrix read from the file
+    // input:
+    const char *filename,   // name of the *.grb file to read
+    char *msg
+)
+{
+
+    //--------------------------------------------------------------------------
+    // check inputs
+    //--------------------------------------------------------------------------
+
+    GrB_Index *Ap = NULL, *Ah = NULL, *Ai = NULL ;
+    int8_t *Ab = NULL ;
+    void *Ax = NULL ;
+    bin_source src ;
+    memset (&src, 0, sizeof (bin_source)) ;
+    #if LG_BINREAD_MMAP
+    src.fd = -1 ;
+    #endif
+    LG_CLEAR_MSG ;
+    LG_ASSERT (A != NULL && filename != NULL, GrB_NULL_POINTER) ;
+    (*A) = NULL ;
+
+    #if !LAGRAPH_SUITESPARSE
+    LG_ASSERT_MSG (false, GrB_NOT_IMPLEMENTED,
+        "SuiteSparse:GraphBLAS required to read binary *.grb files") ;
+    #else
+
+    //--------------------------------------------------------------------------
+    // open the file
+    //--------------------------------------------------------------------------
+
+    int status = open_file (&src, filename, msg) ;
+    if (status == LAGRAPH_IO_ERROR)
+    {
+        LG_ASSERT_MSGF (false, LAGRAPH_IO_ERROR,
+            "unable to open file: %s", filename) ;
+    }
+    LG_TRY (status) ;
+
+    //--------------------------------------------------------------------------
+    // read the header (and ignore it)
+    //--------------------------------------------------------------------------
+
+    // The header is informational only, for "head" command, so the file can
+    // be visually inspected.
+
+    char header [LAGRAPH_BIN_HEADER] ;
+    READ (header, LAGRAPH_BIN_HEADER) ;
+
+    //--------------------------------------------------------------------------
+    // read the scalar content
+    //--------------------------------------------------------------------------
+
+    GxB_Format_Value fmt = -999 ;
+    int32_t kind, typecode ;
+    double hyper = -999 ;
+    GrB_Index nrows, ncols, nvals, nvec ;
+    size_t typesize ;
+    int64_t nonempty ;
+
+    READ (&fmt,      sizeof (GxB_Format_Value)) ;
+    READ (&kind,     sizeof (int32_t)) ;
+    READ (&hyper,    sizeof (double)) ;
+    READ (&nrows,    sizeof (GrB_Index)) ;
+    READ (&ncols,    sizeof (GrB_Index)) ;
+    READ (&nonempty, sizeof (int64_t)) ;
+    READ (&nvec,     sizeof (GrB_Index)) ;
+    READ (&nvals,    sizeof (GrB_Index)) ;
+    READ (&typecode, sizeof (int32_t)) ;
+    READ (&typesize, sizeof (size_t)) ;
+
+    bool iso = false ;
+    if (kind > 100)
+    {
+        iso = true ;
+        kind = kind - 100 ;
+    }
+
+    bool is_hyper  = (kind == GxB_HYPERSPARSE) ;
+    bool is_sparse = (kind == 0 || kind == GxB_SPARSE) ;
+    bool is_bitmap = (kind == GxB_BITMAP) ;
+    bool is_full   = (kind == GxB_FULL) ;
+    LG_ASSERT_MSG ((is_hyper || is_sparse || is_bitmap || is_full)
+        && (fmt == GxB_BY_ROW || fmt == GxB_BY_COL),
+        LAGRAPH_IO_ERROR, "invalid matrix format") ;
+
+    GrB_Type type = NULL ;
+    switch (typecode)
+    {
+        case 0:  type = GrB_BOOL        ; break ;
+        case 1:  type = GrB_INT8        ; break ;
+        case 2:  type = GrB_INT16       ; break ;
+        case 3:  type = GrB_INT32       ; break ;
+        case 4:  type = GrB_INT64       ; break ;
+        case 5:  type = GrB_UINT8       ; break ;
+        case 6:  type = GrB_UINT16      ; break ;
+        case 7:  type = GrB_UINT32      ; break ;
+        case 8:  type = GrB_UINT64      ; break ;
+        case 9:  type = GrB_FP32        ; break ;
+        case 10: type = GrB_FP64        ; break ;
+        default: break ;
+    }
+    LG_ASSERT_MSG (type != NULL, GrB_NOT_IMPLEMENTED,
+        "unknown or unsupported type") ;
+    size_t tsize ;
+    GRB_TRY (GxB_Type_size (&tsize, type)) ;
+    LG_ASSERT_MSG (tsize == typesize, LAGRAPH_IO_ERROR, "invalid type size") ;
+
+    //--------------------------------------------------------------------------
+    // determine the size of each array
+    //--------------------------------------------------------------------------
+
+    size_t Ap_len = 0, Ah_len = 0, Ab_len = 0, Ai_len = 0, Ax_len = 0 ;
+    if (is_hyper)
+    {
+        Ap_len = nvec+1 ;
+        Ah_len = nvec ;
+        Ai_len = nvals ;
+        Ax_len = nvals ;
+    }
+    else if (is_sparse)
+    {
+        Ap_len = nvec+1 ;
+        Ai_len = nvals ;
+        Ax_len = nvals ;
+    }
+    else
+    {
+        // bitmap or full
+        LG_ASSERT_MSG (LG_Multiply_size_t (&Ax_len, nrows, ncols),
+            GrB_OUT_OF_MEMORY, "problem too large") ;
+        if (is_bitmap) Ab_len = Ax_len ;
+    }
+    if (iso) Ax_len = 1 ;
+
+    size_t Ap_size, Ah_size, Ab_size, Ai_size, Ax_size ;
+    LG_ASSERT_MSG (
+        LG_Multiply_size_t (&Ap_size, Ap_len, sizeof (GrB_Index)) &&
+        LG_Multiply_size_t (&Ah_size, Ah_len, sizeof (GrB_Index)) &&
+        LG_Multiply_size_t (&Ab_size, Ab_len, sizeof (int8_t)) &&
+        LG_Multiply_size_t (&Ai_size, Ai_len, sizeof (GrB_Index)) &&
+        LG_Multiply_size_t (&Ax_size, Ax_len, typesize),
+        GrB_OUT_OF_MEMORY, "problem too large") ;
+
+    if (src.map != NULL)
+    {
+        // check the file size before allocating any space
+        size_t remaining = src.size - src.pos ;
+        bool ok = (Ap_size <= remaining) ;
+        if (ok) { remaining -= Ap_size ; ok = (Ah_size <= remaining) ; }
+        if (ok) { remaining -= Ah_size ; ok = (Ab_size <= remaining) ; }
+        if (ok) { remaining -= Ab_size ; ok = (Ai_size <= remaining) ; }
+        if (ok) { remaining -= Ai_size ; ok = (Ax_size <= remaining) ; }
+        LG_ASSERT_MSG (ok, LAGRAPH_IO_ERROR, "file is truncated") ;
+    }
+
+    //--------------------------------------------------------------------------
+    // allocate and read the array content
+    //--------------------------------------------------------------------------
+
+    if (is_hyper || is_sparse)
+    {
+        LG_TRY (LAGraph_Malloc ((void **) &Ap, Ap_len, sizeof (GrB_Index),
+            msg)) ;
+        READ (Ap, Ap_size) ;
+    }
+    if (is_hyper)
+    {
+        LG_TRY (LAGraph_Malloc ((void **) &Ah, Ah_len, sizeof (GrB_Index),
+            msg)) ;
+        READ (Ah, Ah_size) ;
+    }
+    if (is_hyper || is_sparse)
+    {
+        LG_TRY (LAGraph_Malloc ((void **) &Ai, Ai_len, sizeof (GrB_Index),
+            msg)) ;
+        READ (Ai, Ai_size) ;
+    }
+    if (is_bitmap)
+    {
+        LG_TRY (LAGraph_Malloc ((void **) &Ab, Ab_len, sizeof (int8_t), msg)) ;
+        READ (Ab, Ab_size) ;
+    }
+    LG_TRY (LAGraph_Malloc ((void **) &Ax, Ax_len, typesize, msg)) ;
+    READ (Ax, Ax_size) ;
+
+    // the file is no longer needed
+    close_file (&src) ;
+
+    //--------------------------------------------------------------------------
+    // pack the arrays into the matrix
+    //--------------------------------------------------------------------------
+
+    GRB_TRY (GrB_Matrix_new (A, type, nrows, ncols)) ;
+
+    if (fmt == GxB_BY_COL && is_hyper)
+    {
+        // hypersparse CSC
+        GRB_TRY (GxB_Matrix_pack_HyperCSC (*A, &Ap, &Ah, &Ai, &Ax,
+            Ap_size, Ah_size, Ai_size, Ax_size, iso, nvec, false, NULL)) ;
+    }
+    else if (fmt == GxB_BY_ROW && is_hyper)
+    {
+        // hypersparse CSR
+        GRB_TRY (GxB_Matrix_pack_HyperCSR (*A, &Ap, &Ah, &Ai, &Ax,
+            Ap_size, Ah_size, Ai_size, Ax_size, iso, nvec, false, NULL)) ;
+    }
+    else if (fmt == GxB_BY_COL && is_sparse)
+    {
+        // standard CSC
+        GRB_TRY (GxB_Matrix_pack_CSC (*A, &Ap, &Ai, &Ax,
+            Ap_size, Ai_size, Ax_size, iso, false, NULL)) ;
+    }
+    else if (fmt == GxB_BY_ROW && is_sparse)
+    {
+        // standard CSR
+        GRB_TRY (GxB_Matrix_pack_CSR (*A, &Ap, &Ai, &Ax,
+            Ap_size, Ai_size, Ax_size, iso, false, NULL)) ;
+    }
+    else if (fmt == GxB_BY_COL && is_bitmap)
+    {
+        // bitmap by col
+        GRB_TRY (GxB_Matrix_pack_BitmapC (*A, &Ab, &Ax,
+            Ab_size, Ax_size, iso, nvals, NULL)) ;
+    }
+    else if (fmt == GxB_BY_ROW && is_bitmap)
+    {
+        // bitmap by row
+        GRB_TRY (GxB_Matrix_pack_BitmapR (*A, &Ab, &Ax,
+            Ab_size, Ax_size, iso, nvals, NULL)) ;
+    }
+    else if (fmt == GxB_BY_COL && is_full)
+    {
+        // full by col
+        GRB_TRY (GxB_Matrix_pack_FullC (*A, &Ax, Ax_size, iso, NULL)) ;
+    }
+    else
+    {
+        // full by row
+        GRB_TRY (GxB_Matrix_pack_FullR (*A, &Ax, Ax_size, iso, NULL)) ;
+    }
+
+    GRB_TRY (GxB_set (*A, GxB_HYPER_SWITCH, hyper)) ;
+    LG_FREE_WORK ;
+    return (GrB_SUCCESS) ;
+    #endif
+}
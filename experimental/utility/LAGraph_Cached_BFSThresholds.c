@@ -0,0 +1,164 @@
+//------------------------------------------------------------------------------
+// LAGraph_Cached_BFSThresholds: tune the BFS push/pull thresholds for a graph
+//------------------------------------------------------------------------------
+
+// LAGraph, (c) 2019-2022 by The LAGraph Contributors, All Rights Reserved.
+// SPDX-License-Identifier: BSD-2-Clause
+//
+// For additional details (including references to third party source code and
+// other files) see the LICENSE file or contact permission@sei.cmu.edu. See
+// Contributors.txt for a full list of contributors. Created, in part, with
+// funding and support from the U.S. Government (see Acknowledgments.txt file).
+// DM22-0790
+
+//------------------------------------------------------------------------------
+
+// LAGraph_Cached_BFSThresholds computes G->bfs_alpha, G->bfs_beta1, and
+// G->bfs_beta2, the push/pull thresholds used by LAGr_BreadthFirstSearch
+// (see LG_BreadthFirstSearch_SSGrB).  The defaults (8, 8, and 512) switch to
+// pull too late on power-law graphs, and pull when they should not on graphs
+// with a low, uniform degree, such as road networks and meshes.
+
+// The thresholds are first chosen from the sampled mean and median out-degree
+// of G (see LAGr_SampleDegree), which requires G->out_degree (it is computed
+// if not present):
+
+//  mean > 2*median (skewed, power-law):    alpha = 15, beta1 = 8, beta2 = 18
+//  mean <= 8 (low, uniform degree):        alpha = 2,  beta1 = 2, beta2 = 512
+//  otherwise:                              alpha = 8,  beta1 = 8, beta2 = 512
+
+// The first row is the choice of the GAP benchmark (Beamer et al.).  Then, if
+// ntrials > 0 and the BFS can use push/pull (G->AT is present, or G is known
+// to have a symmetric structure), alpha is refined by measurement: ntrials
+// level-only searches are timed with alpha scaled by 1/4, 1/2, 1, 2, and 4,
+// and the fastest is kept.  The degree-based choice is timed first, and a
+// candidate must be at least 5% faster than the best so far to replace it, so
+// that timing noise alone does not move the thresholds.  The sources of the
+// trial searches are spread evenly over the nodes with at least one out-edge.
+
+// The thresholds are performance hints only: the result of the BFS does not
+// depend on them.  LAGraph_DeleteCached clears them.  G->out_degree, if
+// computed here, may then be deleted to keep within the budget set by
+// LAGraph_Cached_SetBudget.
+
+//------------------------------------------------------------------------------
+
+#define LG_FREE_ALL                 \
+{                                   \
+    GrB_free (&level) ;             \
+}
+
+#include "LG_internal.h"
+#include "LAGraphX.h"
+
+int LAGraph_Cached_BFSThresholds
+(
+    // input/output:
+    LAGraph_Graph G,        // graph whose BFS thresholds are computed
+    // input:
+    int64_t ntrials,        // # of timed searches per candidate (0: none)
+    char *msg
+)
+{
+
+    //--------------------------------------------------------------------------
+    // check inputs
+    //--------------------------------------------------------------------------
+
+    LG_CLEAR_MSG ;
+    GrB_Vector level = NULL ;
+    LG_TRY (LAGraph_CheckGraph (G, msg)) ;
+    LG_ASSERT_MSG (ntrials >= 0, GrB_INVALID_VALUE, "ntrials must be >= 0") ;
+
+    GrB_Index n, nvals ;
+    GRB_TRY (GrB_Matrix_nrows (&n, G->A)) ;
+    GRB_TRY (GrB_Matrix_nvals (&nvals, G->A)) ;
+
+    // only G->out_degree may be trimmed, and only if it is computed here
+    int keep = (G->out_degree == NULL) ?
+        (LAGRAPH_CACHE_ALL & ~LAGRAPH_CACHE_OUT_DEGREE) : LAGRAPH_CACHE_ALL ;
+
+    // start with the defaults
+    double alpha = 8, beta1 = 8, beta2 = 512 ;
+
+    //--------------------------------------------------------------------------
+    // choose the thresholds from the degree distribution
+    //--------------------------------------------------------------------------
+
+    if (nvals > 0)
+    {
+        if (G->out_degree == NULL)
+        {
+            // G->out_degree is not trimmed here, but by the trim below
+            LG_TRY (LG_Cached_OutDegree (G, LAGRAPH_CACHE_ALL, msg)) ;
+        }
+        double mean, median ;
+        LG_TRY (LAGr_SampleDegree (&mean, &median, G, true, 1000, n, msg)) ;
+        if (mean > 2 * median)
+        {
+            // skewed degree: switch to pull early, and stay there longer
+            alpha = 15 ;
+            beta1 = 8 ;
+            beta2 = 18 ;
+        }
+        else if (mean <= 8)
+        {
+            // low, uniform degree: the frontier is rarely worth a pull
+            alpha = 2 ;
+            beta1 = 2 ;
+            beta2 = 512 ;
+        }
+    }
+
+    G->bfs_alpha = alpha ;
+    G->bfs_beta1 = beta1 ;
+    G->bfs_beta2 = beta2 ;
+
+    //--------------------------------------------------------------------------
+    // refine alpha by timing a few searches
+    //--------------------------------------------------------------------------
+
+    bool can_pull = (G->kind == LAGraph_ADJACENCY_UNDIRECTED ||
+        G->is_symmetric_structure == LAGraph_TRUE || G->AT != NULL) ;
+    if (ntrials == 0 || nvals == 0 || !can_pull)
+    {
+        LG_TRY (LAGraph_Cached_TrimToBudget (G, keep, msg)) ;
+        return (GrB_SUCCESS) ;
+    }
+
+    double best_time = 0, best_alpha = alpha ;
+    double scale [5] = { 1, 0.25, 0.5, 2, 4 } ;
+    for (int c = 0 ; c < 5 ; c++)
+    {
+        G->bfs_alpha = alpha * scale [c] ;
+        double t = LAGraph_WallClockTime ( ) ;
+        GrB_Index src = 0 ;
+        for (int64_t trial = 0 ; trial < ntrials ; trial++)
+        {
+            // the next source with an out-edge, at or after (trial*n)/ntrials
+            src = LAGRAPH_MAX (src, (trial * n) / ntrials) ;
+            int64_t d = 0 ;
+            for ( ; src < n ; src++)
+            {
+                GrB_Info info = GrB_Vector_extractElement (&d, G->out_degree,
+                    src) ;
+                GRB_TRY (info) ;
+                if (info == GrB_SUCCESS && d > 0) break ;
+            }
+            if (src >= n) break ;
+            LG_TRY (LAGr_BreadthFirstSearch (&level, NULL, G, src, msg)) ;
+            GrB_free (&level) ;
+            src++ ;
+        }
+        t = LAGraph_WallClockTime ( ) - t ;
+        if (c == 0 || t < 0.95 * best_time)
+        {
+            best_time = t ;
+            best_alpha = G->bfs_alpha ;
+        }
+    }
+
+    G->bfs_alpha = best_alpha ;
+    LG_TRY (LAGraph_Cached_TrimToBudget (G, keep, msg)) ;
+    return (GrB_SUCCESS) ;
+}
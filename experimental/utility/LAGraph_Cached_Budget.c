@@ -0,0 +1,158 @@
+//------------------------------------------------------------------------------
+// LAGraph_Cached_Budget: memory footprint and budget for cached properties
+//------------------------------------------------------------------------------
+
+// LAGraph, (c) 2019-2022 by The LAGraph Contributors, All Rights Reserved.
+// SPDX-License-Identifier: BSD-2-Clause
+//
+// For additional details (including references to third party source code and
+// other files) see the LICENSE file or contact permission@sei.cmu.edu. See
+// Contributors.txt for a full list of contributors. Created, in part, with
+// funding and support from the U.S. Government (see Acknowledgments.txt file).
+// DM22-0790
+
+//------------------------------------------------------------------------------
+
+// The cached properties of a graph can take as much memory as the graph
+// itself: G->AT is as large as G->A, and each degree vector takes up to 16
+// bytes per node.  These methods report the memory held by the cached
+// properties of a graph, and evict them to keep within a memory budget:
+
+// LAGraph_Cached_Footprint: returns the bytes held by a set of cached
+//      properties of G, given as a bitmask of LAGRAPH_CACHE_* values.  With
+//      SuiteSparse:GraphBLAS, the sizes are exact; otherwise they are
+//      estimated from the number of entries in each object.
+
+// LAGraph_Cached_Trim: deletes cached properties of G until the bytes held
+//      by all of them is no more than a given budget.  Properties in the keep
+//      bitmask are not deleted, even if the budget cannot then be met.  The
+//      scalar properties (G->emin, G->emax, G->nself_edges,
+//      G->is_symmetric_structure, G->bfs_alpha, G->bfs_beta1, G->bfs_beta2,
+//      and G->sssp_delta) are tiny and costly to recompute, and are never
+//      deleted.  Of the rest (G->AT, G->out_degree, and G->in_degree), the
+//      property with the most bytes held per unit of work to recompute it is
+//      deleted first:
+
+//          property        work to recompute
+//          G->AT           nvals(A) + n
+//          G->out_degree   n (from the row pointers of G->A)
+//          G->in_degree    n if G->AT is present, nvals(A) + n otherwise
+
+//      A degree vector is thus typically deleted before G->AT, but G->AT is
+//      deleted first for a graph with few edges per node.
+
+// LAGraph_Cached_SetBudget and LAGraph_Cached_GetBudget: set and get a
+//      global budget on the bytes held by the cached properties of each graph.
+//      The default is SIZE_MAX (no budget).  The budget should be set only
+//      when no other user thread is using LAGraph.
+
+// LAGraph_Cached_TrimToBudget: trims the cached properties of G to the
+//      global budget, keeping those in the keep bitmask.
+
+// The budget is applied by every method that allocates a cached property,
+// once it has computed it: LAGraph_Cached_AT, LAGraph_Cached_OutDegree, and
+// LAGraph_Cached_InDegree (and so by the Basic algorithms that call them),
+// which keep the property they just computed; LAGraph_Cached_Ensure (and so
+// LAGraph_Freeze), which keeps all the properties it was asked to compute;
+// and LAGraph_Cached_BFSThresholds and LAGraph_Cached_SSSPDelta.  A method
+// that finds its property already present does not modify G, and so does not
+// apply the budget.  The state of the budget and the trimming itself are in
+// the core library (see src/utility/LG_Cached_Budget.c); the methods here are
+// the user-callable interface to them.
+
+// The budget applies to each graph on its own; there is no process-wide
+// accounting across graphs.  A process that holds k graphs thus holds no more
+// than k times the budget in cached properties (aside from those kept because
+// they were requested), once each graph has been trimmed.  To bound the
+// total, divide the memory available for cached properties by the number of
+// graphs held.
+
+//------------------------------------------------------------------------------
+
+#define LG_FREE_ALL ;
+
+#include "LG_internal.h"
+#include "LAGraphX.h"
+
+//------------------------------------------------------------------------------
+// LAGraph_Cached_SetBudget: set the global budget for cached properties
+//------------------------------------------------------------------------------
+
+int LAGraph_Cached_SetBudget
+(
+    // input:
+    size_t budget,          // max bytes for the cached properties of a graph
+    char *msg
+)
+{
+    LG_CLEAR_MSG ;
+    LG_cached_budget = budget ;
+    return (GrB_SUCCESS) ;
+}
+
+//------------------------------------------------------------------------------
+// LAGraph_Cached_GetBudget: get the global budget for cached properties
+//------------------------------------------------------------------------------
+
+int LAGraph_Cached_GetBudget
+(
+    // output:
+    size_t *budget,         // max bytes for the cached properties of a graph
+    char *msg
+)
+{
+    LG_CLEAR_MSG ;
+    LG_ASSERT (budget != NULL, GrB_NULL_POINTER) ;
+    (*budget) = LG_cached_budget ;
+    return (GrB_SUCCESS) ;
+}
+
+//------------------------------------------------------------------------------
+// LAGraph_Cached_TrimToBudget: trim cached properties to the global budget
+//------------------------------------------------------------------------------
+
+int LAGraph_Cached_TrimToBudget
+(
+    // input/output:
+    LAGraph_Graph G,        // graph whose cached properties are trimmed
+    // input:
+    int keep,               // bitmask of LAGRAPH_CACHE_* properties to keep
+    char *msg
+)
+{
+    return (LG_Cached_TrimToBudget (G, keep, msg)) ;
+}
+
+//------------------------------------------------------------------------------
+// LAGraph_Cached_Footprint: bytes held by a set of cached properties
+//------------------------------------------------------------------------------
+
+int LAGraph_Cached_Footprint
+(
+    // output:
+    size_t *bytes,          // bytes held by the selected cached properties
+    // input:
+    const LAGraph_Graph G,
+    int properties,         // bitmask of LAGRAPH_CACHE_* properties to count
+    char *msg
+)
+{
+    return (LG_Cached_Footprint (bytes, G, properties, msg)) ;
+}
+
+//------------------------------------------------------------------------------
+// LAGraph_Cached_Trim: delete cached properties to keep within a budget
+//------------------------------------------------------------------------------
+
+int LAGraph_Cached_Trim
+(
+    // input/output:
+    LAGraph_Graph G,        // graph whose cached properties are trimmed
+    // input:
+    size_t budget,          // max bytes for all cached properties of G
+    int keep,               // bitmask of LAGRAPH_CACHE_* properties to keep
+    char *msg
+)
+{
+    return (LG_Cached_Trim (G, budget, keep, msg)) ;
+}
@@ -0,0 +1,588 @@
+//------------------------------------------------------------------------------
+// LAGraph_Cached_Ensure: compute a set of cached properties of a graph
+//------------------------------------------------------------------------------
+
+// LAGraph, (c) 2019-2022 by The LAGraph Contributors, All Rights Reserved.
+// SPDX-License-Identifier: BSD-2-Clause
+//
+// For additional details (including references to third party source code and
+// other files) see the LICENSE file or contact permission@sei.cmu.edu. See
+// Contributors.txt for a full list of contributors. Created, in part, with
+// funding and support from the U.S. Government (see Acknowledgments.txt file).
+// DM22-0790
+
+//------------------------------------------------------------------------------
+
+// LAGraph_Cached_Ensure computes each cached property of G given by the
+// properties bitmask (a combination of LAGRAPH_CACHE_AT, LAGRAPH_CACHE_*, or
+// LAGRAPH_CACHE_ALL) that is not yet known.  A property that is not needed
+// for the kind of the graph is silently skipped (G->AT and G->in_degree for
+// an undirected graph), as are properties that are already known.
+
+// With SuiteSparse:GraphBLAS, and if G->A is held in sparse CSR form with a
+// built-in type, the properties are computed together, directly from the CSR
+// arrays of G->A, rather than with one GraphBLAS call per property:
+
+//  (1) a single pass over the column indices of A counts the entries in each
+//      column and the number of self-edges.  The column counts are both
+//      G->in_degree and the first phase of the transpose of A.
+//  (2) G->out_degree is computed from the row pointers of A, and G->in_degree
+//      from the cumulative sum of the column counts, in O(n) time.  If the
+//      row and column degrees differ, G->A is unsymmetric, and the transpose
+//      is not needed to determine G->is_symmetric_structure.
+//  (3) the transpose AT is constructed with a second pass over A that
+//      scatters each entry into its place in AT.  It is kept in G->AT only if
+//      LAGRAPH_CACHE_AT is requested; if it is built only to compare the
+//      patterns of A and AT, it is freed once G->is_symmetric_structure is
+//      known.
+//  (4) G->emin and G->emax are computed together, in a single pass over the
+//      values of A (or in O(1) time if A is iso).
+
+// G->sssp_delta is computed last, once the other properties are known, by
+// LAGraph_Cached_SSSPDelta with LG_SSSP_DELTA_TRIALS probes.
+
+// G->A is unpacked for this computation, and packed back before this method
+// returns, in O(1) time.  Otherwise, each property is computed with its own
+// LAGraph_Cached_* method.  The result is identical in either case, except
+// that G->AT may be returned jumbled (its pending work is finished on its
+// first use, or by LAGraph_Freeze).
+
+// Once computed, the cached properties of G are trimmed to the global budget
+// set by LAGraph_Cached_SetBudget (see LAGraph_Cached_Trim), but none of the
+// properties requested are deleted.
+
+//------------------------------------------------------------------------------
+
+#define LG_FREE_WORK                                \
+{                                                   \
+    LAGraph_Free ((void **) &W, NULL) ;             \
+    LAGraph_Free ((void **) &ATp, NULL) ;           \
+    LAGraph_Free ((void **) &ATj, NULL) ;           \
+    LAGraph_Free ((void **) &ATx, NULL) ;           \
+    LAGraph_Free ((void **) &Xmin, NULL) ;          \
+    LAGraph_Free ((void **) &Xmax, NULL) ;          \
+    GrB_free (&AT) ;                                \
+    GrB_free (&C) ;                                 \
+    GrB_free (&out_degree) ;                        \
+    GrB_free (&in_degree) ;                         \
+    GrB_free (&emin) ;                              \
+    GrB_free (&emax) ;                              \
+}
+
+#define LG_FREE_ALL ;
+
+#include "LG_internal.h"
+#include "LAGraphX.h"
+
+#if LAGRAPH_SUITESPARSE
+
+//------------------------------------------------------------------------------
+// minmax_*: find the min and max of X [pstart:pend-1], for each built-in type
+//------------------------------------------------------------------------------
+
+// pstart < pend is required.  For the GrB_BOOL type, min and max are the same
+// as the LAND and LOR monoids used by LAGraph_Cached_EMin and EMax.
+
+#define LG_MINMAX(ctype,suffix)                                             \
+static void minmax_ ## suffix                                               \
+(                                                                           \
+    void *xmin, void *xmax, const void *Xvoid, int64_t pstart, int64_t pend \
+)                                                                           \
+{                                                                           \
+    const ctype *X = (const ctype *) Xvoid ;                                \
+    ctype lo = X [pstart], hi = X [pstart] ;                                \
+    for (int64_t p = pstart + 1 ; p < pend ; p++)                           \
+    {                                                                       \
+        ctype x = X [p] ;                                                   \
+        if (x < lo) lo = x ;                                                \
+        if (x > hi) hi = x ;                                                \
+    }                                                                       \
+    (*((ctype *) xmin)) = lo ;                                              \
+    (*((ctype *) xmax)) = hi ;                                              \
+}                                                                           \
+static GrB_Info set_ ## suffix (GrB_Scalar s, const void *x)                \
+{                                                                           \
+    return (GrB_Scalar_setElement_ ## suffix (s, *((const ctype *) x))) ;   \
+}
+
+LG_MINMAX (bool    , BOOL  )
+LG_MINMAX (int8_t  , INT8  )
+LG_MINMAX (int16_t , INT16 )
+LG_MINMAX (int32_t , INT32 )
+LG_MINMAX (int64_t , INT64 )
+LG_MINMAX (uint8_t , UINT8 )
+LG_MINMAX (uint16_t, UINT16)
+LG_MINMAX (uint32_t, UINT32)
+LG_MINMAX (uint64_t, UINT64)
+LG_MINMAX (float   , FP32  )
+LG_MINMAX (double  , FP64  )
+
+typedef void (*minmax_function) (void *, void *, const void *, int64_t,
+    int64_t) ;
+typedef GrB_Info (*set_function) (GrB_Scalar, const void *) ;
+
+//------------------------------------------------------------------------------
+// degree_vector: construct a degree vector from a CSR or CSC pointer array
+//------------------------------------------------------------------------------
+
+// degree(i) = Ptr [i+1] - Ptr [i], with no explicit zeros, as required for
+// G->out_degree and G->in_degree.  The vector is constructed in bitmap form.
+
+#undef  LG_FREE_ALL
+#define LG_FREE_ALL                                 \
+{                                                   \
+    LAGraph_Free ((void **) &Db, NULL) ;            \
+    LAGraph_Free ((void **) &Dx, NULL) ;            \
+    GrB_free (degree) ;                             \
+}
+
+static int degree_vector
+(
+    // output:
+    GrB_Vector *degree,
+    // input:
+    const GrB_Index *Ptr,       // size n+1
+    GrB_Index n,
+    int nthreads,
+    char *msg
+)
+{
+    int8_t *Db = NULL ;
+    int64_t *Dx = NULL ;
+    LG_TRY (LAGraph_Malloc ((void **) &Db, LAGRAPH_MAX (n, 1),
+        sizeof (int8_t), msg)) ;
+    LG_TRY (LAGraph_Malloc ((void **) &Dx, LAGRAPH_MAX (n, 1),
+        sizeof (int64_t), msg)) ;
+    int64_t nvals = 0, i ;
+    #pragma omp parallel for num_threads(nthreads) schedule(static) \
+        reduction(+:nvals)
+    for (i = 0 ; i < (int64_t) n ; i++)
+    {
+        int64_t d = (int64_t) (Ptr [i+1] - Ptr [i]) ;
+        Dx [i] = d ;
+        Db [i] = (d > 0) ;
+        nvals += (d > 0) ;
+    }
+    GRB_TRY (GrB_Vector_new (degree, GrB_INT64, n)) ;
+    GRB_TRY (GxB_Vector_pack_Bitmap (*degree, &Db, (void **) &Dx,
+        LAGRAPH_MAX (n, 1) * sizeof (int8_t),
+        LAGRAPH_MAX (n, 1) * sizeof (int64_t), false, nvals, NULL)) ;
+    return (GrB_SUCCESS) ;
+}
+
+#endif
+
+//------------------------------------------------------------------------------
+// LAGraph_Cached_Ensure
+//------------------------------------------------------------------------------
+
+#undef  LG_FREE_ALL
+#if LAGRAPH_SUITESPARSE
+#define LG_FREE_ALL                                                         \
+{                                                                           \
+    LG_FREE_WORK ;                                                          \
+    if (unpacked)                                                           \
+    {                                                                       \
+        /* pack A back into G->A; this does not fail */                     \
+        GxB_Matrix_pack_CSR (G->A, &Ap, &Aj, &Ax, Ap_size, Aj_size,         \
+            Ax_size, A_iso, A_jumbled, NULL) ;                              \
+    }                                                                       \
+}
+#else
+#define LG_FREE_ALL LG_FREE_WORK ;
+#endif
+
+int LAGraph_Cached_Ensure
+(
+    // input/output:
+    LAGraph_Graph G,        // graph whose cached properties are computed
+    // input:
+    int properties,         // bitmask of LAGRAPH_CACHE_* properties needed
+    char *msg
+)
+{
+
+    //--------------------------------------------------------------------------
+    // check inputs
+    //--------------------------------------------------------------------------
+
+    GrB_Index *W = NULL, *ATp = NULL, *ATj = NULL, *Ap = NULL, *Aj = NULL ;
+    void *ATx = NULL, *Ax = NULL, *Xmin = NULL, *Xmax = NULL ;
+    GrB_Index Ap_size = 0, Aj_size = 0, Ax_size = 0 ;
+    bool A_iso = false, A_jumbled = false, unpacked = false ;
+    GrB_Matrix AT = NULL, C = NULL ;
+    GrB_Vector out_degree = NULL, in_degree = NULL ;
+    GrB_Scalar emin = NULL, emax = NULL ;
+    LG_CLEAR_MSG_AND_BASIC_ASSERT (G, msg) ;
+
+    //--------------------------------------------------------------------------
+    // determine the properties to compute
+    //--------------------------------------------------------------------------
+
+    bool undirected = (G->kind == LAGraph_ADJACENCY_UNDIRECTED) ;
+    if (undirected && (properties & LAGRAPH_CACHE_SYMMETRIC_STRUCTURE))
+    {
+        // this takes O(1) time
+        LG_TRY (LAGraph_Cached_IsSymmetricStructure (G, msg)) ;
+    }
+
+    bool need_AT = (properties & LAGRAPH_CACHE_AT) &&
+        !undirected && G->AT == NULL ;
+    bool need_out = (properties & LAGRAPH_CACHE_OUT_DEGREE) &&
+        G->out_degree == NULL ;
+    bool need_in = (properties & LAGRAPH_CACHE_IN_DEGREE) &&
+        !undirected && G->in_degree == NULL ;
+    bool need_sym = (properties & LAGRAPH_CACHE_SYMMETRIC_STRUCTURE) &&
+        G->is_symmetric_structure == LAGRAPH_UNKNOWN ;
+    bool need_nself = (properties & LAGRAPH_CACHE_NSELF_EDGES) &&
+        G->nself_edges == LAGRAPH_UNKNOWN ;
+    bool need_emin = (properties & LAGRAPH_CACHE_EMIN) && G->emin == NULL ;
+    bool need_emax = (properties & LAGRAPH_CACHE_EMAX) && G->emax == NULL ;
+    bool need_sssp = (properties & LAGRAPH_CACHE_SSSP_DELTA) &&
+        G->sssp_delta <= 0 ;
+
+    if (!(need_AT || need_out || need_in || need_sym || need_nself ||
+          need_emin || need_emax))
+    {
+        // nothing to do, except perhaps G->sssp_delta
+        if (need_sssp)
+        {
+            LG_TRY (LAGraph_Cached_SSSPDelta (G, LG_SSSP_DELTA_TRIALS, msg)) ;
+            LG_TRY (LAGraph_Cached_TrimToBudget (G, properties, msg)) ;
+        }
+        return (GrB_SUCCESS) ;
+    }
+
+    GrB_Matrix A = G->A ;
+    GrB_Index nrows, ncols, nvals ;
+    GRB_TRY (GrB_Matrix_nrows (&nrows, A)) ;
+    GRB_TRY (GrB_Matrix_ncols (&ncols, A)) ;
+    GRB_TRY (GrB_Matrix_nvals (&nvals, A)) ;
+    if (need_sym && nrows != ncols)
+    {
+        // A is rectangular and thus cannot be symmetric
+        G->is_symmetric_structure = LAGraph_FALSE ;
+        need_sym = false ;
+    }
+
+    //--------------------------------------------------------------------------
+    // determine if the CSR arrays of G->A can be used
+    //--------------------------------------------------------------------------
+
+    bool fused = false ;
+    GrB_Type atype = NULL ;
+    #if LAGRAPH_SUITESPARSE
+    {
+        GxB_Format_Value fmt ;
+        int sparsity ;
+        char atype_name [LAGRAPH_MAX_NAME_LEN] ;
+        GRB_TRY (GxB_get (A, GxB_FORMAT, &fmt)) ;
+        GRB_TRY (GxB_get (A, GxB_SPARSITY_STATUS, &sparsity)) ;
+        LG_TRY (LAGraph_Matrix_TypeName (atype_name, A, msg)) ;
+        // a user-defined type is not found by LAGraph_TypeFromName
+        int result = LAGraph_TypeFromName (&atype, atype_name, msg) ;
+        LG_CLEAR_MSG ;
+        fused = (fmt == GxB_BY_ROW && sparsity == GxB_SPARSE &&
+            result == GrB_SUCCESS) ;
+    }
+    #endif
+
+    if (!fused)
+    {
+
+        //----------------------------------------------------------------------
+        // compute each property with its own method
+        //----------------------------------------------------------------------
+
+        // Each method would trim G to the budget once it computes its
+        // property.  The trim is instead done just once, below, keeping all
+        // the properties requested.
+        if (need_AT    ) LG_TRY (LG_Cached_AT (G, LAGRAPH_CACHE_ALL, msg)) ;
+        if (need_sym)
+        {
+            bool had_AT = (G->AT != NULL) ;
+            // compute G->AT here, with no trim, for the symmetry test
+            LG_TRY (LG_Cached_AT (G, LAGRAPH_CACHE_ALL, msg)) ;
+            LG_TRY (LAGraph_Cached_IsSymmetricStructure (G, msg)) ;
+            if (!had_AT && !(properties & LAGRAPH_CACHE_AT))
+            {
+                // G->AT was only needed to determine the symmetry
+                GRB_TRY (GrB_free (&(G->AT))) ;
+            }
+        }
+        if (need_out   ) LG_TRY (LG_Cached_OutDegree (G, LAGRAPH_CACHE_ALL,
+            msg)) ;
+        if (need_in    ) LG_TRY (LG_Cached_InDegree (G, LAGRAPH_CACHE_ALL,
+            msg)) ;
+        if (need_nself ) LG_TRY (LAGraph_Cached_NSelfEdges (G, msg)) ;
+        if (need_emin  ) LG_TRY (LAGraph_Cached_EMin (G, msg)) ;
+        if (need_emax  ) LG_TRY (LAGraph_Cached_EMax (G, msg)) ;
+        if (need_sssp  ) LG_TRY (LAGraph_Cached_SSSPDelta (G,
+            LG_SSSP_DELTA_TRIALS, msg)) ;
+        LG_TRY (LAGraph_Cached_TrimToBudget (G, properties, msg)) ;
+        return (GrB_SUCCESS) ;
+    }
+
+    #if LAGRAPH_SUITESPARSE
+
+    //--------------------------------------------------------------------------
+    // unpack G->A
+    //--------------------------------------------------------------------------
+
+    GRB_TRY (GxB_Matrix_unpack_CSR (A, &Ap, &Aj, &Ax, &Ap_size, &Aj_size,
+        &Ax_size, &A_iso, &A_jumbled, NULL)) ;
+    unpacked = true ;
+
+    size_t typesize ;
+    GRB_TRY (GxB_Type_size (&typesize, atype)) ;
+
+    int nthreads = LG_nthreads_outer * LG_nthreads_inner ;
+    nthreads = LAGRAPH_MIN (nthreads, (nvals + nrows) / 4096) ;
+    nthreads = LAGRAPH_MAX (nthreads, 1) ;
+
+    //--------------------------------------------------------------------------
+    // phase 1: count the entries in each column, and the self-edges
+    //--------------------------------------------------------------------------
+
+    bool need_counts = need_AT || need_in || need_sym ;
+    bool build_AT = need_AT ;
+    int64_t nself = 0, i ;
+    if (need_counts)
+    {
+        LG_TRY (LAGraph_Calloc ((void **) &W, ncols + 1, sizeof (GrB_Index),
+            msg)) ;
+    }
+
+    if (need_counts || need_nself)
+    {
+        #pragma omp parallel for num_threads(nthreads) \
+            schedule(dynamic,4096) reduction(+:nself)
+        for (i = 0 ; i < (int64_t) nrows ; i++)
+        {
+            for (GrB_Index p = Ap [i] ; p < Ap [i+1] ; p++)
+            {
+                GrB_Index j = Aj [p] ;
+                nself += (j == (GrB_Index) i) ;
+                if (W != NULL)
+                {
+                    #pragma omp atomic update
+                    W [j]++ ;
+                }
+            }
+        }
+    }
+
+    //--------------------------------------------------------------------------
+    // phase 2: degrees, and the row pointers of AT
+    //--------------------------------------------------------------------------
+
+    if (need_counts)
+    {
+        // ATp = cumsum ([0 W])
+        LG_TRY (LAGraph_Malloc ((void **) &ATp, ncols + 1, sizeof (GrB_Index),
+            msg)) ;
+        ATp [0] = 0 ;
+        for (GrB_Index j = 0 ; j < ncols ; j++)
+        {
+            ATp [j+1] = ATp [j] + W [j] ;
+        }
+    }
+
+    if (need_out)
+    {
+        LG_TRY (degree_vector (&out_degree, Ap, nrows, nthreads, msg)) ;
+    }
+    if (need_in)
+    {
+        LG_TRY (degree_vector (&in_degree, ATp, ncols, nthreads, msg)) ;
+    }
+
+    if (need_sym)
+    {
+        // If any row degree differs from its column degree, A is unsymmetric
+        // and AT is not needed to determine this.
+        bool differ = false ;
+        #pragma omp parallel for num_threads(nthreads) schedule(static) \
+            reduction(||:differ)
+        for (i = 0 ; i < (int64_t) nrows ; i++)
+        {
+            differ = differ || (Ap [i+1] - Ap [i] != ATp [i+1] - ATp [i]) ;
+        }
+        if (differ)
+        {
+            G->is_symmetric_structure = LAGraph_FALSE ;
+            need_sym = false ;
+        }
+        else
+        {
+            // AT is needed to compare the patterns of A and AT
+            build_AT = build_AT || G->AT == NULL ;
+        }
+    }
+
+    //--------------------------------------------------------------------------
+    // phase 3: construct AT
+    //--------------------------------------------------------------------------
+
+    GrB_Index ATj_size = 0, ATx_size = 0 ;
+    if (build_AT)
+    {
+        // W = ATp [0:ncols-1], the position of the next entry in each row of AT
+        memcpy (W, ATp, ncols * sizeof (GrB_Index)) ;
+        ATj_size = LAGRAPH_MAX (nvals, 1) * sizeof (GrB_Index) ;
+        ATx_size = (A_iso ? 1 : LAGRAPH_MAX (nvals, 1)) * typesize ;
+        LG_TRY (LAGraph_Malloc ((void **) &ATj, LAGRAPH_MAX (nvals, 1),
+            sizeof (GrB_Index), msg)) ;
+        LG_TRY (LAGraph_Malloc ((void **) &ATx, ATx_size, sizeof (uint8_t),
+            msg)) ;
+        if (A_iso)
+        {
+            memcpy (ATx, Ax, typesize) ;
+        }
+
+        // scatter each entry A(i,j) into AT(j,i)
+        const uint8_t *Ax_bytes = (const uint8_t *) Ax ;
+        uint8_t *ATx_bytes = (uint8_t *) ATx ;
+        #pragma omp parallel for num_threads(nthreads) schedule(dynamic,4096)
+        for (i = 0 ; i < (int64_t) nrows ; i++)
+        {
+            for (GrB_Index p = Ap [i] ; p < Ap [i+1] ; p++)
+            {
+                GrB_Index j = Aj [p], q ;
+                #pragma omp atomic capture
+                q = W [j]++ ;
+                ATj [q] = (GrB_Index) i ;
+                if (!A_iso)
+                {
+                    memcpy (ATx_bytes + q * typesize, Ax_bytes + p * typesize,
+                        typesize) ;
+                }
+            }
+        }
+    }
+
+    //--------------------------------------------------------------------------
+    // phase 4: emin and emax
+    //--------------------------------------------------------------------------
+
+    if (need_emin || need_emax)
+    {
+        minmax_function minmax ;
+        set_function set ;
+        if      (atype == GrB_BOOL  ) { minmax = minmax_BOOL  ; set = set_BOOL  ;}
+        else if (atype == GrB_INT8  ) { minmax = minmax_INT8  ; set = set_INT8  ;}
+        else if (atype == GrB_INT16 ) { minmax = minmax_INT16 ; set = set_INT16 ;}
+        else if (atype == GrB_INT32 ) { minmax = minmax_INT32 ; set = set_INT32 ;}
+        else if (atype == GrB_INT64 ) { minmax = minmax_INT64 ; set = set_INT64 ;}
+        else if (atype == GrB_UINT8 ) { minmax = minmax_UINT8 ; set = set_UINT8 ;}
+        else if (atype == GrB_UINT16) { minmax = minmax_UINT16; set = set_UINT16;}
+        else if (atype == GrB_UINT32) { minmax = minmax_UINT32; set = set_UINT32;}
+        else if (atype == GrB_UINT64) { minmax = minmax_UINT64; set = set_UINT64;}
+        else if (atype == GrB_FP32  ) { minmax = minmax_FP32  ; set = set_FP32  ;}
+        else                          { minmax = minmax_FP64  ; set = set_FP64  ;}
+
+        GRB_TRY (GrB_Scalar_new (&emin, atype)) ;
+        GRB_TRY (GrB_Scalar_new (&emax, atype)) ;
+        if (nvals > 0)
+        {
+            // each task finds the min and max of its part of Ax
+            int64_t xlen = A_iso ? 1 : (int64_t) nvals ;
+            int ntasks = (int) LAGRAPH_MIN (nthreads, xlen) ;
+            LG_TRY (LAGraph_Malloc (&Xmin, ntasks, typesize, msg)) ;
+            LG_TRY (LAGraph_Malloc (&Xmax, ntasks, typesize, msg)) ;
+            int tid ;
+            #pragma omp parallel for num_threads(ntasks) schedule(static)
+            for (tid = 0 ; tid < ntasks ; tid++)
+            {
+                int64_t pstart = (xlen * tid) / ntasks ;
+                int64_t pend = (xlen * (tid+1)) / ntasks ;
+                minmax ((uint8_t *) Xmin + tid * typesize,
+                        (uint8_t *) Xmax + tid * typesize, Ax, pstart, pend) ;
+            }
+            // combine the results of each task
+            uint64_t lo [2], hi [2], unused [2] ;
+            minmax (lo, unused, Xmin, 0, ntasks) ;
+            minmax (unused, hi, Xmax, 0, ntasks) ;
+            GRB_TRY (set (emin, lo)) ;
+            GRB_TRY (set (emax, hi)) ;
+        }
+    }
+
+    //--------------------------------------------------------------------------
+    // pack A back into G->A, and pack AT
+    //--------------------------------------------------------------------------
+
+    GRB_TRY (GxB_Matrix_pack_CSR (A, &Ap, &Aj, &Ax, Ap_size, Aj_size, Ax_size,
+        A_iso, A_jumbled, NULL)) ;
+    unpacked = false ;
+
+    if (build_AT)
+    {
+        GRB_TRY (GrB_Matrix_new (&AT, atype, ncols, nrows)) ;
+        GRB_TRY (GxB_Matrix_pack_CSR (AT, &ATp, &ATj, &ATx,
+            (ncols + 1) * sizeof (GrB_Index), ATj_size, ATx_size, A_iso,
+            /* AT is jumbled if constructed in parallel: */ (nthreads > 1),
+            NULL)) ;
+    }
+
+    //--------------------------------------------------------------------------
+    // save the properties in G
+    //--------------------------------------------------------------------------
+
+    if (need_AT)
+    {
+        G->AT = AT ;
+        AT = NULL ;
+    }
+    if (need_out)
+    {
+        G->out_degree = out_degree ;
+        out_degree = NULL ;
+    }
+    if (need_in)
+    {
+        G->in_degree = in_degree ;
+        in_degree = NULL ;
+    }
+    if (need_nself)
+    {
+        G->nself_edges = nself ;
+    }
+    if (need_emin)
+    {
+        G->emin = emin ;
+        G->emin_state = LAGraph_VALUE ;
+        emin = NULL ;
+    }
+    if (need_emax)
+    {
+        G->emax = emax ;
+        G->emax_state = LAGraph_VALUE ;
+        emax = NULL ;
+    }
+    if (need_sym)
+    {
+        // compare the patterns of A and AT, using G->AT if it is present, or
+        // the AT just constructed otherwise (which is then freed)
+        GrB_Matrix T = (G->AT != NULL) ? G->AT : AT ;
+        GrB_Index nvals_both ;
+        GRB_TRY (GrB_Matrix_new (&C, GrB_BOOL, nrows, nrows)) ;
+        GRB_TRY (GrB_eWiseMult (C, NULL, NULL, GrB_ONEB_BOOL, A, T, NULL)) ;
+        GRB_TRY (GrB_Matrix_nvals (&nvals_both, C)) ;
+        G->is_symmetric_structure =
+            (nvals_both == nvals) ? LAGraph_TRUE : LAGraph_FALSE ;
+    }
+
+    //--------------------------------------------------------------------------
+    // free workspace, compute G->sssp_delta, and trim to the budget
+    //--------------------------------------------------------------------------
+
+    LG_FREE_WORK ;
+    if (need_sssp)
+    {
+        LG_TRY (LAGraph_Cached_SSSPDelta (G, LG_SSSP_DELTA_TRIALS, msg)) ;
+    }
+    LG_TRY (LAGraph_Cached_TrimToBudget (G, properties, msg)) ;
+    #endif
+    return (GrB_SUCCESS) ;
+}
@@ -0,0 +1,49 @@
+//------------------------------------------------------------------------------
+// LAGraph_Cached_SSSPDelta: choose Delta for delta-stepping SSSP on a graph
+//------------------------------------------------------------------------------
+
+// LAGraph, (c) 2019-2022 by The LAGraph Contributors, All Rights Reserved.
+// SPDX-License-Identifier: BSD-2-Clause
+//
+// For additional details (including references to third party source code and
+// other files) see the LICENSE file or contact permission@sei.cmu.edu. See
+// Contributors.txt for a full list of contributors. Created, in part, with
+// funding and support from the U.S. Government (see Acknowledgments.txt file).
+// DM22-0790
+
+//------------------------------------------------------------------------------
+
+// LAGraph_Cached_SSSPDelta computes G->sssp_delta, the Delta used by
+// LAGraph_SingleSourceShortestPath, from up to ntrials BFS probes spread over
+// the nodes with at least one out-edge.  G->emin, G->emax, and G->out_degree
+// are computed first, if not present.  The computation is done by
+// LG_Cached_SSSPDelta (see src/utility/LG_Cached_SSSPDelta.c), which
+// LAGraph_SingleSourceShortestPath also uses when G->sssp_delta is not known.
+
+// G->sssp_delta is a performance hint only: the path lengths found by
+// LAGraph_SingleSourceShortestPath do not depend on it.  It is computed by
+// LAGraph_Cached_Ensure (with LAGRAPH_CACHE_SSSP_DELTA) and by LAGraph_Freeze,
+// and cleared by LAGraph_DeleteCached.  G->out_degree, if computed here, may
+// then be deleted to keep within the budget set by LAGraph_Cached_SetBudget.
+
+//------------------------------------------------------------------------------
+
+#define LG_FREE_ALL ;
+
+#include "LG_internal.h"
+#include "LAGraphX.h"
+
+int LAGraph_Cached_SSSPDelta
+(
+    // input/output:
+    LAGraph_Graph G,        // graph whose Delta is computed
+    // input:
+    int64_t ntrials,        // max # of BFS probes
+    char *msg
+)
+{
+    LG_CLEAR_MSG ;
+    LG_TRY (LAGraph_CheckGraph (G, msg)) ;
+    LG_ASSERT_MSG (ntrials > 0, GrB_INVALID_VALUE, "ntrials must be > 0") ;
+    return (LG_Cached_SSSPDelta (G, ntrials, msg)) ;
+}
@@ -0,0 +1,905 @@
+//------------------------------------------------------------------------------
+// LAGraph_EdgeListRead: read a graph from an edge-list file (SNAP, TSV, CSV)
+//------------------------------------------------------------------------------
+
+// LAGraph, (c) 2019-2022 by The LAGraph Contributors, All Rights Reserved.
+// SPDX-License-Identifier: BSD-2-Clause
+//
+// For additional details (including references to third party source code and
+// other files) see the LICENSE file or contact permission@sei.cmu.edu. See
+// Contributors.txt for a full list of contributors. Created, in part, with
+// funding and support from the U.S. Government (see Acknowledgments.txt file).
+// DM22-0790
+
+//------------------------------------------------------------------------------
+
+// LAGraph_EdgeListRead reads a graph from a text file with one edge per line,
+// such as the files from the SNAP collection (snap.stanford.edu/data):
+//
+//      # Directed graph: example.txt
+//      # FromNodeId    ToNodeId
+//      0       1
+//      0       17
+//      1       42
+//
+// Each line holds the ID of the source node and the ID of the destination
+// node, and optionally a weight.  Any further fields on the line are ignored.
+// The fields are separated by commas (a CSV file) or by spaces and tabs (a
+// SNAP or TSV file); the delimiter is found from the first edge in the file.
+// Blank lines, and lines starting with '#' or '%', are ignored.  A field may
+// be enclosed in double quotes, which are removed.
+
+// Node IDs are either unsigned 64-bit integers, or arbitrary strings.  If the
+// IDs on the first edge are integers, all IDs must be integers; otherwise the
+// IDs are compared as strings.  If the first edge has a third field that is a
+// number, each edge must have a weight.  If the IDs on the first line are not
+// integers but those on the next line are, or the next line has a weight but
+// the first does not, the first line is taken as a header (such as
+// "source,target,weight" in a CSV file) and skipped.
+
+// The n distinct node IDs found in the file are renumbered 0 to n-1, in
+// ascending order of the integer IDs, or in lexicographic order of the string
+// IDs.  A is returned as an n-by-n matrix: GrB_FP64 if the edges have weights,
+// or an iso-valued GrB_BOOL matrix with all entries true otherwise.  If an edge
+// appears more than once, its weights are summed.  If the IDs are integers,
+// the GrB_UINT64 vector ids is returned with ids(k) the ID of node k; it is
+// returned as NULL if the IDs are strings.  If names is not NULL, names [k]
+// is returned as the ID of node k, as a string, for either kind of ID.  The
+// names array and the strings are held in a single block of memory, which is
+// freed with LAGraph_Free ((void **) &names, msg).
+
+// The file is read in large blocks of lines with LG_lines, in the same way as
+// the entries of LAGraph_MMRead, so it may be compressed with gzip or zstd,
+// and it need not be seekable.  Each block is parsed in parallel, and the node
+// IDs are found in a hash table shared by all threads.  The first thread to
+// find a new ID adds it to the table and gives it the next node number.  These
+// node numbers depend on the order in which the threads find each ID, so they
+// are renumbered once the whole file has been read, by sorting the IDs.
+
+// Return values:
+//  GrB_SUCCESS: the graph has been read
+//  LAGRAPH_IO_ERROR: a line of the file is invalid, or the file is truncated
+//  GrB_NULL_POINTER: A or f are NULL
+//  GrB_NOT_IMPLEMENTED: the file is compressed, and LAGraph was compiled
+//      without zlib (for gzip) or libzstd (for zstd)
+//  other: return values directly from GrB_* methods
+
+#define LG_FREE_WORK                                            \
+{                                                               \
+    LG_lines_free (&L) ;                                        \
+    LG_stream_close (&s) ;                                      \
+    free_map (&M) ;                                             \
+    LAGraph_Free ((void **) &I, NULL) ;                         \
+    LAGraph_Free ((void **) &J, NULL) ;                         \
+    LAGraph_Free ((void **) &X, NULL) ;                         \
+    LAGraph_Free ((void **) &Work, NULL) ;                      \
+    LAGraph_Free ((void **) &K0, NULL) ;                        \
+    LAGraph_Free ((void **) &K1, NULL) ;                        \
+    LAGraph_Free ((void **) &Rank, NULL) ;                      \
+    LAGraph_Free ((void **) &Sorted, NULL) ;                    \
+}
+
+#define LG_FREE_ALL                                             \
+{                                                               \
+    LG_FREE_WORK ;                                              \
+    GrB_free (A) ;                                              \
+    if (ids != NULL) GrB_free (ids) ;                           \
+    if (names != NULL) LAGraph_Free ((void **) names, NULL) ;   \
+}
+
+#include "LG_internal.h"
+#include "LAGraphX.h"
+#include <errno.h>
+
+// size of each block of the file
+#define BLOCK (64*1024*1024)
+
+// status of each line
+#define EL_OK       0   // valid line
+#define EL_LINE     1   // missing node ID or weight
+#define EL_ID       2   // node ID is not an integer
+#define EL_WEIGHT   3   // weight is not a number
+
+//------------------------------------------------------------------------------
+// node_map: the hash table of node IDs, and the nodes found so far
+//------------------------------------------------------------------------------
+
+// Each slot of the hash table is empty (Hstate [k] == 0), being filled by the
+// thread that claimed it (Hstate [k] == 1), or holds a node (Hstate [k] == 3).
+// A slot is claimed with an atomic fetch-and-or of Hstate [k], and the thread
+// that finds it empty owns it.  For integer IDs, Hkey [k] is the ID itself;
+// for string IDs, it is a hash of the string, and the string is compared as
+// well.
+
+typedef struct
+{
+    uint64_t *Hkey ;        // ID, or hash of the ID, of the node in each slot
+    int64_t *Hnode ;        // node in each slot
+    uint8_t *Hstate ;       // state of each slot
+    uint64_t hsize ;        // size of the hash table, a power of 2
+    int64_t nnodes ;        // # of nodes found so far
+    int64_t nodes_size ;    // size of NodeId or NodeName
+    uint64_t *NodeId ;      // ID of each node (integer IDs only)
+    char **NodeName ;       // ID of each node (string IDs only)
+    char **Pool ;           // blocks holding the strings in NodeName
+    int64_t npool ;         // # of blocks in the Pool
+    int64_t pool_size ;     // size of the Pool array
+    bool strings ;          // true if the IDs are strings
+}
+node_map ;
+
+static void free_map (node_map *M)
+{
+    LAGraph_Free ((void **) &(M->Hkey), NULL) ;
+    LAGraph_Free ((void **) &(M->Hnode), NULL) ;
+    LAGraph_Free ((void **) &(M->Hstate), NULL) ;
+    LAGraph_Free ((void **) &(M->NodeId), NULL) ;
+    LAGraph_Free ((void **) &(M->NodeName), NULL) ;
+    for (int64_t k = 0 ; k < M->npool ; k++)
+    {
+        LAGraph_Free ((void **) &(M->Pool [k]), NULL) ;
+    }
+    LAGraph_Free ((void **) &(M->Pool), NULL) ;
+    M->npool = 0 ;
+}
+
+//------------------------------------------------------------------------------
+// hash_int, hash_string: hash functions for node IDs
+//------------------------------------------------------------------------------
+
+static inline uint64_t hash_int (uint64_t x)
+{
+    // the finalizer of splitmix64
+    x = (x ^ (x >> 30)) * 0xBF58476D1CE4E5B9ULL ;
+    x = (x ^ (x >> 27)) * 0x94D049BB133111EBULL ;
+    return (x ^ (x >> 31)) ;
+}
+
+static inline uint64_t hash_string (const char *s)
+{
+    // 64-bit FNV-1a
+    uint64_t h = 0xCBF29CE484222325ULL ;
+    for ( ; *s != '\0' ; s++)
+    {
+        h = (h ^ (uint8_t) (*s)) * 0x100000001B3ULL ;
+    }
+    return (h) ;
+}
+
+//------------------------------------------------------------------------------
+// claim_slot: claim an empty slot of the hash table
+//------------------------------------------------------------------------------
+
+// Returns true if the slot was empty, and is now owned by this thread.
+
+static inline bool claim_slot (uint8_t *state)
+{
+    uint8_t old ;
+    #pragma omp atomic capture
+    {
+        old = (*state) ;
+        (*state) |= 1 ;
+    }
+    return (old == 0) ;
+}
+
+// wait until a claimed slot holds its node
+static inline void wait_for_slot (uint8_t *state)
+{
+    uint8_t s ;
+    do
+    {
+        #pragma omp atomic read
+        s = (*state) ;
+    }
+    while (s != 3) ;
+    #pragma omp flush
+}
+
+// mark a claimed slot as holding its node
+static inline void fill_slot (uint8_t *state)
+{
+    #pragma omp flush
+    #pragma omp atomic update
+    (*state) |= 2 ;
+}
+
+//------------------------------------------------------------------------------
+// find_node: find a node ID in the hash table, adding it if not present
+//------------------------------------------------------------------------------
+
+// For string IDs, name is the ID and key is its hash; the name is not copied.
+// Returns the node number of the ID.
+
+static inline int64_t find_node
+(
+    node_map *M,
+    uint64_t key,
+    char *name
+)
+{
+    uint64_t hmask = M->hsize - 1 ;
+    for (uint64_t k = hash_int (key) & hmask ; ; k = (k + 1) & hmask)
+    {
+        uint8_t state ;
+        #pragma omp atomic read
+        state = M->Hstate [k] ;
+        if (state == 0 && claim_slot (&(M->Hstate [k])))
+        {
+            // the ID is not in the table; add it as a new node
+            int64_t node ;
+            #pragma omp atomic capture
+            node = M->nnodes++ ;
+            M->Hkey [k] = key ;
+            M->Hnode [k] = node ;
+            if (M->strings)
+            {
+                M->NodeName [node] = name ;
+            }
+            else
+            {
+                M->NodeId [node] = key ;
+            }
+            fill_slot (&(M->Hstate [k])) ;
+            return (node) ;
+        }
+        wait_for_slot (&(M->Hstate [k])) ;
+        if (M->Hkey [k] == key && (!M->strings ||
+            strcmp (M->NodeName [M->Hnode [k]], name) == 0))
+        {
+            // the ID has been found
+            return (M->Hnode [k]) ;
+        }
+    }
+}
+
+//------------------------------------------------------------------------------
+// grow_map: ensure the node map has space for more nodes
+//------------------------------------------------------------------------------
+
+// The hash table is kept at most half full.
+
+#undef  LG_FREE_ALL
+#define LG_FREE_ALL                             \
+{                                               \
+    LAGraph_Free ((void **) &Hkey, NULL) ;      \
+    LAGraph_Free ((void **) &Hnode, NULL) ;     \
+    LAGraph_Free ((void **) &Hstate, NULL) ;    \
+}
+
+static int grow_map
+(
+    node_map *M,
+    int64_t nnodes_max,     // max # of nodes after the next block
+    int nthreads,
+    char *msg
+)
+{
+    uint64_t *Hkey = NULL ;
+    int64_t *Hnode = NULL ;
+    uint8_t *Hstate = NULL ;
+
+    //--------------------------------------------------------------------------
+    // grow the list of nodes
+    //--------------------------------------------------------------------------
+
+    if (nnodes_max > M->nodes_size)
+    {
+        int64_t size = LAGRAPH_MAX (2 * M->nodes_size, nnodes_max) ;
+        if (M->strings)
+        {
+            LG_TRY (LAGraph_Realloc ((void **) &(M->NodeName), size,
+                M->nodes_size, sizeof (char *), msg)) ;
+        }
+        else
+        {
+            LG_TRY (LAGraph_Realloc ((void **) &(M->NodeId), size,
+                M->nodes_size, sizeof (uint64_t), msg)) ;
+        }
+        M->nodes_size = size ;
+    }
+
+    //--------------------------------------------------------------------------
+    // grow the hash table
+    //--------------------------------------------------------------------------
+
+    if ((uint64_t) (2 * nnodes_max) <= M->hsize) return (GrB_SUCCESS) ;
+    uint64_t hsize = 1024 ;
+    while (hsize < (uint64_t) (2 * nnodes_max)) hsize = 2 * hsize ;
+    LG_TRY (LAGraph_Malloc ((void **) &Hkey, hsize, sizeof (uint64_t), msg)) ;
+    LG_TRY (LAGraph_Malloc ((void **) &Hnode, hsize, sizeof (int64_t), msg)) ;
+    LG_TRY (LAGraph_Calloc ((void **) &Hstate, hsize, sizeof (uint8_t), msg)) ;
+
+    // move the nodes from the old table into the new one; all of the IDs are
+    // distinct, so each is placed in the first empty slot found
+    uint64_t hmask = hsize - 1 ;
+    int64_t k ;
+    #pragma omp parallel for num_threads(nthreads) schedule(static)
+    for (k = 0 ; k < (int64_t) M->hsize ; k++)
+    {
+        if (M->Hstate [k] == 0) continue ;
+        uint64_t key = M->Hkey [k] ;
+        uint64_t h = hash_int (key) & hmask ;
+        while (!claim_slot (&(Hstate [h]))) h = (h + 1) & hmask ;
+        Hkey [h] = key ;
+        Hnode [h] = M->Hnode [k] ;
+        fill_slot (&(Hstate [h])) ;
+    }
+
+    LAGraph_Free ((void **) &(M->Hkey), NULL) ;
+    LAGraph_Free ((void **) &(M->Hnode), NULL) ;
+    LAGraph_Free ((void **) &(M->Hstate), NULL) ;
+    M->Hkey = Hkey ;
+    M->Hnode = Hnode ;
+    M->Hstate = Hstate ;
+    M->hsize = hsize ;
+    return (GrB_SUCCESS) ;
+}
+
+//------------------------------------------------------------------------------
+// save_names: copy the names of new nodes out of the block buffer
+//------------------------------------------------------------------------------
+
+// The names of nodes first found in the current block point into the block
+// buffer.  They are copied into a new block of the Pool, which is never
+// moved, before the buffer is reused for the next block.
+
+#undef  LG_FREE_ALL
+#define LG_FREE_ALL ;
+
+static int save_names
+(
+    node_map *M,
+    int64_t first,          // first node found in the current block
+    char *msg
+)
+{
+    if (first == M->nnodes) return (GrB_SUCCESS) ;
+    if (M->npool == M->pool_size)
+    {
+        int64_t size = LAGRAPH_MAX (2 * M->pool_size, 64) ;
+        LG_TRY (LAGraph_Realloc ((void **) &(M->Pool), size, M->pool_size,
+            sizeof (char *), msg)) ;
+        M->pool_size = size ;
+    }
+    size_t len = 0 ;
+    for (int64_t node = first ; node < M->nnodes ; node++)
+    {
+        len += strlen (M->NodeName [node]) + 1 ;
+    }
+    char *pool = NULL ;
+    LG_TRY (LAGraph_Malloc ((void **) &pool, len, sizeof (char), msg)) ;
+    M->Pool [M->npool++] = pool ;
+    for (int64_t node = first ; node < M->nnodes ; node++)
+    {
+        size_t n = strlen (M->NodeName [node]) + 1 ;
+        memcpy (pool, M->NodeName [node], n) ;
+        M->NodeName [node] = pool ;
+        pool += n ;
+    }
+    return (GrB_SUCCESS) ;
+}
+
+//------------------------------------------------------------------------------
+// is_edge_line: true if a line holds an edge, false if blank or a comment
+//------------------------------------------------------------------------------
+
+static inline bool is_edge_line (const char *p)
+{
+    while (*p == ' ' || *p == '\t' || *p == '\r') p++ ;
+    return (*p != '\0' && *p != '#' && *p != '%') ;
+}
+
+//------------------------------------------------------------------------------
+// next_field: find the next field of a line, and terminate it with '\0'
+//------------------------------------------------------------------------------
+
+// Returns NULL if the line has no more fields, or if the field is empty.
+
+static inline char *next_field
+(
+    char **line,            // line to parse; advanced past the field
+    char delim              // ',' for a CSV file, ' ' otherwise
+)
+{
+    char *p = (*line) ;
+    while (*p == ' ' || *p == '\t' || *p == '\r') p++ ;
+    char *start = p ;
+    if (delim == ',')
+    {
+        while (*p != '\0' && *p != ',') p++ ;
+    }
+    else
+    {
+        while (*p != '\0' && *p != ' ' && *p != '\t' && *p != '\r') p++ ;
+    }
+    char *end = p ;
+    (*line) = (*p == '\0') ? p : (p + 1) ;
+    // remove trailing blanks, and the enclosing double quotes, if any
+    while (end > start && (end [-1] == ' ' || end [-1] == '\t' ||
+        end [-1] == '\r')) end-- ;
+    if (end - start >= 2 && start [0] == '"' && end [-1] == '"')
+    {
+        start++ ;
+        end-- ;
+    }
+    (*end) = '\0' ;
+    return ((end == start) ? NULL : start) ;
+}
+
+//------------------------------------------------------------------------------
+// parse_id, parse_weight: parse a field as an integer ID, or a weight
+//------------------------------------------------------------------------------
+
+static inline bool parse_id (const char *s, uint64_t *x)
+{
+    if (s == NULL || !isdigit ((unsigned char) s [0])) return (false) ;
+    char *end ;
+    errno = 0 ;
+    (*x) = (uint64_t) strtoull (s, &end, 10) ;
+    return (*end == '\0' && errno == 0) ;
+}
+
+static inline bool parse_weight (const char *s, double *x)
+{
+    if (s == NULL) return (false) ;
+    char *end ;
+    (*x) = strtod (s, &end) ;
+    return (*end == '\0' && end != s) ;
+}
+
+//------------------------------------------------------------------------------
+// edge_format: find the format of the edges from a single line
+//------------------------------------------------------------------------------
+
+typedef struct
+{
+    char delim ;            // ',' for a CSV file, ' ' otherwise
+    bool int_ids ;          // true if both IDs are integers
+    bool weighted ;         // true if the line has a weight
+}
+edge_format ;
+
+static edge_format get_format (const char *line)
+{
+    edge_format fmt ;
+    fmt.delim = (strchr (line, ',') != NULL) ? ',' : ' ' ;
+    // parse a copy of the line, since next_field modifies it
+    size_t len = strlen (line) ;
+    char *copy = NULL ;
+    fmt.int_ids = false ;
+    fmt.weighted = false ;
+    if (LAGraph_Malloc ((void **) &copy, len + 1, sizeof (char), NULL)
+        != GrB_SUCCESS)
+    {
+        return (fmt) ;
+    }
+    memcpy (copy, line, len + 1) ;
+    char *p = copy ;
+    uint64_t id ;
+    double w ;
+    char *src = next_field (&p, fmt.delim) ;
+    char *dst = next_field (&p, fmt.delim) ;
+    char *wgt = next_field (&p, fmt.delim) ;
+    fmt.int_ids = parse_id (src, &id) && parse_id (dst, &id) ;
+    fmt.weighted = parse_weight (wgt, &w) ;
+    LAGraph_Free ((void **) &copy, NULL) ;
+    return (fmt) ;
+}
+
+//------------------------------------------------------------------------------
+// compare_names: compare two node names, for qsort
+//------------------------------------------------------------------------------
+
+static int compare_names (const void *a, const void *b)
+{
+    return (strcmp (*((char **) a), *((char **) b))) ;
+}
+
+//------------------------------------------------------------------------------
+// LAGraph_EdgeListRead
+//------------------------------------------------------------------------------
+
+#undef  LG_FREE_ALL
+#define LG_FREE_ALL                                             \
+{                                                               \
+    LG_FREE_WORK ;                                              \
+    GrB_free (A) ;                                              \
+    if (ids != NULL) GrB_free (ids) ;                           \
+    if (names != NULL) LAGraph_Free ((void **) names, NULL) ;   \
+}
+
+int LAGraph_EdgeListRead
+(
+    // output:
+    GrB_Matrix *A,          // n-by-n adjacency matrix
+    GrB_Vector *ids,        // if not NULL, ids (k) is the ID of node k
+                            // (NULL on output if the IDs are strings)
+    char ***names,          // if not NULL, names [k] is the ID of node k
+    // input:
+    FILE *f,                // file to read from, already open
+    char *msg
+)
+{
+
+    //--------------------------------------------------------------------------
+    // check inputs
+    //--------------------------------------------------------------------------
+
+    LG_CLEAR_MSG ;
+    LG_lines L ;
+    memset (&L, 0, sizeof (LG_lines)) ;
+    LG_stream s = NULL ;
+    node_map M ;
+    memset (&M, 0, sizeof (node_map)) ;
+    int64_t *I = NULL, *J = NULL, *Work = NULL, *K0 = NULL, *K1 = NULL ;
+    int64_t *Rank = NULL ;
+    double *X = NULL ;
+    char **Sorted = NULL ;
+
+    LG_ASSERT (A != NULL && f != NULL, GrB_NULL_POINTER) ;
+    (*A) = NULL ;
+    if (ids != NULL) (*ids) = NULL ;
+    if (names != NULL) (*names) = NULL ;
+
+    int nthreads = LG_nthreads_outer * LG_nthreads_inner ;
+    nthreads = LAGRAPH_MAX (nthreads, 1) ;
+    int ntasks_max = 4 * nthreads ;
+
+    LG_TRY (LG_stream_open (&s, f, msg)) ;
+    LG_TRY (LG_lines_init (&L, s, BLOCK, ntasks_max, msg)) ;
+    LG_TRY (LAGraph_Malloc ((void **) &Work, 6 * (ntasks_max + 1),
+        sizeof (int64_t), msg)) ;
+    int64_t *Tcount  = Work ;                           // # edges
+    int64_t *Tlines  = Work +     (ntasks_max + 1) ;    // # lines
+    int64_t *Tfirst  = Work + 2 * (ntasks_max + 1) ;    // first edge
+    int64_t *Tstatus = Work + 3 * (ntasks_max + 1) ;    // error, if any
+    int64_t *Tline   = Work + 4 * (ntasks_max + 1) ;    // line of error
+
+    edge_format fmt = { .delim = ' ', .int_ids = true, .weighted = false } ;
+    bool have_format = false ;
+    int64_t nedges = 0, edges_size = 0, line = 0 ;
+
+    //--------------------------------------------------------------------------
+    // read the edges, one block of the file at a time
+    //--------------------------------------------------------------------------
+
+    while (true)
+    {
+
+        //----------------------------------------------------------------------
+        // read the next block of whole lines, split into chunks
+        //----------------------------------------------------------------------
+
+        LG_TRY (LG_lines_next (&L, msg)) ;
+        int ntasks = L.ntasks ;
+        if (ntasks == 0) break ;
+        char *Buf = L.Buf ;
+        int64_t *Tstart = L.Tstart ;
+
+        //----------------------------------------------------------------------
+        // split each chunk into lines and count its edges
+        //----------------------------------------------------------------------
+
+        int t ;
+        #pragma omp parallel for num_threads(nthreads) schedule(dynamic,1)
+        for (t = 0 ; t < ntasks ; t++)
+        {
+            int64_t count = 0, nlines = 0 ;
+            char *p = Buf + Tstart [t] ;
+            char *pend = Buf + Tstart [t+1] ;
+            while (p < pend)
+            {
+                // terminate the line with '\0' in place of '\n'
+                char *q = memchr (p, '\n', pend - p) ;
+                if (q == NULL) q = pend ;
+                (*q) = '\0' ;
+                nlines++ ;
+                if (is_edge_line (p)) count++ ;
+                p = q + 1 ;
+            }
+            Tcount [t] = count ;
+            Tlines [t] = nlines ;
+        }
+
+        //----------------------------------------------------------------------
+        // find the format of the edges from the first two edges in the file
+        //----------------------------------------------------------------------
+
+        if (!have_format)
+        {
+            char *first = NULL, *second = NULL ;
+            int tfirst = 0 ;
+            for (t = 0 ; t < ntasks && second == NULL ; t++)
+            {
+                char *p = Buf + Tstart [t] ;
+                char *pend = Buf + Tstart [t+1] ;
+                for ( ; p < pend && second == NULL ; p += strlen (p) + 1)
+                {
+                    if (!is_edge_line (p)) continue ;
+                    if (first == NULL)
+                    {
+                        first = p ;
+                        tfirst = t ;
+                    }
+                    else
+                    {
+                        second = p ;
+                    }
+                }
+            }
+            if (first != NULL)
+            {
+                have_format = true ;
+                fmt = get_format (first) ;
+                if ((!fmt.int_ids || !fmt.weighted) && second != NULL)
+                {
+                    edge_format fmt2 = get_format (second) ;
+                    if ((fmt2.int_ids && !fmt.int_ids) ||
+                        (fmt2.weighted && !fmt.weighted))
+                    {
+                        // the first line is a header; make it a comment
+                        while (*first == ' ' || *first == '\t') first++ ;
+                        (*first) = '#' ;
+                        Tcount [tfirst]-- ;
+                        fmt = fmt2 ;
+                    }
+                }
+                M.strings = !fmt.int_ids ;
+            }
+        }
+
+        //----------------------------------------------------------------------
+        // determine where each chunk places its edges
+        //----------------------------------------------------------------------
+
+        int64_t block_edges = 0 ;
+        for (t = 0 ; t < ntasks ; t++)
+        {
+            Tfirst [t] = nedges + block_edges ;
+            block_edges += Tcount [t] ;
+        }
+
+        //----------------------------------------------------------------------
+        // ensure there is space for the edges and nodes of this block
+        //----------------------------------------------------------------------
+
+        if (nedges + block_edges > edges_size)
+        {
+            int64_t size = LAGRAPH_MAX (2 * edges_size, nedges + block_edges) ;
+            LG_TRY (LAGraph_Realloc ((void **) &I, size, edges_size,
+                sizeof (int64_t), msg)) ;
+            LG_TRY (LAGraph_Realloc ((void **) &J, size, edges_size,
+                sizeof (int64_t), msg)) ;
+            if (have_format && fmt.weighted)
+            {
+                LG_TRY (LAGraph_Realloc ((void **) &X, size, edges_size,
+                    sizeof (double), msg)) ;
+            }
+            edges_size = size ;
+        }
+        LG_TRY (grow_map (&M, M.nnodes + 2 * block_edges, nthreads, msg)) ;
+
+        //----------------------------------------------------------------------
+        // parse the edges in each chunk
+        //----------------------------------------------------------------------
+
+        int64_t first_node = M.nnodes ;
+
+        #pragma omp parallel for num_threads(nthreads) schedule(dynamic,1)
+        for (t = 0 ; t < ntasks ; t++)
+        {
+            int64_t e = Tfirst [t], nlines = 0 ;
+            int status = EL_OK ;
+            char *p = Buf + Tstart [t] ;
+            char *pend = Buf + Tstart [t+1] ;
+            while (p < pend && status == EL_OK)
+            {
+                char *next = p + strlen (p) + 1 ;
+                nlines++ ;
+                if (is_edge_line (p))
+                {
+                    char *src = next_field (&p, fmt.delim) ;
+                    char *dst = next_field (&p, fmt.delim) ;
+                    char *wgt = NULL ;
+                    if (fmt.weighted) wgt = next_field (&p, fmt.delim) ;
+                    if (src == NULL || dst == NULL ||
+                        (fmt.weighted && wgt == NULL))
+                    {
+                        status = EL_LINE ;
+                    }
+                    else if (M.strings)
+                    {
+                        I [e] = find_node (&M, hash_string (src), src) ;
+                        J [e] = find_node (&M, hash_string (dst), dst) ;
+                    }
+                    else
+                    {
+                        uint64_t isrc, idst ;
+                        if (parse_id (src, &isrc) && parse_id (dst, &idst))
+                        {
+                            I [e] = find_node (&M, isrc, NULL) ;
+                            J [e] = find_node (&M, idst, NULL) ;
+                        }
+                        else
+                        {
+                            status = EL_ID ;
+                        }
+                    }
+                    if (status == EL_OK && fmt.weighted &&
+                        !parse_weight (wgt, &(X [e])))
+                    {
+                        status = EL_WEIGHT ;
+                    }
+                    e++ ;
+                }
+                p = next ;
+            }
+            Tstatus [t] = status ;
+            Tline [t] = nlines ;
+        }
+
+        //----------------------------------------------------------------------
+        // report the first error, if any
+        //----------------------------------------------------------------------
+
+        for (t = 0 ; t < ntasks ; t++)
+        {
+            int status = (int) Tstatus [t] ;
+            if (status != EL_OK)
+            {
+                line += Tline [t] ;
+                LG_ASSERT_MSGF (status != EL_LINE, LAGRAPH_IO_ERROR,
+                    "line %" PRId64 " of input file: missing field", line) ;
+                LG_ASSERT_MSGF (status != EL_ID, LAGRAPH_IO_ERROR,
+                    "line %" PRId64 " of input file: node ID must be an "
+                    "unsigned integer", line) ;
+                LG_ASSERT_MSGF (false, LAGRAPH_IO_ERROR,
+                    "line %" PRId64 " of input file: invalid weight", line) ;
+            }
+            line += Tlines [t] ;
+        }
+
+        //----------------------------------------------------------------------
+        // keep the names of new nodes, before the buffer is reused
+        //----------------------------------------------------------------------
+
+        if (M.strings)
+        {
+            LG_TRY (save_names (&M, first_node, msg)) ;
+        }
+        nedges += block_edges ;
+    }
+
+    //--------------------------------------------------------------------------
+    // sort the node IDs, and find the rank of each node
+    //--------------------------------------------------------------------------
+
+    int64_t n = M.nnodes ;
+    LG_TRY (LAGraph_Malloc ((void **) &Rank, n, sizeof (int64_t), msg)) ;
+    int64_t k ;
+    if (M.strings)
+    {
+        // sort the names
+        LG_TRY (LAGraph_Malloc ((void **) &Sorted, n, sizeof (char *), msg)) ;
+        memcpy (Sorted, M.NodeName, n * sizeof (char *)) ;
+        qsort (Sorted, n, sizeof (char *), compare_names) ;
+        // find the rank of each node from its name
+        #pragma omp parallel for num_threads(nthreads) schedule(static)
+        for (k = 0 ; k < n ; k++)
+        {
+            Rank [find_node (&M, hash_string (Sorted [k]), Sorted [k])] = k ;
+        }
+    }
+    else
+    {
+        // sort the IDs as signed integers, with the sign bit flipped so that
+        // the order is the same as for the unsigned IDs
+        LG_TRY (LAGraph_Malloc ((void **) &K0, n, sizeof (int64_t), msg)) ;
+        LG_TRY (LAGraph_Malloc ((void **) &K1, n, sizeof (int64_t), msg)) ;
+        #pragma omp parallel for num_threads(nthreads) schedule(static)
+        for (k = 0 ; k < n ; k++)
+        {
+            K0 [k] = (int64_t) (M.NodeId [k] ^ 0x8000000000000000ULL) ;
+            K1 [k] = k ;
+        }
+        LG_TRY (LG_msort2 (K0, K1, n, msg)) ;
+        #pragma omp parallel for num_threads(nthreads) schedule(static)
+        for (k = 0 ; k < n ; k++)
+        {
+            Rank [K1 [k]] = k ;
+            K0 [k] = (int64_t) (((uint64_t) K0 [k]) ^ 0x8000000000000000ULL) ;
+            K1 [k] = k ;
+        }
+    }
+
+    //--------------------------------------------------------------------------
+    // renumber the nodes of each edge
+    //--------------------------------------------------------------------------
+
+    #pragma omp parallel for num_threads(nthreads) schedule(static)
+    for (k = 0 ; k < nedges ; k++)
+    {
+        I [k] = Rank [I [k]] ;
+        J [k] = Rank [J [k]] ;
+    }
+
+    //--------------------------------------------------------------------------
+    // build the matrix
+    //--------------------------------------------------------------------------
+
+    if (have_format && fmt.weighted)
+    {
+        GRB_TRY (GrB_Matrix_new (A, GrB_FP64, n, n)) ;
+        GRB_TRY (GrB_Matrix_build_FP64 (*A, (GrB_Index *) I, (GrB_Index *) J,
+            X, nedges, GrB_PLUS_FP64)) ;
+    }
+    else if (nedges > 0)
+    {
+        GRB_TRY (GrB_Matrix_new (A, GrB_BOOL, n, n)) ;
+        LAGraph_Free ((void **) &X, NULL) ;
+        LG_TRY (LAGraph_Malloc ((void **) &X, nedges, sizeof (bool), msg)) ;
+        bool *Xb = (bool *) X ;
+        #pragma omp parallel for num_threads(nthreads) schedule(static)
+        for (k = 0 ; k < nedges ; k++)
+        {
+            Xb [k] = true ;
+        }
+        GRB_TRY (GrB_Matrix_build_BOOL (*A, (GrB_Index *) I, (GrB_Index *) J,
+            Xb, nedges, GrB_LOR)) ;
+    }
+    else
+    {
+        // the file has no edges
+        GRB_TRY (GrB_Matrix_new (A, GrB_BOOL, n, n)) ;
+    }
+    LAGraph_Free ((void **) &I, NULL) ;
+    LAGraph_Free ((void **) &J, NULL) ;
+    LAGraph_Free ((void **) &X, NULL) ;
+
+    //--------------------------------------------------------------------------
+    // return the IDs of the nodes
+    //--------------------------------------------------------------------------
+
+    if (ids != NULL && !M.strings)
+    {
+        GRB_TRY (GrB_Vector_new (ids, GrB_UINT64, n)) ;
+        GRB_TRY (GrB_Vector_build_UINT64 (*ids, (GrB_Index *) K1,
+            (uint64_t *) K0, n, NULL)) ;
+    }
+
+    if (names != NULL)
+    {
+        // the names are held in a single block, after the array of pointers
+        size_t len = 0 ;
+        char id [64] ;
+        for (k = 0 ; k < n ; k++)
+        {
+            len += 1 + (M.strings ? strlen (Sorted [k]) :
+                (size_t) snprintf (id, 64, "%" PRIu64, (uint64_t) K0 [k])) ;
+        }
+        LG_TRY (LAGraph_Malloc ((void **) names, n * sizeof (char *) + len,
+            sizeof (char), msg)) ;
+        char *p = (char *) ((*names) + n) ;
+        for (k = 0 ; k < n ; k++)
+        {
+            (*names) [k] = p ;
+            if (M.strings)
+            {
+                strcpy (p, Sorted [k]) ;
+            }
+            else
+            {
+                snprintf (p, 64, "%" PRIu64, (uint64_t) K0 [k]) ;
+            }
+            p += strlen (p) + 1 ;
+        }
+    }
+
+    //--------------------------------------------------------------------------
+    // free workspace and return result
+    //--------------------------------------------------------------------------
+
+    LG_FREE_WORK ;
+    return (GrB_SUCCESS) ;
+}
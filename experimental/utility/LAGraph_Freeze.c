@@ -0,0 +1,109 @@
+//------------------------------------------------------------------------------
+// LAGraph_Freeze: prepare a graph to be shared read-only by many user threads
+//------------------------------------------------------------------------------
+
+// LAGraph, (c) 2019-2022 by The LAGraph Contributors, All Rights Reserved.
+// SPDX-License-Identifier: BSD-2-Clause
+//
+// For additional details (including references to third party source code and
+// other files) see the LICENSE file or contact permission@sei.cmu.edu. See
+// Contributors.txt for a full list of contributors. Created, in part, with
+// funding and support from the U.S. Government (see Acknowledgments.txt file).
+// DM22-0790
+
+//------------------------------------------------------------------------------
+
+// LAGraph_Freeze computes all cached properties of G that are needed for its
+// kind, and then finishes all pending work in G->A and in each of its cached
+// properties.  Once frozen, G can be passed to any LAGraph algorithm that
+// takes G as a read-only input, by any number of user threads at the same
+// time, with no locking.  In particular:
+
+//  (1) each LAGraph_Cached_* method returns immediately, without modifying G,
+//      since the property it computes is already known.  The only exception
+//      is LAGraph_Cached_EMin and LAGraph_Cached_EMax for a matrix with a
+//      user-defined type, where G->emin and G->emax cannot be computed.
+
+//  (2) GraphBLAS never needs to finish any pending work on G->A or its cached
+//      properties when they are used as inputs, so they are never modified.
+
+//  (3) G->sssp_delta is computed (see LAGraph_Cached_SSSPDelta), so
+//      LAGraph_SingleSourceShortestPath, which would otherwise compute it on
+//      its first call, only reads it.
+
+//  (4) LG_CC_FastSV6 and LG_CC_FastSV5 never unpack G->A (they work on a
+//      structural copy), so LAGr_ConnectedComponents is safe to use on a
+//      shared graph.
+
+// The graph G remains an ordinary LAGraph_Graph, and no flag is kept in G.
+// It can be modified later on (LAGraph_UpdateEdges, LAGraph_DeleteCached, and
+// so on), but only when no other user thread is reading it.  LAGraph_Freeze
+// must then be called again before it is shared.
+
+//------------------------------------------------------------------------------
+
+#define LG_FREE_ALL ;
+
+#include "LG_internal.h"
+#include "LAGraphX.h"
+
+int LAGraph_Freeze
+(
+    // input/output:
+    LAGraph_Graph G,        // graph to freeze
+    char *msg
+)
+{
+
+    //--------------------------------------------------------------------------
+    // check inputs
+    //--------------------------------------------------------------------------
+
+    LG_CLEAR_MSG_AND_BASIC_ASSERT (G, msg) ;
+
+    //--------------------------------------------------------------------------
+    // compute all cached properties of G
+    //--------------------------------------------------------------------------
+
+    // G->emin and G->emax cannot be computed for a user-defined type, in which
+    // case LAGraph_Cached_Ensure returns GrB_NOT_IMPLEMENTED.  They are then
+    // left unknown, as is G->sssp_delta, which depends on them.
+
+    int result = LAGraph_Cached_Ensure (G, LAGRAPH_CACHE_ALL, msg) ;
+    if (result == GrB_NOT_IMPLEMENTED)
+    {
+        LG_CLEAR_MSG ;
+        result = LAGraph_Cached_Ensure (G, LAGRAPH_CACHE_ALL &
+            ~(LAGRAPH_CACHE_EMIN | LAGRAPH_CACHE_EMAX |
+            LAGRAPH_CACHE_SSSP_DELTA), msg) ;
+    }
+    LG_TRY (result) ;
+
+    //--------------------------------------------------------------------------
+    // finish all pending work
+    //--------------------------------------------------------------------------
+
+    GRB_TRY (GrB_wait (G->A, GrB_MATERIALIZE)) ;
+    if (G->AT != NULL)
+    {
+        GRB_TRY (GrB_wait (G->AT, GrB_MATERIALIZE)) ;
+    }
+    if (G->out_degree != NULL)
+    {
+        GRB_TRY (GrB_wait (G->out_degree, GrB_MATERIALIZE)) ;
+    }
+    if (G->in_degree != NULL)
+    {
+        GRB_TRY (GrB_wait (G->in_degree, GrB_MATERIALIZE)) ;
+    }
+    if (G->emin != NULL)
+    {
+        GRB_TRY (GrB_wait (G->emin, GrB_MATERIALIZE)) ;
+    }
+    if (G->emax != NULL)
+    {
+        GRB_TRY (GrB_wait (G->emax, GrB_MATERIALIZE)) ;
+    }
+
+    return (GrB_SUCCESS) ;
+}
@@ -0,0 +1,415 @@
+//------------------------------------------------------------------------------
+// LAGraph_MMConvert: convert a Matrix Market file to a *.grb or *.lagraph file
+//------------------------------------------------------------------------------
+
+// LAGraph, (c) 2019-2022 by The LAGraph Contributors, All Rights Reserved.
+// SPDX-License-Identifier: BSD-2-Clause
+//
+// For additional details (including references to third party source code and
+// other files) see the LICENSE file or contact permission@sei.cmu.edu. See
+// Contributors.txt for a full list of contributors. Created, in part, with
+// funding and support from the U.S. Government (see Acknowledgments.txt file).
+// DM22-0790
+
+//------------------------------------------------------------------------------
+
+// LAGraph_MMConvert reads a matrix from a Matrix Market file and writes it to
+// a binary *.grb file (if the name of the output file ends in ".grb"), or to a
+// *.lagraph file (otherwise).  The *.grb file can be read with LAGraph_BinRead,
+// and the *.lagraph file with LAGraph_SLoadSet or LAGraph_SOpen; it holds a
+// single matrix named "A_0".
+
+// Optionally, the matrix can be modified in the same way as readproblem in
+// src/benchmark/LAGraph_demo.h modifies a matrix after reading it:
+//
+//  remove_self_edges:  entries on the diagonal are removed.
+//  structural:         the matrix is converted to an iso-valued GrB_BOOL
+//                      matrix, with all entries equal to true.
+//  pref:               if non-NULL (and structural is false), the values of
+//                      the matrix are typecast to this type.
+//  make_symmetric:     if the matrix is not symmetric, it is replaced with
+//                      A+A' (using the LOR operator for GrB_BOOL).  The matrix
+//                      must be square.  If the Matrix Market header declares
+//                      the matrix as symmetric, skew-symmetric, or Hermitian,
+//                      both of its triangles are already present and it is
+//                      left as-is.  Otherwise, A' is constructed and compared
+//                      with A.
+
+// The conversion never holds two copies of the matrix at the same time, except
+// when make_symmetric is true and the file is stored as "general", in which
+// case A and A' are both held (and then A+A', if A is not symmetric).  Most
+// undirected graphs are stored as "symmetric" Matrix Market files, and need
+// no transpose.  The file is read as with LAGraph_MMRead_LowMemory, directly
+// into the CSR arrays of the matrix.  The self-edges are removed from these
+// arrays in place, and the values are typecast by packing them into a dense
+// GrB_Vector, so only the values exist twice.  A *.grb file is then written from the same CSR arrays.
+// For a *.lagraph file, the matrix is serialized and freed before the blob is
+// written, so the peak memory usage is the size of the matrix plus the size
+// of its (compressed) blob.
+
+// This method requires SuiteSparse:GraphBLAS.
+
+// Return values:
+//  GrB_SUCCESS: the output file has been written
+//  LAGRAPH_IO_ERROR: the input file cannot be opened, or the output file
+//      cannot be created or written
+//  GrB_NULL_POINTER: outfile or infile are NULL
+//  GrB_DIMENSION_MISMATCH: make_symmetric is true but A is not square
+//  GrB_NOT_IMPLEMENTED: the type is not supported, or SuiteSparse:GraphBLAS
+//      is not in use
+//  other: return values from LAGraph_MMRead, and GrB_* and GxB_* methods
+
+#define LG_FREE_WORK                                \
+{                                                   \
+    if (f != NULL) fclose (f) ;                     \
+    f = NULL ;                                      \
+    GrB_free (&AT) ;                                \
+    GrB_free (&X) ;                                 \
+    GrB_free (&Y) ;                                 \
+    GrB_free (&desc) ;                              \
+    LAGraph_Free ((void **) &Ap, NULL) ;            \
+    LAGraph_Free ((void **) &Aj, NULL) ;            \
+    LAGraph_Free ((void **) &Ax, NULL) ;            \
+    LAGraph_Free ((void **) &blob, NULL) ;          \
+}
+
+#define LG_FREE_ALL                                 \
+{                                                   \
+    LG_FREE_WORK ;                                  \
+    GrB_free (&A) ;                                 \
+}
+
+#include "LG_internal.h"
+#include "LAGraphX.h"
+
+// size of the ASCII header of a *.grb file
+#define LAGRAPH_BIN_HEADER 512
+
+#define FWRITE(p,s,n)                                                   \
+{                                                                       \
+    LG_ASSERT_MSG (fwrite (p, s, n, f) == (size_t) (n), LAGRAPH_IO_ERROR, \
+        "file not written properly") ;                                  \
+}
+
+#if LAGRAPH_SUITESPARSE
+
+//------------------------------------------------------------------------------
+// delete_self_edges: remove the diagonal entries from a CSR matrix, in place
+//------------------------------------------------------------------------------
+
+static void delete_self_edges
+(
+    GrB_Index *Ap,          // row pointers, of size nrows+1
+    GrB_Index *Aj,          // column indices
+    uint8_t *Ax,            // values (unchanged if iso)
+    GrB_Index nrows,
+    bool iso,
+    size_t typesize
+)
+{
+    GrB_Index nz = 0 ;
+    GrB_Index pstart = Ap [0] ;
+    for (GrB_Index i = 0 ; i < nrows ; i++)
+    {
+        GrB_Index pend = Ap [i+1] ;
+        Ap [i] = nz ;
+        for (GrB_Index p = pstart ; p < pend ; p++)
+        {
+            if (Aj [p] == i) continue ;
+            if (nz < p)
+            {
+                Aj [nz] = Aj [p] ;
+                if (!iso) memcpy (Ax + nz*typesize, Ax + p*typesize, typesize) ;
+            }
+            nz++ ;
+        }
+        pstart = pend ;
+    }
+    Ap [nrows] = nz ;
+}
+
+//------------------------------------------------------------------------------
+// grb_typecode: type code of a *.grb file (see LAGraph_BinRead)
+//------------------------------------------------------------------------------
+
+static int32_t grb_typecode (GrB_Type type)
+{
+    GrB_Type types [11] = { GrB_BOOL, GrB_INT8, GrB_INT16, GrB_INT32,
+        GrB_INT64, GrB_UINT8, GrB_UINT16, GrB_UINT32, GrB_UINT64, GrB_FP32,
+        GrB_FP64 } ;
+    for (int32_t k = 0 ; k < 11 ; k++)
+    {
+        if (type == types [k]) return (k) ;
+    }
+    return (-1) ;
+}
+
+#endif
+
+//------------------------------------------------------------------------------
+// LAGraph_MMConvert
+//------------------------------------------------------------------------------
+
+int LAGraph_MMConvert           // convert a Matrix Market file
+(
+    // input:
+    const char *outfile,        // name of the *.grb or *.lagraph file to create
+    const char *infile,         // name of the Matrix Market file to read
+    bool make_symmetric,        // if true, A = A+A' if A is not symmetric
+    bool remove_self_edges,     // if true, remove self-edges
+    bool structural,            // if true, A becomes iso-valued GrB_BOOL
+    GrB_Type pref,              // if non-NULL, typecast A to this type
+    char *msg
+)
+{
+
+    //--------------------------------------------------------------------------
+    // check inputs
+    //--------------------------------------------------------------------------
+
+    LG_CLEAR_MSG ;
+    FILE *f = NULL ;
+    GrB_Matrix A = NULL, AT = NULL ;
+    GrB_Vector X = NULL, Y = NULL ;
+    GrB_Descriptor desc = NULL ;
+    GrB_Index *Ap = NULL, *Aj = NULL ;
+    void *Ax = NULL, *blob = NULL ;
+    LG_ASSERT (outfile != NULL && infile != NULL, GrB_NULL_POINTER) ;
+
+    #if !LAGRAPH_SUITESPARSE
+    LG_ASSERT_MSG (false, GrB_NOT_IMPLEMENTED,
+        "SuiteSparse:GraphBLAS required to convert Matrix Market files") ;
+    #else
+
+    size_t len = strlen (outfile) ;
+    bool to_grb = (len >= 4 && strcmp (outfile + len - 4, ".grb") == 0) ;
+
+    //--------------------------------------------------------------------------
+    // read the matrix into CSR format
+    //--------------------------------------------------------------------------
+
+    f = fopen (infile, "rb") ;
+    LG_ASSERT_MSGF (f != NULL, LAGRAPH_IO_ERROR, "unable to open file: %s",
+        infile) ;
+    bool header_symmetric ;
+    LG_TRY (LG_MMRead (&A, f, true, &header_symmetric, msg)) ;
+    fclose (f) ;
+    f = NULL ;
+
+    GrB_Type type ;
+    GrB_Index nrows, ncols, Ap_size, Aj_size, Ax_size ;
+    bool iso ;
+    GRB_TRY (GxB_Matrix_type (&type, A)) ;
+    GRB_TRY (GrB_Matrix_nrows (&nrows, A)) ;
+    GRB_TRY (GrB_Matrix_ncols (&ncols, A)) ;
+    LG_ASSERT_MSG (nrows == ncols || !make_symmetric, GrB_DIMENSION_MISMATCH,
+        "A must be square to be made symmetric") ;
+
+    //--------------------------------------------------------------------------
+    // remove self-edges and typecast the values, in place
+    //--------------------------------------------------------------------------
+
+    GrB_Type new_type = structural ? GrB_BOOL : ((pref != NULL) ? pref : type) ;
+    if (remove_self_edges || structural || new_type != type)
+    {
+        GRB_TRY (GxB_set (A, GxB_SPARSITY_CONTROL, GxB_SPARSE)) ;
+        GRB_TRY (GxB_set (A, GxB_FORMAT, GxB_BY_ROW)) ;
+        GRB_TRY (GxB_Matrix_unpack_CSR (A, &Ap, &Aj, &Ax, &Ap_size, &Aj_size,
+            &Ax_size, &iso, NULL, NULL)) ;
+        GrB_Index nvals = Ap [nrows] ;
+
+        if (remove_self_edges)
+        {
+            size_t typesize ;
+            GRB_TRY (GxB_Type_size (&typesize, type)) ;
+            delete_self_edges (Ap, Aj, (uint8_t *) Ax, nrows, iso, typesize) ;
+            nvals = Ap [nrows] ;
+        }
+
+        if (structural || (new_type != type && !iso && nvals == 0))
+        {
+            // the values are discarded; all entries are true if structural
+            size_t typesize ;
+            GRB_TRY (GxB_Type_size (&typesize, new_type)) ;
+            LAGraph_Free ((void **) &Ax, NULL) ;
+            LG_TRY (LAGraph_Calloc (&Ax, 1, typesize, msg)) ;
+            if (structural) ((bool *) Ax) [0] = true ;
+            Ax_size = typesize ;
+            iso = structural ;
+        }
+        else if (new_type != type)
+        {
+            // typecast the values: X = Ax, Y = (new_type) X, Ax = Y
+            GrB_Index n = iso ? 1 : nvals ;
+            GRB_TRY (GrB_Vector_new (&X, type, n)) ;
+            GRB_TRY (GxB_Vector_pack_Full (X, &Ax, Ax_size, false, NULL)) ;
+            GRB_TRY (GrB_Vector_new (&Y, new_type, n)) ;
+            GRB_TRY (GrB_assign (Y, NULL, NULL, X, GrB_ALL, n, NULL)) ;
+            GRB_TRY (GrB_free (&X)) ;
+            bool y_iso ;
+            GRB_TRY (GxB_Vector_unpack_Full (Y, &Ax, &Ax_size, &y_iso, NULL)) ;
+            GRB_TRY (GrB_free (&Y)) ;
+            // all values of Y may be the same, even if A was not iso
+            iso = iso || y_iso ;
+        }
+
+        if (new_type != type)
+        {
+            GRB_TRY (GrB_free (&A)) ;
+            GRB_TRY (GrB_Matrix_new (&A, new_type, nrows, ncols)) ;
+            type = new_type ;
+        }
+        GRB_TRY (GxB_Matrix_pack_CSR (A, &Ap, &Aj, &Ax, Ap_size, Aj_size,
+            Ax_size, iso, false, NULL)) ;
+    }
+
+    //--------------------------------------------------------------------------
+    // make the matrix symmetric, if requested
+    //--------------------------------------------------------------------------
+
+    if (make_symmetric && !header_symmetric)
+    {
+        GRB_TRY (GrB_Matrix_new (&AT, type, nrows, ncols)) ;
+        GRB_TRY (GrB_transpose (AT, NULL, NULL, A, NULL)) ;
+        bool sym ;
+        LG_TRY (LAGraph_Matrix_IsEqual (&sym, A, AT, msg)) ;
+        if (!sym)
+        {
+            GrB_BinaryOp op = NULL ;
+            if      (type == GrB_BOOL  ) op = GrB_LOR ;
+            else if (type == GrB_INT8  ) op = GrB_PLUS_INT8 ;
+            else if (type == GrB_INT16 ) op = GrB_PLUS_INT16 ;
+            else if (type == GrB_INT32 ) op = GrB_PLUS_INT32 ;
+            else if (type == GrB_INT64 ) op = GrB_PLUS_INT64 ;
+            else if (type == GrB_UINT8 ) op = GrB_PLUS_UINT8 ;
+            else if (type == GrB_UINT16) op = GrB_PLUS_UINT16 ;
+            else if (type == GrB_UINT32) op = GrB_PLUS_UINT32 ;
+            else if (type == GrB_UINT64) op = GrB_PLUS_UINT64 ;
+            else if (type == GrB_FP32  ) op = GrB_PLUS_FP32 ;
+            else if (type == GrB_FP64  ) op = GrB_PLUS_FP64 ;
+            LG_ASSERT_MSG (op != NULL, GrB_NOT_IMPLEMENTED,
+                "type not supported") ;
+            GRB_TRY (GrB_eWiseAdd (A, NULL, NULL, op, A, AT, NULL)) ;
+        }
+        GRB_TRY (GrB_free (&AT)) ;
+    }
+
+    //--------------------------------------------------------------------------
+    // write the output file
+    //--------------------------------------------------------------------------
+
+    if (to_grb)
+    {
+
+        //----------------------------------------------------------------------
+        // write a *.grb file, in the same format as binwrite
+        //----------------------------------------------------------------------
+
+        int32_t typecode = grb_typecode (type) ;
+        LG_ASSERT_MSG (typecode >= 0, GrB_NOT_IMPLEMENTED,
+            "type not supported") ;
+        size_t typesize ;
+        GRB_TRY (GxB_Type_size (&typesize, type)) ;
+        double hyper ;
+        GRB_TRY (GxB_get (A, GxB_HYPER_SWITCH, &hyper)) ;
+        GRB_TRY (GxB_set (A, GxB_SPARSITY_CONTROL, GxB_SPARSE)) ;
+        GRB_TRY (GxB_set (A, GxB_FORMAT, GxB_BY_ROW)) ;
+        GRB_TRY (GxB_Matrix_unpack_CSR (A, &Ap, &Aj, &Ax, &Ap_size, &Aj_size,
+            &Ax_size, &iso, NULL, NULL)) ;
+        GRB_TRY (GrB_free (&A)) ;
+
+        GxB_Format_Value fmt = GxB_BY_ROW ;
+        int32_t kind = GxB_SPARSE + (iso ? 100 : 0) ;
+        int64_t nonempty = -1 ;
+        GrB_Index nvec = nrows ;
+        GrB_Index nvals = Ap [nrows] ;
+
+        // the header is informational only, as written by binwrite
+        char version [LAGRAPH_BIN_HEADER] ;
+        snprintf (version, LAGRAPH_BIN_HEADER, "%d.%d.%d (LAGraph DRAFT)",
+            GxB_IMPLEMENTATION_MAJOR, GxB_IMPLEMENTATION_MINOR,
+            GxB_IMPLEMENTATION_SUB) ;
+        version [25] = '\0' ;
+        char typename [LAGRAPH_BIN_HEADER] ;
+        LG_TRY (LAGraph_NameOfType (typename, type, msg)) ;
+        char user [LAGRAPH_BIN_HEADER] ;
+        snprintf (user, 211, "%s", infile) ;
+        char header [LAGRAPH_BIN_HEADER] ;
+        int32_t hlen = snprintf (header, LAGRAPH_BIN_HEADER,
+            "SuiteSparse:GraphBLAS matrix\nv%-25s\n"
+            "nrows:  %-18" PRIu64 "\n"
+            "ncols:  %-18" PRIu64 "\n"
+            "nvec:   %-18" PRIu64 "\n"
+            "nvals:  %-18" PRIu64 "\n"
+            "format: %-8s\n"
+            "size:   %-18" PRIu64 "\n"
+            "type:   %-72s\n"
+            "iso:    %1d\n"
+            "%-210s\n\n",
+            version, nrows, ncols, nvec, nvals, "CSR ", (uint64_t) typesize,
+            typename, iso, user) ;
+        for (int32_t k = hlen ; k < LAGRAPH_BIN_HEADER ; k++) header [k] = ' ';
+        header [LAGRAPH_BIN_HEADER-1] = '\0' ;
+
+        f = fopen (outfile, "wb") ;
+        LG_ASSERT_MSG (f != NULL, LAGRAPH_IO_ERROR,
+            "unable to create output file") ;
+        FWRITE (header, sizeof (char), LAGRAPH_BIN_HEADER) ;
+        FWRITE (&fmt,      sizeof (GxB_Format_Value), 1) ;
+        FWRITE (&kind,     sizeof (int32_t), 1) ;
+        FWRITE (&hyper,    sizeof (double), 1) ;
+        FWRITE (&nrows,    sizeof (GrB_Index), 1) ;
+        FWRITE (&ncols,    sizeof (GrB_Index), 1) ;
+        FWRITE (&nonempty, sizeof (int64_t), 1) ;
+        FWRITE (&nvec,     sizeof (GrB_Index), 1) ;
+        FWRITE (&nvals,    sizeof (GrB_Index), 1) ;
+        FWRITE (&typecode, sizeof (int32_t), 1) ;
+        FWRITE (&typesize, sizeof (size_t), 1) ;
+        FWRITE (Ap, sizeof (GrB_Index), nvec+1) ;
+        FWRITE (Aj, sizeof (GrB_Index), nvals) ;
+        FWRITE (Ax, typesize, (iso ? 1 : nvals)) ;
+
+    }
+    else
+    {
+
+        //----------------------------------------------------------------------
+        // write a *.lagraph file, with a single matrix
+        //----------------------------------------------------------------------
+
+        char typename [GxB_MAX_NAME_LEN] ;
+        LG_TRY (LAGraph_Matrix_TypeName (typename, A, msg)) ;
+        GrB_Index blob_size ;
+        GRB_TRY (GrB_Descriptor_new (&desc)) ;
+        GRB_TRY (GxB_set (desc, GxB_COMPRESSION, GxB_COMPRESSION_LZ4HC + 9)) ;
+        GRB_TRY (GxB_Matrix_serialize (&blob, &blob_size, A, desc)) ;
+        GRB_TRY (GrB_free (&A)) ;
+
+        // the collection is named after the input file, without its path
+        const char *collection = infile ;
+        for (const char *p = infile ; *p != '\0' ; p++)
+        {
+            if (*p == '/' || *p == '\\') collection = p + 1 ;
+        }
+
+        f = fopen (outfile, "wb") ;
+        LG_ASSERT_MSG (f != NULL, LAGRAPH_IO_ERROR,
+            "unable to create output file") ;
+        LG_TRY (LAGraph_SWrite_HeaderStart (f, collection, msg)) ;
+        LG_TRY (LAGraph_SWrite_HeaderItem (f, LAGraph_matrix_kind, "A_0",
+            typename, 0, blob_size, msg)) ;
+        LG_TRY (LAGraph_SWrite_HeaderEnd (f, msg)) ;
+        LG_TRY (LAGraph_SWrite_Item (f, blob, blob_size, msg)) ;
+    }
+
+    //--------------------------------------------------------------------------
+    // free workspace and return result
+    //--------------------------------------------------------------------------
+
+    int result = fclose (f) ;
+    f = NULL ;
+    LG_ASSERT_MSG (result == 0, LAGRAPH_IO_ERROR, "file not written properly") ;
+    LG_FREE_WORK ;
+    return (GrB_SUCCESS) ;
+    #endif
+}
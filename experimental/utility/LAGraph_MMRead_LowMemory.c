@@ -0,0 +1,52 @@
+//------------------------------------------------------------------------------
+// LAGraph_MMRead_LowMemory: read a Matrix Market file with little workspace
+//------------------------------------------------------------------------------
+
+// LAGraph, (c) 2019-2022 by The LAGraph Contributors, All Rights Reserved.
+// SPDX-License-Identifier: BSD-2-Clause
+//
+// For additional details (including references to third party source code and
+// other files) see the LICENSE file or contact permission@sei.cmu.edu. See
+// Contributors.txt for a full list of contributors. Created, in part, with
+// funding and support from the U.S. Government (see Acknowledgments.txt file).
+// DM22-0790
+
+//------------------------------------------------------------------------------
+
+// LAGraph_MMRead_LowMemory reads the same files as LAGraph_MMRead, and returns
+// the same matrix.  LAGraph_MMRead saves the entries of a file in coordinate
+// format as (i,j,x) triplets, and then builds the matrix with
+// GrB_Matrix_build.  The triplets take 16 bytes plus the size of the type for
+// each entry, twice that for a symmetric or skew-symmetric file (which holds
+// only the lower triangular part), and GrB_Matrix_build needs workspace of its
+// own, so the peak memory usage can be several times the size of the result.
+
+// LAGraph_MMRead_LowMemory reads the file twice instead.  The first pass
+// counts the entries in each row, which gives the row pointers Ap of the CSR
+// format of the result.  The second pass places each entry directly in its
+// row, in the column indices Aj and the values Ax.  Each row is then sorted,
+// and the arrays are given to the matrix with GxB_Matrix_pack_CSR, with no
+// copying.  The peak memory usage is the size of the result plus a single
+// block buffer for reading the file.  A pattern file gives an iso-valued
+// matrix, with a single value in Ax.
+
+// The file must be seekable (not a pipe).  If it is not, or if
+// SuiteSparse:GraphBLAS is not in use, the matrix is read with the same
+// method as LAGraph_MMRead.
+
+// Return values: the same as LAGraph_MMRead.
+
+#include "LG_internal.h"
+#include "LAGraphX.h"
+
+int LAGraph_MMRead_LowMemory
+(
+    // output:
+    GrB_Matrix *A,  // handle of matrix to create
+    // input:
+    FILE *f,        // file to read from, already open
+    char *msg
+)
+{
+    return (LG_MMRead (A, f, true, NULL, msg)) ;
+}
@@ -0,0 +1,409 @@
+//------------------------------------------------------------------------------
+// LAGraph_MemStats: memory allocation statistics
+//------------------------------------------------------------------------------
+
+// LAGraph, (c) 2019-2022 by The LAGraph Contributors, All Rights Reserved.
+// SPDX-License-Identifier: BSD-2-Clause
+//
+// For additional details (including references to third party source code and
+// other files) see the LICENSE file or contact permission@sei.cmu.edu. See
+// Contributors.txt for a full list of contributors. Created, in part, with
+// funding and support from the U.S. Government (see Acknowledgments.txt file).
+// DM22-0790
+
+//------------------------------------------------------------------------------
+
+// The LAGraph_MemStats_* memory functions record the number of blocks
+// allocated and freed, the bytes allocated, and the high-water mark of the
+// bytes in use, by LAGraph and by GraphBLAS.  To use them, pass them to
+// LAGr_Init:
+//
+//      LAGr_Init (GrB_NONBLOCKING, LAGraph_MemStats_malloc,
+//          LAGraph_MemStats_calloc, LAGraph_MemStats_realloc,
+//          LAGraph_MemStats_free, msg) ;
+//
+// They allocate memory with malloc, realloc, and free, unless
+// LAGraph_MemStats_SetAllocator is called first (before LAGr_Init) to use
+// other functions, such as LAGraph_Pool_malloc, LAGraph_Pool_realloc, and
+// LAGraph_Pool_free.  Each block has a
+// 16-byte header that holds its size.
+//
+// The statistics of one call to an algorithm are found by bracketing it with
+// LAGraph_MemStats_Begin and LAGraph_MemStats_End:
+//
+//      LAGraph_MemStats stats ;
+//      LAGraph_MemStats_Begin (&stats, msg) ;
+//      LAGr_BreadthFirstSearch (&level, &parent, G, src, msg) ;
+//      LAGraph_MemStats_End (&stats, "bfs", msg) ;
+//      // stats.peak is the most memory the call used at any one time
+//
+// If the name passed to LAGraph_MemStats_End is not NULL, the statistics of
+// the call are also added to a global table, under that name.
+// LAGraph_MemStats_Query returns the statistics for a name, summed over all
+// calls with that name (with the largest peak of any one call), or the
+// statistics of all allocations since LAGr_Init (or the last
+// LAGraph_MemStats_Reset) if the name is NULL.
+//
+// Scopes may be nested, but the counters are global: if two user threads
+// call algorithms at the same time, each scope records the allocations of
+// both threads.
+
+//------------------------------------------------------------------------------
+
+#define LG_FREE_ALL ;
+
+#include "LG_internal.h"
+#include "LAGraphX.h"
+
+// max # of names in the global table
+#define LG_MEMSTATS_NAMES 64
+
+//------------------------------------------------------------------------------
+// global counters and underlying memory functions
+//------------------------------------------------------------------------------
+
+static int64_t LG_memstats_nmalloc = 0 ;      // # of blocks allocated
+static int64_t LG_memstats_nfree = 0 ;        // # of blocks freed
+static int64_t LG_memstats_bytes = 0 ;        // total bytes allocated
+static int64_t LG_memstats_in_use = 0 ;       // bytes in use now
+static int64_t LG_memstats_peak = 0 ;         // high-water mark since reset
+static int64_t LG_memstats_mark_peak = 0 ;    // high-water mark since Begin
+
+static void * (* LG_memstats_malloc_function  ) (size_t) = malloc ;
+static void * (* LG_memstats_realloc_function ) (void *, size_t) = realloc ;
+static void   (* LG_memstats_free_function    ) (void *) = free ;
+
+// the global table of statistics, by name
+static struct
+{
+    char name [LAGRAPH_MAX_NAME_LEN] ;
+    LAGraph_MemStats stats ;
+}
+LG_memstats_table [LG_MEMSTATS_NAMES] ;
+static int LG_memstats_ntable = 0 ;
+
+// the header of each block
+typedef struct
+{
+    size_t size ;
+    size_t unused ;
+}
+LG_memstats_header ;
+
+//------------------------------------------------------------------------------
+// LG_memstats_record: record a change in the bytes in use
+//------------------------------------------------------------------------------
+
+static void LG_memstats_record
+(
+    int64_t nmalloc,        // # of blocks allocated
+    int64_t nfree,          // # of blocks freed
+    int64_t bytes,          // bytes allocated
+    int64_t delta           // change in the bytes in use
+)
+{
+    int64_t in_use ;
+    #pragma omp atomic update
+    LG_memstats_nmalloc += nmalloc ;
+    #pragma omp atomic update
+    LG_memstats_nfree += nfree ;
+    #pragma omp atomic update
+    LG_memstats_bytes += bytes ;
+    #pragma omp atomic capture
+    {
+        LG_memstats_in_use += delta ;
+        in_use = LG_memstats_in_use ;
+    }
+    if (delta > 0)
+    {
+        // update the high-water marks
+        int64_t peak, mark_peak ;
+        #pragma omp atomic read
+        peak = LG_memstats_peak ;
+        #pragma omp atomic read
+        mark_peak = LG_memstats_mark_peak ;
+        if (in_use > peak || in_use > mark_peak)
+        {
+            #pragma omp critical (LG_memstats_critical)
+            {
+                LG_memstats_peak = LAGRAPH_MAX (LG_memstats_peak, in_use) ;
+                LG_memstats_mark_peak =
+                    LAGRAPH_MAX (LG_memstats_mark_peak, in_use) ;
+            }
+        }
+    }
+}
+
+//------------------------------------------------------------------------------
+// LAGraph_MemStats_malloc
+//------------------------------------------------------------------------------
+
+void *LAGraph_MemStats_malloc   // return pointer to allocated block of memory
+(
+    size_t size                 // # of bytes to allocate
+)
+{
+    size = LAGRAPH_MAX (1, size) ;
+    if (size > SIZE_MAX - sizeof (LG_memstats_header)) return (NULL) ;
+    LG_memstats_header *h =
+        LG_memstats_malloc_function (sizeof (LG_memstats_header) + size) ;
+    if (h == NULL) return (NULL) ;
+    h->size = size ;
+    LG_memstats_record (1, 0, (int64_t) size, (int64_t) size) ;
+    return ((void *) (h + 1)) ;
+}
+
+//------------------------------------------------------------------------------
+// LAGraph_MemStats_calloc
+//------------------------------------------------------------------------------
+
+void *LAGraph_MemStats_calloc   // return pointer to allocated block of memory
+(
+    size_t nitems,              // # of items to allocate
+    size_t itemsize             // # of bytes per item
+)
+{
+    size_t size ;
+    if (!LG_Multiply_size_t (&size, nitems, itemsize))
+    {
+        // overflow
+        return (NULL) ;
+    }
+    size = LAGRAPH_MAX (1, size) ;
+    void *p = LAGraph_MemStats_malloc (size) ;
+    if (p != NULL)
+    {
+        memset (p, 0, size) ;
+    }
+    return (p) ;
+}
+
+//------------------------------------------------------------------------------
+// LAGraph_MemStats_realloc
+//------------------------------------------------------------------------------
+
+void *LAGraph_MemStats_realloc  // return pointer to reallocated memory
+(
+    void *p,                    // block to realloc
+    size_t size                 // new size of the block
+)
+{
+    if (p == NULL)
+    {
+        return (LAGraph_MemStats_malloc (size)) ;
+    }
+    size = LAGRAPH_MAX (1, size) ;
+    if (size > SIZE_MAX - sizeof (LG_memstats_header)) return (NULL) ;
+    LG_memstats_header *h = ((LG_memstats_header *) p) - 1 ;
+    int64_t oldsize = (int64_t) h->size ;
+    h = LG_memstats_realloc_function (h, sizeof (LG_memstats_header) + size) ;
+    if (h == NULL) return (NULL) ;
+    h->size = size ;
+    int64_t delta = ((int64_t) size) - oldsize ;
+    LG_memstats_record (0, 0, LAGRAPH_MAX (delta, 0), delta) ;
+    return ((void *) (h + 1)) ;
+}
+
+//------------------------------------------------------------------------------
+// LAGraph_MemStats_free
+//------------------------------------------------------------------------------
+
+void LAGraph_MemStats_free
+(
+    void *p                     // block to free
+)
+{
+    if (p == NULL) return ;
+    LG_memstats_header *h = ((LG_memstats_header *) p) - 1 ;
+    int64_t size = (int64_t) h->size ;
+    LG_memstats_free_function (h) ;
+    LG_memstats_record (0, 1, 0, -size) ;
+}
+
+//------------------------------------------------------------------------------
+// LAGraph_MemStats_SetAllocator: set the underlying memory functions
+//------------------------------------------------------------------------------
+
+int LAGraph_MemStats_SetAllocator
+(
+    // input:
+    void * (* user_malloc_function  ) (size_t),
+    void * (* user_realloc_function ) (void *, size_t),
+    void   (* user_free_function    ) (void *),
+    char *msg
+)
+{
+    LG_CLEAR_MSG ;
+    LG_ASSERT (user_malloc_function  != NULL, GrB_NULL_POINTER) ;
+    LG_ASSERT (user_realloc_function != NULL, GrB_NULL_POINTER) ;
+    LG_ASSERT (user_free_function    != NULL, GrB_NULL_POINTER) ;
+    LG_ASSERT_MSG (LG_memstats_in_use == 0, GrB_INVALID_VALUE,
+        "allocator cannot be changed while blocks are in use") ;
+    LG_memstats_malloc_function  = user_malloc_function ;
+    LG_memstats_realloc_function = user_realloc_function ;
+    LG_memstats_free_function    = user_free_function ;
+    return (GrB_SUCCESS) ;
+}
+
+//------------------------------------------------------------------------------
+// LAGraph_MemStats_Begin: start recording the statistics of a scope
+//------------------------------------------------------------------------------
+
+int LAGraph_MemStats_Begin
+(
+    // output:
+    LAGraph_MemStats *stats,    // statistics of the scope
+    char *msg
+)
+{
+    LG_CLEAR_MSG ;
+    LG_ASSERT (stats != NULL, GrB_NULL_POINTER) ;
+    memset (stats, 0, sizeof (LAGraph_MemStats)) ;
+    #pragma omp critical (LG_memstats_critical)
+    {
+        // save the counters at the start of the scope
+        stats->start_nmalloc = LG_memstats_nmalloc ;
+        stats->start_nfree = LG_memstats_nfree ;
+        stats->start_bytes = LG_memstats_bytes ;
+        stats->start_in_use = LG_memstats_in_use ;
+        // save the high-water mark of the enclosing scope, and start a new one
+        stats->outer_peak = LG_memstats_mark_peak ;
+        LG_memstats_mark_peak = LG_memstats_in_use ;
+    }
+    return (GrB_SUCCESS) ;
+}
+
+//------------------------------------------------------------------------------
+// LAGraph_MemStats_End: finish recording the statistics of a scope
+//------------------------------------------------------------------------------
+
+int LAGraph_MemStats_End
+(
+    // input/output:
+    LAGraph_MemStats *stats,    // statistics of the scope
+    // input:
+    const char *name,           // if not NULL, add stats to the global table
+    char *msg
+)
+{
+    LG_CLEAR_MSG ;
+    LG_ASSERT (stats != NULL, GrB_NULL_POINTER) ;
+    bool full = false ;
+    #pragma omp critical (LG_memstats_critical)
+    {
+        stats->ncalls  = 1 ;
+        stats->nmalloc = LG_memstats_nmalloc - stats->start_nmalloc ;
+        stats->nfree   = LG_memstats_nfree   - stats->start_nfree ;
+        stats->bytes   = LG_memstats_bytes   - stats->start_bytes ;
+        stats->in_use  = LG_memstats_in_use  - stats->start_in_use ;
+        stats->peak    = LG_memstats_mark_peak - stats->start_in_use ;
+        // the high-water mark of the enclosing scope includes this one
+        LG_memstats_mark_peak =
+            LAGRAPH_MAX (LG_memstats_mark_peak, stats->outer_peak) ;
+
+        if (name != NULL)
+        {
+            // find the name in the table, or add it
+            int k ;
+            for (k = 0 ; k < LG_memstats_ntable ; k++)
+            {
+                if (strncmp (LG_memstats_table [k].name, name,
+                    LAGRAPH_MAX_NAME_LEN) == 0) break ;
+            }
+            if (k == LG_memstats_ntable && k < LG_MEMSTATS_NAMES)
+            {
+                strncpy (LG_memstats_table [k].name, name,
+                    LAGRAPH_MAX_NAME_LEN-1) ;
+                LG_memstats_table [k].name [LAGRAPH_MAX_NAME_LEN-1] = '\0' ;
+                memset (&(LG_memstats_table [k].stats), 0,
+                    sizeof (LAGraph_MemStats)) ;
+                LG_memstats_ntable++ ;
+            }
+            if (k < LG_memstats_ntable)
+            {
+                LAGraph_MemStats *s = &(LG_memstats_table [k].stats) ;
+                s->ncalls  += 1 ;
+                s->nmalloc += stats->nmalloc ;
+                s->nfree   += stats->nfree ;
+                s->bytes   += stats->bytes ;
+                s->in_use  += stats->in_use ;
+                s->peak     = LAGRAPH_MAX (s->peak, stats->peak) ;
+            }
+            else
+            {
+                full = true ;
+            }
+        }
+    }
+    LG_ASSERT_MSG (!full, GrB_INSUFFICIENT_SPACE,
+        "too many names in the LAGraph_MemStats table") ;
+    return (GrB_SUCCESS) ;
+}
+
+//------------------------------------------------------------------------------
+// LAGraph_MemStats_Query: get the statistics for a name, or for all
+//------------------------------------------------------------------------------
+
+int LAGraph_MemStats_Query
+(
+    // output:
+    LAGraph_MemStats *stats,    // statistics for the name
+    // input:
+    const char *name,           // name to query, or NULL for all allocations
+    char *msg
+)
+{
+    LG_CLEAR_MSG ;
+    LG_ASSERT (stats != NULL, GrB_NULL_POINTER) ;
+    memset (stats, 0, sizeof (LAGraph_MemStats)) ;
+    #pragma omp critical (LG_memstats_critical)
+    {
+        if (name == NULL)
+        {
+            stats->nmalloc = LG_memstats_nmalloc ;
+            stats->nfree   = LG_memstats_nfree ;
+            stats->bytes   = LG_memstats_bytes ;
+            stats->in_use  = LG_memstats_in_use ;
+            stats->peak    = LG_memstats_peak ;
+        }
+        else
+        {
+            for (int k = 0 ; k < LG_memstats_ntable ; k++)
+            {
+                if (strncmp (LG_memstats_table [k].name, name,
+                    LAGRAPH_MAX_NAME_LEN) == 0)
+                {
+                    (*stats) = LG_memstats_table [k].stats ;
+                    break ;
+                }
+            }
+        }
+    }
+    return (GrB_SUCCESS) ;
+}
+
+//------------------------------------------------------------------------------
+// LAGraph_MemStats_Reset: clear the global statistics and the table
+//------------------------------------------------------------------------------
+
+// The bytes in use are not cleared, since those blocks are still allocated.
+// The high-water mark is reset to the bytes in use.  LAGraph_MemStats_Reset
+// must not be called inside a LAGraph_MemStats_Begin/End scope.
+
+int LAGraph_MemStats_Reset
+(
+    char *msg
+)
+{
+    LG_CLEAR_MSG ;
+    #pragma omp critical (LG_memstats_critical)
+    {
+        LG_memstats_nmalloc = 0 ;
+        LG_memstats_nfree = 0 ;
+        LG_memstats_bytes = 0 ;
+        LG_memstats_peak = LG_memstats_in_use ;
+        LG_memstats_mark_peak = LG_memstats_in_use ;
+        LG_memstats_ntable = 0 ;
+    }
+    return (GrB_SUCCESS) ;
+}
@@ -0,0 +1,396 @@
+//------------------------------------------------------------------------------
+// LAGraph_Pool: a thread-caching size-class memory pool for LAGr_Init
+//------------------------------------------------------------------------------
+
+// LAGraph, (c) 2019-2022 by The LAGraph Contributors, All Rights Reserved.
+// SPDX-License-Identifier: BSD-2-Clause
+//
+// For additional details (including references to third party source code and
+// other files) see the LICENSE file or contact permission@sei.cmu.edu. See
+// Contributors.txt for a full list of contributors. Created, in part, with
+// funding and support from the U.S. Government (see Acknowledgments.txt file).
+// DM22-0790
+
+//------------------------------------------------------------------------------
+
+// LAGraph algorithms, and GraphBLAS itself, allocate and free many blocks of
+// workspace of the same size on each iteration.  For a small graph, the time
+// spent in malloc and free can exceed the time spent in the algorithm itself.
+// The LAGraph_Pool_* functions keep freed blocks in free lists, one per size
+// class, and reuse them for later allocations.  To use them, pass them to
+// LAGr_Init, which passes them in turn to GxB_init:
+//
+//      LAGr_Init (GrB_NONBLOCKING, LAGraph_Pool_malloc, LAGraph_Pool_calloc,
+//          LAGraph_Pool_realloc, LAGraph_Pool_free, msg) ;
+//      ... use LAGraph and GraphBLAS
+//      LAGraph_Finalize (msg) ;
+//      LAGraph_Pool_Release (msg) ;
+//
+// Each block has a 16-byte header that holds its size class.  Blocks of up
+// to 1 MB are rounded up to a power of 2 (at least 64 bytes) and pooled;
+// larger blocks are passed directly to malloc, realloc, and free.
+//
+// Each user or OpenMP thread has its own cache of free blocks, so most calls
+// to LAGraph_Pool_malloc and LAGraph_Pool_free take no lock at all.  When a
+// thread cache for one size class is full, half of it is moved to a global
+// free list (under a critical section), and a thread with an empty cache
+// takes blocks from the global list before calling malloc.  The global list
+// is bounded in size as well, beyond which blocks are returned to the system.
+// A block freed by one thread can be reused by any other.
+//
+// LAGraph_Pool_Release returns all free blocks in all thread caches and in the
+// global list to the system.  It must only be called when no other thread is
+// using the pool, typically after LAGraph_Finalize.  A small descriptor for
+// each thread cache remains allocated, so that threads can continue to use
+// the pool afterwards.
+
+//------------------------------------------------------------------------------
+
+#define LG_FREE_ALL ;
+
+#include "LG_internal.h"
+#include "LAGraphX.h"
+
+// thread-local storage
+#if defined ( _MSC_VER ) && !defined ( __INTEL_COMPILER )
+    #define LG_THREAD_LOCAL __declspec ( thread )
+#else
+    #define LG_THREAD_LOCAL _Thread_local
+#endif
+
+// size classes: 64 bytes (2^6) to 1 MB (2^20)
+#define LG_POOL_MIN_LOG2    6
+#define LG_POOL_NCLASSES    15
+#define LG_POOL_LARGE       LG_POOL_NCLASSES
+
+// bytes held in each size class by each thread cache, and by the global list
+#define LG_POOL_CACHE_BYTES  (1 << 20)
+#define LG_POOL_GLOBAL_BYTES (16 << 20)
+
+// the header of each block: its size class, and its size (for large blocks).
+// The header is 16 bytes, so the block keeps the alignment of malloc.
+typedef struct
+{
+    size_t size_class ;
+    size_t size ;
+}
+LG_pool_header ;
+
+// a free block holds a pointer to the next free block in its list
+typedef struct LG_pool_free_struct
+{
+    struct LG_pool_free_struct *next ;
+}
+LG_pool_free ;
+
+// the free lists of one thread, for each size class
+typedef struct LG_pool_cache_struct
+{
+    LG_pool_free *head [LG_POOL_NCLASSES] ;
+    int64_t count [LG_POOL_NCLASSES] ;
+    struct LG_pool_cache_struct *next ;     // next thread cache in registry
+}
+LG_pool_cache ;
+
+// the cache for this thread, and a registry of all thread caches
+static LG_THREAD_LOCAL LG_pool_cache *LG_pool_mycache = NULL ;
+static LG_pool_cache *LG_pool_registry = NULL ;
+
+// the global free lists, shared by all threads
+static LG_pool_free *LG_pool_global [LG_POOL_NCLASSES] ;
+static int64_t LG_pool_global_count [LG_POOL_NCLASSES] ;
+
+//------------------------------------------------------------------------------
+// LG_pool_class_size: size of the blocks in a size class
+//------------------------------------------------------------------------------
+
+static inline size_t LG_pool_class_size (size_t k)
+{
+    return (((size_t) 1) << (k + LG_POOL_MIN_LOG2)) ;
+}
+
+//------------------------------------------------------------------------------
+// LG_pool_class_limit: max # of blocks in a size class of one thread cache
+//------------------------------------------------------------------------------
+
+static inline int64_t LG_pool_class_limit (size_t k, size_t bytes)
+{
+    return (LAGRAPH_MAX (2, (int64_t) (bytes / LG_pool_class_size (k)))) ;
+}
+
+//------------------------------------------------------------------------------
+// LG_pool_size_class: find the size class of a request
+//------------------------------------------------------------------------------
+
+static inline size_t LG_pool_size_class (size_t size)
+{
+    if (size > LG_pool_class_size (LG_POOL_NCLASSES - 1))
+    {
+        return (LG_POOL_LARGE) ;
+    }
+    size_t k = 0 ;
+    while (LG_pool_class_size (k) < size)
+    {
+        k++ ;
+    }
+    return (k) ;
+}
+
+//------------------------------------------------------------------------------
+// LG_pool_get_cache: get the cache of this thread, creating it if needed
+//------------------------------------------------------------------------------
+
+static LG_pool_cache *LG_pool_get_cache (void)
+{
+    LG_pool_cache *cache = LG_pool_mycache ;
+    if (cache == NULL)
+    {
+        cache = calloc (1, sizeof (LG_pool_cache)) ;
+        if (cache != NULL)
+        {
+            // add the new thread cache to the registry
+            #pragma omp critical (LG_pool_critical)
+            {
+                cache->next = LG_pool_registry ;
+                LG_pool_registry = cache ;
+            }
+            LG_pool_mycache = cache ;
+        }
+    }
+    return (cache) ;
+}
+
+//------------------------------------------------------------------------------
+// LAGraph_Pool_malloc
+//------------------------------------------------------------------------------
+
+void *LAGraph_Pool_malloc   // return pointer to allocated block of memory
+(
+    size_t size             // # of bytes to allocate
+)
+{
+    size = LAGRAPH_MAX (1, size) ;
+    size_t k = LG_pool_size_class (size) ;
+    LG_pool_header *h = NULL ;
+
+    if (k == LG_POOL_LARGE)
+    {
+        // large blocks are not pooled
+        if (size > SIZE_MAX - sizeof (LG_pool_header)) return (NULL) ;
+        h = malloc (sizeof (LG_pool_header) + size) ;
+        if (h == NULL) return (NULL) ;
+        h->size_class = LG_POOL_LARGE ;
+        h->size = size ;
+        return ((void *) (h + 1)) ;
+    }
+
+    LG_pool_cache *cache = LG_pool_get_cache ( ) ;
+    if (cache != NULL && cache->head [k] == NULL)
+    {
+        // refill the thread cache from the global list
+        int64_t refill = LG_pool_class_limit (k, LG_POOL_CACHE_BYTES) / 2 ;
+        #pragma omp critical (LG_pool_critical)
+        {
+            while (refill > 0 && LG_pool_global [k] != NULL)
+            {
+                LG_pool_free *b = LG_pool_global [k] ;
+                LG_pool_global [k] = b->next ;
+                LG_pool_global_count [k]-- ;
+                b->next = cache->head [k] ;
+                cache->head [k] = b ;
+                cache->count [k]++ ;
+                refill-- ;
+            }
+        }
+    }
+
+    if (cache != NULL && cache->head [k] != NULL)
+    {
+        // reuse a block from the thread cache
+        LG_pool_free *b = cache->head [k] ;
+        cache->head [k] = b->next ;
+        cache->count [k]-- ;
+        h = ((LG_pool_header *) b) - 1 ;
+    }
+    else
+    {
+        // allocate a new block
+        h = malloc (sizeof (LG_pool_header) + LG_pool_class_size (k)) ;
+        if (h == NULL) return (NULL) ;
+        h->size_class = k ;
+        h->size = LG_pool_class_size (k) ;
+    }
+    return ((void *) (h + 1)) ;
+}
+
+//------------------------------------------------------------------------------
+// LAGraph_Pool_calloc
+//------------------------------------------------------------------------------
+
+void *LAGraph_Pool_calloc   // return pointer to allocated block of memory
+(
+    size_t nitems,          // # of items to allocate
+    size_t itemsize         // # of bytes per item
+)
+{
+    size_t size ;
+    if (!LG_Multiply_size_t (&size, nitems, itemsize))
+    {
+        // overflow
+        return (NULL) ;
+    }
+    size = LAGRAPH_MAX (1, size) ;
+    void *p = LAGraph_Pool_malloc (size) ;
+    if (p != NULL)
+    {
+        memset (p, 0, size) ;
+    }
+    return (p) ;
+}
+
+//------------------------------------------------------------------------------
+// LAGraph_Pool_free
+//------------------------------------------------------------------------------
+
+void LAGraph_Pool_free
+(
+    void *p                 // block to free
+)
+{
+    if (p == NULL) return ;
+    LG_pool_header *h = ((LG_pool_header *) p) - 1 ;
+    size_t k = h->size_class ;
+
+    if (k == LG_POOL_LARGE)
+    {
+        free (h) ;
+        return ;
+    }
+
+    LG_pool_cache *cache = LG_pool_get_cache ( ) ;
+    if (cache == NULL)
+    {
+        free (h) ;
+        return ;
+    }
+
+    // keep the block in the thread cache
+    LG_pool_free *b = (LG_pool_free *) p ;
+    b->next = cache->head [k] ;
+    cache->head [k] = b ;
+    cache->count [k]++ ;
+
+    int64_t limit = LG_pool_class_limit (k, LG_POOL_CACHE_BYTES) ;
+    if (cache->count [k] > limit)
+    {
+        // the thread cache is full: move half of it to the global list, and
+        // return any blocks that do not fit there to the system
+        int64_t global_limit = LG_pool_class_limit (k, LG_POOL_GLOBAL_BYTES) ;
+        int64_t nmove = limit / 2 ;
+        LG_pool_free *spill = NULL ;
+        #pragma omp critical (LG_pool_critical)
+        {
+            for ( ; nmove > 0 ; nmove--)
+            {
+                b = cache->head [k] ;
+                cache->head [k] = b->next ;
+                cache->count [k]-- ;
+                if (LG_pool_global_count [k] < global_limit)
+                {
+                    b->next = LG_pool_global [k] ;
+                    LG_pool_global [k] = b ;
+                    LG_pool_global_count [k]++ ;
+                }
+                else
+                {
+                    b->next = spill ;
+                    spill = b ;
+                }
+            }
+        }
+        while (spill != NULL)
+        {
+            b = spill ;
+            spill = b->next ;
+            free (((LG_pool_header *) b) - 1) ;
+        }
+    }
+}
+
+//------------------------------------------------------------------------------
+// LAGraph_Pool_realloc
+//------------------------------------------------------------------------------
+
+void *LAGraph_Pool_realloc  // return pointer to reallocated memory
+(
+    void *p,                // block to realloc
+    size_t size             // new size of the block
+)
+{
+    if (p == NULL)
+    {
+        return (LAGraph_Pool_malloc (size)) ;
+    }
+    size = LAGRAPH_MAX (1, size) ;
+    LG_pool_header *h = ((LG_pool_header *) p) - 1 ;
+
+    if (h->size_class == LG_POOL_LARGE)
+    {
+        // a large block stays large, even if it shrinks
+        if (size > SIZE_MAX - sizeof (LG_pool_header)) return (NULL) ;
+        LG_pool_header *hnew = realloc (h, sizeof (LG_pool_header) + size) ;
+        if (hnew == NULL) return (NULL) ;
+        hnew->size = size ;
+        return ((void *) (hnew + 1)) ;
+    }
+
+    if (size <= h->size)
+    {
+        // the block is already large enough
+        return (p) ;
+    }
+
+    // move the block to a larger size class
+    void *pnew = LAGraph_Pool_malloc (size) ;
+    if (pnew == NULL) return (NULL) ;
+    memcpy (pnew, p, h->size) ;
+    LAGraph_Pool_free (p) ;
+    return (pnew) ;
+}
+
+//------------------------------------------------------------------------------
+// LAGraph_Pool_Release: return all free blocks to the system
+//------------------------------------------------------------------------------
+
+int LAGraph_Pool_Release
+(
+    char *msg
+)
+{
+    LG_CLEAR_MSG ;
+    #pragma omp critical (LG_pool_critical)
+    {
+        for (size_t k = 0 ; k < LG_POOL_NCLASSES ; k++)
+        {
+            for (LG_pool_cache *cache = LG_pool_registry ; cache != NULL ;
+                cache = cache->next)
+            {
+                while (cache->head [k] != NULL)
+                {
+                    LG_pool_free *b = cache->head [k] ;
+                    cache->head [k] = b->next ;
+                    free (((LG_pool_header *) b) - 1) ;
+                }
+                cache->count [k] = 0 ;
+            }
+            while (LG_pool_global [k] != NULL)
+            {
+                LG_pool_free *b = LG_pool_global [k] ;
+                LG_pool_global [k] = b->next ;
+                free (((LG_pool_header *) b) - 1) ;
+            }
+            LG_pool_global_count [k] = 0 ;
+        }
+    }
+    return (GrB_SUCCESS) ;
+}
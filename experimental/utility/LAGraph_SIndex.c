@@ -0,0 +1,354 @@
+//------------------------------------------------------------------------------
+// LAGraph_SIndex: random access to the items in a *.lagraph file
+//------------------------------------------------------------------------------
+
+// LAGraph, (c) 2019-2022 by The LAGraph Contributors, All Rights Reserved.
+// SPDX-License-Identifier: BSD-2-Clause
+//
+// For additional details (including references to third party source code and
+// other files) see the LICENSE file or contact permission@sei.cmu.edu. See
+// Contributors.txt for a full list of contributors. Created, in part, with
+// funding and support from the U.S. Government (see Acknowledgments.txt file).
+// DM22-0790
+
+//------------------------------------------------------------------------------
+
+// LAGraph_SOpen opens a *.lagraph file and reads its JSON header, with
+// LAGraph_SReadHeader.  The offset of each serialized blob in the file is
+// computed from the sizes given in the header, so any one item can then be
+// read or deserialized without reading any of the others:
+
+//      LAGraph_SIndex Index = NULL ;
+//      LAGraph_SOpen (&Index, "mystuff.lagraph", msg) ;
+//      int64_t k ;
+//      LAGraph_SFind (&k, Index, "A_3", msg) ;
+//      LAGraph_SLoadItem (&A, Index, k, msg) ;
+//      LAGraph_SClose (&Index, msg) ;
+
+// On POSIX systems, the file is mapped into memory with mmap, and a matrix is
+// deserialized directly from the mapped file.  Only the pages of the blob
+// being deserialized are read from disk.  Since the mapping is read-only,
+// LAGraph_SReadItem and LAGraph_SLoadItem may then be called by many user
+// threads at the same time, for the same Index.  On other systems (or if mmap
+// fails), each blob is read with fseek and fread, and the two methods are not
+// thread-safe.
+
+// Index->Contents [k].blob is always NULL; LAGraph_SReadItem returns a copy
+// of the blob for the kth item, which the caller must free with LAGraph_Free.
+
+//------------------------------------------------------------------------------
+
+#if defined ( __linux__ ) || defined ( __APPLE__ ) || defined ( __unix__ )
+#define LG_SINDEX_MMAP 1
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <fcntl.h>
+#include <unistd.h>
+#else
+#define LG_SINDEX_MMAP 0
+#endif
+
+#include "LG_internal.h"
+#include "LAGraphX.h"
+
+//------------------------------------------------------------------------------
+// get_blob: get a pointer to the kth blob, reading it if necessary
+//------------------------------------------------------------------------------
+
+// If the file is mapped, (*blob) points into the mapping and (*copy) is
+// false.  Otherwise, the blob is read into newly allocated space, and
+// (*copy) is true.
+
+static int get_blob
+(
+    void **blob,
+    bool *copy,
+    LAGraph_SIndex Index,
+    GrB_Index k,
+    char *msg
+)
+{
+    (*blob) = NULL ;
+    (*copy) = false ;
+    size_t blob_size = Index->Contents [k].blob_size ;
+    size_t offset = Index->offset [k] ;
+
+    #if LG_SINDEX_MMAP
+    if (Index->map != NULL)
+    {
+        // start reading the pages of the blob from the file
+        size_t pagesize = (size_t) sysconf (_SC_PAGESIZE) ;
+        size_t first = (offset / pagesize) * pagesize ;
+        madvise (((uint8_t *) Index->map) + first, offset + blob_size - first,
+            MADV_WILLNEED) ;
+        (*blob) = ((uint8_t *) Index->map) + offset ;
+        return (GrB_SUCCESS) ;
+    }
+    #endif
+
+    void *p = NULL ;
+    LG_TRY (LAGraph_Malloc (&p, LAGRAPH_MAX (blob_size, 1), sizeof (uint8_t),
+        msg)) ;
+    int result = LG_fseek (Index->f, offset, SEEK_SET) ;
+    if (result != 0 ||
+        fread (p, sizeof (uint8_t), blob_size, Index->f) != blob_size)
+    {
+        LAGraph_Free (&p, NULL) ;
+        LG_ASSERT_MSG (false, LAGRAPH_IO_ERROR, "file is truncated") ;
+    }
+    (*blob) = p ;
+    (*copy) = true ;
+    return (GrB_SUCCESS) ;
+}
+
+//------------------------------------------------------------------------------
+// LAGraph_SOpen: open a *.lagraph file and index its contents
+//------------------------------------------------------------------------------
+
+#undef  LG_FREE_ALL
+#define LG_FREE_ALL LAGraph_SClose (&I, NULL) ;
+
+int LAGraph_SOpen               // open a *.lagraph file for random access
+(
+    // output:
+    LAGraph_SIndex *Index,      // index of the file
+    // input:
+    const char *filename,       // name of the *.lagraph file to open
+    char *msg
+)
+{
+
+    //--------------------------------------------------------------------------
+    // check inputs
+    //--------------------------------------------------------------------------
+
+    LG_CLEAR_MSG ;
+    LAGraph_SIndex I = NULL ;
+    LG_ASSERT (Index != NULL && filename != NULL, GrB_NULL_POINTER) ;
+    (*Index) = NULL ;
+
+    LG_TRY (LAGraph_Calloc ((void **) &I, 1,
+        sizeof (struct LAGraph_SIndex_struct), msg)) ;
+
+    //--------------------------------------------------------------------------
+    // open the file and read the JSON header
+    //--------------------------------------------------------------------------
+
+    I->f = fopen (filename, "rb") ;
+    LG_ASSERT_MSGF (I->f != NULL, LAGRAPH_IO_ERROR,
+        "unable to open file: %s", filename) ;
+    LG_TRY (LAGraph_SReadHeader (I->f, &(I->collection), &(I->Contents),
+        &(I->ncontents), msg)) ;
+
+    //--------------------------------------------------------------------------
+    // find the size of the file and the offset of each blob
+    //--------------------------------------------------------------------------
+
+    int64_t start = LG_ftell (I->f) ;
+    bool ok = (start >= 0 && LG_fseek (I->f, 0, SEEK_END) == 0) ;
+    int64_t file_size = LG_ftell (I->f) ;
+    LG_ASSERT_MSG (ok && file_size >= start, LAGRAPH_IO_ERROR,
+        "file is not seekable") ;
+    I->file_size = (size_t) file_size ;
+
+    LG_TRY (LAGraph_Malloc ((void **) &(I->offset), I->ncontents + 1,
+        sizeof (size_t), msg)) ;
+    size_t offset = (size_t) start ;
+    for (GrB_Index k = 0 ; k < I->ncontents ; k++)
+    {
+        I->offset [k] = offset ;
+        size_t blob_size = I->Contents [k].blob_size ;
+        LG_ASSERT_MSG (blob_size <= I->file_size - offset, LAGRAPH_IO_ERROR,
+            "file is truncated") ;
+        offset += blob_size ;
+    }
+    I->offset [I->ncontents] = offset ;
+
+    //--------------------------------------------------------------------------
+    // map the file into memory, if possible
+    //--------------------------------------------------------------------------
+
+    #if LG_SINDEX_MMAP
+    if (I->file_size > 0)
+    {
+        int fd = open (filename, O_RDONLY) ;
+        if (fd >= 0)
+        {
+            void *map = mmap (NULL, I->file_size, PROT_READ, MAP_PRIVATE, fd,
+                0) ;
+            // the mapping remains valid after the file descriptor is closed
+            close (fd) ;
+            if (map != MAP_FAILED)
+            {
+                I->map = map ;
+                fclose (I->f) ;
+                I->f = NULL ;
+            }
+        }
+    }
+    #endif
+
+    (*Index) = I ;
+    return (GrB_SUCCESS) ;
+}
+
+//------------------------------------------------------------------------------
+// LAGraph_SClose: close a *.lagraph file opened by LAGraph_SOpen
+//------------------------------------------------------------------------------
+
+int LAGraph_SClose              // close a *.lagraph file and free its index
+(
+    // input/output:
+    LAGraph_SIndex *Index,      // index to free; set to NULL on output
+    char *msg
+)
+{
+    LG_CLEAR_MSG ;
+    if (Index != NULL && (*Index) != NULL)
+    {
+        LAGraph_SIndex I = (*Index) ;
+        #if LG_SINDEX_MMAP
+        if (I->map != NULL) munmap (I->map, I->file_size) ;
+        #endif
+        if (I->f != NULL) fclose (I->f) ;
+        LAGraph_Free ((void **) &(I->collection), NULL) ;
+        LAGraph_SFreeContents (&(I->Contents), I->ncontents) ;
+        LAGraph_Free ((void **) &(I->offset), NULL) ;
+        LAGraph_Free ((void **) Index, NULL) ;
+    }
+    return (GrB_SUCCESS) ;
+}
+
+//------------------------------------------------------------------------------
+// LAGraph_SFind: find an item in a *.lagraph file, by name
+//------------------------------------------------------------------------------
+
+#undef  LG_FREE_ALL
+#define LG_FREE_ALL ;
+
+int LAGraph_SFind               // find an item by name
+(
+    // output:
+    int64_t *k,                 // the item is Index->Contents [k]
+    // input:
+    LAGraph_SIndex Index,       // index of the file, from LAGraph_SOpen
+    const char *name,           // name of the item to find
+    char *msg
+)
+{
+    LG_CLEAR_MSG ;
+    LG_ASSERT (k != NULL && Index != NULL && name != NULL, GrB_NULL_POINTER) ;
+    (*k) = -1 ;
+    for (GrB_Index i = 0 ; i < Index->ncontents ; i++)
+    {
+        if (strcmp (Index->Contents [i].name, name) == 0)
+        {
+            // found the first item with this name
+            (*k) = (int64_t) i ;
+            break ;
+        }
+    }
+    LG_ASSERT_MSGF ((*k) >= 0, GrB_INVALID_INDEX, "item not found: %s", name) ;
+    return (GrB_SUCCESS) ;
+}
+
+//------------------------------------------------------------------------------
+// LAGraph_SReadItem: read the blob of a single item
+//------------------------------------------------------------------------------
+
+int LAGraph_SReadItem           // read a single serialized blob
+(
+    // output:
+    void **blob,                // copy of the serialized blob
+    GrB_Index *blob_size,       // size of the blob
+    // input:
+    LAGraph_SIndex Index,       // index of the file, from LAGraph_SOpen
+    GrB_Index k,                // item to read: Index->Contents [k]
+    char *msg
+)
+{
+
+    //--------------------------------------------------------------------------
+    // check inputs
+    //--------------------------------------------------------------------------
+
+    LG_CLEAR_MSG ;
+    LG_ASSERT (blob != NULL && blob_size != NULL && Index != NULL,
+        GrB_NULL_POINTER) ;
+    (*blob) = NULL ;
+    (*blob_size) = 0 ;
+    LG_ASSERT_MSG (k < Index->ncontents, GrB_INVALID_INDEX,
+        "item index out of range") ;
+
+    //--------------------------------------------------------------------------
+    // get the blob
+    //--------------------------------------------------------------------------
+
+    void *p = NULL ;
+    bool copy ;
+    size_t size = Index->Contents [k].blob_size ;
+    LG_TRY (get_blob (&p, &copy, Index, k, msg)) ;
+    if (!copy)
+    {
+        // the blob is in the mapped file; return a copy of it
+        void *mapped = p ;
+        LG_TRY (LAGraph_Malloc (&p, LAGRAPH_MAX (size, 1), sizeof (uint8_t),
+            msg)) ;
+        memcpy (p, mapped, size) ;
+    }
+    (*blob) = p ;
+    (*blob_size) = size ;
+    return (GrB_SUCCESS) ;
+}
+
+//------------------------------------------------------------------------------
+// LAGraph_SLoadItem: deserialize a single matrix
+//------------------------------------------------------------------------------
+
+#undef  LG_FREE_WORK
+#define LG_FREE_WORK                                \
+{                                                   \
+    if (copy) LAGraph_Free (&blob, NULL) ;          \
+}
+
+#undef  LG_FREE_ALL
+#define LG_FREE_ALL LG_FREE_WORK ;
+
+int LAGraph_SLoadItem           // deserialize a single matrix
+(
+    // output:
+    GrB_Matrix *A,              // matrix deserialized from the file
+    // input:
+    LAGraph_SIndex Index,       // index of the file, from LAGraph_SOpen
+    GrB_Index k,                // item to load: Index->Contents [k]
+    char *msg
+)
+{
+
+    //--------------------------------------------------------------------------
+    // check inputs
+    //--------------------------------------------------------------------------
+
+    LG_CLEAR_MSG ;
+    void *blob = NULL ;
+    bool copy = false ;
+    LG_ASSERT (A != NULL && Index != NULL, GrB_NULL_POINTER) ;
+    (*A) = NULL ;
+    LG_ASSERT_MSG (k < Index->ncontents, GrB_INVALID_INDEX,
+        "item index out of range") ;
+    LAGraph_Contents *Item = &(Index->Contents [k]) ;
+    LG_ASSERT_MSG (Item->kind == LAGraph_matrix_kind, GrB_NOT_IMPLEMENTED,
+        "only matrices can be loaded") ;
+
+    //--------------------------------------------------------------------------
+    // deserialize the matrix
+    //--------------------------------------------------------------------------
+
+    // SuiteSparse:GraphBLAS allows ctype to be NULL for built-in types.
+    GrB_Type ctype = NULL ;
+    LG_TRY (LAGraph_TypeFromName (&ctype, Item->type_name, msg)) ;
+    LG_TRY (get_blob (&blob, &copy, Index, k, msg)) ;
+    GRB_TRY (GrB_Matrix_deserialize (A, ctype, blob, Item->blob_size)) ;
+    LG_FREE_WORK ;
+    return (GrB_SUCCESS) ;
+}
@@ -0,0 +1,276 @@
+//------------------------------------------------------------------------------
+// LAGraph_SLoadGraph: load a graph and its cached properties from a file
+//------------------------------------------------------------------------------
+
+// LAGraph, (c) 2019-2022 by The LAGraph Contributors, All Rights Reserved.
+// SPDX-License-Identifier: BSD-2-Clause
+//
+// For additional details (including references to third party source code and
+// other files) see the LICENSE file or contact permission@sei.cmu.edu. See
+// Contributors.txt for a full list of contributors. Created, in part, with
+// funding and support from the U.S. Government (see Acknowledgments.txt file).
+// DM22-0790
+
+//------------------------------------------------------------------------------
+
+// LAGraph_SLoadGraph loads a graph from a *.lagraph file created by
+// LAGraph_SSaveGraph.  The cached properties saved with the graph are
+// restored as they were, so none of them need to be recomputed.  A cached
+// property that was not saved (including the BFS thresholds and Delta, in a
+// file written before they were saved) is left unknown.  The file is opened
+// with LAGraph_SOpen, so each matrix is deserialized directly from the file
+// mapped into memory, if possible.
+
+// This method requires SuiteSparse:GraphBLAS, since the C API has no method
+// for deserializing a GrB_Vector.
+
+//------------------------------------------------------------------------------
+
+#define LG_FREE_WORK                                \
+{                                                   \
+    LAGraph_SClose (&Index, NULL) ;                 \
+    LAGraph_Free ((void **) &text, NULL) ;          \
+    GrB_free (&A) ;                                 \
+}
+
+#define LG_FREE_ALL                                 \
+{                                                   \
+    LG_FREE_WORK ;                                  \
+    LAGraph_Delete (G, NULL) ;                      \
+}
+
+#include "LG_internal.h"
+#include "LAGraphX.h"
+
+//------------------------------------------------------------------------------
+// find_item: find an item in the file, or return -1 if not present
+//------------------------------------------------------------------------------
+
+static int64_t find_item
+(
+    LAGraph_SIndex Index,
+    const char *name,
+    LAGraph_Contents_kind kind
+)
+{
+    for (GrB_Index k = 0 ; k < Index->ncontents ; k++)
+    {
+        LAGraph_Contents *Item = &(Index->Contents [k]) ;
+        if (Item->kind == kind && strcmp (Item->name, name) == 0)
+        {
+            return ((int64_t) k) ;
+        }
+    }
+    return (-1) ;
+}
+
+//------------------------------------------------------------------------------
+// load_vector: deserialize a vector from the file, if present
+//------------------------------------------------------------------------------
+
+#if LAGRAPH_SUITESPARSE
+
+#undef  LG_FREE_ALL
+#define LG_FREE_ALL LAGraph_Free (&blob, NULL) ;
+
+static int load_vector
+(
+    GrB_Vector *v,                  // vector loaded, or NULL if not present
+    LAGraph_SIndex Index,
+    const char *name,
+    char *msg
+)
+{
+    void *blob = NULL ;
+    GrB_Index blob_size ;
+    (*v) = NULL ;
+    int64_t k = find_item (Index, name, LAGraph_vector_kind) ;
+    if (k < 0) return (GrB_SUCCESS) ;
+    GrB_Type type = NULL ;
+    LG_TRY (LAGraph_TypeFromName (&type, Index->Contents [k].type_name, msg)) ;
+    LG_TRY (LAGraph_SReadItem (&blob, &blob_size, Index, k, msg)) ;
+    GRB_TRY (GxB_Vector_deserialize (v, type, blob, blob_size, NULL)) ;
+    LG_FREE_ALL ;
+    return (GrB_SUCCESS) ;
+}
+
+//------------------------------------------------------------------------------
+// load_scalar: load emin or emax, held in the file as a vector of size 1
+//------------------------------------------------------------------------------
+
+#undef  LG_FREE_ALL
+#define LG_FREE_ALL GrB_free (&v) ;
+
+static int load_scalar
+(
+    GrB_Scalar *s,                  // scalar loaded, or NULL if not present
+    LAGraph_State *state,           // its state, or unknown if not present
+    int64_t saved_state,            // state of the scalar when it was saved
+    LAGraph_SIndex Index,
+    const char *name,
+    char *msg
+)
+{
+    GrB_Vector v = NULL ;
+    (*s) = NULL ;
+    (*state) = LAGRAPH_UNKNOWN ;
+    if (saved_state == LAGRAPH_UNKNOWN) return (GrB_SUCCESS) ;
+    LG_TRY (load_vector (&v, Index, name, msg)) ;
+    if (v == NULL) return (GrB_SUCCESS) ;
+    char type_name [LAGRAPH_MAX_NAME_LEN] ;
+    GrB_Type type = NULL ;
+    LG_TRY (LAGraph_Vector_TypeName (type_name, v, msg)) ;
+    LG_TRY (LAGraph_TypeFromName (&type, type_name, msg)) ;
+    GRB_TRY (GrB_Scalar_new (s, type)) ;
+    GRB_TRY (GrB_Vector_extractElement_Scalar (*s, v, 0)) ;
+    (*state) = (LAGraph_State) saved_state ;
+    LG_FREE_ALL ;
+    return (GrB_SUCCESS) ;
+}
+
+#endif
+
+//------------------------------------------------------------------------------
+// LAGraph_SLoadGraph
+//------------------------------------------------------------------------------
+
+#undef  LG_FREE_ALL
+#define LG_FREE_ALL                                 \
+{                                                   \
+    LG_FREE_WORK ;                                  \
+    LAGraph_Delete (G, NULL) ;                      \
+}
+
+int LAGraph_SLoadGraph          // load a graph from a *.lagraph file
+(
+    // output:
+    LAGraph_Graph *G,           // graph loaded, with its cached properties
+    // input:
+    const char *filename,       // name of file to read from
+    char *msg
+)
+{
+
+    //--------------------------------------------------------------------------
+    // check inputs
+    //--------------------------------------------------------------------------
+
+    LG_CLEAR_MSG ;
+    LAGraph_SIndex Index = NULL ;
+    char *text = NULL ;
+    GrB_Matrix A = NULL ;
+    LG_ASSERT (G != NULL && filename != NULL, GrB_NULL_POINTER) ;
+    (*G) = NULL ;
+
+    #if !LAGRAPH_SUITESPARSE
+    LG_ASSERT_MSG (false, GrB_NOT_IMPLEMENTED,
+        "SuiteSparse:GraphBLAS required") ;
+    #else
+
+    //--------------------------------------------------------------------------
+    // open the file and read the properties text
+    //--------------------------------------------------------------------------
+
+    LG_TRY (LAGraph_SOpen (&Index, filename, msg)) ;
+    int64_t k = find_item (Index, "properties", LAGraph_text_kind) ;
+    LG_ASSERT_MSG (k >= 0 && Index->Contents [k].compression == -1,
+        LAGRAPH_IO_ERROR, "file does not hold a graph") ;
+    void *blob = NULL ;
+    GrB_Index text_len ;
+    LG_TRY (LAGraph_SReadItem (&blob, &text_len, Index, k, msg)) ;
+    text = blob ;
+    LG_TRY (LAGraph_Realloc ((void **) &text, text_len + 1,
+        LAGRAPH_MAX (text_len, 1), sizeof (char), msg)) ;
+    text [text_len] = '\0' ;
+
+    // parse the "name value" pairs; unrecognized names are ignored
+    int64_t kind = LAGRAPH_UNKNOWN, is_symmetric_structure = LAGRAPH_UNKNOWN ;
+    int64_t nself_edges = LAGRAPH_UNKNOWN ;
+    int64_t emin_state = LAGRAPH_UNKNOWN, emax_state = LAGRAPH_UNKNOWN ;
+    double bfs_alpha = LAGRAPH_UNKNOWN, bfs_beta1 = LAGRAPH_UNKNOWN ;
+    double bfs_beta2 = LAGRAPH_UNKNOWN, sssp_delta = LAGRAPH_UNKNOWN ;
+    char *p = text ;
+    char name [64], value [64] ;
+    int len ;
+    while (sscanf (p, "%63s %63s%n", name, value, &len) == 2)
+    {
+        p += len ;
+        if (strcmp (name, "kind") == 0)
+        {
+            kind = strtoll (value, NULL, 10) ;
+        }
+        else if (strcmp (name, "is_symmetric_structure") == 0)
+        {
+            is_symmetric_structure = strtoll (value, NULL, 10) ;
+        }
+        else if (strcmp (name, "nself_edges") == 0)
+        {
+            nself_edges = strtoll (value, NULL, 10) ;
+        }
+        else if (strcmp (name, "emin_state") == 0)
+        {
+            emin_state = strtoll (value, NULL, 10) ;
+        }
+        else if (strcmp (name, "emax_state") == 0)
+        {
+            emax_state = strtoll (value, NULL, 10) ;
+        }
+        else if (strcmp (name, "bfs_alpha") == 0)
+        {
+            bfs_alpha = strtod (value, NULL) ;
+        }
+        else if (strcmp (name, "bfs_beta1") == 0)
+        {
+            bfs_beta1 = strtod (value, NULL) ;
+        }
+        else if (strcmp (name, "bfs_beta2") == 0)
+        {
+            bfs_beta2 = strtod (value, NULL) ;
+        }
+        else if (strcmp (name, "sssp_delta") == 0)
+        {
+            sssp_delta = strtod (value, NULL) ;
+        }
+    }
+
+    //--------------------------------------------------------------------------
+    // load the adjacency matrix and create the graph
+    //--------------------------------------------------------------------------
+
+    k = find_item (Index, "A", LAGraph_matrix_kind) ;
+    LG_ASSERT_MSG (k >= 0, LAGRAPH_IO_ERROR, "file does not hold a graph") ;
+    LG_TRY (LAGraph_SLoadItem (&A, Index, k, msg)) ;
+    LG_TRY (LAGraph_New (G, &A, (LAGraph_Kind) kind, msg)) ;
+
+    //--------------------------------------------------------------------------
+    // restore the cached properties
+    //--------------------------------------------------------------------------
+
+    k = find_item (Index, "AT", LAGraph_matrix_kind) ;
+    if (k >= 0)
+    {
+        LG_TRY (LAGraph_SLoadItem (&((*G)->AT), Index, k, msg)) ;
+    }
+    LG_TRY (load_vector (&((*G)->out_degree), Index, "out_degree", msg)) ;
+    LG_TRY (load_vector (&((*G)->in_degree), Index, "in_degree", msg)) ;
+    (*G)->is_symmetric_structure = (LAGraph_Boolean) is_symmetric_structure ;
+    (*G)->nself_edges = nself_edges ;
+    (*G)->bfs_alpha = bfs_alpha ;
+    (*G)->bfs_beta1 = bfs_beta1 ;
+    (*G)->bfs_beta2 = bfs_beta2 ;
+    (*G)->sssp_delta = sssp_delta ;
+
+    LG_TRY (load_scalar (&((*G)->emin), &((*G)->emin_state), emin_state,
+        Index, "emin", msg)) ;
+    LG_TRY (load_scalar (&((*G)->emax), &((*G)->emax_state), emax_state,
+        Index, "emax", msg)) ;
+
+    //--------------------------------------------------------------------------
+    // check the graph, free workspace, and return result
+    //--------------------------------------------------------------------------
+
+    LG_TRY (LAGraph_CheckGraph (*G, msg)) ;
+    LG_FREE_WORK ;
+    return (GrB_SUCCESS) ;
+    #endif
+}
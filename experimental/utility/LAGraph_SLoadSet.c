@@ -28,6 +28,20 @@
 // does not convert them to their corresponding GrB_Matrix, GrB_Vector, or
 // uncompressed texts.
 
+// If LG_nthreads_outer > 1 (see LAGraph_SetNumThreads), the matrices are
+// deserialized in parallel, with up to LG_nthreads_outer of them at a time.
+// With SuiteSparse:GraphBLAS, each call to GxB_Matrix_deserialize is given
+// LG_nthreads_inner threads via its descriptor, so that the outer and inner
+// levels together use no more than LG_nthreads_outer * LG_nthreads_inner
+// threads (and each uses a single thread if nested parallelism is disabled).
+// This is much faster for a collection of many small or medium-sized
+// matrices, whose deserialization does not benefit from many threads.
+
+// LAGraph_SLoadSet_Timed is identical to LAGraph_SLoadSet, except that it
+// also returns an array Time of size nmatrices, where Time [i] is the time
+// taken, in seconds, to deserialize the ith matrix.  The caller must free it
+// with LAGraph_Free ((void **) &Time, NULL).
+
 //------------------------------------------------------------------------------
 
 #define LG_FREE_WORK                                                \
@@ -35,6 +49,9 @@
     if (f != NULL && f != stdin) fclose (f) ;                       \
     f = NULL ;                                                      \
     LAGraph_SFreeContents (&Contents, ncontents) ;                  \
+    LAGraph_Free ((void **) &Type, NULL) ;                          \
+    LAGraph_Free ((void **) &Info, NULL) ;                          \
+    GrB_free (&desc) ;                                              \
 }
 
 #define LG_FREE_ALL                                                 \
@@ -42,28 +59,26 @@
     LG_FREE_WORK ;                                                  \
     LAGraph_SFreeSet (&Set, nmatrices) ;                            \
     LAGraph_Free ((void **) &collection, NULL) ;                    \
+    LAGraph_Free ((void **) &Time, NULL) ;                          \
 }
 
 #include "LG_internal.h"
 #include "LAGraphX.h"
 
 //------------------------------------------------------------------------------
-// LAGraph_SLoadSet
+// load_set: load a set of matrices, and optionally time each one
 //------------------------------------------------------------------------------
 
-int LAGraph_SLoadSet            // load a set of matrices from a *.lagraph file
+static int load_set
 (
     // input:
     char *filename,                 // name of file to read; NULL for stdin
     // outputs:
     GrB_Matrix **Set_handle,        // array of GrB_Matrix of size nmatrices
     GrB_Index *nmatrices_handle,    // # of matrices loaded from *.lagraph file
-//  todo: handle vectors and text in LAGraph_SLoadSet
-//  GrB_Vector **Set_handle,        // array of GrB_Vector of size nvector
-//  GrB_Index **nvectors_handle,    // # of vectors loaded from *.lagraph file
-//  char **Text_handle,             // array of pointers to (char *) strings
-//  GrB_Index **ntext_handle,       // # of texts loaded from *.lagraph file
     char **collection_handle,       // name of this collection of matrices
+    double **Time_handle,           // time to deserialize each matrix,
+                                    // or NULL if not needed
     char *msg
 )
 {
@@ -79,6 +94,10 @@ int LAGraph_SLoadSet            // load a set of matrices from a *.lagraph file
     LAGraph_Contents *Contents = NULL ;
     GrB_Index ncontents = 0 ;
     GrB_Index nmatrices = 0 ;
+    GrB_Type *Type = NULL ;
+    GrB_Info *Info = NULL ;
+    double *Time = NULL ;
+    GrB_Descriptor desc = NULL ;
 //  GrB_Index nvectors = 0 ;
 //  GrB_Index ntexts = 0 ;
 
@@ -106,7 +125,13 @@ int LAGraph_SLoadSet            // load a set of matrices from a *.lagraph file
     // count the matrices/vectors/texts in the Contents
     //--------------------------------------------------------------------------
 
-    // todo: for now, all Contents are matrices
+    // todo: for now, all Contents must be matrices.  A graph saved by
+    // LAGraph_SSaveGraph also holds vectors and text; use LAGraph_SLoadGraph.
+    for (GrB_Index i = 0 ; i < ncontents ; i++)
+    {
+        LG_ASSERT_MSG (Contents [i].kind == LAGraph_matrix_kind,
+            GrB_NOT_IMPLEMENTED, "only matrices can be loaded") ;
+    }
     nmatrices = ncontents ;
 
 #if 0
@@ -129,35 +154,69 @@ int LAGraph_SLoadSet            // load a set of matrices from a *.lagraph file
 #endif
 
     //--------------------------------------------------------------------------
-    // convert all the matrices (skip vectors and text content for now)
+    // get the type of each matrix
     //--------------------------------------------------------------------------
 
     LG_TRY (LAGraph_Calloc ((void **) &Set, nmatrices, sizeof (GrB_Matrix),
         msg)) ;
+    LG_TRY (LAGraph_Calloc ((void **) &Type, nmatrices, sizeof (GrB_Type),
+        msg)) ;
+    LG_TRY (LAGraph_Malloc ((void **) &Info, nmatrices, sizeof (GrB_Info),
+        msg)) ;
+    if (Time_handle != NULL)
+    {
+        LG_TRY (LAGraph_Calloc ((void **) &Time, nmatrices, sizeof (double),
+            msg)) ;
+    }
 
-    GrB_Index kmatrices = 0 ;
     for (GrB_Index i = 0 ; i < ncontents ; i++)
     {
-        // convert Contents [i]
-        void *blob = Contents [i].blob ;
-        size_t blob_size = Contents [i].blob_size ;
+        // convert Contents [i].typename to a GrB_Type ctype.
+        // SuiteSparse:GraphBLAS allows this to be NULL for built-in types.
+        LG_TRY (LAGraph_TypeFromName (&(Type [i]), Contents [i].type_name,
+            msg)) ;
+    }
 
-        if (Contents [i].kind == LAGraph_matrix_kind)
-        {
-            // convert Contents [i].typename to a GrB_Type ctype.
-            // SuiteSparse:GraphBLAS allows this to be NULL for built-in types.
-            GrB_Type ctype = NULL ;
-            LG_TRY (LAGraph_TypeFromName (&ctype, Contents [i].type_name, msg));
-            GRB_TRY (GrB_Matrix_deserialize (&(Set [kmatrices]), ctype, blob,
-                blob_size)) ;
-            kmatrices++ ;
-        }
-        // todo: handle vectors and texts
-        // else if (Content [i].kind == LAGraph_vector_kind) ...
-        // else if (Content [i].kind == LAGraph_text_kind) ...
+    //--------------------------------------------------------------------------
+    // convert all the matrices (skip vectors and text content for now)
+    //--------------------------------------------------------------------------
+
+    // todo: handle vectors and texts
+    // else if (Content [i].kind == LAGraph_vector_kind) ...
+    // else if (Content [i].kind == LAGraph_text_kind) ...
+
+    int nthreads = LG_nthreads_outer ;
+    nthreads = LAGRAPH_MIN (nthreads, (int64_t) nmatrices) ;
+    nthreads = LAGRAPH_MAX (nthreads, 1) ;
+
+    #if LAGRAPH_SUITESPARSE
+    // the # of threads used by each call to GxB_Matrix_deserialize
+    int nthreads_inner = LAGRAPH_MAX (LG_nthreads_inner, 1) ;
+    GRB_TRY (GrB_Descriptor_new (&desc)) ;
+    GRB_TRY (GxB_set (desc, GxB_NTHREADS, nthreads_inner)) ;
+    #endif
 
-        // free the ith blob
+    int64_t i ;
+    #pragma omp parallel for num_threads(nthreads) schedule(dynamic,1)
+    for (i = 0 ; i < (int64_t) nmatrices ; i++)
+    {
+        // convert Contents [i] and free the ith blob
+        double t = LAGraph_WallClockTime ( ) ;
+        #if LAGRAPH_SUITESPARSE
+        Info [i] = GxB_Matrix_deserialize (&(Set [i]), Type [i],
+            Contents [i].blob, Contents [i].blob_size, desc) ;
+        #else
+        Info [i] = GrB_Matrix_deserialize (&(Set [i]), Type [i],
+            Contents [i].blob, Contents [i].blob_size) ;
+        #endif
         LAGraph_Free ((void **) &(Contents [i].blob), NULL) ;
+        if (Time != NULL) Time [i] = LAGraph_WallClockTime ( ) - t ;
+    }
+
+    // report the first error, if any
+    for (i = 0 ; i < (int64_t) nmatrices ; i++)
+    {
+        GRB_TRY (Info [i]) ;
     }
 
     //--------------------------------------------------------------------------
@@ -168,5 +227,60 @@ int LAGraph_SLoadSet            // load a set of matrices from a *.lagraph file
     (*Set_handle) = Set ;
     (*collection_handle) = collection ;
     (*nmatrices_handle) = nmatrices ;
+    if (Time_handle != NULL) (*Time_handle) = Time ;
     return (GrB_SUCCESS) ;
 }
+
+#undef  LG_FREE_WORK
+#define LG_FREE_WORK ;
+
+#undef  LG_FREE_ALL
+#define LG_FREE_ALL ;
+
+//------------------------------------------------------------------------------
+// LAGraph_SLoadSet
+//------------------------------------------------------------------------------
+
+int LAGraph_SLoadSet            // load a set of matrices from a *.lagraph file
+(
+    // input:
+    char *filename,                 // name of file to read; NULL for stdin
+    // outputs:
+    GrB_Matrix **Set_handle,        // array of GrB_Matrix of size nmatrices
+    GrB_Index *nmatrices_handle,    // # of matrices loaded from *.lagraph file
+//  todo: handle vectors and text in LAGraph_SLoadSet
+//  GrB_Vector **Set_handle,        // array of GrB_Vector of size nvector
+//  GrB_Index **nvectors_handle,    // # of vectors loaded from *.lagraph file
+//  char **Text_handle,             // array of pointers to (char *) strings
+//  GrB_Index **ntext_handle,       // # of texts loaded from *.lagraph file
+    char **collection_handle,       // name of this collection of matrices
+    char *msg
+)
+{
+    return (load_set (filename, Set_handle, nmatrices_handle,
+        collection_handle, NULL, msg)) ;
+}
+
+//------------------------------------------------------------------------------
+// LAGraph_SLoadSet_Timed
+//------------------------------------------------------------------------------
+
+int LAGraph_SLoadSet_Timed      // load a set of matrices, and time each one
+(
+    // input:
+    char *filename,                 // name of file to read; NULL for stdin
+    // outputs:
+    GrB_Matrix **Set_handle,        // array of GrB_Matrix of size nmatrices
+    GrB_Index *nmatrices_handle,    // # of matrices loaded from *.lagraph file
+    char **collection_handle,       // name of this collection of matrices
+    double **Time_handle,           // array of size nmatrices: Time [i] is
+                                    // the time to deserialize Set [i]
+    char *msg
+)
+{
+    LG_CLEAR_MSG ;
+    LG_ASSERT (Time_handle != NULL, GrB_NULL_POINTER) ;
+    (*Time_handle) = NULL ;
+    return (load_set (filename, Set_handle, nmatrices_handle,
+        collection_handle, Time_handle, msg)) ;
+}
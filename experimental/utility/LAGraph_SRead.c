@@ -26,6 +26,13 @@
 // See also LAGraph_SLoadSet, which calls this function and then converts all
 // serialized objects into their GrB_Matrix, GrB_Vector, or text components.
 
+// LAGraph_SReadHeader reads just the JSON header of the file.  The Contents
+// are returned with their blob_size, but with no blobs (each Contents [i].blob
+// is NULL), and the file is left positioned at the start of the first blob.
+// The blobs are held in the file in the same order as the Contents, with no
+// gaps between them.  See LAGraph_SOpen, which uses this to find each item
+// in the file without reading the others.
+
 //------------------------------------------------------------------------------
 
 #include "LG_internal.h"
@@ -78,7 +85,7 @@ static int get_int_array_3 (json_arr arr, int *x, char *msg)
 }
 
 //------------------------------------------------------------------------------
-// LAGraph_SRead
+// LAGraph_SReadHeader
 //------------------------------------------------------------------------------
 
 #undef  LG_FREE_WORK
@@ -97,12 +104,12 @@ static int get_int_array_3 (json_arr arr, int *x, char *msg)
     LAGraph_SFreeContents (&Contents, ncontents) ;      \
 }
 
-int LAGraph_SRead   // read a set of matrices from a *.lagraph file
+int LAGraph_SReadHeader // read the JSON header of a *.lagraph file
 (
     FILE *f,                            // file to read from
     // output
     char **collection_handle,           // name of collection
-    LAGraph_Contents **Contents_handle, // array of contents
+    LAGraph_Contents **Contents_handle, // array of contents, with no blobs
     GrB_Index *ncontents_handle,        // # of items in the Contents array
     char *msg
 )
@@ -265,8 +272,6 @@ int LAGraph_SRead   // read a set of matrices from a *.lagraph file
         {
             Item->kind = LAGraph_matrix_kind ;
         }
-#if 0
-        // todo: handle vectors and text
         else if (STRMATCH (o->name->string, "GrB_Vector"))
         {
             Item->kind = LAGraph_vector_kind ;
@@ -275,7 +280,6 @@ int LAGraph_SRead   // read a set of matrices from a *.lagraph file
         {
             Item->kind = LAGraph_text_kind ;
         }
-#endif
         else
         {
             Item->kind = LAGraph_unknown_kind ;
@@ -298,8 +302,6 @@ int LAGraph_SRead   // read a set of matrices from a *.lagraph file
         // parse the text compression method, or matrix/vector type
         //----------------------------------------------------------------------
 
-#if 0
-        // todo: handle text, with optional compression
         if (Item->kind == LAGraph_text_kind)
         {
             // text, uncompressed or compressed
@@ -322,7 +324,6 @@ int LAGraph_SRead   // read a set of matrices from a *.lagraph file
             Item->compression = c ;
         }
         else
-#endif
         {
             // serialized matrix or vector
             strncpy (Item->type_name, str->string, LAGRAPH_MAX_NAME_LEN) ;
@@ -338,16 +339,6 @@ int LAGraph_SRead   // read a set of matrices from a *.lagraph file
         json_num num = json_value_as_number (o->value) ;
         OK (num != NULL) ;
         Item->blob_size = (GrB_Index) strtoll (num->number, NULL, 0) ;
-
-        //----------------------------------------------------------------------
-        // allocate the blob and read it from the file
-        //----------------------------------------------------------------------
-
-        LAGRAPH_TRY (LAGraph_Malloc ((void **) &(Item->blob), Item->blob_size,
-            sizeof (uint8_t), msg)) ;
-        size_t bytes_read = fread (Item->blob, sizeof (uint8_t),
-            Item->blob_size, f) ;
-        OK (bytes_read == Item->blob_size) ;
     }
 
     // todo: optional components will be needed for matrices from
@@ -372,3 +363,75 @@ int LAGraph_SRead   // read a set of matrices from a *.lagraph file
     (*ncontents_handle) = ncontents ;
     return (GrB_SUCCESS) ;
 }
+
+//------------------------------------------------------------------------------
+// LAGraph_SRead
+//------------------------------------------------------------------------------
+
+#undef  LG_FREE_WORK
+#define LG_FREE_WORK ;
+
+#undef  LG_FREE_ALL
+#define LG_FREE_ALL                                     \
+{                                                       \
+    LAGraph_Free ((void **) &collection, NULL) ;        \
+    LAGraph_SFreeContents (&Contents, ncontents) ;      \
+}
+
+int LAGraph_SRead   // read a set of matrices from a *.lagraph file
+(
+    FILE *f,                            // file to read from
+    // output
+    char **collection_handle,           // name of collection
+    LAGraph_Contents **Contents_handle, // array of contents
+    GrB_Index *ncontents_handle,        // # of items in the Contents array
+    char *msg
+)
+{
+
+    //--------------------------------------------------------------------------
+    // check inputs
+    //--------------------------------------------------------------------------
+
+    LG_CLEAR_MSG ;
+    char *collection = NULL ;
+    LAGraph_Contents *Contents = NULL ;
+    GrB_Index ncontents = 0 ;
+
+    LG_ASSERT (collection_handle != NULL, GrB_NULL_POINTER) ;
+    LG_ASSERT (Contents_handle != NULL, GrB_NULL_POINTER) ;
+    LG_ASSERT (f != NULL, GrB_NULL_POINTER) ;
+    LG_ASSERT (ncontents_handle != NULL, GrB_NULL_POINTER) ;
+    (*collection_handle) = NULL ;
+    (*Contents_handle) = NULL ;
+    (*ncontents_handle) = 0 ;
+
+    //--------------------------------------------------------------------------
+    // read the JSON header
+    //--------------------------------------------------------------------------
+
+    LG_TRY (LAGraph_SReadHeader (f, &collection, &Contents, &ncontents, msg)) ;
+
+    //--------------------------------------------------------------------------
+    // allocate each blob and read it from the file
+    //--------------------------------------------------------------------------
+
+    for (GrB_Index i = 0 ; i < ncontents ; i++)
+    {
+        LAGraph_Contents *Item = &(Contents [i]) ;
+        LG_TRY (LAGraph_Malloc ((void **) &(Item->blob), Item->blob_size,
+            sizeof (uint8_t), msg)) ;
+        size_t bytes_read = fread (Item->blob, sizeof (uint8_t),
+            Item->blob_size, f) ;
+        OK (bytes_read == Item->blob_size) ;
+    }
+
+    //--------------------------------------------------------------------------
+    // return result
+    //--------------------------------------------------------------------------
+
+    (*collection_handle) = collection ;
+    (*Contents_handle) = Contents ;
+    (*ncontents_handle) = ncontents ;
+    return (GrB_SUCCESS) ;
+}
@@ -0,0 +1,235 @@
+//------------------------------------------------------------------------------
+// LAGraph_SSaveGraph: save a graph and its cached properties to a file
+//------------------------------------------------------------------------------
+
+// LAGraph, (c) 2019-2022 by The LAGraph Contributors, All Rights Reserved.
+// SPDX-License-Identifier: BSD-2-Clause
+//
+// For additional details (including references to third party source code and
+// other files) see the LICENSE file or contact permission@sei.cmu.edu. See
+// Contributors.txt for a full list of contributors. Created, in part, with
+// funding and support from the U.S. Government (see Acknowledgments.txt file).
+// DM22-0790
+
+//------------------------------------------------------------------------------
+
+// LAGraph_SSaveGraph saves a graph G to a *.lagraph file: its adjacency matrix
+// G->A, its kind, and each of its cached properties that is known.  Use
+// LAGraph_SLoadGraph to load the graph back in, with none of its cached
+// properties recomputed.  The file holds the following items:
+
+//      "properties"    text: G->kind, G->is_symmetric_structure,
+//                      G->nself_edges, G->emin_state, G->emax_state,
+//                      G->bfs_alpha, G->bfs_beta1, G->bfs_beta2, and
+//                      G->sssp_delta, as one "name value" pair per line (the
+//                      thresholds and Delta are written with 17 digits, so
+//                      they are restored exactly)
+//      "A"             matrix: G->A
+//      "AT"            matrix: G->AT, if present
+//      "out_degree"    vector: G->out_degree, if present
+//      "in_degree"     vector: G->in_degree, if present
+//      "emin"          vector of size 1: G->emin, if present
+//      "emax"          vector of size 1: G->emax, if present
+
+// The matrices and vectors are serialized and written one at a time, as in
+// LAGraph_SSaveSet, with the highest level of compression (LZ4HC:9).
+
+// This method requires SuiteSparse:GraphBLAS, since the C API has no method
+// for serializing a GrB_Vector.
+
+//------------------------------------------------------------------------------
+
+#define LG_FREE_WORK                                \
+{                                                   \
+    LG_writer_close (&writer, NULL) ;               \
+    if (f != NULL) fclose (f) ;                     \
+    f = NULL ;                                      \
+    GrB_free (&desc) ;                              \
+    GrB_free (&emin) ;                              \
+    GrB_free (&emax) ;                              \
+    LAGraph_Free ((void **) &blob, NULL) ;          \
+}
+
+#define LG_FREE_ALL                                 \
+{                                                   \
+    LG_FREE_WORK ;                                  \
+}
+
+#include "LG_internal.h"
+#include "LAGraphX.h"
+
+// # of matrix and vector items, and max length of the "properties" text
+#define LG_SGRAPH_NITEMS 6
+#define LG_SGRAPH_TEXT_LEN 1024
+
+//------------------------------------------------------------------------------
+// LAGraph_SSaveGraph
+//------------------------------------------------------------------------------
+
+int LAGraph_SSaveGraph          // save a graph to a *.lagraph file
+(
+    // inputs:
+    const char *filename,       // name of file to write to
+    LAGraph_Graph G,            // graph to save, with its cached properties
+    const char *collection,     // name of this collection
+    char *msg
+)
+{
+
+    //--------------------------------------------------------------------------
+    // check inputs
+    //--------------------------------------------------------------------------
+
+    LG_CLEAR_MSG ;
+    FILE *f = NULL ;
+    LG_writer writer = NULL ;
+    GrB_Descriptor desc = NULL ;
+    GrB_Vector emin = NULL, emax = NULL ;
+    void *blob = NULL ;
+
+    LG_ASSERT (filename != NULL && collection != NULL, GrB_NULL_POINTER) ;
+    LG_TRY (LAGraph_CheckGraph (G, msg)) ;
+
+    #if !LAGRAPH_SUITESPARSE
+    LG_ASSERT_MSG (false, GrB_NOT_IMPLEMENTED,
+        "SuiteSparse:GraphBLAS required") ;
+    #else
+
+    GRB_TRY (GrB_Descriptor_new (&desc)) ;
+    GRB_TRY (GxB_set (desc, GxB_COMPRESSION, GxB_COMPRESSION_LZ4HC + 9)) ;
+
+    //--------------------------------------------------------------------------
+    // place emin and emax in vectors of size 1
+    //--------------------------------------------------------------------------
+
+    char type [LAGRAPH_MAX_NAME_LEN] ;
+    if (G->emin != NULL && G->emin_state != LAGRAPH_UNKNOWN)
+    {
+        GrB_Type emin_type ;
+        LG_TRY (LAGraph_Scalar_TypeName (type, G->emin, msg)) ;
+        LG_TRY (LAGraph_TypeFromName (&emin_type, type, msg)) ;
+        GRB_TRY (GrB_Vector_new (&emin, emin_type, 1)) ;
+        GRB_TRY (GrB_Vector_setElement_Scalar (emin, G->emin, 0)) ;
+    }
+    if (G->emax != NULL && G->emax_state != LAGRAPH_UNKNOWN)
+    {
+        GrB_Type emax_type ;
+        LG_TRY (LAGraph_Scalar_TypeName (type, G->emax, msg)) ;
+        LG_TRY (LAGraph_TypeFromName (&emax_type, type, msg)) ;
+        GRB_TRY (GrB_Vector_new (&emax, emax_type, 1)) ;
+        GRB_TRY (GrB_Vector_setElement_Scalar (emax, G->emax, 0)) ;
+    }
+
+    //--------------------------------------------------------------------------
+    // list the items to save
+    //--------------------------------------------------------------------------
+
+    const char *Name [LG_SGRAPH_NITEMS] =
+    {
+        "A", "AT", "out_degree", "in_degree", "emin", "emax"
+    } ;
+    GrB_Matrix Matrix [LG_SGRAPH_NITEMS] = { G->A, G->AT } ;
+    GrB_Vector Vector [LG_SGRAPH_NITEMS] =
+    {
+        NULL, NULL, G->out_degree, G->in_degree, emin, emax
+    } ;
+    int64_t Pos [LG_SGRAPH_NITEMS] ;
+
+    //--------------------------------------------------------------------------
+    // construct the properties text
+    //--------------------------------------------------------------------------
+
+    LG_TRY (LAGraph_Malloc (&blob, LG_SGRAPH_TEXT_LEN, sizeof (char), msg)) ;
+    int text_len = snprintf ((char *) blob, LG_SGRAPH_TEXT_LEN,
+        "kind %d\n"
+        "is_symmetric_structure %d\n"
+        "nself_edges %" PRId64 "\n"
+        "emin_state %d\n"
+        "emax_state %d\n"
+        "bfs_alpha %.17g\n"
+        "bfs_beta1 %.17g\n"
+        "bfs_beta2 %.17g\n"
+        "sssp_delta %.17g\n",
+        (int) G->kind, (int) G->is_symmetric_structure, G->nself_edges,
+        (emin == NULL) ? LAGRAPH_UNKNOWN : (int) G->emin_state,
+        (emax == NULL) ? LAGRAPH_UNKNOWN : (int) G->emax_state,
+        G->bfs_alpha, G->bfs_beta1, G->bfs_beta2, G->sssp_delta) ;
+    ASSERT (text_len > 0 && text_len < LG_SGRAPH_TEXT_LEN) ;
+
+    //--------------------------------------------------------------------------
+    // write the header, with space reserved for the size of each blob
+    //--------------------------------------------------------------------------
+
+    f = fopen (filename, "wb") ;
+    LG_ASSERT_MSG (f != NULL, LAGRAPH_IO_ERROR, "unable to create output file");
+
+    LG_TRY (LAGraph_SWrite_HeaderStart (f, collection, msg)) ;
+    LG_TRY (LAGraph_SWrite_HeaderItem (f, LAGraph_text_kind, "properties",
+        NULL, -1, (GrB_Index) text_len, msg)) ;
+    for (int k = 0 ; k < LG_SGRAPH_NITEMS ; k++)
+    {
+        Pos [k] = -1 ;
+        if (Matrix [k] != NULL)
+        {
+            LG_TRY (LAGraph_Matrix_TypeName (type, Matrix [k], msg)) ;
+            LG_TRY (LAGraph_SWrite_HeaderItemReserve (f, LAGraph_matrix_kind,
+                Name [k], type, 0, &(Pos [k]), msg)) ;
+        }
+        else if (Vector [k] != NULL)
+        {
+            LG_TRY (LAGraph_Vector_TypeName (type, Vector [k], msg)) ;
+            LG_TRY (LAGraph_SWrite_HeaderItemReserve (f, LAGraph_vector_kind,
+                Name [k], type, 0, &(Pos [k]), msg)) ;
+        }
+    }
+    LG_TRY (LAGraph_SWrite_HeaderEnd (f, msg)) ;
+
+    //--------------------------------------------------------------------------
+    // write the properties text, then serialize and write each item
+    //--------------------------------------------------------------------------
+
+    GrB_Index Size [LG_SGRAPH_NITEMS] ;
+    LG_TRY (LG_writer_open (&writer, f, msg)) ;
+    LG_TRY (LG_writer_put (writer, &blob, (size_t) text_len, msg)) ;
+    for (int k = 0 ; k < LG_SGRAPH_NITEMS ; k++)
+    {
+        if (Matrix [k] != NULL)
+        {
+            GRB_TRY (GxB_Matrix_serialize (&blob, &(Size [k]), Matrix [k],
+                desc)) ;
+        }
+        else if (Vector [k] != NULL)
+        {
+            GRB_TRY (GxB_Vector_serialize (&blob, &(Size [k]), Vector [k],
+                desc)) ;
+        }
+        else
+        {
+            continue ;
+        }
+        // the blob is written while the next item is serialized
+        LG_TRY (LG_writer_put (writer, &blob, (size_t) Size [k], msg)) ;
+    }
+    LG_TRY (LG_writer_close (&writer, msg)) ;
+
+    //--------------------------------------------------------------------------
+    // write the size of each blob in the header
+    //--------------------------------------------------------------------------
+
+    for (int k = 0 ; k < LG_SGRAPH_NITEMS ; k++)
+    {
+        if (Pos [k] < 0) continue ;
+        LG_TRY (LAGraph_SWrite_HeaderItemSize (f, Pos [k], Size [k], msg)) ;
+    }
+
+    //--------------------------------------------------------------------------
+    // free workspace and return result
+    //--------------------------------------------------------------------------
+
+    LG_ASSERT_MSG (fclose (f) == 0, LAGRAPH_IO_ERROR,
+        "file not written properly") ;
+    f = NULL ;
+    LG_FREE_WORK ;
+    return (GrB_SUCCESS) ;
+    #endif
+}
@@ -22,6 +22,14 @@
 
 // Use LAGraph_SSLoadSet to load the matrices back in from the file.
 
+// The matrices are serialized one at a time, and each blob is written to the
+// file and freed before the next matrix is serialized, so at most two blobs
+// are held in memory at any one time.  Since the size of each blob is not
+// known until the matrix is serialized, space for each size is reserved in
+// the JSON header, and the sizes are written there after all the blobs have
+// been written.  Each blob is written by a separate thread (see LG_writer),
+// while the next matrix is serialized.
+
 // This method will not work without SuiteSparse:GraphBLAS, because the C API
 // has no GrB* method for querying the GrB_Type (or its name as a string) of a
 // matrix.
@@ -30,10 +38,13 @@
 
 #define LG_FREE_WORK                                \
 {                                                   \
-    fclose (f) ;                                    \
+    LG_writer_close (&writer, NULL) ;               \
+    if (f != NULL) fclose (f) ;                     \
     f = NULL ;                                      \
     GrB_free (&desc) ;                              \
-    LAGraph_SFreeContents (&Contents, nmatrices) ;  \
+    LAGraph_Free ((void **) &blob, NULL) ;          \
+    LAGraph_Free ((void **) &Pos, NULL) ;           \
+    LAGraph_Free ((void **) &Size, NULL) ;          \
 }
 
 #define LG_FREE_ALL                                 \
@@ -66,8 +77,11 @@ int LAGraph_SSaveSet            // save a set of matrices from a *.lagraph file
     LG_CLEAR_MSG ;
     FILE *f = NULL ;
 
-    LAGraph_Contents *Contents = NULL ;
+    LG_writer writer = NULL ;
     GrB_Descriptor desc = NULL ;
+    void *blob = NULL ;
+    int64_t *Pos = NULL ;
+    GrB_Index *Size = NULL ;
 
     LG_ASSERT (filename != NULL && Set != NULL && collection != NULL,
         GrB_NULL_POINTER) ;
@@ -80,67 +94,69 @@ int LAGraph_SSaveSet            // save a set of matrices from a *.lagraph file
     f = fopen (filename, "wb") ;
     LG_ASSERT_MSG (f != NULL, -1001, "unable to create output file") ;
 
+    LG_TRY (LAGraph_Malloc ((void **) &Pos, nmatrices, sizeof (int64_t),
+        msg)) ;
+    LG_TRY (LAGraph_Malloc ((void **) &Size, nmatrices, sizeof (GrB_Index),
+        msg)) ;
+
     //--------------------------------------------------------------------------
-    // serialize all the matrices
+    // write the header, with space reserved for the size of each blob
     //--------------------------------------------------------------------------
 
-    // allocate an Contents array of size nmatrices to hold the contents
-    LG_TRY (LAGraph_Calloc ((void **) &Contents, nmatrices,
-        sizeof (LAGraph_Contents), msg)) ;
+    LG_TRY (LAGraph_SWrite_HeaderStart (f, collection, msg)) ;
+    for (GrB_Index i = 0 ; i < nmatrices ; i++)
+    {
+        char typename [GxB_MAX_NAME_LEN] ;
+        LG_TRY (LAGraph_Matrix_TypeName (typename, Set [i], msg)) ;
+        char matrix_name [256] ;
+        snprintf (matrix_name, 256, "A_%" PRIu64, i) ;
+        LG_TRY (LAGraph_SWrite_HeaderItemReserve (f, LAGraph_matrix_kind,
+            matrix_name, typename, 0, &(Pos [i]), msg)) ;
+    }
+    LG_TRY (LAGraph_SWrite_HeaderEnd (f, msg)) ;
+
+    //--------------------------------------------------------------------------
+    // serialize each matrix and write its blob
+    //--------------------------------------------------------------------------
 
+    LG_TRY (LG_writer_open (&writer, f, msg)) ;
     for (GrB_Index i = 0 ; i < nmatrices ; i++)
     {
         #if LAGRAPH_SUITESPARSE
         {
-            GRB_TRY (GxB_Matrix_serialize (&(Contents [i].blob),
-                (GrB_Index *)&(Contents [i].blob_size), Set [i], desc)) ;
+            GRB_TRY (GxB_Matrix_serialize (&blob, &(Size [i]), Set [i], desc)) ;
         }
         #else
         {
             GrB_Index estimate ;
             GRB_TRY (GrB_Matrix_serializeSize (&estimate, Set [i])) ;
-            Contents [i].blob_size = estimate ;
-            LAGRAPH_TRY (LAGraph_Malloc ((void **) &(Contents [i].blob),
-                estimate, sizeof (uint8_t), msg)) ;
-            GRB_TRY (GrB_Matrix_serialize (Contents [i].blob,
-                (GrB_Index *) &(Contents [i].blob_size), Set [i])) ;
-            LG_TRY (LAGraph_Realloc ((void **) &(Contents [i].blob),
-                (size_t) Contents [i].blob_size,
-                estimate, sizeof (uint8_t), msg)) ;
+            Size [i] = estimate ;
+            LG_TRY (LAGraph_Malloc (&blob, estimate, sizeof (uint8_t), msg)) ;
+            GRB_TRY (GrB_Matrix_serialize (blob, &(Size [i]), Set [i])) ;
+            LG_TRY (LAGraph_Realloc (&blob, (size_t) Size [i], estimate,
+                sizeof (uint8_t), msg)) ;
         }
         #endif
+        // the blob is written while the next matrix is serialized
+        LG_TRY (LG_writer_put (writer, &blob, (size_t) Size [i], msg)) ;
     }
+    LG_TRY (LG_writer_close (&writer, msg)) ;
 
     //--------------------------------------------------------------------------
-    // write the header
-    //--------------------------------------------------------------------------
-
-    LG_TRY (LAGraph_SWrite_HeaderStart (f, collection, msg)) ;
-    for (GrB_Index i = 0 ; i < nmatrices ; i++)
-    {
-        char typename [GxB_MAX_NAME_LEN] ;
-        LG_TRY (LAGraph_Matrix_TypeName (typename, Set [i], msg)) ;
-        char matrix_name [256] ;
-        snprintf (matrix_name, 256, "A_%" PRIu64, i) ;
-        LG_TRY (LAGraph_SWrite_HeaderItem (f, LAGraph_matrix_kind,
-            matrix_name, typename, 0, Contents [i].blob_size, msg)) ;
-    }
-    LG_TRY (LAGraph_SWrite_HeaderEnd (f, msg)) ;
-
-    //--------------------------------------------------------------------------
-    // write all the blobs
+    // write the size of each blob in the header
     //--------------------------------------------------------------------------
 
     for (GrB_Index i = 0 ; i < nmatrices ; i++)
     {
-        LG_TRY (LAGraph_SWrite_Item (f, Contents [i].blob,
-            Contents [i].blob_size, msg)) ;
+        LG_TRY (LAGraph_SWrite_HeaderItemSize (f, Pos [i], Size [i], msg)) ;
     }
 
     //--------------------------------------------------------------------------
     // free workspace and return result
     //--------------------------------------------------------------------------
 
+    LG_ASSERT_MSG (fclose (f) == 0, -1001, "file not written properly") ;
+    f = NULL ;
     LG_FREE_WORK ;
     return (GrB_SUCCESS) ;
 }
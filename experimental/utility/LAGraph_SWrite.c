@@ -66,26 +66,28 @@ int LAGraph_SWrite_HeaderStart  // write the first part of the JSON header
 }
 
 //------------------------------------------------------------------------------
-// LAGraph_SWrite_HeaderItem
+// header_item: write a single item to the JSON header
 //------------------------------------------------------------------------------
 
-int LAGraph_SWrite_HeaderItem   // write a single item to the JSON header
+// If pos is NULL, the blob_size is written.  Otherwise, a blank field of
+// width LG_SWRITE_SIZE_WIDTH is written in place of the blob_size, and its
+// position in the file is returned in (*pos).  The JSON header remains valid
+// with the blanks in place.
+
+#define LG_SWRITE_SIZE_WIDTH 20
+
+static int header_item
 (
-    // inputs:
     FILE *f,                    // file to write to
     LAGraph_Contents_kind kind, // matrix, vector, or text
-    const char *name,           // name of the matrix/vector/text; matrices from
-                                // sparse.tamu.edu use the form "Group/Name"
+    const char *name,           // name of the matrix/vector/text
     const char *type,           // name of type of the matrix/vector
-    // todo: vectors and text not yet supported by LAGraph_SWrite_HeaderItem
     int compression,            // text compression method
     GrB_Index blob_size,        // exact size of serialized blob for this item
+    int64_t *pos,               // if not NULL, reserve space for blob_size
     char *msg
 )
 {
-    // check inputs
-    LG_CLEAR_MSG ;
-    LG_ASSERT (f != NULL, GrB_NULL_POINTER) ;
 
     // write the JSON information for this item
     FPRINT ((f, "        { \"")) ;
@@ -95,8 +97,6 @@ int LAGraph_SWrite_HeaderItem   // write a single item to the JSON header
             FPRINT ((f, "GrB_Matrix\": \"%s\", \"type\": \"%s", name, type)) ;
             break ;
 
-        // todo: handle vectors and text
-#if 0
         case LAGraph_vector_kind :
             FPRINT((f, "GrB_Vector\": \"%s\", \"type\": \"%s", name, type)) ;
             break ;
@@ -122,14 +122,109 @@ int LAGraph_SWrite_HeaderItem   // write a single item to the JSON header
                     "invalid compression") ; break ;
             }
             break ;
-#endif
 
         default :
             LG_ASSERT_MSG (false, GrB_INVALID_VALUE, "invalid kind") ;
             break ;
     }
 
-    FPRINT ((f, "\", \"bytes\": %" PRIu64 " },\n", blob_size)) ;
+    if (pos == NULL)
+    {
+        FPRINT ((f, "\", \"bytes\": %" PRIu64 " },\n", blob_size)) ;
+    }
+    else
+    {
+        FPRINT ((f, "\", \"bytes\": ")) ;
+        (*pos) = LG_ftell (f) ;
+        LG_ASSERT_MSG ((*pos) >= 0, LAGRAPH_IO_ERROR, "file is not seekable") ;
+        FPRINT ((f, "%*s },\n", LG_SWRITE_SIZE_WIDTH, "")) ;
+    }
+    return (GrB_SUCCESS) ;
+}
+
+//------------------------------------------------------------------------------
+// LAGraph_SWrite_HeaderItem
+//------------------------------------------------------------------------------
+
+int LAGraph_SWrite_HeaderItem   // write a single item to the JSON header
+(
+    // inputs:
+    FILE *f,                    // file to write to
+    LAGraph_Contents_kind kind, // matrix, vector, or text
+    const char *name,           // name of the matrix/vector/text; matrices from
+                                // sparse.tamu.edu use the form "Group/Name"
+    const char *type,           // name of type of the matrix/vector
+    int compression,            // text compression method
+    GrB_Index blob_size,        // exact size of serialized blob for this item
+    char *msg
+)
+{
+    // check inputs
+    LG_CLEAR_MSG ;
+    LG_ASSERT (f != NULL, GrB_NULL_POINTER) ;
+
+    // write the JSON information for this item
+    return (header_item (f, kind, name, type, compression, blob_size, NULL,
+        msg)) ;
+}
+
+//------------------------------------------------------------------------------
+// LAGraph_SWrite_HeaderItemReserve
+//------------------------------------------------------------------------------
+
+// LAGraph_SWrite_HeaderItemReserve is the same as LAGraph_SWrite_HeaderItem,
+// except that the size of the blob need not be known yet.  Space is reserved
+// for it in the header, and its position in the file is returned in pos.
+// Once the blob has been written, LAGraph_SWrite_HeaderItemSize writes its
+// size into the header.  The file must be seekable.
+
+int LAGraph_SWrite_HeaderItemReserve    // write an item, without its size
+(
+    // inputs:
+    FILE *f,                    // file to write to
+    LAGraph_Contents_kind kind, // matrix, vector, or text
+    const char *name,           // name of the matrix/vector/text
+    const char *type,           // name of type of the matrix/vector
+    int compression,            // text compression method
+    // output:
+    int64_t *pos,               // position of the size in the file
+    char *msg
+)
+{
+    // check inputs
+    LG_CLEAR_MSG ;
+    LG_ASSERT (f != NULL && pos != NULL, GrB_NULL_POINTER) ;
+    (*pos) = -1 ;
+
+    // write the JSON information for this item, with space for its size
+    return (header_item (f, kind, name, type, compression, 0, pos, msg)) ;
+}
+
+//------------------------------------------------------------------------------
+// LAGraph_SWrite_HeaderItemSize
+//------------------------------------------------------------------------------
+
+int LAGraph_SWrite_HeaderItemSize   // write the size of a reserved item
+(
+    // inputs:
+    FILE *f,                    // file to write to
+    int64_t pos,                // position from LAGraph_SWrite_HeaderItemReserve
+    GrB_Index blob_size,        // exact size of serialized blob for this item
+    char *msg
+)
+{
+    // check inputs
+    LG_CLEAR_MSG ;
+    LG_ASSERT (f != NULL, GrB_NULL_POINTER) ;
+    LG_ASSERT_MSG (pos >= 0, GrB_INVALID_VALUE, "invalid position") ;
+
+    // write the size in the reserved space, and return to the current position
+    int64_t current = LG_ftell (f) ;
+    LG_ASSERT_MSG (current >= 0 && LG_fseek (f, pos, SEEK_SET) == 0,
+        LAGRAPH_IO_ERROR, "file is not seekable") ;
+    FPRINT ((f, "%-*" PRIu64, LG_SWRITE_SIZE_WIDTH, blob_size)) ;
+    LG_ASSERT_MSG (LG_fseek (f, current, SEEK_SET) == 0, LAGRAPH_IO_ERROR,
+        "file is not seekable") ;
     return (GrB_SUCCESS) ;
 }
 
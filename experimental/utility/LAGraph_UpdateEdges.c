@@ -0,0 +1,464 @@
+//------------------------------------------------------------------------------
+// LAGraph_UpdateEdges: insert and delete a batch of edges of a graph
+//------------------------------------------------------------------------------
+
+// LAGraph, (c) 2019-2022 by The LAGraph Contributors, All Rights Reserved.
+// SPDX-License-Identifier: BSD-2-Clause
+//
+// For additional details (including references to third party source code and
+// other files) see the LICENSE file or contact permission@sei.cmu.edu. See
+// Contributors.txt for a full list of contributors. Created, in part, with
+// funding and support from the U.S. Government (see Acknowledgments.txt file).
+// DM22-0790
+
+//------------------------------------------------------------------------------
+
+// LAGraph_UpdateEdges applies a batch of edge updates to G->A, and updates the
+// cached properties of G to match, instead of deleting them.  Each entry
+// Delete(i,j) deletes the edge (i,j), if present; the values of Delete are
+// ignored.  Each entry Insert(i,j) then inserts the edge (i,j) with the value
+// Insert(i,j), or replaces the value of the edge if it is already present.
+// An edge in both Insert and Delete is thus given the value Insert(i,j).
+// Either matrix may be NULL.  If G is undirected, both matrices must be
+// symmetric (Delete in its structure only).
+
+// The work and memory needed are proportional to the size of the batch, and
+// not to the size of G (aside from the work done by GraphBLAS to merge the
+// changes into G->A), so this is much faster than recomputing the cached
+// properties for a small batch of updates.  The cached properties are updated
+// as follows, with E the edges inserted, and D the edges deleted (not counting
+// edges whose value is just replaced):
+
+//  G->AT                       AT(j,i) is updated for each update of A(i,j)
+//  G->out_degree, in_degree    degree changes of E-D, added to each vector
+//  G->nself_edges              diagonal entries of E-D are added to it
+//  G->emin, G->emax            min(emin,min(Insert)), max(emax,max(Insert));
+//                              a VALUE becomes a BOUND if any edge is deleted
+//                              or its value is replaced
+//  G->is_symmetric_structure   only the updated entries and their transposes
+//                              are checked.  If true, it remains exact.  If
+//                              false, it becomes unknown unless E and D are
+//                              empty or the updated entries are asymmetric.
+//  G->bfs_alpha, beta1, beta2, kept; these are performance hints only
+//  G->sssp_delta
+
+// If an error occurs once G->A has been modified, all cached properties of G
+// are deleted, since they may no longer match G->A.
+
+//------------------------------------------------------------------------------
+
+#define LG_FREE_WORK                    \
+{                                       \
+    GrB_free (&Ins) ;                   \
+    GrB_free (&InsT) ;                  \
+    GrB_free (&Del) ;                   \
+    GrB_free (&DelT) ;                  \
+    GrB_free (&Kept) ;                  \
+    GrB_free (&Rm) ;                    \
+    GrB_free (&New) ;                   \
+    GrB_free (&S) ;                     \
+    GrB_free (&M) ;                     \
+    GrB_free (&MT) ;                    \
+    GrB_free (&E) ;                     \
+    GrB_free (&ET) ;                    \
+    GrB_free (&d) ;                     \
+}
+
+#include "LG_internal.h"
+#include "LAGraphX.h"
+
+//------------------------------------------------------------------------------
+// update_degree: degree += d, and remove any entries that become zero
+//------------------------------------------------------------------------------
+
+// A degree vector has no explicit zero entries (see LAGraph_Cached_OutDegree),
+// so an entry is removed if its degree drops to zero.  Only entries with d(i)
+// < 0 need to be checked.
+
+#undef  LG_FREE_ALL
+#define LG_FREE_ALL                                 \
+{                                                   \
+    LAGraph_Free ((void **) &I, NULL) ;             \
+    LAGraph_Free ((void **) &X, NULL) ;             \
+}
+
+static int update_degree
+(
+    GrB_Vector degree,      // degree vector to update
+    GrB_Vector d,           // change in the degree of each node
+    char *msg
+)
+{
+    GrB_Index *I = NULL ;
+    int64_t *X = NULL ;
+    GrB_Index n, nd ;
+    GRB_TRY (GrB_Vector_size (&n, degree)) ;
+    GRB_TRY (GrB_Vector_nvals (&nd, d)) ;
+    LG_TRY (LAGraph_Malloc ((void **) &I, LAGRAPH_MAX (nd, 1),
+        sizeof (GrB_Index), msg)) ;
+    LG_TRY (LAGraph_Malloc ((void **) &X, LAGRAPH_MAX (nd, 1),
+        sizeof (int64_t), msg)) ;
+    GRB_TRY (GrB_Vector_extractTuples_INT64 (I, X, &nd, d)) ;
+
+    // degree += d
+    GRB_TRY (GrB_assign (degree, NULL, GrB_PLUS_INT64, d, GrB_ALL, n, NULL)) ;
+
+    // remove any degree that is now zero
+    for (GrB_Index k = 0 ; k < nd ; k++)
+    {
+        if (X [k] >= 0) continue ;
+        int64_t deg = 0 ;
+        GRB_TRY (GrB_Vector_extractElement_INT64 (&deg, degree, I [k])) ;
+        if (deg == 0)
+        {
+            GRB_TRY (GrB_Vector_removeElement (degree, I [k])) ;
+        }
+    }
+
+    LG_FREE_ALL ;
+    return (GrB_SUCCESS) ;
+}
+
+//------------------------------------------------------------------------------
+// LAGraph_UpdateEdges
+//------------------------------------------------------------------------------
+
+#undef  LG_FREE_ALL
+#define LG_FREE_ALL                                 \
+{                                                   \
+    LG_FREE_WORK ;                                  \
+    if (modified) LAGraph_DeleteCached (G, NULL) ;  \
+}
+
+int LAGraph_UpdateEdges
+(
+    // input/output:
+    LAGraph_Graph G,        // graph to update, with its cached properties
+    // input:
+    GrB_Matrix Insert,      // edges to insert or replace (may be NULL)
+    GrB_Matrix Delete,      // edges to delete (may be NULL)
+    char *msg
+)
+{
+
+    //--------------------------------------------------------------------------
+    // check inputs
+    //--------------------------------------------------------------------------
+
+    GrB_Matrix Ins = NULL, InsT = NULL, Del = NULL, DelT = NULL, Kept = NULL,
+        Rm = NULL, New = NULL, S = NULL, M = NULL, MT = NULL, E = NULL,
+        ET = NULL ;
+    GrB_Vector d = NULL ;
+    bool modified = false ;
+    LG_CLEAR_MSG_AND_BASIC_ASSERT (G, msg) ;
+
+    GrB_Matrix A = G->A ;
+    GrB_Index nrows, ncols, nr, nc ;
+    GRB_TRY (GrB_Matrix_nrows (&nrows, A)) ;
+    GRB_TRY (GrB_Matrix_ncols (&ncols, A)) ;
+    if (Insert != NULL)
+    {
+        GRB_TRY (GrB_Matrix_nrows (&nr, Insert)) ;
+        GRB_TRY (GrB_Matrix_ncols (&nc, Insert)) ;
+        LG_ASSERT_MSG (nr == nrows && nc == ncols, GrB_DIMENSION_MISMATCH,
+            "Insert must have the same dimensions as G->A") ;
+    }
+    if (Delete != NULL)
+    {
+        GRB_TRY (GrB_Matrix_nrows (&nr, Delete)) ;
+        GRB_TRY (GrB_Matrix_ncols (&nc, Delete)) ;
+        LG_ASSERT_MSG (nr == nrows && nc == ncols, GrB_DIMENSION_MISMATCH,
+            "Delete must have the same dimensions as G->A") ;
+    }
+
+    char atype_name [LAGRAPH_MAX_NAME_LEN] ;
+    LG_TRY (LAGraph_Matrix_TypeName (atype_name, A, msg)) ;
+    GrB_Type atype ;
+    LG_TRY (LAGraph_TypeFromName (&atype, atype_name, msg)) ;
+
+    //--------------------------------------------------------------------------
+    // Ins = Insert, typecast to the type of A, and Del = pattern of Delete
+    //--------------------------------------------------------------------------
+
+    GRB_TRY (GrB_Matrix_new (&Ins, atype, nrows, ncols)) ;
+    if (Insert != NULL)
+    {
+        GRB_TRY (GrB_assign (Ins, NULL, NULL, Insert, GrB_ALL, nrows,
+            GrB_ALL, ncols, NULL)) ;
+    }
+    GRB_TRY (GrB_Matrix_new (&Del, GrB_BOOL, nrows, ncols)) ;
+    if (Delete != NULL)
+    {
+        GRB_TRY (GrB_assign (Del, Delete, NULL, (bool) true, GrB_ALL, nrows,
+            GrB_ALL, ncols, GrB_DESC_S)) ;
+    }
+
+    bool undirected = (G->kind == LAGraph_ADJACENCY_UNDIRECTED) ;
+    if (undirected)
+    {
+        // the updates must keep A symmetric
+        bool ok ;
+        GRB_TRY (GrB_Matrix_new (&InsT, atype, nrows, ncols)) ;
+        GRB_TRY (GrB_transpose (InsT, NULL, NULL, Ins, NULL)) ;
+        LG_TRY (LAGraph_Matrix_IsEqual (&ok, Ins, InsT, msg)) ;
+        LG_ASSERT_MSG (ok, GrB_INVALID_VALUE,
+            "Insert must be symmetric for an undirected graph") ;
+        GRB_TRY (GrB_Matrix_new (&DelT, GrB_BOOL, nrows, ncols)) ;
+        GRB_TRY (GrB_transpose (DelT, NULL, NULL, Del, NULL)) ;
+        LG_TRY (LAGraph_Matrix_IsEqual (&ok, Del, DelT, msg)) ;
+        LG_ASSERT_MSG (ok, GrB_INVALID_VALUE,
+            "Delete must be symmetric for an undirected graph") ;
+        GrB_free (&InsT) ;
+        GrB_free (&DelT) ;
+    }
+
+    //--------------------------------------------------------------------------
+    // find the edges kept (replaced), removed, and new
+    //--------------------------------------------------------------------------
+
+    // These are computed with eWiseMult, whose work is proportional to the
+    // size of the batch, not the size of A.
+
+    // Kept = pattern of Ins .* A: edges whose values are replaced
+    GRB_TRY (GrB_Matrix_new (&Kept, GrB_BOOL, nrows, ncols)) ;
+    GRB_TRY (GrB_eWiseMult (Kept, NULL, NULL, GrB_ONEB_BOOL, Ins, A, NULL)) ;
+
+    // Rm<!Ins> = pattern of Del .* A: edges removed and not reinserted
+    GRB_TRY (GrB_Matrix_new (&Rm, GrB_BOOL, nrows, ncols)) ;
+    GRB_TRY (GrB_eWiseMult (Rm, Ins, NULL, GrB_ONEB_BOOL, Del, A,
+        GrB_DESC_SC)) ;
+
+    // New<!Kept> = pattern of Ins: edges that are not in A
+    GRB_TRY (GrB_Matrix_new (&New, GrB_BOOL, nrows, ncols)) ;
+    GRB_TRY (GrB_apply (New, Kept, NULL, GrB_ONEB_BOOL, Ins, (bool) true,
+        GrB_DESC_SC)) ;
+
+    GrB_Index nins, nkept, nrm, nnew ;
+    GRB_TRY (GrB_Matrix_nvals (&nins, Ins)) ;
+    GRB_TRY (GrB_Matrix_nvals (&nkept, Kept)) ;
+    GRB_TRY (GrB_Matrix_nvals (&nrm, Rm)) ;
+    GRB_TRY (GrB_Matrix_nvals (&nnew, New)) ;
+    if (nins == 0 && nrm == 0)
+    {
+        // nothing to do
+        LG_FREE_WORK ;
+        return (GrB_SUCCESS) ;
+    }
+
+    // S = +1 for each new edge, -1 for each edge removed
+    GRB_TRY (GrB_Matrix_new (&S, GrB_INT64, nrows, ncols)) ;
+    GRB_TRY (GrB_apply (S, NULL, NULL, GrB_ONEB_INT64, New, (int64_t) 0,
+        NULL)) ;
+    GRB_TRY (GrB_assign (S, Rm, NULL, (int64_t) -1, GrB_ALL, nrows,
+        GrB_ALL, ncols, GrB_DESC_S)) ;
+
+    //--------------------------------------------------------------------------
+    // update A and AT
+    //--------------------------------------------------------------------------
+
+    // M = pattern of Ins and Rm.  Then A<M> = Ins inserts or replaces the
+    // edges in Ins, and deletes those in Rm (where Ins has no entry).
+    GRB_TRY (GrB_Matrix_new (&M, GrB_BOOL, nrows, ncols)) ;
+    GRB_TRY (GrB_eWiseAdd (M, NULL, NULL, GrB_LOR, Kept, New, NULL)) ;
+    GRB_TRY (GrB_eWiseAdd (M, NULL, NULL, GrB_LOR, M, Rm, NULL)) ;
+    modified = true ;
+    GRB_TRY (GrB_assign (A, M, NULL, Ins, GrB_ALL, nrows, GrB_ALL, ncols,
+        GrB_DESC_S)) ;
+
+    if (G->AT != NULL)
+    {
+        // AT<M'> = Ins'
+        GRB_TRY (GrB_Matrix_new (&MT, GrB_BOOL, ncols, nrows)) ;
+        GRB_TRY (GrB_transpose (MT, NULL, NULL, M, NULL)) ;
+        GRB_TRY (GrB_Matrix_new (&InsT, atype, ncols, nrows)) ;
+        GRB_TRY (GrB_transpose (InsT, NULL, NULL, Ins, NULL)) ;
+        GRB_TRY (GrB_assign (G->AT, MT, NULL, InsT, GrB_ALL, ncols,
+            GrB_ALL, nrows, GrB_DESC_S)) ;
+        GrB_free (&MT) ;
+        GrB_free (&InsT) ;
+    }
+
+    //--------------------------------------------------------------------------
+    // update the degrees
+    //--------------------------------------------------------------------------
+
+    if (nnew > 0 || nrm > 0)
+    {
+        if (G->out_degree != NULL)
+        {
+            // d(i) = sum (S (i,:))
+            GRB_TRY (GrB_Vector_new (&d, GrB_INT64, nrows)) ;
+            GRB_TRY (GrB_reduce (d, NULL, NULL, GrB_PLUS_MONOID_INT64, S,
+                NULL)) ;
+            LG_TRY (update_degree (G->out_degree, d, msg)) ;
+            GrB_free (&d) ;
+        }
+        if (G->in_degree != NULL)
+        {
+            // d(j) = sum (S (:,j))
+            GRB_TRY (GrB_Vector_new (&d, GrB_INT64, ncols)) ;
+            GRB_TRY (GrB_reduce (d, NULL, NULL, GrB_PLUS_MONOID_INT64, S,
+                GrB_DESC_T0)) ;
+            LG_TRY (update_degree (G->in_degree, d, msg)) ;
+            GrB_free (&d) ;
+        }
+    }
+
+    //--------------------------------------------------------------------------
+    // update the number of self-edges
+    //--------------------------------------------------------------------------
+
+    if (G->nself_edges != LAGRAPH_UNKNOWN && (nnew > 0 || nrm > 0))
+    {
+        // E = diag (S), and nself_edges += sum (E)
+        int64_t delta = 0 ;
+        GRB_TRY (GrB_Matrix_new (&E, GrB_INT64, nrows, ncols)) ;
+        GRB_TRY (GrB_select (E, NULL, NULL, GrB_DIAG, S, 0, NULL)) ;
+        GRB_TRY (GrB_reduce (&delta, NULL, GrB_PLUS_MONOID_INT64, E, NULL)) ;
+        G->nself_edges += delta ;
+        GrB_free (&E) ;
+    }
+
+    //--------------------------------------------------------------------------
+    // update emin and emax
+    //--------------------------------------------------------------------------
+
+    // If an edge is deleted or its value replaced, the old emin and emax
+    // remain valid bounds, but they may no longer be attained.
+    bool lost = (nrm > 0 || nkept > 0) ;
+
+    GrB_BinaryOp min_op = NULL, max_op = NULL ;
+    GrB_Monoid min_monoid = NULL, max_monoid = NULL ;
+    if (atype == GrB_BOOL)
+    {
+        min_op = GrB_LAND ; min_monoid = GrB_LAND_MONOID_BOOL ;
+        max_op = GrB_LOR  ; max_monoid = GrB_LOR_MONOID_BOOL ;
+    }
+    else if (atype == GrB_INT8)
+    {
+        min_op = GrB_MIN_INT8 ; min_monoid = GrB_MIN_MONOID_INT8 ;
+        max_op = GrB_MAX_INT8 ; max_monoid = GrB_MAX_MONOID_INT8 ;
+    }
+    else if (atype == GrB_INT16)
+    {
+        min_op = GrB_MIN_INT16 ; min_monoid = GrB_MIN_MONOID_INT16 ;
+        max_op = GrB_MAX_INT16 ; max_monoid = GrB_MAX_MONOID_INT16 ;
+    }
+    else if (atype == GrB_INT32)
+    {
+        min_op = GrB_MIN_INT32 ; min_monoid = GrB_MIN_MONOID_INT32 ;
+        max_op = GrB_MAX_INT32 ; max_monoid = GrB_MAX_MONOID_INT32 ;
+    }
+    else if (atype == GrB_INT64)
+    {
+        min_op = GrB_MIN_INT64 ; min_monoid = GrB_MIN_MONOID_INT64 ;
+        max_op = GrB_MAX_INT64 ; max_monoid = GrB_MAX_MONOID_INT64 ;
+    }
+    else if (atype == GrB_UINT8)
+    {
+        min_op = GrB_MIN_UINT8 ; min_monoid = GrB_MIN_MONOID_UINT8 ;
+        max_op = GrB_MAX_UINT8 ; max_monoid = GrB_MAX_MONOID_UINT8 ;
+    }
+    else if (atype == GrB_UINT16)
+    {
+        min_op = GrB_MIN_UINT16 ; min_monoid = GrB_MIN_MONOID_UINT16 ;
+        max_op = GrB_MAX_UINT16 ; max_monoid = GrB_MAX_MONOID_UINT16 ;
+    }
+    else if (atype == GrB_UINT32)
+    {
+        min_op = GrB_MIN_UINT32 ; min_monoid = GrB_MIN_MONOID_UINT32 ;
+        max_op = GrB_MAX_UINT32 ; max_monoid = GrB_MAX_MONOID_UINT32 ;
+    }
+    else if (atype == GrB_UINT64)
+    {
+        min_op = GrB_MIN_UINT64 ; min_monoid = GrB_MIN_MONOID_UINT64 ;
+        max_op = GrB_MAX_UINT64 ; max_monoid = GrB_MAX_MONOID_UINT64 ;
+    }
+    else if (atype == GrB_FP32)
+    {
+        min_op = GrB_MIN_FP32 ; min_monoid = GrB_MIN_MONOID_FP32 ;
+        max_op = GrB_MAX_FP32 ; max_monoid = GrB_MAX_MONOID_FP32 ;
+    }
+    else if (atype == GrB_FP64)
+    {
+        min_op = GrB_MIN_FP64 ; min_monoid = GrB_MIN_MONOID_FP64 ;
+        max_op = GrB_MAX_FP64 ; max_monoid = GrB_MAX_MONOID_FP64 ;
+    }
+
+    if (G->emin != NULL && G->emin_state != LAGRAPH_UNKNOWN)
+    {
+        if (min_op == NULL)
+        {
+            // type not supported; see LAGraph_Cached_EMin
+            GrB_free (&(G->emin)) ;
+            G->emin_state = LAGRAPH_UNKNOWN ;
+        }
+        else
+        {
+            // emin = min (emin, min (Ins))
+            if (nins > 0)
+            {
+                GRB_TRY (GrB_reduce (G->emin, min_op, min_monoid, Ins, NULL)) ;
+            }
+            if (lost) G->emin_state = LAGraph_BOUND ;
+        }
+    }
+
+    if (G->emax != NULL && G->emax_state != LAGRAPH_UNKNOWN)
+    {
+        if (max_op == NULL)
+        {
+            // type not supported; see LAGraph_Cached_EMax
+            GrB_free (&(G->emax)) ;
+            G->emax_state = LAGRAPH_UNKNOWN ;
+        }
+        else
+        {
+            // emax = max (emax, max (Ins))
+            if (nins > 0)
+            {
+                GRB_TRY (GrB_reduce (G->emax, max_op, max_monoid, Ins, NULL)) ;
+            }
+            if (lost) G->emax_state = LAGraph_BOUND ;
+        }
+    }
+
+    //--------------------------------------------------------------------------
+    // update the symmetry of the structure of A
+    //--------------------------------------------------------------------------
+
+    if (!undirected && nrows == ncols &&
+        G->is_symmetric_structure != LAGRAPH_UNKNOWN && (nnew > 0 || nrm > 0))
+    {
+        // Any entry of A whose presence has changed is in the pattern of S.
+        // E = pattern of A restricted to the pattern of S+S'.  If A was
+        // symmetric, then A is symmetric now if and only if E is symmetric.
+        // If A was unsymmetric, then A is still unsymmetric if E is
+        // unsymmetric; otherwise its symmetry is unknown.
+        GrB_free (&M) ;
+        GRB_TRY (GrB_Matrix_new (&M, GrB_BOOL, nrows, ncols)) ;
+        GRB_TRY (GrB_eWiseAdd (M, NULL, NULL, GrB_ONEB_BOOL, S, S,
+            GrB_DESC_T1)) ;
+        GRB_TRY (GrB_Matrix_new (&E, GrB_BOOL, nrows, ncols)) ;
+        GRB_TRY (GrB_eWiseMult (E, NULL, NULL, GrB_ONEB_BOOL, M, A, NULL)) ;
+        GRB_TRY (GrB_Matrix_new (&ET, GrB_BOOL, ncols, nrows)) ;
+        GRB_TRY (GrB_transpose (ET, NULL, NULL, E, NULL)) ;
+        bool ok ;
+        LG_TRY (LAGraph_Matrix_IsEqual (&ok, E, ET, msg)) ;
+        if (!ok)
+        {
+            G->is_symmetric_structure = false ;
+        }
+        else if (G->is_symmetric_structure == false)
+        {
+            G->is_symmetric_structure = LAGRAPH_UNKNOWN ;
+        }
+    }
+
+    //--------------------------------------------------------------------------
+    // free workspace and return result
+    //--------------------------------------------------------------------------
+
+    LG_FREE_WORK ;
+    return (GrB_SUCCESS) ;
+}
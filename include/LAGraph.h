@@ -200,6 +200,10 @@
  *          diagonal entries from G->A.
  *    - LAGRAPH_CONVERGENCE_FAILURE (-1005):
  *          An iterative process failed to converge to a good solution.
+ *    - LAGRAPH_NEGATIVE_CYCLE (-1006):
+ *          A shortest-path method found a cycle of negative total weight
+ *          reachable from the source node, so the shortest path lengths are
+ *          not defined.
  *    - LAGRAPH_CACHE_NOT_NEEDED (1000):
  *          This is a warning, not an error.  It is returned by
  *          LAGraph_Cached_* methods when asked to compute cached properties
@@ -215,6 +219,7 @@
 #define LAGRAPH_NOT_CACHED                      (-1003)
 #define LAGRAPH_NO_SELF_EDGES_ALLOWED           (-1004)
 #define LAGRAPH_CONVERGENCE_FAILURE             (-1005)
+#define LAGRAPH_NEGATIVE_CYCLE                  (-1006)
 #define LAGRAPH_CACHE_NOT_NEEDED                ( 1000)
 
 /**
@@ -723,6 +728,23 @@ struct LAGraph_Graph_struct
             ///< - BOUND: emax >= max(G->A)
             ///< - UNKNOWN: emax is unknown
 
+    double bfs_alpha ;  ///< push/pull thresholds for LAGr_BreadthFirstSearch,
+    double bfs_beta1 ;  ///< tuned for this graph, or LAGRAPH_UNKNOWN if not
+    double bfs_beta2 ;  ///< known, in which case the defaults (8, 8, and 512)
+            ///< are used.  The BFS switches from push to pull when the edges
+            ///< in the frontier exceed the unexplored edges / bfs_alpha (or,
+            ///< after the first pull, when the frontier exceeds n/bfs_beta1),
+            ///< and back to push when the frontier shrinks below n/bfs_beta2.
+            ///< These are performance hints only; any positive values give
+            ///< the same result.  See LAGraph_Cached_BFSThresholds in
+            ///< LAGraphX.h.
+
+    double sssp_delta ; ///< Delta for delta-stepping SSSP, used by
+            ///< LAGraph_SingleSourceShortestPath, or LAGRAPH_UNKNOWN if not
+            ///< known, in which case it is computed on the first call to
+            ///< LAGraph_SingleSourceShortestPath.  This is a performance hint
+            ///< only; any Delta > 0 gives the same path lengths.
+
     //@}
 
     // FUTURE: possible future cached properties:
@@ -976,6 +998,32 @@ int LAGraph_DeleteCached
     char *msg
 ) ;
 
+//------------------------------------------------------------------------------
+// LAGraph_Cached_Property: a bitmask of cached properties
+//------------------------------------------------------------------------------
+
+/** LAGraph_Cached_Property: each cached property of a graph, for use in a
+ * bitmask.  These are used by LAGraph_Cached_Ensure and the memory budget for
+ * cached properties (see LAGraph_Cached_SetBudget in LAGraphX.h).  If a
+ * budget has been set, LAGraph_Cached_AT, LAGraph_Cached_OutDegree, and
+ * LAGraph_Cached_InDegree delete other cached properties of G, once they have
+ * computed their own, to keep within it.
+ */
+
+typedef enum
+{
+    LAGRAPH_CACHE_AT                    = 0x01, // G->AT
+    LAGRAPH_CACHE_OUT_DEGREE            = 0x02, // G->out_degree
+    LAGRAPH_CACHE_IN_DEGREE             = 0x04, // G->in_degree
+    LAGRAPH_CACHE_SYMMETRIC_STRUCTURE   = 0x08, // G->is_symmetric_structure
+    LAGRAPH_CACHE_NSELF_EDGES           = 0x10, // G->nself_edges
+    LAGRAPH_CACHE_EMIN                  = 0x20, // G->emin
+    LAGRAPH_CACHE_EMAX                  = 0x40, // G->emax
+    LAGRAPH_CACHE_SSSP_DELTA            = 0x80, // G->sssp_delta
+    LAGRAPH_CACHE_ALL                   = 0xFF  // all of the above
+}
+LAGraph_Cached_Property ;
+
 //------------------------------------------------------------------------------
 // LAGraph_Cached_AT: construct G->AT for a graph
 //------------------------------------------------------------------------------
@@ -986,6 +1034,8 @@ int LAGraph_DeleteCached
  * G->A changes, G->AT should be freed and recomputed.  If G->AT already
  * exists, it is left unchanged (even if it is not equal to the transpose of
  * G->A).  As a result, if G->A changes, G->AT should be explictly freed.
+ * Once G->AT is computed, other cached properties of G may be deleted to keep
+ * within the memory budget, if one is set (see LAGraph_Cached_Property).
  *
  * @param[in,out] G     graph for which G->AT is computed.
  * @param[in,out] msg   any error messages.
@@ -1040,7 +1090,9 @@ int LAGraph_Cached_IsSymmetricStructure
 //------------------------------------------------------------------------------
 
 /** LAGraph_Cached_OutDegree: computes G->out_degree.  No work is performed if
- * it already exists in G.
+ * it already exists in G.  Once G->out_degree is computed, other cached
+ * properties of G may be deleted to keep within the memory budget, if one is
+ * set (see LAGraph_Cached_Property).
  *
  * @param[in,out] G     graph for which G->out_degree is computed.
  * @param[in,out] msg   any error messages.
@@ -1075,6 +1127,10 @@ int LAGraph_Cached_OutDegree
  * then call LAGraph_Cached_Indegree.  This is optional; if G->AT is not known,
  * then G->in_degree is computed from G->A instead.
  *
+ * Once G->in_degree is computed, other cached properties of G may be deleted
+ * to keep within the memory budget, if one is set (see
+ * LAGraph_Cached_Property).
+ *
  * @param[in,out] G     graph for which G->in_degree is computed.
  * @param[in,out] msg   any error messages.
  *
@@ -1471,6 +1527,10 @@ double LAGraph_WallClockTime     // returns omp_get_wtime(), or other timer
  * column-major order.  This rule is follwed by @sphinxref{LAGraph_MMWrite}.
  * However, LAGraph_MMRead can read the entries in any order.
  *
+ * The file may be compressed with gzip or zstd, which is detected from its
+ * first few bytes.  It is decompressed by a separate thread as it is read.
+ * This requires LAGraph to be compiled with zlib or libzstd, respectively.
+ *
  * @param[out] A        handle of the matrix to create.
  * @param[in,out]  f    handle to an open file to read from.
  * @param[in,out] msg   any error messages.
@@ -1481,6 +1541,8 @@ double LAGraph_WallClockTime     // returns omp_get_wtime(), or other timer
  *      be read or contains a matrix with an invalid Matrix Market format.
  * @retval GrB_NOT_IMPLEMENTED if the type is not supported.  Complex types
  *      (GxB_FC32 and GxB_FC64 in SuiteSparse:GraphBLAS) are not yet supported.
+ *      Also returned if the file is compressed but LAGraph was compiled
+ *      without the library needed to decompress it.
  * @returns any GraphBLAS errors that may have been encountered.
  */
 
@@ -2068,6 +2130,50 @@ int LAGraph_TriangleCount
     char *msg
 ) ;
 
+//------------------------------------------------------------------------------
+// LAGraph_SingleSourceShortestPath
+//------------------------------------------------------------------------------
+
+/** LAGraph_SingleSourceShortestPath: single-source shortest paths, with Delta
+ * chosen automatically.  This is a Basic algorithm (G->emin, G->emax, and
+ * G->sssp_delta are computed, if not present).  Delta is taken from
+ * G->sssp_delta.  If it is not known, it is computed on this first call, from
+ * the edge weights, the mean out-degree, and level-only BFS probes from a
+ * small sample of sources spread over the nodes with out-edges (G->out_degree
+ * is computed as well, to choose them), and kept in G->sssp_delta for later
+ * calls.  Once G->sssp_delta is known, G is not modified.  See
+ * @sphinxref{LAGr_SingleSourceShortestPath} for the supported types and the
+ * contents of path_length.
+ *
+ * @param[out] path_length  path_length (i) is the length of the shortest
+ *     path from the source node to node i.
+ * @param[in,out] G     input graph; cached properties computed.
+ * @param[in] src       source node.
+ * @param[in,out] msg   any error messages.
+ *
+ * @retval GrB_SUCCESS if successful.
+ * @retval GrB_NULL_POINTER if G or path_length are NULL.
+ * @retval GrB_INVALID_INDEX if src is invalid.
+ * @retval GrB_NOT_IMPLEMENTED if the type is not supported.
+ * @retval LAGRAPH_NEGATIVE_CYCLE if a negative-weight cycle is reachable
+ *      from src.
+ * @retval LAGRAPH_INVALID_GRAPH Graph is invalid
+ *              (@sphinxref{LAGraph_CheckGraph} failed).
+ * @returns any GraphBLAS errors that may have been encountered.
+ */
+
+LAGRAPH_PUBLIC
+int LAGraph_SingleSourceShortestPath
+(
+    // output:
+    GrB_Vector *path_length,
+    // input/output:
+    LAGraph_Graph G,
+    // input:
+    GrB_Index src,
+    char *msg
+) ;
+
 //==============================================================================
 // LAGraph Advanced algorithms and utilities
 //==============================================================================
@@ -2210,6 +2316,8 @@ int LAGr_SampleDegree
  * properties are not present, or if a vanilla GraphBLAS library is being used,
  * then a push-only method is used (which can be slower).  G is not modified;
  * that is, G->AT and G->out_degree are not computed if not already cached.
+ * The push/pull thresholds G->bfs_alpha, G->bfs_beta1, and G->bfs_beta2 are
+ * used if known.
  *
  * @param[out]    level      If non-NULL on input, on successful return, it
  *                           contains the levels of each node reached. The
@@ -2291,7 +2399,9 @@ int LAGr_ConnectedComponents
  * Advanced algorithm (G->emin is required for best performance).  The graph G
  * must have an adjacency matrix of type GrB_INT32, GrB_INT64, GrB_UINT32,
  * GrB_UINT64, GrB_FP32, or GrB_FP64.  If G->A has any other type,
- * GrB_NOT_IMPLEMENTED is returned.
+ * GrB_NOT_IMPLEMENTED is returned.  Negative edge weights are allowed, but
+ * LAGRAPH_NEGATIVE_CYCLE is returned if a cycle of negative total weight can
+ * be reached from src.
  *
  * @param[out] path_length  path_length (i) is the length of the shortest
  *     path from the source node to node i.  The path_length vector is dense.
@@ -2308,14 +2418,13 @@ int LAGr_ConnectedComponents
  * @retval GrB_INVALID_INDEX if src is invalid.
  * @retval GrB_EMPTY_OBJECT if Delta does not contain a value.
  * @retval GrB_NOT_IMPLEMENTED if the type is not supported.
+ * @retval LAGRAPH_NEGATIVE_CYCLE if a negative-weight cycle is reachable
+ *      from src.
  * @retval LAGRAPH_INVALID_GRAPH Graph is invalid
  *              (@sphinxref{LAGraph_CheckGraph} failed).
  * @returns any GraphBLAS errors that may have been encountered.
  */
 
-// FUTURE: add a Basic algorithm that computes G->emin, G->emax, and then uses
-// that information to compute an appropriate (estimated) Delta.
-
 LAGRAPH_PUBLIC
 int LAGr_SingleSourceShortestPath
 (
@@ -2328,6 +2437,56 @@ int LAGr_SingleSourceShortestPath
     char *msg
 ) ;
 
+//------------------------------------------------------------------------------
+// LAGr_SingleSourceShortestPath_Parent: shortest paths, with the path tree
+//------------------------------------------------------------------------------
+
+/** LAGr_SingleSourceShortestPath_Parent: single-source shortest paths, and the
+ * shortest-path tree.  This is identical to
+ * @sphinxref{LAGr_SingleSourceShortestPath}, except that the parent vector is
+ * also computed, at the cost of a few more passes over the edges of each
+ * frontier.  This is an Advanced algorithm (G->emin is required for best
+ * performance).
+ *
+ * @param[out] path_length  path_length (i) is the length of the shortest
+ *     path from the source node to node i, as for
+ *     @sphinxref{LAGr_SingleSourceShortestPath}.
+ * @param[out] parent   if not NULL on input, parent (i) is the node before
+ *     node i on a shortest path from the source node, and parent (src) = src.
+ *     The parent vector has type GrB_INT64.  If node i is not reachable from
+ *     src, parent (i) is not present.  If NULL on input, the parent vector is
+ *     not computed.
+ * @param[in] G         input graph.
+ * @param[in] src       source node.
+ * @param[in] Delta     for delta stepping.
+ * @param[in,out] msg   any error messages.
+ *
+ * @retval GrB_SUCCESS if successful.
+ * @retval GrB_NULL_POINTER if G or path_length are NULL.
+ * @retval GrB_INVALID_INDEX if src is invalid.
+ * @retval GrB_EMPTY_OBJECT if Delta does not contain a value.
+ * @retval GrB_NOT_IMPLEMENTED if the type is not supported, or if the parent
+ *      is requested and SuiteSparse:GraphBLAS is not in use.
+ * @retval LAGRAPH_NEGATIVE_CYCLE if a negative-weight cycle is reachable
+ *      from src.
+ * @retval LAGRAPH_INVALID_GRAPH Graph is invalid
+ *              (@sphinxref{LAGraph_CheckGraph} failed).
+ * @returns any GraphBLAS errors that may have been encountered.
+ */
+
+LAGRAPH_PUBLIC
+int LAGr_SingleSourceShortestPath_Parent
+(
+    // output:
+    GrB_Vector *path_length,
+    GrB_Vector *parent,         // may be NULL
+    // input:
+    const LAGraph_Graph G,
+    GrB_Index src,
+    GrB_Scalar Delta,           // delta value for delta stepping
+    char *msg
+) ;
+
 //------------------------------------------------------------------------------
 // LAGr_Betweenness: betweeness centrality metric
 //------------------------------------------------------------------------------
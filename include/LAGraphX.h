@@ -204,12 +204,41 @@ int LAGraph_SWrite_HeaderItem   // write a single item to the JSON header
     const char *name,           // name of the matrix/vector/text; matrices from
                                 // sparse.tamu.edu use the form "Group/Name"
     const char *type,           // name of type of the matrix/vector
-    // todo: text not yet supported by LAGraph_SWrithe_HeaderItem
     int compression,            // text compression method
     GrB_Index blob_size,        // exact size of serialized blob for this item
     char *msg
 ) ;
 
+// LAGraph_SWrite_HeaderItemReserve writes an item to the JSON header, like
+// LAGraph_SWrite_HeaderItem, but with space reserved for the size of its
+// blob.  Once the blob has been written and its size is known,
+// LAGraph_SWrite_HeaderItemSize writes the size into the header.  The file
+// must be seekable.
+
+LAGRAPHX_PUBLIC
+int LAGraph_SWrite_HeaderItemReserve    // write an item, without its size
+(
+    // inputs:
+    FILE *f,                    // file to write to
+    LAGraph_Contents_kind kind, // matrix, vector, or text
+    const char *name,           // name of the matrix/vector/text
+    const char *type,           // name of type of the matrix/vector
+    int compression,            // text compression method
+    // output:
+    int64_t *pos,               // position of the size in the file
+    char *msg
+) ;
+
+LAGRAPHX_PUBLIC
+int LAGraph_SWrite_HeaderItemSize   // write the size of a reserved item
+(
+    // inputs:
+    FILE *f,                    // file to write to
+    int64_t pos,                // position from LAGraph_SWrite_HeaderItemReserve
+    GrB_Index blob_size,        // exact size of serialized blob for this item
+    char *msg
+) ;
+
 LAGRAPHX_PUBLIC
 int LAGraph_SWrite_HeaderEnd    // write the end of the JSON header
 (
@@ -238,6 +267,21 @@ int LAGraph_SRead   // read a set of matrices from a *.lagraph file
     char *msg
 ) ;
 
+// LAGraph_SReadHeader reads just the JSON header of a *.lagraph file, and
+// returns the Contents with no blobs.  The file is left positioned at the
+// first blob.
+
+LAGRAPHX_PUBLIC
+int LAGraph_SReadHeader // read the JSON header of a *.lagraph file
+(
+    FILE *f,                        // file to read from
+    // output
+    char **collection,              // name of collection (allocated string)
+    LAGraph_Contents **Contents,    // array of contents, with no blobs
+    GrB_Index *ncontents,           // # of items in the Contents array
+    char *msg
+) ;
+
 LAGRAPHX_PUBLIC
 void LAGraph_SFreeContents      // free the Contents returned by LAGraph_SRead
 (
@@ -274,6 +318,24 @@ int LAGraph_SLoadSet            // load a set of matrices from a *.lagraph file
     char *msg
 ) ;
 
+// LAGraph_SLoadSet_Timed is the same as LAGraph_SLoadSet, but also returns
+// the time taken to deserialize each matrix.  Both methods deserialize up to
+// LG_nthreads_outer matrices in parallel (see LAGraph_SetNumThreads).
+
+LAGRAPHX_PUBLIC
+int LAGraph_SLoadSet_Timed      // load a set of matrices, and time each one
+(
+    // input:
+    char *filename,             // name of file to read from
+    // outputs:
+    GrB_Matrix **Set_handle,        // array of GrB_Matrix of size nmatrices
+    GrB_Index *nmatrices_handle,    // # of matrices loaded from *.lagraph file
+    char **collection_handle,   // name of this collection of matrices
+    double **Time_handle,       // array of size nmatrices: Time [i] is the
+                                // time to deserialize Set [i]
+    char *msg
+) ;
+
 LAGRAPHX_PUBLIC
 void LAGraph_SFreeSet           // free a set of matrices
 (
@@ -282,6 +344,518 @@ void LAGraph_SFreeSet           // free a set of matrices
     GrB_Index nmatrices         // # of matrices in the set
 ) ;
 
+// LAGraph_SIndex: random access to the items of a *.lagraph file.
+// LAGraph_SOpen reads the JSON header of the file and computes the offset of
+// each blob, so that a single item can be read (LAGraph_SReadItem) or
+// deserialized (LAGraph_SLoadItem) without reading any other item.  The file
+// is mapped into memory if possible; otherwise it is held open until
+// LAGraph_SClose.
+
+struct LAGraph_SIndex_struct
+{
+    char *collection ;          // name of the collection
+    LAGraph_Contents *Contents ;    // array of size ncontents (blobs are NULL)
+    GrB_Index ncontents ;       // # of items in the file
+    size_t *offset ;            // Contents [k] is held in the file at
+                                // offset [k] to offset [k+1]-1
+    size_t file_size ;          // size of the file, in bytes
+    // private content:
+    FILE *f ;                   // the open file, if not mapped
+    void *map ;                 // the file mapped into memory, or NULL
+} ;
+
+typedef struct LAGraph_SIndex_struct *LAGraph_SIndex ;
+
+LAGRAPHX_PUBLIC
+int LAGraph_SOpen               // open a *.lagraph file for random access
+(
+    // output:
+    LAGraph_SIndex *Index,      // index of the file
+    // input:
+    const char *filename,       // name of the *.lagraph file to open
+    char *msg
+) ;
+
+LAGRAPHX_PUBLIC
+int LAGraph_SClose              // close a *.lagraph file and free its index
+(
+    // input/output:
+    LAGraph_SIndex *Index,      // index to free; set to NULL on output
+    char *msg
+) ;
+
+LAGRAPHX_PUBLIC
+int LAGraph_SFind               // find an item by name
+(
+    // output:
+    int64_t *k,                 // the item is Index->Contents [k]
+    // input:
+    LAGraph_SIndex Index,       // index of the file, from LAGraph_SOpen
+    const char *name,           // name of the item to find
+    char *msg
+) ;
+
+LAGRAPHX_PUBLIC
+int LAGraph_SReadItem           // read a single serialized blob
+(
+    // output:
+    void **blob,                // copy of the serialized blob
+    GrB_Index *blob_size,       // size of the blob
+    // input:
+    LAGraph_SIndex Index,       // index of the file, from LAGraph_SOpen
+    GrB_Index k,                // item to read: Index->Contents [k]
+    char *msg
+) ;
+
+LAGRAPHX_PUBLIC
+int LAGraph_SLoadItem           // deserialize a single matrix
+(
+    // output:
+    GrB_Matrix *A,              // matrix deserialized from the file
+    // input:
+    LAGraph_SIndex Index,       // index of the file, from LAGraph_SOpen
+    GrB_Index k,                // item to load: Index->Contents [k]
+    char *msg
+) ;
+
+// LAGraph_SSaveGraph saves a graph to a *.lagraph file: G->A, G->kind, and
+// each of its cached properties that is known (G->AT, G->out_degree,
+// G->in_degree, G->is_symmetric_structure, G->nself_edges, G->emin, G->emax,
+// and their states, the BFS thresholds G->bfs_alpha, G->bfs_beta1, and
+// G->bfs_beta2, and G->sssp_delta).  LAGraph_SLoadGraph loads it back in,
+// with all of those cached properties restored, so none of them need to be
+// recomputed.  Both methods require SuiteSparse:GraphBLAS.
+
+LAGRAPHX_PUBLIC
+int LAGraph_SSaveGraph          // save a graph to a *.lagraph file
+(
+    // inputs:
+    const char *filename,       // name of file to write to
+    LAGraph_Graph G,            // graph to save, with its cached properties
+    const char *collection,     // name of this collection
+    char *msg
+) ;
+
+LAGRAPHX_PUBLIC
+int LAGraph_SLoadGraph          // load a graph from a *.lagraph file
+(
+    // output:
+    LAGraph_Graph *G,           // graph loaded, with its cached properties
+    // input:
+    const char *filename,       // name of file to read from
+    char *msg
+) ;
+
+// LAGraph_BinRead reads a matrix from a binary *.grb file, created by
+// binwrite in src/benchmark/LAGraph_demo.h.  The file is mapped into memory
+// (if possible) and its arrays are packed into the matrix with
+// GxB_Matrix_pack_*.  Requires SuiteSparse:GraphBLAS.
+
+LAGRAPHX_PUBLIC
+int LAGraph_BinRead             // read a matrix from a binary *.grb file
+(
+    // output:
+    GrB_Matrix *A,              // matrix read from the file
+    // input:
+    const char *filename,       // name of the *.grb file to read
+    char *msg
+) ;
+
+// LAGraph_MMRead_LowMemory reads a matrix from a Matrix Market file, like
+// LAGraph_MMRead, but a file in coordinate format is read in two passes,
+// directly into the CSR arrays of the result, so that its peak memory usage is
+// close to the size of the result.  The file must be seekable; otherwise, or
+// if SuiteSparse:GraphBLAS is not in use, the method of LAGraph_MMRead is used.
+
+LAGRAPHX_PUBLIC
+int LAGraph_MMRead_LowMemory    // read a matrix from a Matrix Market file
+(
+    // output:
+    GrB_Matrix *A,              // handle of matrix to create
+    // input:
+    FILE *f,                    // file to read from, already open
+    char *msg
+) ;
+
+// LAGraph_MMConvert converts a Matrix Market file to a binary *.grb file (if
+// outfile ends in ".grb") or a *.lagraph file holding a single matrix "A_0",
+// without holding two copies of the matrix in memory (except to make a
+// matrix symmetric that is stored as "general" in the file).  The matrix can be
+// modified in the same way as readproblem in src/benchmark/LAGraph_demo.h.
+// Requires SuiteSparse:GraphBLAS.
+
+LAGRAPHX_PUBLIC
+int LAGraph_MMConvert           // convert a Matrix Market file
+(
+    // input:
+    const char *outfile,        // name of the *.grb or *.lagraph file to create
+    const char *infile,         // name of the Matrix Market file to read
+    bool make_symmetric,        // if true, A = A+A' if A is not symmetric
+    bool remove_self_edges,     // if true, remove self-edges
+    bool structural,            // if true, A becomes iso-valued GrB_BOOL
+    GrB_Type pref,              // if non-NULL, typecast A to this type
+    char *msg
+) ;
+
+// LAGraph_EdgeListRead reads a graph from an edge-list file (SNAP, TSV, or
+// CSV), with one edge per line: the source and destination node IDs, and an
+// optional weight.  The IDs may be unsigned 64-bit integers or strings; the
+// n distinct IDs are renumbered 0 to n-1 in ascending order.  A is GrB_FP64 if
+// the edges have weights, or iso-valued GrB_BOOL otherwise.  For integer IDs,
+// ids (k) is the ID of node k.  If names is not NULL, names [k] is the ID of
+// node k as a string; free it with LAGraph_Free ((void **) &names, msg).
+
+LAGRAPHX_PUBLIC
+int LAGraph_EdgeListRead        // read a graph from an edge-list file
+(
+    // output:
+    GrB_Matrix *A,              // n-by-n adjacency matrix
+    GrB_Vector *ids,            // if not NULL, ids (k) is the ID of node k
+                                // (NULL on output if the IDs are strings)
+    char ***names,              // if not NULL, names [k] is the ID of node k
+    // input:
+    FILE *f,                    // file to read from, already open
+    char *msg
+) ;
+
+// LAGraph_UpdateEdges deletes the edges in the structure of Delete from G->A,
+// and then inserts the edges in Insert (replacing the value of any edge
+// already present).  Either may be NULL.  The cached properties of G are
+// updated to match, with work proportional to the size of the batch, rather
+// than deleted: see experimental/utility/LAGraph_UpdateEdges.c for details.
+// If G is undirected, Insert and Delete must both be symmetric.
+
+LAGRAPHX_PUBLIC
+int LAGraph_UpdateEdges
+(
+    // input/output:
+    LAGraph_Graph G,        // graph to update, with its cached properties
+    // input:
+    GrB_Matrix Insert,      // edges to insert or replace (may be NULL)
+    GrB_Matrix Delete,      // edges to delete (may be NULL)
+    char *msg
+) ;
+
+// LAGraph_Cached_Ensure computes any of the cached properties of G given by a
+// bitmask of LAGraph_Cached_Property values (see LAGraph.h) that are not
+// already known.  With SuiteSparse:GraphBLAS, they are computed together from
+// the CSR arrays of G->A, rather than with one pass over G->A per property.
+
+LAGRAPHX_PUBLIC
+int LAGraph_Cached_Ensure
+(
+    // input/output:
+    LAGraph_Graph G,        // graph whose cached properties are computed
+    // input:
+    int properties,         // bitmask of LAGRAPH_CACHE_* properties needed
+    char *msg
+) ;
+
+// LAGraph_Cached_Footprint returns the bytes held by a set of cached
+// properties of G.  LAGraph_Cached_Trim deletes cached properties of G, other
+// than those in the keep bitmask, until they hold no more than budget bytes.
+// The properties with the most bytes per unit of work to recompute them are
+// deleted first.  LAGraph_Cached_SetBudget sets a global budget for the
+// cached properties of each graph (the default is SIZE_MAX, for no budget),
+// and LAGraph_Cached_TrimToBudget trims G to it.  The budget is applied by
+// every LAGraph_Cached_* method that allocates a property, including
+// LAGraph_Cached_AT, LAGraph_Cached_OutDegree, and LAGraph_Cached_InDegree in
+// LAGraph.h.  It is per graph, not per process.  See
+// experimental/utility/LAGraph_Cached_Budget.c for details.
+
+LAGRAPHX_PUBLIC
+int LAGraph_Cached_Footprint
+(
+    // output:
+    size_t *bytes,          // bytes held by the selected cached properties
+    // input:
+    const LAGraph_Graph G,
+    int properties,         // bitmask of LAGRAPH_CACHE_* properties to count
+    char *msg
+) ;
+
+LAGRAPHX_PUBLIC
+int LAGraph_Cached_Trim
+(
+    // input/output:
+    LAGraph_Graph G,        // graph whose cached properties are trimmed
+    // input:
+    size_t budget,          // max bytes for all cached properties of G
+    int keep,               // bitmask of LAGRAPH_CACHE_* properties to keep
+    char *msg
+) ;
+
+LAGRAPHX_PUBLIC
+int LAGraph_Cached_SetBudget
+(
+    // input:
+    size_t budget,          // max bytes for the cached properties of a graph
+    char *msg
+) ;
+
+LAGRAPHX_PUBLIC
+int LAGraph_Cached_GetBudget
+(
+    // output:
+    size_t *budget,         // max bytes for the cached properties of a graph
+    char *msg
+) ;
+
+LAGRAPHX_PUBLIC
+int LAGraph_Cached_TrimToBudget
+(
+    // input/output:
+    LAGraph_Graph G,        // graph whose cached properties are trimmed
+    // input:
+    int keep,               // bitmask of LAGRAPH_CACHE_* properties to keep
+    char *msg
+) ;
+
+// LAGraph_Cached_BFSThresholds sets the push/pull thresholds G->bfs_alpha,
+// G->bfs_beta1, and G->bfs_beta2 used by LAGr_BreadthFirstSearch, from the
+// sampled mean and median out-degree of G (G->out_degree is computed if not
+// present).  If ntrials > 0 and the BFS can pull, the choice of bfs_alpha is
+// then refined by timing ntrials searches with a few candidate values.  See
+// experimental/utility/LAGraph_Cached_BFSThresholds.c for details.
+
+LAGRAPHX_PUBLIC
+int LAGraph_Cached_BFSThresholds
+(
+    // input/output:
+    LAGraph_Graph G,        // graph whose BFS thresholds are computed
+    // input:
+    int64_t ntrials,        // # of timed searches per candidate (0: none)
+    char *msg
+) ;
+
+// LAGraph_Cached_SSSPDelta sets G->sssp_delta, the Delta used by
+// LAGraph_SingleSourceShortestPath, from the mean edge weight and out-degree
+// of G and the number of BFS levels from up to ntrials sources spread over
+// the graph (G->emin, G->emax, and G->out_degree are computed if not
+// present).  LAGraph_SingleSourceShortestPath does the same, with a fixed
+// number of sources, when G->sssp_delta is not known.  See
+// experimental/utility/LAGraph_Cached_SSSPDelta.c for details.
+
+LAGRAPHX_PUBLIC
+int LAGraph_Cached_SSSPDelta
+(
+    // input/output:
+    LAGraph_Graph G,        // graph whose Delta is computed
+    // input:
+    int64_t ntrials,        // max # of BFS probes
+    char *msg
+) ;
+
+//------------------------------------------------------------------------------
+// memory pools and arenas
+//------------------------------------------------------------------------------
+
+// LAGraph_Pool_malloc, LAGraph_Pool_calloc, LAGraph_Pool_realloc, and
+// LAGraph_Pool_free: a thread-caching size-class memory pool, to be passed
+// to LAGr_Init.  LAGraph_Pool_Release returns all free blocks in the pool to
+// the system, after LAGraph_Finalize.  See
+// experimental/utility/LAGraph_Pool.c for details.
+
+LAGRAPHX_PUBLIC
+void *LAGraph_Pool_malloc   // return pointer to allocated block of memory
+(
+    size_t size             // # of bytes to allocate
+) ;
+
+LAGRAPHX_PUBLIC
+void *LAGraph_Pool_calloc   // return pointer to allocated block of memory
+(
+    size_t nitems,          // # of items to allocate
+    size_t itemsize         // # of bytes per item
+) ;
+
+LAGRAPHX_PUBLIC
+void *LAGraph_Pool_realloc  // return pointer to reallocated memory
+(
+    void *p,                // block to realloc
+    size_t size             // new size of the block
+) ;
+
+LAGRAPHX_PUBLIC
+void LAGraph_Pool_free
+(
+    void *p                 // block to free
+) ;
+
+LAGRAPHX_PUBLIC
+int LAGraph_Pool_Release
+(
+    char *msg
+) ;
+
+// LAGraph_Arena: workspace whose blocks are all released at once, in O(1)
+// time, by LAGraph_Arena_Reset.  See experimental/utility/LAGraph_Arena.c.
+
+typedef struct LAGraph_Arena_struct *LAGraph_Arena ;
+
+LAGRAPHX_PUBLIC
+int LAGraph_Arena_New
+(
+    // output:
+    LAGraph_Arena *arena,   // the arena to create
+    // input:
+    size_t chunk_size,      // bytes in each chunk; 0 for the default (256 KB)
+    char *msg
+) ;
+
+LAGRAPHX_PUBLIC
+int LAGraph_Arena_Malloc
+(
+    // output:
+    void **p,               // pointer to allocated block of memory
+    // input/output:
+    LAGraph_Arena arena,    // arena to allocate the block from
+    // input:
+    size_t nitems,          // number of items
+    size_t size_of_item,    // size of each item
+    char *msg
+) ;
+
+LAGRAPHX_PUBLIC
+int LAGraph_Arena_Calloc
+(
+    // output:
+    void **p,               // pointer to allocated block of memory
+    // input/output:
+    LAGraph_Arena arena,    // arena to allocate the block from
+    // input:
+    size_t nitems,          // number of items
+    size_t size_of_item,    // size of each item
+    char *msg
+) ;
+
+LAGRAPHX_PUBLIC
+int LAGraph_Arena_Reset
+(
+    // input/output:
+    LAGraph_Arena arena,    // arena to reset
+    char *msg
+) ;
+
+LAGRAPHX_PUBLIC
+int LAGraph_Arena_Delete
+(
+    // input/output:
+    LAGraph_Arena *arena,   // arena to free; does nothing if NULL
+    char *msg
+) ;
+
+//------------------------------------------------------------------------------
+// memory allocation statistics
+//------------------------------------------------------------------------------
+
+// LAGraph_MemStats_malloc, LAGraph_MemStats_calloc, LAGraph_MemStats_realloc,
+// and LAGraph_MemStats_free: memory functions that record allocation
+// statistics, to be passed to LAGr_Init.  LAGraph_MemStats_Begin and
+// LAGraph_MemStats_End record the statistics of a scope, such as one call to
+// an algorithm, and LAGraph_MemStats_Query returns them by name.  See
+// experimental/utility/LAGraph_MemStats.c for details.
+
+typedef struct
+{
+    int64_t ncalls ;        // # of scopes summed into these statistics
+    int64_t nmalloc ;       // # of blocks allocated
+    int64_t nfree ;         // # of blocks freed
+    int64_t bytes ;         // total bytes allocated
+    int64_t in_use ;        // net change in the bytes in use
+    int64_t peak ;          // high-water mark of the bytes in use
+    // used internally by LAGraph_MemStats_Begin and LAGraph_MemStats_End:
+    int64_t start_nmalloc ;
+    int64_t start_nfree ;
+    int64_t start_bytes ;
+    int64_t start_in_use ;
+    int64_t outer_peak ;
+}
+LAGraph_MemStats ;
+
+LAGRAPHX_PUBLIC
+void *LAGraph_MemStats_malloc   // return pointer to allocated block of memory
+(
+    size_t size                 // # of bytes to allocate
+) ;
+
+LAGRAPHX_PUBLIC
+void *LAGraph_MemStats_calloc   // return pointer to allocated block of memory
+(
+    size_t nitems,              // # of items to allocate
+    size_t itemsize             // # of bytes per item
+) ;
+
+LAGRAPHX_PUBLIC
+void *LAGraph_MemStats_realloc  // return pointer to reallocated memory
+(
+    void *p,                    // block to realloc
+    size_t size                 // new size of the block
+) ;
+
+LAGRAPHX_PUBLIC
+void LAGraph_MemStats_free
+(
+    void *p                     // block to free
+) ;
+
+LAGRAPHX_PUBLIC
+int LAGraph_MemStats_SetAllocator
+(
+    // input:
+    void * (* user_malloc_function  ) (size_t),
+    void * (* user_realloc_function ) (void *, size_t),
+    void   (* user_free_function    ) (void *),
+    char *msg
+) ;
+
+LAGRAPHX_PUBLIC
+int LAGraph_MemStats_Begin
+(
+    // output:
+    LAGraph_MemStats *stats,    // statistics of the scope
+    char *msg
+) ;
+
+LAGRAPHX_PUBLIC
+int LAGraph_MemStats_End
+(
+    // input/output:
+    LAGraph_MemStats *stats,    // statistics of the scope
+    // input:
+    const char *name,           // if not NULL, add stats to the global table
+    char *msg
+) ;
+
+LAGRAPHX_PUBLIC
+int LAGraph_MemStats_Query
+(
+    // output:
+    LAGraph_MemStats *stats,    // statistics for the name
+    // input:
+    const char *name,           // name to query, or NULL for all allocations
+    char *msg
+) ;
+
+LAGRAPHX_PUBLIC
+int LAGraph_MemStats_Reset
+(
+    char *msg
+) ;
+
+// LAGraph_Freeze computes all cached properties of G and finishes all pending
+// work in G->A and its cached properties.  G can then be shared, read-only,
+// by any number of user threads calling LAGraph algorithms at the same time,
+// with no locking.  G must not be modified while it is shared.
+
+LAGRAPHX_PUBLIC
+int LAGraph_Freeze
+(
+    // input/output:
+    LAGraph_Graph G,        // graph to freeze
+    char *msg
+) ;
+
 //****************************************************************************
 // Algorithms
 //****************************************************************************
@@ -812,7 +1386,7 @@ int LG_CC_FastSV5           // SuiteSparse:GraphBLAS method, with GxB extensions
     // output
     GrB_Vector *component,  // output: array of component identifiers
     // inputs
-    LAGraph_Graph G,        // input graph, modified then restored
+    const LAGraph_Graph G,  // input graph (not modified)
     char *msg
 ) ;
 
@@ -879,6 +1453,116 @@ int LAGraph_SquareClustering
     char *msg
 ) ;
 
+//------------------------------------------------------------------------------
+// breadth-first search with explicit push/pull thresholds
+//------------------------------------------------------------------------------
+
+// LAGraph_BreadthFirstSearch_Options: the same as LAGr_BreadthFirstSearch,
+// but with the push/pull thresholds given by the options struct instead of
+// G->bfs_alpha, G->bfs_beta1, and G->bfs_beta2.  A threshold <= 0 (or a NULL
+// options) uses the value cached in G, or the default if not known.  The
+// search switches from push to pull when the edges in the frontier exceed
+// the unexplored edges / alpha (or, after the first pull, when the frontier
+// has more than n/beta1 nodes), and back to push when the frontier shrinks
+// to n/beta2 nodes or less.  G is not modified.
+
+typedef struct
+{
+    double alpha ;          // default: 8
+    double beta1 ;          // default: 8
+    double beta2 ;          // default: 512
+}
+LAGraph_BFS_Options ;
+
+LAGRAPHX_PUBLIC
+int LAGraph_BreadthFirstSearch_Options
+(
+    // output:
+    GrB_Vector *level,
+    GrB_Vector *parent,
+    // input:
+    const LAGraph_Graph G,
+    GrB_Index src,
+    const LAGraph_BFS_Options *options,     // may be NULL
+    char *msg
+) ;
+
+// LAGraph_BreadthFirstSearch_CSR: the same as LAGr_BreadthFirstSearch, but
+// with each level done directly on the unpacked CSR arrays of A and AT, with
+// a sliding queue for push steps and a bitmap frontier for pull steps.  This
+// avoids the per-level overhead of GraphBLAS on graphs with many levels.
+
+LAGRAPHX_PUBLIC
+int LAGraph_BreadthFirstSearch_CSR
+(
+    // output:
+    GrB_Vector *level,
+    GrB_Vector *parent,
+    // input:
+    const LAGraph_Graph G,
+    GrB_Index src,
+    char *msg
+) ;
+
+//------------------------------------------------------------------------------
+// shortest path between two nodes, by hop count
+//------------------------------------------------------------------------------
+
+// LAGraph_BidirectionalBFS: a path with the fewest edges from src to dest,
+// found by searching forward from src and backward from dest until the two
+// searches meet.  path(k) is the kth node of the path, for k = 0 to hops.  If
+// there is no path, hops is -1 and path is NULL.  path may be NULL on input.
+
+LAGRAPHX_PUBLIC
+int LAGraph_BidirectionalBFS
+(
+    // output:
+    int64_t *hops,          // # of edges in the path, or -1 if none
+    GrB_Vector *path,       // path(k) = kth node of the path, may be NULL
+    // input:
+    const LAGraph_Graph G,
+    GrB_Index src,          // first node of the path
+    GrB_Index dest,         // last node of the path
+    char *msg
+) ;
+
+//------------------------------------------------------------------------------
+// breadth-first search from many sources
+//------------------------------------------------------------------------------
+
+// LAGraph_MultiSourceBFS: a BFS from each of ns sources, all at once.  Row s
+// of level and parent holds the result of LAGr_BreadthFirstSearch from
+// sources [s].  Either level or parent may be NULL, but not both.
+
+LAGRAPHX_PUBLIC
+int LAGraph_MultiSourceBFS
+(
+    // output:
+    GrB_Matrix *level,          // level(s,i): level of node i in BFS s
+    GrB_Matrix *parent,         // parent(s,i): parent of node i in BFS s
+    // input:
+    const LAGraph_Graph G,
+    const GrB_Index *sources,   // source node of each BFS
+    int64_t ns,                 // number of sources
+    char *msg
+) ;
+
+// LAGraph_MultiSourceBFS_BitParallel: the level matrix of
+// LAGraph_MultiSourceBFS, computed with one bit per (source, node) pair.  Up
+// to 512 searches are advanced at once by a CSR kernel on G->A and G->AT.
+
+LAGRAPHX_PUBLIC
+int LAGraph_MultiSourceBFS_BitParallel
+(
+    // output:
+    GrB_Matrix *level,          // level(s,i): level of node i in BFS s
+    // input:
+    const LAGraph_Graph G,
+    const GrB_Index *sources,   // source node of each BFS
+    int64_t ns,                 // number of sources
+    char *msg
+) ;
+
 //------------------------------------------------------------------------------
 // a simple example of an algorithm
 //------------------------------------------------------------------------------
@@ -0,0 +1,43 @@
+//------------------------------------------------------------------------------
+// LAGr_SingleSourceShortestPath_Parent: shortest path lengths and tree
+//------------------------------------------------------------------------------
+
+// LAGraph, (c) 2019-2022 by The LAGraph Contributors, All Rights Reserved.
+// SPDX-License-Identifier: BSD-2-Clause
+//
+// For additional details (including references to third party source code and
+// other files) see the LICENSE file or contact permission@sei.cmu.edu. See
+// Contributors.txt for a full list of contributors. Created, in part, with
+// funding and support from the U.S. Government (see Acknowledgments.txt file).
+// DM22-0790
+
+//------------------------------------------------------------------------------
+
+// Single source shortest path with delta stepping, as in
+// LAGr_SingleSourceShortestPath, but the shortest-path tree is also returned
+// in the parent vector, if not NULL on input.  The routes from the source can
+// then be found by following parent back to the source, without the O(n*m)
+// work of LAGraph_BF_full.  See LG_SingleSourceShortestPath_DeltaStepping.
+
+// This is an Advanced algorithm (G->emin is required for best performance).
+// The parent vector requires SuiteSparse:GraphBLAS.
+
+#include "LG_alg_internal.h"
+
+int LAGr_SingleSourceShortestPath_Parent
+(
+    // output:
+    GrB_Vector *path_length,    // path_length (i) is the length of the shortest
+                                // path from the source vertex to vertex i
+    GrB_Vector *parent,         // parent (i) is the node before i on the
+                                // shortest path from the source, if not NULL
+    // input:
+    const LAGraph_Graph G,      // input graph, not modified
+    GrB_Index source,           // source vertex
+    GrB_Scalar Delta,           // delta value for delta stepping
+    char *msg
+)
+{
+    return (LG_SingleSourceShortestPath_DeltaStepping (path_length, parent, G,
+        source, Delta, msg)) ;
+}
@@ -0,0 +1,94 @@
+//------------------------------------------------------------------------------
+// LAGraph_SingleSourceShortestPath: single-source shortest path, basic API
+//------------------------------------------------------------------------------
+
+// LAGraph, (c) 2019-2022 by The LAGraph Contributors, All Rights Reserved.
+// SPDX-License-Identifier: BSD-2-Clause
+//
+// For additional details (including references to third party source code and
+// other files) see the LICENSE file or contact permission@sei.cmu.edu. See
+// Contributors.txt for a full list of contributors. Created, in part, with
+// funding and support from the U.S. Government (see Acknowledgments.txt file).
+// DM22-0790
+
+//------------------------------------------------------------------------------
+
+// This is a Basic algorithm (G->emin, G->emax, and G->sssp_delta are
+// computed, if not present), and then LAGr_SingleSourceShortestPath is used,
+// with Delta taken from G->sssp_delta.
+
+// If G->sssp_delta is not known, it is chosen on this first call from a small
+// sample of sources (LG_SSSP_DELTA_TRIALS level-only BFS probes spread over
+// the nodes with out-edges, not just the source of this query), and kept in
+// G->sssp_delta so that later calls reuse it (see LG_Cached_SSSPDelta).
+// G->out_degree is computed as well, to choose the sample.  Once
+// G->sssp_delta is known, G is only read, so a graph prepared with
+// LAGraph_Freeze can be shared by many user threads with no locking.
+
+#define LG_FREE_WORK                \
+{                                   \
+    GrB_free (&Delta) ;             \
+}
+
+#define LG_FREE_ALL                 \
+{                                   \
+    LG_FREE_WORK ;                  \
+    GrB_free (path_length) ;        \
+}
+
+#include "LG_internal.h"
+
+int LAGraph_SingleSourceShortestPath
+(
+    // output:
+    GrB_Vector *path_length,    // path_length (i) is the length of the shortest
+                                // path from the source vertex to vertex i
+    // input/output:
+    LAGraph_Graph G,            // input graph; cached properties computed
+    // input:
+    GrB_Index source,           // source vertex
+    char *msg
+)
+{
+
+    //--------------------------------------------------------------------------
+    // check inputs
+    //--------------------------------------------------------------------------
+
+    LG_CLEAR_MSG ;
+    GrB_Scalar Delta = NULL ;
+    LG_ASSERT (path_length != NULL, GrB_NULL_POINTER) ;
+    (*path_length) = NULL ;
+    LG_TRY (LAGraph_CheckGraph (G, msg)) ;
+
+    GrB_Matrix A = G->A ;
+    GrB_Index n ;
+    GRB_TRY (GrB_Matrix_nrows (&n, A)) ;
+    LG_ASSERT_MSG (source < n, GrB_INVALID_INDEX, "invalid source node") ;
+
+    // compute G->emin and G->emax, if not present
+    LG_TRY (LAGraph_Cached_EMin (G, msg)) ;
+    LG_TRY (LAGraph_Cached_EMax (G, msg)) ;
+
+    //--------------------------------------------------------------------------
+    // compute G->sssp_delta, if not already known
+    //--------------------------------------------------------------------------
+
+    if (G->sssp_delta <= 0)
+    {
+        LG_TRY (LG_Cached_SSSPDelta (G, LG_SSSP_DELTA_TRIALS, msg)) ;
+    }
+    double delta = G->sssp_delta ;
+
+    //--------------------------------------------------------------------------
+    // compute the path lengths
+    //--------------------------------------------------------------------------
+
+    GRB_TRY (GrB_Scalar_new (&Delta, GrB_FP64)) ;
+    GRB_TRY (GrB_Scalar_setElement_FP64 (Delta, delta)) ;
+    LG_TRY (LAGr_SingleSourceShortestPath (path_length, G, source, Delta,
+        msg)) ;
+
+    LG_FREE_WORK ;
+    return (GrB_SUCCESS) ;
+}
@@ -19,7 +19,9 @@
 // this method to use push-pull optimization.  If not provided, this method
 // defaults to a push-only algorithm, which can be slower.  This is not
 // user-callable (see LAGr_BreadthFirstSearch instead).  G->AT and
-// G->out_degree are not computed if not present.
+// G->out_degree are not computed if not present.  The push/pull thresholds
+// are taken from G->bfs_alpha, G->bfs_beta1, and G->bfs_beta2, if known (see
+// LAGraph_Cached_BFSThresholds in LAGraphX.h).
 
 // References:
 //
@@ -156,10 +158,11 @@ int LG_BreadthFirstSearch_SSGrB
     // workspace for computing work remaining
     GRB_TRY (GrB_Vector_new (&w, GrB_INT64, n)) ;
 
+    // push/pull thresholds: use the values tuned for this graph, if known
     GrB_Index nq = 1 ;          // number of nodes in the current level
-    double alpha = 8.0 ;
-    double beta1 = 8.0 ;
-    double beta2 = 512.0 ;
+    double alpha = (G->bfs_alpha > 0) ? G->bfs_alpha :   8.0 ;
+    double beta1 = (G->bfs_beta1 > 0) ? G->bfs_beta1 :   8.0 ;
+    double beta2 = (G->bfs_beta2 > 0) ? G->bfs_beta2 : 512.0 ;
     int64_t n_over_beta1 = (int64_t) (((double) n) / beta1) ;
     int64_t n_over_beta2 = (int64_t) (((double) n) / beta2) ;
 
@@ -40,12 +40,13 @@
 // OK, and are ignored.  The values and type of A are ignored; just its
 // structure is accessed.
 
-// NOTE: This function must not be called by multiple user threads at the same
-// time on the same graph G, since it unpacks G->A and then packs it back when
-// done.  G->A is unchanged when the function returns, but during execution
-// G->A is empty.  This will be fixed once the todos are finished below, and
-// G->A will then become a truly read-only object (assuming GrB_wait (G->A)
-// has been done first).
+// G is not modified, not even temporarily, so any number of user threads may
+// call this function at the same time on the same graph G, if G->A has no
+// pending work (see LAGraph_Freeze).  The sample phase needs direct access to
+// the row pointers and column indices of G->A.  Rather than unpacking G->A
+// itself, these are taken from S, a structural copy of G->A that is iso-valued
+// and thus costs only O(n+nvals(A)) integers, and which is freed once the
+// pruned matrix T has been constructed.
 
 #define __STDC_WANT_LIB_EXT1__ 1
 #include <string.h>
@@ -184,8 +185,12 @@ static inline GrB_Info fastsv
     LAGraph_Free ((void **) &ht_count, NULL) ;  \
     LAGraph_Free ((void **) &count, NULL) ;     \
     LAGraph_Free ((void **) &range, NULL) ;     \
+    LAGraph_Free ((void **) &Sp, NULL) ;        \
+    LAGraph_Free ((void **) &Sj, NULL) ;        \
+    LAGraph_Free ((void **) &Sx, NULL) ;        \
     GrB_free (&C) ;                             \
     GrB_free (&T) ;                             \
+    GrB_free (&S) ;                             \
     GrB_free (&t) ;                             \
     GrB_free (&y) ;                             \
     GrB_free (&gp) ;                            \
@@ -207,7 +212,7 @@ int LG_CC_FastSV6           // SuiteSparse:GraphBLAS method, with GxB extensions
     // output:
     GrB_Vector *component,  // component(i)=r if node is in the component r
     // input:
-    LAGraph_Graph G,        // input graph (modified then restored)
+    const LAGraph_Graph G,  // input graph (not modified)
     char *msg
 )
 {
@@ -224,11 +229,11 @@ int LG_CC_FastSV6           // SuiteSparse:GraphBLAS method, with GxB extensions
 
     int64_t *range = NULL ;
     GrB_Index n, nvals, Cp_size = 0, *ht_key = NULL, *Px = NULL, *Cp = NULL,
-        *count = NULL, *Tp = NULL, *Tj = NULL ;
+        *count = NULL, *Tp = NULL, *Tj = NULL, *Sp = NULL, *Sj = NULL ;
     GrB_Vector parent = NULL, gp_new = NULL, mngp = NULL, gp = NULL, t = NULL,
         y = NULL ;
-    GrB_Matrix T = NULL, C = NULL ;
-    void *Tx = NULL, *Cx = NULL ;
+    GrB_Matrix T = NULL, C = NULL, S = NULL ;
+    void *Tx = NULL, *Cx = NULL, *Sx = NULL ;
     int *ht_count = NULL ;
 
     LG_TRY (LAGraph_CheckGraph (G, msg)) ;
@@ -382,14 +387,19 @@ int LG_CC_FastSV6           // SuiteSparse:GraphBLAS method, with GxB extensions
 //      C = A*diag(D)
 
         //----------------------------------------------------------------------
-        // unpack A in CSR format
+        // unpack a structural copy of A in CSR format
         //----------------------------------------------------------------------
 
-        void *Ax ;
-        GrB_Index *Ap, *Aj, Ap_size, Aj_size, Ax_size ;
-        bool A_jumbled, A_iso ;
-        GRB_TRY (GxB_Matrix_unpack_CSR (A, &Ap, &Aj, &Ax,
-            &Ap_size, &Aj_size, &Ax_size, &A_iso, &A_jumbled, NULL)) ;
+        // G->A itself is not unpacked, so that it remains valid for any other
+        // user thread that is reading it.  S is iso, so Sx has size 1.
+
+        GrB_Index Sp_size, Sj_size, Sx_size ;
+        bool A_jumbled, S_iso ;
+        LG_TRY (LAGraph_Matrix_Structure (&S, A, msg)) ;
+        GRB_TRY (GxB_Matrix_unpack_CSR (S, &Sp, &Sj, &Sx,
+            &Sp_size, &Sj_size, &Sx_size, &S_iso, &A_jumbled, NULL)) ;
+        GRB_TRY (GrB_free (&S)) ;
+        const GrB_Index *Ap = Sp, *Aj = Sj ;
 
         //----------------------------------------------------------------------
         // allocate workspace, including space to construct T
@@ -628,12 +638,12 @@ int LG_CC_FastSV6           // SuiteSparse:GraphBLAS method, with GxB extensions
         GRB_TRY (GxB_Matrix_pack_CSR (T, &Tp, &Tj, &Tx, Tp_size, Tj_size,
             Tx_size, T_iso, /* T is now jumbled */ true, NULL)) ;
 
-        // pack A (unchanged since last unpack); this is the original G->A.
-        GRB_TRY (GxB_Matrix_pack_CSR (A, &Ap, &Aj, &Ax, Ap_size, Aj_size,
-            Ax_size, A_iso, A_jumbled, NULL)) ;
+        // free the structural copy of A
+        LAGraph_Free ((void **) &Sp, NULL) ;
+        LAGraph_Free ((void **) &Sj, NULL) ;
+        LAGraph_Free ((void **) &Sx, NULL) ;
 
-// ].  The unpack/pack of A into Ap, Aj, Ax will not be needed, and G->A
-// will become truly a read-only matrix.
+// ].  The structural copy S of A will then not be needed.
 
         // final phase uses the pruned matrix T
         A = T ;
@@ -0,0 +1,581 @@
+//------------------------------------------------------------------------------
+// LG_SingleSourceShortestPath_DeltaStepping: single-source shortest path
+//------------------------------------------------------------------------------
+
+// LAGraph, (c) 2019-2022 by The LAGraph Contributors, All Rights Reserved.
+// SPDX-License-Identifier: BSD-2-Clause
+//
+// For additional details (including references to third party source code and
+// other files) see the LICENSE file or contact permission@sei.cmu.edu. See
+// Contributors.txt for a full list of contributors. Created, in part, with
+// funding and support from the U.S. Government (see Acknowledgments.txt file).
+// DM22-0790
+
+// Contributed by Jinhao Chen, Scott Kolodziej and Tim Davis, Texas A&M
+// University.  Adapted from GraphBLAS Template Library (GBTL) by Scott
+// McMillan and Tze Meng Low.
+
+//------------------------------------------------------------------------------
+
+// This is an Advanced algorithm (G->emin is required for best performance).
+
+// Single source shortest path with delta stepping.
+
+// U. Sridhar, M. Blanco, R. Mayuranath, D. G. Spampinato, T. M. Low, and
+// S. McMillan, "Delta-Stepping SSSP: From Vertices and Edges to GraphBLAS
+// Implementations," in 2019 IEEE International Parallel and Distributed
+// Processing Symposium Workshops (IPDPSW), 2019, pp. 241–250.
+// https://ieeexplore.ieee.org/document/8778222/references
+// https://arxiv.org/abs/1911.06895
+
+// LG_SingleSourceShortestPath_DeltaStepping computes the shortest path
+// lengths from the specified source vertex to all other vertices in the graph,
+// for LAGr_SingleSourceShortestPath and LAGr_SingleSourceShortestPath_Parent.
+
+// If parent is not NULL, the shortest-path tree is also computed, as a
+// GrB_INT64 vector where parent(i) is the node before i on a shortest path
+// from the source, and parent(source) = source.  If i is not reachable,
+// parent(i) is not present.  The parent of a node is updated each time its
+// path length is improved, to the node whose edge gave the improvement.  In
+// LAGraph_BF_full, this is done with a user-defined (distance, parent) tuple
+// type and a min-with-index semiring; here, built-in semirings are used
+// instead, so that the path lengths are still computed with the fast kernels
+// of the min_plus semiring.  For the frontier x and the matrix M of light or
+// heavy edges, with tReq = x'*M, each improved node j gets the parent:
+
+//      parent(j) = min { i : x(i) + M(i,j) == tReq(j) }
+
+// which is computed with the LOR_EQ and MIN_SECONDI semirings (see
+// update_parent below).  The work is on the order of the work for tReq.  The
+// parent vector requires SuiteSparse:GraphBLAS.
+
+// If the graph has negative edge weights, the method stops with the error
+// LAGRAPH_NEGATIVE_CYCLE if it finds a negative-weight cycle reachable from
+// the source.  Two tests are used, and both only find cycles that exist:
+
+// (1) Within one bucket, each pass of the light-edge loop relaxes the edges
+//     out of the nodes improved by the prior pass.  If a node is improved in
+//     pass n, it was reached by a chain of n+1 improvements, one per pass,
+//     each from the node before it.  Some node must appear twice in the chain,
+//     and since t only decreases, the closed walk between the two has a
+//     negative length.  This finds a cycle of light edges in at most n passes.
+
+// (2) Any path length below (n-1)*emin is shorter than all simple paths, so
+//     the walk that gives it contains a negative-weight cycle.  This bounds
+//     the work for cycles that span buckets, or include heavy edges.
+
+// If G->emin is not known, it is computed here (but not kept in G), unless
+// the edge weights are unsigned.  If emin >= 0, neither test is needed.
+
+// See LAGraph_SingleSourceShortestPath for a Basic algorithm that picks Delta
+// automatically.
+
+#include "LG_internal.h"
+
+//------------------------------------------------------------------------------
+// update_parent: parent(j) = the node whose edge gave the new t(j)
+//------------------------------------------------------------------------------
+
+#if LAGRAPH_SUITESPARSE
+
+#undef  LG_FREE_ALL
+#define LG_FREE_ALL         \
+{                           \
+    GrB_free (&D) ;         \
+    GrB_free (&W) ;         \
+    GrB_free (&E) ;         \
+    GrB_free (&tnew) ;      \
+    GrB_free (&pnew) ;      \
+}
+
+static int update_parent
+(
+    // input/output:
+    GrB_Vector parent,      // parent (j) is updated for each improved node j
+    // input:
+    GrB_Vector x,           // the frontier, with x (i) = t (i)
+    GrB_Matrix M,           // the light or heavy edges
+    GrB_Vector tReq,        // tReq = x'*M, with the min_plus semiring
+    GrB_Vector tless,       // tless (j) is true if t (j) is improved by tReq
+    GrB_Type etype,         // the type of t and M
+    GrB_Semiring min_plus,
+    char *msg
+)
+{
+    GrB_Matrix D = NULL, W = NULL, E = NULL ;
+    GrB_Vector tnew = NULL, pnew = NULL ;
+    GrB_Index n ;
+    GRB_TRY (GrB_Vector_size (&n, x)) ;
+
+    GrB_Semiring lor_eq ;
+    if      (etype == GrB_INT32 ) lor_eq = GxB_LOR_EQ_INT32  ;
+    else if (etype == GrB_INT64 ) lor_eq = GxB_LOR_EQ_INT64  ;
+    else if (etype == GrB_UINT32) lor_eq = GxB_LOR_EQ_UINT32 ;
+    else if (etype == GrB_UINT64) lor_eq = GxB_LOR_EQ_UINT64 ;
+    else if (etype == GrB_FP32  ) lor_eq = GxB_LOR_EQ_FP32   ;
+    else                          lor_eq = GxB_LOR_EQ_FP64   ;
+
+    // W = diag (x) min.+ M, so that W (i,j) = x (i) + M (i,j)
+    GRB_TRY (GrB_Matrix_diag (&D, x, 0)) ;
+    GRB_TRY (GrB_Matrix_new (&W, etype, n, n)) ;
+    GRB_TRY (GrB_mxm (W, NULL, NULL, min_plus, D, M, NULL)) ;
+    GRB_TRY (GrB_free (&D)) ;
+
+    // tnew<tless> = tReq, the new path lengths of the improved nodes
+    GRB_TRY (GrB_Vector_new (&tnew, etype, n)) ;
+    GRB_TRY (GrB_assign (tnew, tless, NULL, tReq, GrB_ALL, n, NULL)) ;
+
+    // E = W lor.eq diag (tnew), so E (i,j) = (x (i) + M (i,j) == tReq (j))
+    // for each improved node j, and drop the entries that are false
+    GRB_TRY (GrB_Matrix_diag (&D, tnew, 0)) ;
+    GRB_TRY (GrB_Matrix_new (&E, GrB_BOOL, n, n)) ;
+    GRB_TRY (GrB_mxm (E, NULL, NULL, lor_eq, W, D, NULL)) ;
+    GRB_TRY (GrB_select (E, NULL, NULL, GrB_VALUEEQ_BOOL, E, true, NULL)) ;
+
+    // pnew = x' min.secondi E, so pnew (j) = min { i : E (i,j) }
+    GRB_TRY (GrB_Vector_new (&pnew, GrB_INT64, n)) ;
+    GRB_TRY (GrB_vxm (pnew, NULL, NULL, GxB_MIN_SECONDI_INT64, x, E, NULL)) ;
+
+    // parent<struct(pnew)> = pnew
+    GRB_TRY (GrB_assign (parent, pnew, NULL, pnew, GrB_ALL, n, GrB_DESC_S)) ;
+
+    LG_FREE_ALL ;
+    return (GrB_SUCCESS) ;
+}
+#endif
+
+//------------------------------------------------------------------------------
+// LG_SingleSourceShortestPath_DeltaStepping
+//------------------------------------------------------------------------------
+
+#undef  LG_FREE_WORK
+#define LG_FREE_WORK        \
+{                           \
+    GrB_free (&AL) ;        \
+    GrB_free (&AH) ;        \
+    GrB_free (&uBound) ;    \
+    GrB_free (&tmasked) ;   \
+    GrB_free (&tReq) ;      \
+    GrB_free (&tless) ;     \
+    GrB_free (&s) ;         \
+    GrB_free (&reach) ;     \
+    GrB_free (&Empty) ;     \
+}
+
+#undef  LG_FREE_ALL
+#define LG_FREE_ALL         \
+{                           \
+    LG_FREE_WORK ;          \
+    GrB_free (&t) ;         \
+    GrB_free (&p) ;         \
+}
+
+#define setelement(s, k)                                                      \
+{                                                                             \
+    switch (tcode)                                                            \
+    {                                                                         \
+        default:                                                              \
+        case 0 : GrB_Scalar_setElement_INT32  (s, k * delta_int32 ) ; break ; \
+        case 1 : GrB_Scalar_setElement_INT64  (s, k * delta_int64 ) ; break ; \
+        case 2 : GrB_Scalar_setElement_UINT32 (s, k * delta_uint32) ; break ; \
+        case 3 : GrB_Scalar_setElement_UINT64 (s, k * delta_uint64) ; break ; \
+        case 4 : GrB_Scalar_setElement_FP32   (s, k * delta_fp32  ) ; break ; \
+        case 5 : GrB_Scalar_setElement_FP64   (s, k * delta_fp64  ) ; break ; \
+    }                                                                         \
+}
+
+int LG_SingleSourceShortestPath_DeltaStepping
+(
+    // output:
+    GrB_Vector *path_length,    // path_length (i) is the length of the shortest
+                                // path from the source vertex to vertex i
+    GrB_Vector *parent,         // parent (i) is the node before i on the
+                                // path, if not NULL on input
+    // input:
+    const LAGraph_Graph G,      // input graph, not modified
+    GrB_Index source,           // source vertex
+    GrB_Scalar Delta,           // delta value for delta stepping
+    char *msg
+)
+{
+
+    //--------------------------------------------------------------------------
+    // check inputs
+    //--------------------------------------------------------------------------
+
+    LG_CLEAR_MSG ;
+    GrB_Scalar uBound = NULL ;  // the threshold for GrB_select
+    GrB_Matrix AL = NULL ;      // graph containing the light weight edges
+    GrB_Matrix AH = NULL ;      // graph containing the heavy weight edges
+    GrB_Vector t = NULL ;       // tentative shortest path length
+    GrB_Vector p = NULL ;       // parent vector
+    GrB_Vector tmasked = NULL ;
+    GrB_Vector tReq = NULL ;
+    GrB_Vector tless = NULL ;
+    GrB_Vector s = NULL ;
+    GrB_Vector reach = NULL ;
+    GrB_Vector Empty = NULL ;
+
+    LG_TRY (LAGraph_CheckGraph (G, msg)) ;
+    LG_ASSERT (path_length != NULL && Delta != NULL, GrB_NULL_POINTER) ;
+    (*path_length) = NULL ;
+    bool compute_parent = (parent != NULL) ;
+    if (compute_parent)
+    {
+        (*parent) = NULL ;
+        #if !LAGRAPH_SUITESPARSE
+        LG_ASSERT_MSG (false, GrB_NOT_IMPLEMENTED,
+            "parent requires SuiteSparse:GraphBLAS") ;
+        #endif
+    }
+
+    GrB_Index nvals ;
+    LG_TRY (GrB_Scalar_nvals (&nvals, Delta)) ;
+    LG_ASSERT_MSG (nvals == 1, GrB_EMPTY_OBJECT, "Delta is missing") ;
+
+    GrB_Matrix A = G->A ;
+    GrB_Index n ;
+    GRB_TRY (GrB_Matrix_nrows (&n, A)) ;
+    LG_ASSERT_MSG (source < n, GrB_INVALID_INDEX, "invalid source node") ;
+
+    //--------------------------------------------------------------------------
+    // initializations
+    //--------------------------------------------------------------------------
+
+    // get the type of the A matrix
+    GrB_Type etype ;
+    char typename [LAGRAPH_MAX_NAME_LEN] ;
+    LG_TRY (LAGraph_Matrix_TypeName (typename, A, msg)) ;
+    LG_TRY (LAGraph_TypeFromName (&etype, typename, msg)) ;
+
+    GRB_TRY (GrB_Scalar_new (&uBound, etype)) ;
+    GRB_TRY (GrB_Vector_new (&t, etype, n)) ;
+    GRB_TRY (GrB_Vector_new (&tmasked, etype, n)) ;
+    GRB_TRY (GrB_Vector_new (&tReq, etype, n)) ;
+    GRB_TRY (GrB_Vector_new (&Empty, GrB_BOOL, n)) ;
+    GRB_TRY (GrB_Vector_new (&tless, GrB_BOOL, n)) ;
+    GRB_TRY (GrB_Vector_new (&s, GrB_BOOL, n)) ;
+    GRB_TRY (GrB_Vector_new (&reach, GrB_BOOL, n)) ;
+
+#if LAGRAPH_SUITESPARSE
+    // optional hints for SuiteSparse:GraphBLAS
+    GRB_TRY (GxB_set (t, GxB_SPARSITY_CONTROL, GxB_BITMAP)) ;
+    GRB_TRY (GxB_set (tmasked, GxB_SPARSITY_CONTROL, GxB_SPARSE)) ;
+    GRB_TRY (GxB_set (tReq, GxB_SPARSITY_CONTROL, GxB_SPARSE)) ;
+    GRB_TRY (GxB_set (tless, GxB_SPARSITY_CONTROL, GxB_SPARSE)) ;
+    GRB_TRY (GxB_set (s, GxB_SPARSITY_CONTROL, GxB_SPARSE)) ;
+    GRB_TRY (GxB_set (reach, GxB_SPARSITY_CONTROL, GxB_BITMAP)) ;
+#endif
+
+    // select the operators, and set t (:) = infinity
+    GrB_IndexUnaryOp ne, le, lt, gt ;
+    GrB_BinaryOp less_than ;
+    GrB_Semiring min_plus ;
+    int tcode ;
+    int32_t  delta_int32  ;
+    int64_t  delta_int64  ;
+    uint32_t delta_uint32 ;
+    uint64_t delta_uint64 ;
+    float    delta_fp32   ;
+    double   delta_fp64   ;
+
+    bool negative_edge_weights = true ;
+
+    if (etype == GrB_INT32)
+    {
+        GRB_TRY (GrB_Scalar_extractElement (&delta_int32, Delta)) ;
+        GRB_TRY (GrB_assign (t, NULL, NULL, (int32_t) INT32_MAX,
+            GrB_ALL, n, NULL)) ;
+        ne = GrB_VALUENE_INT32 ;
+        le = GrB_VALUELE_INT32 ;
+        lt = GrB_VALUELT_INT32 ;
+        gt = GrB_VALUEGT_INT32 ;
+        less_than = GrB_LT_INT32 ;
+        min_plus = GrB_MIN_PLUS_SEMIRING_INT32 ;
+        tcode = 0 ;
+    }
+    else if (etype == GrB_INT64)
+    {
+        GRB_TRY (GrB_Scalar_extractElement (&delta_int64, Delta)) ;
+        GRB_TRY (GrB_assign (t, NULL, NULL, (int64_t) INT64_MAX,
+            GrB_ALL, n, NULL)) ;
+        ne = GrB_VALUENE_INT64 ;
+        le = GrB_VALUELE_INT64 ;
+        lt = GrB_VALUELT_INT64 ;
+        gt = GrB_VALUEGT_INT64 ;
+        less_than = GrB_LT_INT64 ;
+        min_plus = GrB_MIN_PLUS_SEMIRING_INT64 ;
+        tcode = 1 ;
+    }
+    else if (etype == GrB_UINT32)
+    {
+        GRB_TRY (GrB_Scalar_extractElement (&delta_uint32, Delta)) ;
+        GRB_TRY (GrB_assign (t, NULL, NULL, (uint32_t) UINT32_MAX,
+            GrB_ALL, n, NULL)) ;
+        ne = GrB_VALUENE_UINT32 ;
+        le = GrB_VALUELE_UINT32 ;
+        lt = GrB_VALUELT_UINT32 ;
+        gt = GrB_VALUEGT_UINT32 ;
+        less_than = GrB_LT_UINT32 ;
+        min_plus = GrB_MIN_PLUS_SEMIRING_UINT32 ;
+        tcode = 2 ;
+        negative_edge_weights = false ;
+    }
+    else if (etype == GrB_UINT64)
+    {
+        GRB_TRY (GrB_Scalar_extractElement (&delta_uint64, Delta)) ;
+        GRB_TRY (GrB_assign (t, NULL, NULL, (uint64_t) UINT64_MAX,
+            GrB_ALL, n, NULL)) ;
+        ne = GrB_VALUENE_UINT64 ;
+        le = GrB_VALUELE_UINT64 ;
+        lt = GrB_VALUELT_UINT64 ;
+        gt = GrB_VALUEGT_UINT64 ;
+        less_than = GrB_LT_UINT64 ;
+        min_plus = GrB_MIN_PLUS_SEMIRING_UINT64 ;
+        tcode = 3 ;
+        negative_edge_weights = false ;
+    }
+    else if (etype == GrB_FP32)
+    {
+        GRB_TRY (GrB_Scalar_extractElement (&delta_fp32, Delta)) ;
+        GRB_TRY (GrB_assign (t, NULL, NULL, (float) INFINITY,
+            GrB_ALL, n, NULL)) ;
+        ne = GrB_VALUENE_FP32 ;
+        le = GrB_VALUELE_FP32 ;
+        lt = GrB_VALUELT_FP32 ;
+        gt = GrB_VALUEGT_FP32 ;
+        less_than = GrB_LT_FP32 ;
+        min_plus = GrB_MIN_PLUS_SEMIRING_FP32 ;
+        tcode = 4 ;
+    }
+    else if (etype == GrB_FP64)
+    {
+        GRB_TRY (GrB_Scalar_extractElement (&delta_fp64, Delta)) ;
+        GRB_TRY (GrB_assign (t, NULL, NULL, (double) INFINITY,
+            GrB_ALL, n, NULL)) ;
+        ne = GrB_VALUENE_FP64 ;
+        le = GrB_VALUELE_FP64 ;
+        lt = GrB_VALUELT_FP64 ;
+        gt = GrB_VALUEGT_FP64 ;
+        less_than = GrB_LT_FP64 ;
+        min_plus = GrB_MIN_PLUS_SEMIRING_FP64 ;
+        tcode = 5 ;
+    }
+    else
+    {
+        LG_ASSERT_MSG (false, GrB_NOT_IMPLEMENTED, "type not supported") ;
+    }
+
+    // check if the graph might have negative edge weights
+    double tlower = 0 ;     // lower bound on the length of all simple paths
+    if (negative_edge_weights)
+    {
+        double emin = 0 ;
+        GrB_Info info = GrB_NO_VALUE ;
+        if (G->emin != NULL &&
+            (G->emin_state == LAGraph_VALUE ||
+             G->emin_state == LAGraph_BOUND))
+        {
+            info = GrB_Scalar_extractElement_FP64 (&emin, G->emin) ;
+            GRB_TRY (info) ;
+        }
+        if (info == GrB_NO_VALUE)
+        {
+            // emin is not known; find it but do not modify G
+            GRB_TRY (GrB_reduce (&emin, NULL, GrB_MIN_MONOID_FP64, A, NULL)) ;
+        }
+        negative_edge_weights = (emin < 0) ;
+        tlower = ((double) (n-1)) * emin ;
+    }
+
+    // t (src) = 0
+    GRB_TRY (GrB_Vector_setElement (t, 0, source)) ;
+
+    // reach (src) = true
+    GRB_TRY (GrB_Vector_setElement (reach, true, source)) ;
+
+    // s (src) = true
+    GRB_TRY (GrB_Vector_setElement (s, true, source)) ;
+
+    // p (src) = src
+    if (compute_parent)
+    {
+        GRB_TRY (GrB_Vector_new (&p, GrB_INT64, n)) ;
+        GRB_TRY (GrB_Vector_setElement (p, source, source)) ;
+    }
+
+    // AL = A .* (A <= Delta)
+    GRB_TRY (GrB_Matrix_new (&AL, etype, n, n)) ;
+    GRB_TRY (GrB_select (AL, NULL, NULL, le, A, Delta, NULL)) ;
+    GRB_TRY (GrB_wait (AL, GrB_MATERIALIZE)) ;
+
+    // FUTURE: costly for some problems, taking up to 50% of the total time:
+    // AH = A .* (A > Delta)
+    GRB_TRY (GrB_Matrix_new (&AH, etype, n, n)) ;
+    GRB_TRY (GrB_select (AH, NULL, NULL, gt, A, Delta, NULL)) ;
+    GRB_TRY (GrB_wait (AH, GrB_MATERIALIZE)) ;
+
+    //--------------------------------------------------------------------------
+    // while (t >= step*Delta) not empty
+    //--------------------------------------------------------------------------
+
+    for (int64_t step = 0 ; ; step++)
+    {
+
+        //----------------------------------------------------------------------
+        // tmasked = all entries in t<reach> that are less than (step+1)*Delta
+        //----------------------------------------------------------------------
+
+        setelement (uBound, (step+1)) ;        // uBound = (step+1) * Delta
+        GRB_TRY (GrB_Vector_clear (tmasked)) ;
+
+        // tmasked<reach> = t
+        // FUTURE: this is costly, typically using Method 06s in SuiteSparse,
+        // which is a very general-purpose one.  Write a specialized kernel to
+        // exploit the fact that reach and t are bitmap and tmasked starts
+        // empty, or fuse this assignment with the GrB_select below.
+        GRB_TRY (GrB_assign (tmasked, reach, NULL, t, GrB_ALL, n, NULL)) ;
+        // tmasked = select (tmasked < (step+1)*Delta)
+        GRB_TRY (GrB_select (tmasked, NULL, NULL, lt, tmasked, uBound, NULL)) ;
+        // --- alternative:
+        // FUTURE this is slower than the above but should be much faster.
+        // GrB_select is computing a bitmap result then converting it to
+        // sparse.  t and reach are both bitmap and tmasked finally sparse.
+        // tmasked<reach> = select (t < (step+1)*Delta)
+        // GRB_TRY (GrB_select (tmasked, reach, NULL, lt, t, uBound, NULL)) ;
+
+        GrB_Index tmasked_nvals ;
+        GRB_TRY (GrB_Vector_nvals (&tmasked_nvals, tmasked)) ;
+
+        //----------------------------------------------------------------------
+        // continue while the current bucket (tmasked) is not empty
+        //----------------------------------------------------------------------
+
+        int64_t npasses = 0 ;
+        while (tmasked_nvals > 0)
+        {
+            // tReq = AL'*tmasked using the min_plus semiring
+            GRB_TRY (GrB_vxm (tReq, NULL, NULL, min_plus, tmasked, AL, NULL)) ;
+
+            // s<struct(tmasked)> = true
+            GRB_TRY (GrB_assign (s, tmasked, NULL, (bool) true, GrB_ALL, n,
+                GrB_DESC_S)) ;
+
+            // if nvals (tReq) is 0, no need to continue the rest of this loop
+            GrB_Index tReq_nvals ;
+            GRB_TRY (GrB_Vector_nvals (&tReq_nvals, tReq)) ;
+            if (tReq_nvals == 0) break ;
+            if (negative_edge_weights)
+            {
+                // test (2): tReq must not be shorter than any simple path
+                double treq_min ;
+                GRB_TRY (GrB_reduce (&treq_min, NULL, GrB_MIN_MONOID_FP64,
+                    tReq, NULL)) ;
+                LG_ASSERT_MSG (treq_min >= tlower, LAGRAPH_NEGATIVE_CYCLE,
+                    "negative-weight cycle found") ;
+            }
+
+            // tless = (tReq .< t) using set intersection
+            GRB_TRY (GrB_eWiseMult (tless, NULL, NULL, less_than, tReq, t,
+                NULL)) ;
+
+            // remove explicit zeros from tless so it can be used as a
+            // structural mask
+            GrB_Index tless_nvals ;
+            GRB_TRY (GrB_select (tless, NULL, NULL, ne, tless, 0, NULL)) ;
+            GRB_TRY (GrB_Vector_nvals (&tless_nvals, tless)) ;
+            if (tless_nvals == 0) break ;
+            // test (1): no node can be improved in pass n of this bucket
+            npasses++ ;
+            LG_ASSERT_MSG (!negative_edge_weights || npasses < (int64_t) n,
+                LAGRAPH_NEGATIVE_CYCLE, "negative-weight cycle found") ;
+
+            #if LAGRAPH_SUITESPARSE
+            if (compute_parent)
+            {
+                // p<tless> = the node in tmasked that gave each tReq
+                LG_TRY (update_parent (p, tmasked, AL, tReq, tless, etype,
+                    min_plus, msg)) ;
+            }
+            #endif
+
+            // update reachable node list/mask
+            // reach<struct(tless)> = true
+            GRB_TRY (GrB_assign (reach, tless, NULL, (bool) true, GrB_ALL, n,
+                GrB_DESC_S)) ;
+
+            // tmasked<struct(tless)> = select (tReq < (step+1)*Delta)
+            GRB_TRY (GrB_Vector_clear (tmasked)) ;
+            GRB_TRY (GrB_select (tmasked, tless, NULL, lt, tReq, uBound,
+                GrB_DESC_S)) ;
+
+            // With negative edge weights, tmasked may include nodes below
+            // step*Delta, improved after they were first done in this
+            // step or an earlier one.  They are kept, so that the
+            // improvement reaches the rest of the graph.
+
+            // t<struct(tless)> = tReq
+            GRB_TRY (GrB_assign (t, tless, NULL, tReq, GrB_ALL, n, GrB_DESC_S));
+            GRB_TRY (GrB_Vector_nvals (&tmasked_nvals, tmasked)) ;
+        }
+
+        // tmasked<s> = t
+        GRB_TRY (GrB_Vector_clear (tmasked)) ;
+        GRB_TRY (GrB_assign (tmasked, s, NULL, t, GrB_ALL, n, GrB_DESC_S)) ;
+
+        // tReq = AH'*tmasked using the min_plus semiring
+        GRB_TRY (GrB_vxm (tReq, NULL, NULL, min_plus, tmasked, AH, NULL)) ;
+        if (negative_edge_weights)
+        {
+            // test (2): tReq must not be shorter than any simple path
+            double treq_min ;
+            GRB_TRY (GrB_reduce (&treq_min, NULL, GrB_MIN_MONOID_FP64, tReq,
+                NULL)) ;
+            LG_ASSERT_MSG (treq_min >= tlower, LAGRAPH_NEGATIVE_CYCLE,
+                "negative-weight cycle found") ;
+        }
+
+        // tless = (tReq .< t) using set intersection
+        GRB_TRY (GrB_eWiseMult (tless, NULL, NULL, less_than, tReq, t, NULL)) ;
+
+        #if LAGRAPH_SUITESPARSE
+        if (compute_parent)
+        {
+            // p<tless> = the node in tmasked that gave each tReq
+            LG_TRY (update_parent (p, tmasked, AH, tReq, tless, etype,
+                min_plus, msg)) ;
+        }
+        #endif
+
+        // t<tless> = tReq, which computes t = min (t, tReq)
+        GRB_TRY (GrB_assign (t, tless, NULL, tReq, GrB_ALL, n, NULL)) ;
+
+        //----------------------------------------------------------------------
+        // find out how many left to be computed
+        //----------------------------------------------------------------------
+
+        // remove previous buckets
+        // reach<struct(s)> = Empty
+        GRB_TRY (GrB_assign (reach, s, NULL, Empty, GrB_ALL, n, GrB_DESC_S)) ;
+
+        // update reachable node list, after removing the previous buckets,
+        // since a negative heavy edge can improve a node already in s
+        // reach<tless> = true
+        GRB_TRY (GrB_assign (reach, tless, NULL, (bool) true, GrB_ALL, n,
+            NULL)) ;
+        GrB_Index nreach ;
+        GRB_TRY (GrB_Vector_nvals (&nreach, reach)) ;
+        if (nreach == 0) break ;
+
+        GRB_TRY (GrB_Vector_clear (s)) ; // clear s for the next iteration
+    }
+
+    //--------------------------------------------------------------------------
+    // free workspace and return result
+    //--------------------------------------------------------------------------
+
+    (*path_length) = t ;
+    if (compute_parent) (*parent) = p ;
+    LG_FREE_WORK ;
+    return (GrB_SUCCESS) ;
+}
@@ -45,12 +45,24 @@ int LG_BreadthFirstSearch_vanilla
     char          *msg
 ) ;
 
+int LG_SingleSourceShortestPath_DeltaStepping
+(
+    // output:
+    GrB_Vector *path_length,
+    GrB_Vector *parent,     // may be NULL
+    // input:
+    const LAGraph_Graph G,
+    GrB_Index source,
+    GrB_Scalar Delta,
+    char *msg
+) ;
+
 int LG_CC_FastSV6           // SuiteSparse:GraphBLAS method, with GxB extensions
 (
     // output:
     GrB_Vector *component,  // output: array of component identifiers
     // input:
-    LAGraph_Graph G,        // input graph (modified then restored)
+    const LAGraph_Graph G,  // input graph (not modified)
     char *msg
 ) ;
 
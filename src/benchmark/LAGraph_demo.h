@@ -19,6 +19,7 @@
 #define LAGRAPH_DEMO_H
 
 #include <LAGraph.h>
+#include <LAGraphX.h>
 #include <LG_test.h>
 
 #if defined ( __linux__ )
@@ -450,263 +451,6 @@ static inline int binwrite  // returns 0 if successful, < 0 on error
 #endif
 }
 
-//------------------------------------------------------------------------------
-// binread: read a matrix from a binary file
-//------------------------------------------------------------------------------
-
-#define FREAD(p,s,n)                    \
-{                                       \
-    if (fread (p, s, n, f) != n)        \
-    {                                   \
-        CATCH (-1001) ; /* file I/O error */ \
-    }                                   \
-}
-
-static inline int binread   // returns 0 if successful, -1 if failure
-(
-    GrB_Matrix *A,          // matrix to read from the file
-    FILE *f                 // file to read it from, already open
-)
-{
-
-    //--------------------------------------------------------------------------
-    // check inputs
-    //--------------------------------------------------------------------------
-
-    char msg [LAGRAPH_MSG_LEN] ;
-    msg [0] = '\0' ;
-
-#if !LAGRAPH_SUITESPARSE
-    printf ("SuiteSparse:GraphBLAS required to read binary *.grb files\n") ;
-    return (GrB_NOT_IMPLEMENTED) ;
-#else
-
-    GrB_Index *Ap = NULL, *Ai = NULL, *Ah = NULL ;
-    int8_t *Ab = NULL ;
-    void *Ax = NULL ;
-    if (A == NULL || f == NULL) CATCH (GrB_NULL_POINTER) ;
-    (*A) = NULL ;
-
-    //--------------------------------------------------------------------------
-    // basic matrix properties
-    //--------------------------------------------------------------------------
-
-    GxB_Format_Value fmt = -999 ;
-    bool is_hyper, is_sparse, is_bitmap, is_full ;
-    int32_t kind, typecode ;
-    double hyper = -999 ;
-    GrB_Type type ;
-    GrB_Index nrows, ncols, nvals, nvec ;
-    size_t typesize ;
-    int64_t nonempty ;
-
-    //--------------------------------------------------------------------------
-    // read the header (and ignore it)
-    //--------------------------------------------------------------------------
-
-    // The header is informational only, for "head" command, so the file can
-    // be visually inspected.
-
-    char header [LAGRAPH_BIN_HEADER] ;
-    FREAD (header, sizeof (char), LAGRAPH_BIN_HEADER) ;
-    // printf ("%s\n", header) ;
-
-    //--------------------------------------------------------------------------
-    // read the scalar content
-    //--------------------------------------------------------------------------
-
-    FREAD (&fmt,      sizeof (GxB_Format_Value), 1) ;
-    FREAD (&kind,     sizeof (int32_t), 1) ;
-    FREAD (&hyper,    sizeof (double), 1) ;
-    FREAD (&nrows,    sizeof (GrB_Index), 1) ;
-    FREAD (&ncols,    sizeof (GrB_Index), 1) ;
-    FREAD (&nonempty, sizeof (int64_t), 1) ;
-    FREAD (&nvec,     sizeof (GrB_Index), 1) ;
-    FREAD (&nvals,    sizeof (GrB_Index), 1) ;
-    FREAD (&typecode, sizeof (int32_t), 1) ;
-    FREAD (&typesize, sizeof (size_t), 1) ;
-
-    bool iso = false ;
-    if (kind > 100)
-    {
-        iso = true ;
-        kind = kind - 100 ;
-    }
-
-    is_hyper  = (kind == 1) ;
-    is_sparse = (kind == 0 || kind == GxB_SPARSE) ;
-    is_bitmap = (kind == GxB_BITMAP) ;
-    is_full   = (kind == GxB_FULL) ;
-
-    switch (typecode)
-    {
-        case 0:  type = GrB_BOOL        ; break ;
-        case 1:  type = GrB_INT8        ; break ;
-        case 2:  type = GrB_INT16       ; break ;
-        case 3:  type = GrB_INT32       ; break ;
-        case 4:  type = GrB_INT64       ; break ;
-        case 5:  type = GrB_UINT8       ; break ;
-        case 6:  type = GrB_UINT16      ; break ;
-        case 7:  type = GrB_UINT32      ; break ;
-        case 8:  type = GrB_UINT64      ; break ;
-        case 9:  type = GrB_FP32        ; break ;
-        case 10: type = GrB_FP64        ; break ;
-        #if 0
-        case 11: type = GxB_FC32        ; break ;
-        case 12: type = GxB_FC64        ; break ;
-        #endif
-        default: CATCH (GrB_NOT_IMPLEMENTED) ;    // unknown or unsupported type
-    }
-
-    //--------------------------------------------------------------------------
-    // allocate the array content
-    //--------------------------------------------------------------------------
-
-    GrB_Index Ap_len = 0, Ap_size = 0 ;
-    GrB_Index Ah_len = 0, Ah_size = 0 ;
-    GrB_Index Ab_len = 0, Ab_size = 0 ;
-    GrB_Index Ai_len = 0, Ai_size = 0 ;
-    GrB_Index Ax_len = 0, Ax_size = 0 ;
-
-    bool ok = true ;
-    if (is_hyper)
-    {
-        Ap_len = nvec+1 ;
-        Ah_len = nvec ;
-        Ai_len = nvals ;
-        Ax_len = nvals ;
-        LAGraph_Malloc ((void **) &Ap, Ap_len, sizeof (GrB_Index), msg) ;
-        LAGraph_Malloc ((void **) &Ah, Ah_len, sizeof (GrB_Index), msg) ;
-        LAGraph_Malloc ((void **) &Ai, Ai_len, sizeof (GrB_Index), msg) ;
-        Ap_size = Ap_len * sizeof (GrB_Index) ;
-        Ah_size = Ah_len * sizeof (GrB_Index) ;
-        Ai_size = Ai_len * sizeof (GrB_Index) ;
-        ok = (Ap != NULL && Ah != NULL && Ai != NULL) ;
-    }
-    else if (is_sparse)
-    {
-        Ap_len = nvec+1 ;
-        Ai_len = nvals ;
-        Ax_len = nvals ;
-        LAGraph_Malloc ((void **) &Ap, Ap_len, sizeof (GrB_Index), msg) ;
-        LAGraph_Malloc ((void **) &Ai, Ai_len, sizeof (GrB_Index), msg) ;
-        Ap_size = Ap_len * sizeof (GrB_Index) ;
-        Ai_size = Ai_len * sizeof (GrB_Index) ;
-        ok = (Ap != NULL && Ai != NULL) ;
-    }
-    else if (is_bitmap)
-    {
-        Ab_len = nrows*ncols ;
-        Ax_len = nrows*ncols ;
-        LAGraph_Malloc ((void **) &Ab, nrows*ncols, sizeof (int8_t), msg) ;
-        Ab_size = Ab_len * sizeof (GrB_Index) ;
-        ok = (Ab != NULL) ;
-    }
-    else if (is_full)
-    {
-        Ax_len = nrows*ncols ;
-    }
-    else
-    {
-        CATCH (DEAD_CODE) ;    // this "cannot" happen
-    }
-    LAGraph_Malloc ((void **) &Ax, iso ? 1 : Ax_len, typesize, msg) ;
-    Ax_size = (iso ? 1 : Ax_len) * typesize ;
-    ok = ok && (Ax != NULL) ;
-    if (!ok) CATCH (GrB_OUT_OF_MEMORY) ;        // out of memory
-
-    //--------------------------------------------------------------------------
-    // read the array content
-    //--------------------------------------------------------------------------
-
-    if (is_hyper)
-    {
-        FREAD (Ap, sizeof (GrB_Index), Ap_len) ;
-        FREAD (Ah, sizeof (GrB_Index), Ah_len) ;
-        FREAD (Ai, sizeof (GrB_Index), Ai_len) ;
-    }
-    else if (is_sparse)
-    {
-        FREAD (Ap, sizeof (GrB_Index), Ap_len) ;
-        FREAD (Ai, sizeof (GrB_Index), Ai_len) ;
-    }
-    else if (is_bitmap)
-    {
-        FREAD (Ab, sizeof (int8_t), Ab_len) ;
-    }
-
-    FREAD (Ax, typesize, (iso ? 1 : Ax_len)) ;
-
-    //--------------------------------------------------------------------------
-    // import the matrix
-    //--------------------------------------------------------------------------
-
-    if (fmt == GxB_BY_COL && is_hyper)
-    {
-        // hypersparse CSC
-        GRB_TRY (GxB_Matrix_import_HyperCSC (A, type, nrows, ncols,
-            &Ap, &Ah, &Ai, &Ax, Ap_size, Ah_size, Ai_size, Ax_size,
-            iso, nvec, false, NULL)) ;
-    }
-    else if (fmt == GxB_BY_ROW && is_hyper)
-    {
-        // hypersparse CSR
-        GRB_TRY (GxB_Matrix_import_HyperCSR (A, type, nrows, ncols,
-            &Ap, &Ah, &Ai, &Ax, Ap_size, Ah_size, Ai_size, Ax_size,
-            iso, nvec, false, NULL)) ;
-    }
-    else if (fmt == GxB_BY_COL && is_sparse)
-    {
-        // standard CSC
-        GRB_TRY (GxB_Matrix_import_CSC (A, type, nrows, ncols,
-            &Ap, &Ai, &Ax, Ap_size, Ai_size, Ax_size,
-            iso, false, NULL)) ;
-    }
-    else if (fmt == GxB_BY_ROW && is_sparse)
-    {
-        // standard CSR
-        GRB_TRY (GxB_Matrix_import_CSR (A, type, nrows, ncols,
-            &Ap, &Ai, &Ax, Ap_size, Ai_size, Ax_size,
-            iso, false, NULL)) ;
-    }
-    else if (fmt == GxB_BY_COL && is_bitmap)
-    {
-        // bitmap by col
-        GRB_TRY (GxB_Matrix_import_BitmapC (A, type, nrows, ncols,
-            &Ab, &Ax, Ab_size, Ax_size,
-            iso, nvals, NULL)) ;
-    }
-    else if (fmt == GxB_BY_ROW && is_bitmap)
-    {
-        // bitmap by row
-        GRB_TRY (GxB_Matrix_import_BitmapR (A, type, nrows, ncols,
-            &Ab, &Ax, Ab_size, Ax_size,
-            iso, nvals, NULL)) ;
-    }
-    else if (fmt == GxB_BY_COL && is_full)
-    {
-        // full by col
-        GRB_TRY (GxB_Matrix_import_FullC (A, type, nrows, ncols,
-            &Ax, Ax_size,
-            iso, NULL)) ;
-    }
-    else if (fmt == GxB_BY_ROW && is_full)
-    {
-        // full by row
-        GRB_TRY (GxB_Matrix_import_FullR (A, type, nrows, ncols,
-            &Ax, Ax_size,
-            iso, NULL)) ;
-    }
-    else
-    {
-        CATCH (DEAD_CODE) ;    // this "cannot" happen
-    }
-
-    GRB_TRY (GxB_set (*A, GxB_HYPER_SWITCH, hyper)) ;
-    return (GrB_SUCCESS) ;
-#endif
-}
-
 //------------------------------------------------------------------------------
 // readproblem: read a GAP problem from a file
 //------------------------------------------------------------------------------
@@ -775,13 +519,23 @@ static int readproblem          // returns 0 if successful, -1 if failure
         // Usage:
         //      ./test_whatever matrixfile.mtx [sources.mtx]
         //      ./test_whatever matrixfile.grb [sources.mtx]
+        // Either file may also be compressed with gzip or zstd, as in
+        // matrixfile.mtx.gz or matrixfile.grb.zst.
 
         // read in the file in Matrix Market format from the input file
         char *filename = argv [1] ;
         printf ("matrix: %s\n", filename) ;
 
-        // find the filename extension
+        // find the filename extension, skipping any .gz or .zst suffix
         size_t len = strlen (filename) ;
+        if (len > 3 && strcmp (filename + len - 3, ".gz") == 0)
+        {
+            len -= 3 ;
+        }
+        else if (len > 4 && strcmp (filename + len - 4, ".zst") == 0)
+        {
+            len -= 4 ;
+        }
         char *ext = NULL ;
         for (int k = len-1 ; k >= 0 ; k--)
         {
@@ -798,15 +552,14 @@ static int readproblem          // returns 0 if successful, -1 if failure
         if (is_binary)
         {
             printf ("Reading binary file: %s\n", filename) ;
-            f = fopen (filename, "r") ;
-            if (f == NULL)
+            int result = LAGraph_BinRead (&A, filename, msg) ;
+            if (result != GrB_SUCCESS)
             {
-                printf ("Binary file not found: [%s]\n", filename) ;
-                exit (1) ;
+                printf ("LAGraph_BinRead failed to read matrix: %s\n",
+                    filename) ;
+                printf ("result: %d msg: %s\n", result, msg) ;
             }
-            if (binread (&A, f) < 0) CATCH (-1001) ;    // file I/O error
-            fclose (f) ;
-            f = NULL ;
+            LAGRAPH_TRY (result) ;
         }
         else
         {
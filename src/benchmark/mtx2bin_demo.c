@@ -1,5 +1,5 @@
 //------------------------------------------------------------------------------
-// LAGraph/src/benchmark/mtx2bin_demo.c: convert Matrix Market file to SS:GrB binary file
+// LAGraph/src/benchmark/mtx2bin_demo.c: convert Matrix Market file to *.grb or *.lagraph
 //------------------------------------------------------------------------------
 
 // LAGraph, (c) 2019-2022 by The LAGraph Contributors, All Rights Reserved.
@@ -12,28 +12,35 @@
 // DM22-0790
 
 // Contributed by Timothy A. Davis, Texas A&M University
-
 //------------------------------------------------------------------------------
 
 // usage:
-// mtx2bin infile.mtx outfile.grb
+// mtx2bin infile.mtx outfile.grb [options]
+// mtx2bin infile.mtx outfile.lagraph [options]
+//
+// options:
+//  -s          make the matrix symmetric (A = A+A' if A is unsymmetric)
+//  -n          remove self-edges
+//  -b          convert the matrix to boolean, with all entries true
+//  -t type     typecast the matrix to the type (int32_t, double, ...)
+//
+// The matrix is converted with LAGraph_MMConvert, which never holds two copies
+// of the matrix in memory, except with -s for a file stored as "general"
+// (where A' is constructed to check if A is symmetric).  The input file may
+// be compressed with gzip or zstd.
 
 #include "LAGraph_demo.h"
 
-#define LG_FREE_ALL                 \
-{                                   \
-    GrB_free (&A) ;                 \
-}
+#define LG_FREE_ALL ;
 
 int main (int argc, char **argv)
 {
-    GrB_Info info ;
-    GrB_Matrix A = NULL ;
     char msg [LAGRAPH_MSG_LEN] ;
 
     if (argc < 3)
     {
-        printf ("Usage: mxt2bin infile.mtx outfile.grb\n") ;
+        printf ("Usage: mtx2bin infile.mtx outfile.grb [-s] [-n] [-b] "
+            "[-t type]\n") ;
         exit (1) ;
     }
 
@@ -45,45 +52,37 @@ int main (int argc, char **argv)
     demo_init (burble) ;
 
     //--------------------------------------------------------------------------
-    // read matrix from input file
+    // get the options
     //--------------------------------------------------------------------------
 
-    double t_read = LAGraph_WallClockTime ( ) ;
-
-    // read in the file in Matrix Market format from the input file
-    FILE *f = fopen (argv [1], "r") ;
-    if (f == NULL)
+    bool make_symmetric = false, remove_self_edges = false, structural = false ;
+    GrB_Type pref = NULL ;
+    for (int k = 3 ; k < argc ; k++)
     {
-        printf ("Matrix file not found: [%s]\n", argv [1]) ;
-        exit (1) ;
+        if      (strcmp (argv [k], "-s") == 0) make_symmetric = true ;
+        else if (strcmp (argv [k], "-n") == 0) remove_self_edges = true ;
+        else if (strcmp (argv [k], "-b") == 0) structural = true ;
+        else if (strcmp (argv [k], "-t") == 0 && k+1 < argc)
+        {
+            LAGRAPH_TRY (LAGraph_TypeFromName (&pref, argv [++k], msg)) ;
+        }
+        else
+        {
+            printf ("Unknown option: [%s]\n", argv [k]) ;
+            exit (1) ;
+        }
     }
-    LAGRAPH_TRY (LAGraph_MMRead (&A, f, msg)) ;
-    fclose (f) ;
-
-    GRB_TRY (GrB_wait (A, GrB_MATERIALIZE)) ;
-
-    t_read = LAGraph_WallClockTime ( ) - t_read ;
-    printf ("read time: %g sec\n", t_read) ;
 
     //--------------------------------------------------------------------------
-    // write to output file
+    // convert the file
     //--------------------------------------------------------------------------
 
-    double t_binwrite = LAGraph_WallClockTime ( ) ;
-    f = fopen (argv [2], "w") ;
-    if (f == NULL)
-    {
-        printf ("Unable to open binary output file: [%s]\n", argv [2]) ;
-        exit (1) ;
-    }
-    if (binwrite (&A, f, argv [1]) != 0)
-    {
-        printf ("Unable to create binary file\n") ;
-        exit (1) ;
-    }
-    t_binwrite = LAGraph_WallClockTime ( ) - t_binwrite ;
-    printf ("binary write time: %g sec\n", t_binwrite) ;
+    double t = LAGraph_WallClockTime ( ) ;
+    LAGRAPH_TRY (LAGraph_MMConvert (argv [2], argv [1], make_symmetric,
+        remove_self_edges, structural, pref, msg)) ;
+    t = LAGraph_WallClockTime ( ) - t ;
+    printf ("convert time: %g sec\n", t) ;
 
-    LG_FREE_ALL ;
+    LAGRAPH_TRY (LAGraph_Finalize (msg)) ;
     return (GrB_SUCCESS) ;
 }
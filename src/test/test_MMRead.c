@@ -763,6 +763,268 @@ void test_array_pattern ( )
     OK (LG_brutal_teardown (msg)) ;
 }
 
+//------------------------------------------------------------------------------
+// test_MMRead_blocks: read a large file in parallel, in multiple chunks
+//------------------------------------------------------------------------------
+
+void test_MMRead_blocks (void)
+{
+
+    //--------------------------------------------------------------------------
+    // start up the test
+    //--------------------------------------------------------------------------
+
+    OK (LAGraph_Init (msg)) ;
+    int save_nthreads_outer, save_nthreads_inner ;
+    OK (LAGraph_GetNumThreads (&save_nthreads_outer, &save_nthreads_inner,
+        msg)) ;
+    OK (LAGraph_SetNumThreads (1, 4, msg)) ;
+
+    //--------------------------------------------------------------------------
+    // write a symmetric matrix, with comments and blank lines between entries
+    //--------------------------------------------------------------------------
+
+    // The file is large enough to be split into several chunks.  Lines end
+    // with CR/LF, and the last line has no newline.
+
+    #define N 1000
+    #define NTRIPLETS 40000
+    FILE *f = tmpfile ( ) ;
+    TEST_CHECK (f != NULL) ;
+    fprintf (f, "%%%%MatrixMarket matrix coordinate real symmetric\r\n") ;
+    fprintf (f, "%% a symmetric test matrix\r\n") ;
+    fprintf (f, "%d %d %d\r\n", N, N, NTRIPLETS) ;
+    OK (GrB_Matrix_new (&A, GrB_FP64, N, N)) ;
+    int64_t k = 0 ;
+    for (int64_t j = 0 ; j < N && k < NTRIPLETS ; j++)
+    {
+        for (int64_t i = j ; i < N && k < NTRIPLETS ; i += 13, k++)
+        {
+            double x = (i == j) ? (double) i : ((double) (i - j) / 8.0) ;
+            if (k % 1000 == 0) fprintf (f, "%% comment %" PRId64 "\r\n", k) ;
+            if (k % 3001 == 0) fprintf (f, "\r\n") ;
+            fprintf (f, "%" PRId64 " %" PRId64 " %.17g%s", i+1, j+1, x,
+                (k == NTRIPLETS-1) ? "" : "\r\n") ;
+            OK (GrB_Matrix_setElement_FP64 (A, x, i, j)) ;
+            OK (GrB_Matrix_setElement_FP64 (A, x, j, i)) ;
+        }
+    }
+    TEST_CHECK (k == NTRIPLETS) ;
+
+    //--------------------------------------------------------------------------
+    // read it back in and compare
+    //--------------------------------------------------------------------------
+
+    rewind (f) ;
+    OK (LAGraph_MMRead (&B, f, msg)) ;
+    OK (fclose (f)) ;       // close and delete the temporary file
+    bool ok ;
+    OK (LAGraph_Matrix_IsEqual (&ok, A, B, msg)) ;
+    TEST_CHECK (ok) ;
+    TEST_MSG ("Failed test for equality, large symmetric matrix\n") ;
+    OK (GrB_free (&B)) ;
+
+    //--------------------------------------------------------------------------
+    // an invalid entry in a later chunk is reported with its line number
+    //--------------------------------------------------------------------------
+
+    f = tmpfile ( ) ;
+    TEST_CHECK (f != NULL) ;
+    fprintf (f, "%%%%MatrixMarket matrix coordinate real general\n") ;
+    fprintf (f, "%d %d %d\n", N, N, NTRIPLETS) ;
+    for (k = 0 ; k < NTRIPLETS ; k++)
+    {
+        if (k == 30000)
+        {
+            fprintf (f, "1 %d 3\n", N+1) ;
+        }
+        else
+        {
+            fprintf (f, "%" PRId64 " %" PRId64 " 1.5\n", (k % N) + 1,
+                (k / N) + 1) ;
+        }
+    }
+    rewind (f) ;
+    int result = LAGraph_MMRead (&B, f, msg) ;
+    OK (fclose (f)) ;
+    TEST_CHECK (result == GrB_INDEX_OUT_OF_BOUNDS) ;
+    TEST_CHECK (B == NULL) ;
+    TEST_CHECK (strstr (msg, "line 30003 of input file") != NULL) ;
+    printf ("\nexpected error: %s\n", msg) ;
+
+    //--------------------------------------------------------------------------
+    // finish the test
+    //--------------------------------------------------------------------------
+
+    OK (GrB_free (&A)) ;
+    OK (LAGraph_SetNumThreads (save_nthreads_outer, save_nthreads_inner,
+        msg)) ;
+    OK (LAGraph_Finalize (msg)) ;
+}
+
+//-----------------------------------------------------------------------------
+// test_MMWrite_blocks: write a large matrix in parallel
+//-----------------------------------------------------------------------------
+
+// The matrix has enough entries that LAGraph_MMWrite formats them in several
+// rounds.  The file must be the same for any number of threads.
+
+static char *write_to_string (GrB_Matrix A, int nthreads, long *len)
+{
+    OK (LAGraph_SetNumThreads (1, nthreads, msg)) ;
+    FILE *f = tmpfile ( ) ;
+    TEST_CHECK (f != NULL) ;
+    OK (LAGraph_MMWrite (A, f, NULL, msg)) ;
+    (*len) = ftell (f) ;
+    char *s = malloc ((*len) + 1) ;
+    TEST_CHECK (s != NULL) ;
+    rewind (f) ;
+    TEST_CHECK (fread (s, 1, (*len), f) == (size_t) (*len)) ;
+    s [*len] = '\0' ;
+    OK (fclose (f)) ;
+    return (s) ;
+}
+
+void test_MMWrite_blocks (void)
+{
+
+    //--------------------------------------------------------------------------
+    // start up the test
+    //--------------------------------------------------------------------------
+
+    OK (LAGraph_Init (msg)) ;
+    int save_nthreads_outer, save_nthreads_inner ;
+    OK (LAGraph_GetNumThreads (&save_nthreads_outer, &save_nthreads_inner,
+        msg)) ;
+
+    //--------------------------------------------------------------------------
+    // create a large unsymmetric matrix, with integer and fractional values
+    //--------------------------------------------------------------------------
+
+    #define NW 600
+    OK (GrB_Matrix_new (&A, GrB_FP64, NW, NW)) ;
+    for (int64_t i = 0 ; i < NW ; i++)
+    {
+        for (int64_t j = 0 ; j < NW ; j++)
+        {
+            if (i == 0 && j == 0) continue ;
+            double x = (i % 3 == 0) ? ((double) (i * NW + j)) :
+                ((double) (i - j) / 64.0 + 1e-3 * j) ;
+            OK (GrB_Matrix_setElement_FP64 (A, x, i, j)) ;
+        }
+    }
+
+    //--------------------------------------------------------------------------
+    // write it with 1 and 4 threads, and compare
+    //--------------------------------------------------------------------------
+
+    long len1, len4 ;
+    char *s1 = write_to_string (A, 1, &len1) ;
+    char *s4 = write_to_string (A, 4, &len4) ;
+    TEST_CHECK (len1 == len4) ;
+    TEST_CHECK (memcmp (s1, s4, len1) == 0) ;
+    TEST_MSG ("Files differ for 1 and 4 threads\n") ;
+
+    //--------------------------------------------------------------------------
+    // read it back in and compare
+    //--------------------------------------------------------------------------
+
+    FILE *f = tmpfile ( ) ;
+    TEST_CHECK (f != NULL) ;
+    TEST_CHECK (fwrite (s4, 1, len4, f) == (size_t) len4) ;
+    rewind (f) ;
+    OK (LAGraph_MMRead (&B, f, msg)) ;
+    OK (fclose (f)) ;
+    bool ok ;
+    OK (LAGraph_Matrix_IsEqual (&ok, A, B, msg)) ;
+    TEST_CHECK (ok) ;
+    TEST_MSG ("Failed test for equality, large matrix\n") ;
+
+    //--------------------------------------------------------------------------
+    // finish the test
+    //--------------------------------------------------------------------------
+
+    free (s1) ;
+    free (s4) ;
+    OK (GrB_free (&A)) ;
+    OK (GrB_free (&B)) ;
+    OK (LAGraph_SetNumThreads (save_nthreads_outer, save_nthreads_inner,
+        msg)) ;
+    OK (LAGraph_Finalize (msg)) ;
+}
+
+//-----------------------------------------------------------------------------
+// test_MMRead_compressed: read a gzip-compressed file
+//-----------------------------------------------------------------------------
+
+// small_gz holds a 4-by-4 matrix in Matrix Market format, compressed as two
+// concatenated gzip members (the second holds the last two entries).  If
+// LAGraph was compiled without zlib, LAGraph_MMRead returns
+// GrB_NOT_IMPLEMENTED.
+
+static const uint8_t small_gz [142] =
+{
+    0x1f, 0x8b, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x03, 0x2d, 0x8b,
+    0x3b, 0x0a, 0x80, 0x30, 0x10, 0x05, 0xfb, 0x3d, 0xc5, 0x6b, 0x52, 0x1a,
+    0x30, 0x26, 0xc7, 0xc8, 0x21, 0x16, 0x5d, 0x24, 0x98, 0x8f, 0x6c, 0x52,
+    0x78, 0x7c, 0x83, 0xc8, 0x2b, 0x86, 0x81, 0x79, 0xc6, 0x44, 0x1e, 0x9a,
+    0x9e, 0xc8, 0x7a, 0xc9, 0x40, 0xf9, 0x04, 0x7b, 0x6b, 0x7a, 0xa4, 0xca,
+    0x43, 0xa0, 0xc2, 0x19, 0xa7, 0x54, 0x51, 0xce, 0x64, 0xc0, 0xe8, 0x85,
+    0x73, 0x9e, 0x45, 0xb9, 0x55, 0x7a, 0x97, 0xe3, 0xff, 0x90, 0x87, 0x47,
+    0xa0, 0x15, 0x73, 0x36, 0x90, 0x9b, 0x5c, 0x1c, 0x6d, 0x70, 0xf0, 0xd6,
+    0x05, 0x7a, 0x01, 0x22, 0x57, 0x8a, 0x95, 0x68, 0x00, 0x00, 0x00, 0x1f,
+    0x8b, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x03, 0x33, 0x51, 0x30,
+    0x56, 0xb0, 0xe0, 0x32, 0x51, 0x30, 0x51, 0x30, 0x4c, 0xd5, 0x35, 0xe6,
+    0x02, 0x00, 0x61, 0x67, 0xdc, 0x1e, 0x0f, 0x00, 0x00, 0x00,
+} ;
+
+void test_MMRead_compressed (void)
+{
+    OK (LAGraph_Init (msg)) ;
+
+    // the matrix held in small_gz
+    OK (GrB_Matrix_new (&A, GrB_FP64, 4, 4)) ;
+    OK (GrB_Matrix_setElement_FP64 (A,  1.5,  0, 0)) ;
+    OK (GrB_Matrix_setElement_FP64 (A, -2,    1, 0)) ;
+    OK (GrB_Matrix_setElement_FP64 (A,  4.25, 2, 1)) ;
+    OK (GrB_Matrix_setElement_FP64 (A,  8,    3, 2)) ;
+    OK (GrB_Matrix_setElement_FP64 (A,  1e-3, 3, 3)) ;
+
+    // read the entire compressed file
+    FILE *f = tmpfile ( ) ;
+    TEST_CHECK (f != NULL) ;
+    TEST_CHECK (fwrite (small_gz, 1, 142, f) == 142) ;
+    rewind (f) ;
+    int result = LAGraph_MMRead (&B, f, msg) ;
+    OK (fclose (f)) ;
+    printf ("\ncompressed file: result %d msg: %s\n", result, msg) ;
+    TEST_CHECK (result == GrB_SUCCESS || result == GrB_NOT_IMPLEMENTED) ;
+    bool have_zlib = (result == GrB_SUCCESS) ;
+    if (have_zlib)
+    {
+        bool ok ;
+        OK (LAGraph_Matrix_IsEqual (&ok, A, B, msg)) ;
+        TEST_CHECK (ok) ;
+        TEST_MSG ("Failed test for equality, compressed file\n") ;
+        OK (GrB_free (&B)) ;
+    }
+
+    // read a truncated compressed file
+    f = tmpfile ( ) ;
+    TEST_CHECK (f != NULL) ;
+    TEST_CHECK (fwrite (small_gz, 1, 60, f) == 60) ;
+    rewind (f) ;
+    result = LAGraph_MMRead (&B, f, msg) ;
+    OK (fclose (f)) ;
+    printf ("truncated file: result %d msg: %s\n", result, msg) ;
+    TEST_CHECK (result ==
+        (have_zlib ? LAGRAPH_IO_ERROR : GrB_NOT_IMPLEMENTED)) ;
+    TEST_CHECK (B == NULL) ;
+
+    OK (GrB_free (&A)) ;
+    OK (LAGraph_Finalize (msg)) ;
+}
+
 //-----------------------------------------------------------------------------
 // TEST_LIST: the list of tasks for this entire test
 //-----------------------------------------------------------------------------
@@ -779,5 +1041,8 @@ TEST_LIST =
     { "MMReadWrite_brutal", test_MMReadWrite_brutal },
     #endif
     { "array_pattern", test_array_pattern },
+    { "MMRead_blocks", test_MMRead_blocks },
+    { "MMWrite_blocks", test_MMWrite_blocks },
+    { "MMRead_compressed", test_MMRead_compressed },
     { NULL, NULL }
 } ;
@@ -305,6 +305,278 @@ void test_SingleSourceShortestPath_types (void)
     LAGraph_Finalize (msg) ;
 }
 
+//------------------------------------------------------------------------------
+// test_SingleSourceShortestPath_Basic
+//------------------------------------------------------------------------------
+
+void test_SingleSourceShortestPath_Basic (void)
+{
+    LAGraph_Init (msg) ;
+    GrB_Matrix A = NULL, T = NULL ;
+
+    for (int k = 0 ; ; k++)
+    {
+
+        // load the adjacency matrix as A
+        const char *aname = files [k].name ;
+        if (strlen (aname) == 0) break;
+        TEST_CASE (aname) ;
+        printf ("\nMatrix: %s\n", aname) ;
+        snprintf (filename, LEN, LG_DATA_DIR "%s", aname) ;
+        FILE *f = fopen (filename, "r") ;
+        TEST_CHECK (f != NULL) ;
+        OK (LAGraph_MMRead (&A, f, msg)) ;
+        OK (fclose (f)) ;
+        TEST_MSG ("Loading of adjacency matrix failed") ;
+
+        GrB_Index n = 0 ;
+        OK (GrB_Matrix_nrows (&n, A)) ;
+
+        // T = max (abs (double (A)), 0.1)
+        OK (GrB_Matrix_new (&T, GrB_FP64, n, n)) ;
+        OK (GrB_apply (T, NULL, NULL, GrB_ABS_FP64, A, NULL)) ;
+        OK (GrB_apply (T, NULL, NULL, GrB_MAX_FP64, T, 0.1, NULL)) ;
+        OK (GrB_free (&A)) ;
+        A = T ;
+
+        // create the graph
+        OK (LAGraph_New (&G, &A, LAGraph_ADJACENCY_DIRECTED, msg)) ;
+        OK (LAGraph_CheckGraph (G, msg)) ;
+        TEST_CHECK (G->sssp_delta == LAGRAPH_UNKNOWN) ;
+
+        // run the SSSP, with Delta chosen on the first call, or given by the
+        // user in G->sssp_delta
+        GrB_Vector path_length = NULL ;
+        int64_t step = (n > 100) ? (3*n/4) : ((n/4) + 1) ;
+        double delta = LAGRAPH_UNKNOWN ;
+        for (int trial = 0 ; trial < 2 ; trial++)
+        {
+            for (int64_t src = 0 ; src < n ; src += step)
+            {
+                OK (LAGraph_SingleSourceShortestPath (&path_length, G, src,
+                    msg)) ;
+                int res = LG_check_sssp (path_length, G, src, msg) ;
+                if (res != GrB_SUCCESS) printf ("res: %d msg: %s\n", res, msg);
+                OK (res) ;
+                OK (GrB_free (&path_length)) ;
+                TEST_CHECK (G->emin != NULL) ;
+                TEST_CHECK (G->emax != NULL) ;
+                // G->sssp_delta is set on the first call, and then reused
+                TEST_CHECK (G->sssp_delta > 0) ;
+                if (delta <= 0) delta = G->sssp_delta ;
+                TEST_CHECK (G->sssp_delta == delta) ;
+            }
+            G->sssp_delta = 0.5 ;
+            delta = 0.5 ;
+        }
+
+        // Delta is a cached property
+        OK (LAGraph_DeleteCached (G, msg)) ;
+        TEST_CHECK (G->sssp_delta == LAGRAPH_UNKNOWN) ;
+
+        OK (LAGraph_Delete (&G, msg)) ;
+    }
+
+    LAGraph_Finalize (msg) ;
+}
+
+//------------------------------------------------------------------------------
+// test_SingleSourceShortestPath_negative
+//------------------------------------------------------------------------------
+
+void test_SingleSourceShortestPath_negative (void)
+{
+    LAGraph_Init (msg) ;
+    GrB_Matrix A = NULL ;
+    GrB_Vector path_length = NULL ;
+    GrB_Scalar Delta = NULL ;
+    OK (GrB_Scalar_new (&Delta, GrB_INT32)) ;
+
+    // no negative cycle, but node 1 is improved by the negative edge (2,1)
+    // after its edge to node 3 has been relaxed
+    GrB_Index I1 [4] = { 0, 0, 2, 1 } ;
+    GrB_Index J1 [4] = { 1, 2, 1, 3 } ;
+    int32_t   X1 [4] = { 1, 2, -5, 1 } ;
+    int32_t result [4] = { 0, -3, 2, -2 } ;
+
+    // the cycle 1->2->1 has length -1, and node 3 cannot reach it
+    GrB_Index I2 [4] = { 0, 1, 2, 0 } ;
+    GrB_Index J2 [4] = { 1, 2, 1, 3 } ;
+    int32_t   X2 [4] = { 1, -3, 2, 1 } ;
+
+    // with Delta = 30, all edges are light; with Delta = 1, some are heavy
+    int32_t Deltas [2] = { 30, 1 } ;
+    for (int kk = 0 ; kk < 2 ; kk++)
+    {
+        OK (GrB_Scalar_setElement (Delta, Deltas [kk])) ;
+
+        OK (GrB_Matrix_new (&A, GrB_INT32, 4, 4)) ;
+        OK (GrB_Matrix_build (A, I1, J1, X1, 4, GrB_PLUS_INT32)) ;
+        OK (LAGraph_New (&G, &A, LAGraph_ADJACENCY_DIRECTED, msg)) ;
+        OK (LAGr_SingleSourceShortestPath (&path_length, G, 0, Delta, msg)) ;
+        for (int i = 0 ; i < 4 ; i++)
+        {
+            int32_t len = 0 ;
+            OK (GrB_Vector_extractElement (&len, path_length, i)) ;
+            TEST_CHECK (len == result [i]) ;
+        }
+        OK (GrB_free (&path_length)) ;
+        OK (LAGraph_Delete (&G, msg)) ;
+
+        OK (GrB_Matrix_new (&A, GrB_INT32, 4, 4)) ;
+        OK (GrB_Matrix_build (A, I2, J2, X2, 4, GrB_PLUS_INT32)) ;
+        OK (LAGraph_New (&G, &A, LAGraph_ADJACENCY_DIRECTED, msg)) ;
+        int status = LAGr_SingleSourceShortestPath (&path_length, G, 0,
+            Delta, msg) ;
+        printf ("\ndelta %d status: %d msg: %s\n", Deltas [kk], status, msg) ;
+        TEST_CHECK (status == LAGRAPH_NEGATIVE_CYCLE) ;
+        TEST_CHECK (path_length == NULL) ;
+        OK (LAGr_SingleSourceShortestPath (&path_length, G, 3, Delta, msg)) ;
+        OK (GrB_free (&path_length)) ;
+        OK (LAGraph_Delete (&G, msg)) ;
+    }
+
+    OK (GrB_free (&Delta)) ;
+    LAGraph_Finalize (msg) ;
+}
+
+//------------------------------------------------------------------------------
+// test_SingleSourceShortestPath_parent
+//------------------------------------------------------------------------------
+
+#if LAGRAPH_SUITESPARSE
+void test_SingleSourceShortestPath_parent (void)
+{
+    LAGraph_Init (msg) ;
+    GrB_Matrix A = NULL, T = NULL ;
+    GrB_Vector path_length = NULL, parent = NULL ;
+    GrB_Scalar Delta = NULL ;
+    OK (GrB_Scalar_new (&Delta, GrB_INT32)) ;
+
+    for (int k = 0 ; ; k++)
+    {
+
+        // load the adjacency matrix as A
+        const char *aname = files [k].name ;
+        if (strlen (aname) == 0) break;
+        TEST_CASE (aname) ;
+        printf ("\nMatrix: %s\n", aname) ;
+        snprintf (filename, LEN, LG_DATA_DIR "%s", aname) ;
+        FILE *f = fopen (filename, "r") ;
+        TEST_CHECK (f != NULL) ;
+        OK (LAGraph_MMRead (&A, f, msg)) ;
+        OK (fclose (f)) ;
+        TEST_MSG ("Loading of adjacency matrix failed") ;
+
+        GrB_Index n = 0 ;
+        OK (GrB_Matrix_nrows (&n, A)) ;
+
+        // convert A to int32, with entries in the range 1 to 255
+        OK (LAGraph_Matrix_TypeName (atype_name, A, msg)) ;
+        if (!MATCHNAME (atype_name, "int32_t"))
+        {
+            OK (GrB_Matrix_new (&T, GrB_INT32, n, n)) ;
+            OK (GrB_assign (T, NULL, NULL, A, GrB_ALL, n, GrB_ALL, n, NULL)) ;
+            OK (GrB_free (&A)) ;
+            A = T ;
+        }
+        OK (GrB_Matrix_apply_BinaryOp2nd_INT32 (A, NULL, NULL,
+            GrB_BAND_INT32, A, 255, NULL)) ;
+        OK (GrB_Matrix_apply_BinaryOp2nd_INT32 (A, NULL, NULL,
+            GrB_MAX_INT32, A, 1, NULL)) ;
+
+        // create the graph
+        OK (LAGraph_New (&G, &A, LAGraph_ADJACENCY_DIRECTED, msg)) ;
+        OK (LAGraph_Cached_EMin (G, msg)) ;
+
+        int64_t step = (n > 100) ? (3*n/4) : ((n/4) + 1) ;
+        for (int64_t src = 0 ; src < n ; src += step)
+        {
+            for (int32_t delta = 1 ; delta <= 300 ; delta *= 30)
+            {
+                printf ("src %d delta %d n %d\n", (int) src, delta, (int) n) ;
+                OK (GrB_Scalar_setElement (Delta, delta)) ;
+                OK (LAGr_SingleSourceShortestPath_Parent (&path_length,
+                    &parent, G, src, Delta, msg)) ;
+
+                // parent (i) is present if and only if i is reachable, and
+                // the edge from parent (i) to i is on a shortest path
+                for (int64_t i = 0 ; i < n ; i++)
+                {
+                    int32_t len = 0, plen = 0, aij = 0 ;
+                    int64_t p = -1 ;
+                    OK (GrB_Vector_extractElement (&len, path_length, i)) ;
+                    int info = GrB_Vector_extractElement (&p, parent, i) ;
+                    TEST_CHECK (info == ((len == INT32_MAX) ?
+                        GrB_NO_VALUE : GrB_SUCCESS)) ;
+                    if (info != GrB_SUCCESS) continue ;
+                    if (i == src)
+                    {
+                        TEST_CHECK (p == src) ;
+                        continue ;
+                    }
+                    OK (GrB_Vector_extractElement (&plen, path_length, p)) ;
+                    OK (GrB_Matrix_extractElement (&aij, G->A, p, i)) ;
+                    TEST_CHECK (plen + aij == len) ;
+                }
+
+                // following parent from each node leads back to the source
+                GrB_Index nreach ;
+                OK (GrB_Vector_nvals (&nreach, parent)) ;
+                for (int64_t i = 0 ; i < n ; i++)
+                {
+                    int64_t p = i ;
+                    GrB_Index hops = 0 ;
+                    while (p != src && hops <= nreach)
+                    {
+                        if (GrB_Vector_extractElement (&p, parent, p) !=
+                            GrB_SUCCESS) break ;
+                        hops++ ;
+                    }
+                    TEST_CHECK (hops <= nreach) ;
+                }
+
+                int res = LG_check_sssp (path_length, G, src, msg) ;
+                if (res != GrB_SUCCESS) printf ("res: %d msg: %s\n", res, msg) ;
+                OK (res) ;
+                OK (GrB_free (&path_length)) ;
+                OK (GrB_free (&parent)) ;
+            }
+        }
+
+        // the parent is optional
+        OK (LAGr_SingleSourceShortestPath_Parent (&path_length, NULL, G, 0,
+            Delta, msg)) ;
+        OK (GrB_free (&path_length)) ;
+        OK (LAGraph_Delete (&G, msg)) ;
+    }
+
+    // a graph with a negative edge: the parent of node 1 changes from 0 to 2
+    GrB_Index I [4] = { 0, 0, 2, 1 } ;
+    GrB_Index J [4] = { 1, 2, 1, 3 } ;
+    int32_t   X [4] = { 1, 2, -5, 1 } ;
+    int64_t result [4] = { 0, 2, 0, 1 } ;
+    OK (GrB_Matrix_new (&A, GrB_INT32, 4, 4)) ;
+    OK (GrB_Matrix_build (A, I, J, X, 4, GrB_PLUS_INT32)) ;
+    OK (LAGraph_New (&G, &A, LAGraph_ADJACENCY_DIRECTED, msg)) ;
+    OK (GrB_Scalar_setElement (Delta, 30)) ;
+    OK (LAGr_SingleSourceShortestPath_Parent (&path_length, &parent, G, 0,
+        Delta, msg)) ;
+    for (int i = 0 ; i < 4 ; i++)
+    {
+        int64_t p = -1 ;
+        OK (GrB_Vector_extractElement (&p, parent, i)) ;
+        TEST_CHECK (p == result [i]) ;
+    }
+    OK (GrB_free (&path_length)) ;
+    OK (GrB_free (&parent)) ;
+    OK (LAGraph_Delete (&G, msg)) ;
+
+    OK (GrB_free (&Delta)) ;
+    LAGraph_Finalize (msg) ;
+}
+#endif
+
 //------------------------------------------------------------------------------
 // test_SingleSourceShortestPath_failure
 //------------------------------------------------------------------------------
@@ -448,8 +720,11 @@ void test_SingleSourceShortestPath_brutal (void)
 TEST_LIST = {
     {"SSSP", test_SingleSourceShortestPath},
     {"SSSP_types", test_SingleSourceShortestPath_types},
+    {"SSSP_Basic", test_SingleSourceShortestPath_Basic},
+    {"SSSP_negative", test_SingleSourceShortestPath_negative},
     {"SSSP_failure", test_SingleSourceShortestPath_failure},
     #if LAGRAPH_SUITESPARSE
+    {"SSSP_parent", test_SingleSourceShortestPath_parent},
     {"SSSP_brutal", test_SingleSourceShortestPath_brutal },
     #endif
     {NULL, NULL}
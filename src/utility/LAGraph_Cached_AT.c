@@ -15,14 +15,24 @@
 
 //------------------------------------------------------------------------------
 
+// LAGraph_Cached_AT computes G->AT = (G->A)', if not already present.  Once
+// G->AT is computed, other cached properties of G may be deleted to keep
+// within the budget set by LAGraph_Cached_SetBudget (see LG_Cached_Budget.c).
+// LG_Cached_AT does the same, keeping the properties in its keep bitmask as
+// well.  If G->AT is already present, G is not modified.
+
+//------------------------------------------------------------------------------
+
 #define LG_FREE_ALL GrB_free (&AT) ;
 
 #include "LG_internal.h"
 
-int LAGraph_Cached_AT
+int LG_Cached_AT
 (
     // input/output:
     LAGraph_Graph G,    // graph for which to compute G->AT
+    // input:
+    int keep,           // other properties to keep when trimming G
     char *msg
 )
 {
@@ -61,6 +71,26 @@ int LAGraph_Cached_AT
     GRB_TRY (GrB_Matrix_new (&AT, atype, ncols, nrows)) ;
     GRB_TRY (GrB_transpose (AT, NULL, NULL, A, NULL)) ;
     G->AT = AT ;
+    AT = NULL ;
+
+    //--------------------------------------------------------------------------
+    // keep the cached properties of G within the budget
+    //--------------------------------------------------------------------------
 
+    LG_TRY (LG_Cached_TrimToBudget (G, keep | LAGRAPH_CACHE_AT, msg)) ;
     return (GrB_SUCCESS) ;
 }
+
+//------------------------------------------------------------------------------
+// LAGraph_Cached_AT: compute G->AT
+//------------------------------------------------------------------------------
+
+int LAGraph_Cached_AT
+(
+    // input/output:
+    LAGraph_Graph G,    // graph for which to compute G->AT
+    char *msg
+)
+{
+    return (LG_Cached_AT (G, 0, msg)) ;
+}
@@ -23,6 +23,12 @@
 // G->in_degree is not computed if the graph is undirected.  Use G->out_degree
 // instead, and LAGraph_Cached_OutDegree.
 
+// Once G->in_degree is computed, other cached properties of G may be deleted
+// to keep within the budget set by LAGraph_Cached_SetBudget (see
+// LG_Cached_Budget.c).  LG_Cached_InDegree does the same, keeping the
+// properties in its keep bitmask as well.  If G->in_degree is already
+// present, G is not modified.
+
 #define LG_FREE_WORK            \
 {                               \
     GrB_free (&S) ;             \
@@ -37,10 +43,12 @@
 
 #include "LG_internal.h"
 
-int LAGraph_Cached_InDegree
+int LG_Cached_InDegree
 (
     // input/output:
     LAGraph_Graph G,    // graph to determine G->in_degree
+    // input:
+    int keep,           // other properties to keep when trimming G
     char *msg
 )
 {
@@ -99,7 +107,28 @@ int LAGraph_Cached_InDegree
     }
 
     G->in_degree = in_degree ;
-
+    in_degree = NULL ;
     LG_FREE_WORK ;
+
+    //--------------------------------------------------------------------------
+    // keep the cached properties of G within the budget
+    //--------------------------------------------------------------------------
+
+    LG_TRY (LG_Cached_TrimToBudget (G, keep | LAGRAPH_CACHE_IN_DEGREE,
+        msg)) ;
     return (GrB_SUCCESS) ;
 }
+
+//------------------------------------------------------------------------------
+// LAGraph_Cached_InDegree: compute G->in_degree
+//------------------------------------------------------------------------------
+
+int LAGraph_Cached_InDegree
+(
+    // input/output:
+    LAGraph_Graph G,    // graph to determine G->in_degree
+    char *msg
+)
+{
+    return (LG_Cached_InDegree (G, 0, msg)) ;
+}
@@ -44,8 +44,13 @@ int LAGraph_Cached_IsSymmetricStructure
 
     if (G->kind == LAGraph_ADJACENCY_UNDIRECTED)
     {
-        // assume A is symmetric for an undirected graph
-        G->is_symmetric_structure = LAGraph_TRUE ;
+        // assume A is symmetric for an undirected graph.  G is not written
+        // if this is already known, so that this method is safe to call on a
+        // graph shared by multiple user threads (see LAGraph_Freeze).
+        if (G->is_symmetric_structure != LAGraph_TRUE)
+        {
+            G->is_symmetric_structure = LAGraph_TRUE ;
+        }
         return (GrB_SUCCESS) ;
     }
 
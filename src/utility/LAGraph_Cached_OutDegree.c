@@ -20,6 +20,12 @@
 // G->rowdgree(i) is not present in the structure of G->out_degree.  That is,
 // G->out_degree contains no explicit zero entries.
 
+// Once G->out_degree is computed, other cached properties of G may be deleted
+// to keep within the budget set by LAGraph_Cached_SetBudget (see
+// LG_Cached_Budget.c).  LG_Cached_OutDegree does the same, keeping the
+// properties in its keep bitmask as well.  If G->out_degree is already
+// present, G is not modified.
+
 #define LG_FREE_WORK            \
 {                               \
     GrB_free (&x) ;             \
@@ -33,10 +39,12 @@
 
 #include "LG_internal.h"
 
-int LAGraph_Cached_OutDegree
+int LG_Cached_OutDegree
 (
     // input/output:
     LAGraph_Graph G,    // graph to determine G->out_degree
+    // input:
+    int keep,           // other properties to keep when trimming G
     char *msg
 )
 {
@@ -76,7 +84,28 @@ int LAGraph_Cached_OutDegree
         A, x, NULL)) ;
 
     G->out_degree = out_degree ;
-
+    out_degree = NULL ;
     LG_FREE_WORK ;
+
+    //--------------------------------------------------------------------------
+    // keep the cached properties of G within the budget
+    //--------------------------------------------------------------------------
+
+    LG_TRY (LG_Cached_TrimToBudget (G, keep | LAGRAPH_CACHE_OUT_DEGREE,
+        msg)) ;
     return (GrB_SUCCESS) ;
 }
+
+//------------------------------------------------------------------------------
+// LAGraph_Cached_OutDegree: compute G->out_degree
+//------------------------------------------------------------------------------
+
+int LAGraph_Cached_OutDegree
+(
+    // input/output:
+    LAGraph_Graph G,    // graph to determine G->out_degree
+    char *msg
+)
+{
+    return (LG_Cached_OutDegree (G, 0, msg)) ;
+}
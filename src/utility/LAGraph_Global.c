@@ -42,3 +42,15 @@ int LG_nthreads_inner ; // # of threads to use at the lower level of a nested
                         // parallel region, or to use inside GraphBLAS.
                         // Default: the value obtained by omp_get_max_threads
                         // if OpenMP is in use, or 1 otherwise.
+
+//------------------------------------------------------------------------------
+// budget for cached properties
+//------------------------------------------------------------------------------
+
+// This is modified by LAGraph_Cached_SetBudget and accessed by
+// LAGraph_Cached_GetBudget (see LAGraphX.h), and applied by
+// LG_Cached_TrimToBudget.  It is not intended to be directly accessed by the
+// end user.
+
+size_t LG_cached_budget = SIZE_MAX ;    // max bytes for the cached properties
+                                        // of a graph.  Default: no budget.
@@ -23,6 +23,9 @@
 // The Matrix Market format is described at:
 // https://math.nist.gov/MatrixMarket/formats.html
 
+// The file may be compressed with gzip or zstd (see LG_stream.c), in which case
+// it is decompressed by a separate thread as it is read.
+
 // Return values:
 //  GrB_SUCCESS: input file and output matrix are valid
 //  LAGRAPH_IO_ERROR: the input file cannot be read or has invalid content
@@ -30,19 +33,6 @@
 //  GrB_NOT_IMPLEMENTED: complex types not yet supported
 //  other: return values directly from GrB_* methods
 
-#define LG_FREE_WORK                    \
-{                                       \
-    LAGraph_Free ((void **) &I, NULL) ; \
-    LAGraph_Free ((void **) &J, NULL) ; \
-    LAGraph_Free ((void **) &X, NULL) ; \
-}
-
-#define LG_FREE_ALL                     \
-{                                       \
-    LG_FREE_WORK ;                      \
-    GrB_free (A) ;                      \
-}
-
 #include "LG_internal.h"
 
 //------------------------------------------------------------------------------
@@ -54,7 +44,7 @@
 
 static inline bool get_line
 (
-    FILE *f,        // file open for reading
+    LG_stream f,    // stream open for reading
     char *buf       // size MAXLINE+1
 )
 {
@@ -66,7 +56,7 @@ static inline bool get_line
     // read the line from the file
     buf [0] = '\0' ;
     buf [1] = '\0' ;
-    if (fgets (buf, MAXLINE, f) == NULL)
+    if (LG_stream_gets (buf, MAXLINE, f) == NULL)
     {
         // EOF or other I/O error
         return (false) ;
@@ -123,46 +113,6 @@ static inline bool is_blank_line
     return (true) ;
 }
 
-//------------------------------------------------------------------------------
-// read_double
-//------------------------------------------------------------------------------
-
-// Read a single double value from a string.  The string may be any string
-// recognized by sscanf, or inf, -inf, +inf, or nan.  The token infinity is
-// also OK instead of inf (only the first 3 letters of inf* or nan* are
-// significant, and the rest are ignored).
-
-static inline bool read_double      // true if successful, false if failure
-(
-    char *p,        // string containing the value
-    double *rval    // value to read in
-)
-{
-    while (*p && isspace (*p)) p++ ;   // skip any spaces
-
-    if (MATCH (p, "inf", 3) || MATCH (p, "+inf", 4))
-    {
-        (*rval) = INFINITY ;
-    }
-    else if (MATCH (p, "-inf", 4))
-    {
-        (*rval) = -INFINITY ;
-    }
-    else if (MATCH (p, "nan", 3))
-    {
-        (*rval) = NAN ;
-    }
-    else
-    {
-        if (sscanf (p, "%lg", rval) != 1)
-        {
-            // invalid file format, EOF, or other I/O error
-            return (false) ;
-        }
-    }
-    return (true) ;
-}
-
 //------------------------------------------------------------------------------
 // read_entry: read a numerical value and typecast to the given type
 //------------------------------------------------------------------------------
@@ -179,11 +129,9 @@ static inline bool read_entry   // returns true if successful, false if failure
     int64_t ival = 1 ;
     double rval = 1, zval = 0 ;
 
-    while (*p && isspace (*p)) p++ ;   // skip any spaces
-
     if (type == GrB_BOOL)
     {
-        if (!structural && sscanf (p, "%" SCNd64, &ival) != 1) return (false) ;
+        if (!structural && !LG_scan_int64 (&p, &ival)) return (false) ;
         if (ival < 0 || ival > 1)
         {
             // entry out of range
@@ -194,7 +142,7 @@ static inline bool read_entry   // returns true if successful, false if failure
     }
     else if (type == GrB_INT8)
     {
-        if (!structural && sscanf (p, "%" SCNd64, &ival) != 1) return (false) ;
+        if (!structural && !LG_scan_int64 (&p, &ival)) return (false) ;
         if (ival < INT8_MIN || ival > INT8_MAX)
         {
             // entry out of range
@@ -205,7 +153,7 @@ static inline bool read_entry   // returns true if successful, false if failure
     }
     else if (type == GrB_INT16)
     {
-        if (!structural && sscanf (p, "%" SCNd64, &ival) != 1) return (false) ;
+        if (!structural && !LG_scan_int64 (&p, &ival)) return (false) ;
         if (ival < INT16_MIN || ival > INT16_MAX)
         {
             // entry out of range
@@ -216,7 +164,7 @@ static inline bool read_entry   // returns true if successful, false if failure
     }
     else if (type == GrB_INT32)
     {
-        if (!structural && sscanf (p, "%" SCNd64, &ival) != 1) return (false) ;
+        if (!structural && !LG_scan_int64 (&p, &ival)) return (false) ;
         if (ival < INT32_MIN || ival > INT32_MAX)
         {
             // entry out of range
@@ -227,13 +175,13 @@ static inline bool read_entry   // returns true if successful, false if failure
     }
     else if (type == GrB_INT64)
     {
-        if (!structural && sscanf (p, "%" SCNd64, &ival) != 1) return (false) ;
+        if (!structural && !LG_scan_int64 (&p, &ival)) return (false) ;
         int64_t *result = (int64_t *) x ;
         result [0] = (int64_t) ival ;
     }
     else if (type == GrB_UINT8)
     {
-        if (!structural && sscanf (p, "%" SCNd64, &ival) != 1) return (false) ;
+        if (!structural && !LG_scan_int64 (&p, &ival)) return (false) ;
         if (ival < 0 || ival > UINT8_MAX)
         {
             // entry out of range
@@ -244,7 +192,7 @@ static inline bool read_entry   // returns true if successful, false if failure
     }
     else if (type == GrB_UINT16)
     {
-        if (!structural && sscanf (p, "%" SCNd64, &ival) != 1) return (false) ;
+        if (!structural && !LG_scan_int64 (&p, &ival)) return (false) ;
         if (ival < 0 || ival > UINT16_MAX)
         {
             // entry out of range
@@ -255,7 +203,7 @@ static inline bool read_entry   // returns true if successful, false if failure
     }
     else if (type == GrB_UINT32)
     {
-        if (!structural && sscanf (p, "%" SCNd64, &ival) != 1) return (false) ;
+        if (!structural && !LG_scan_int64 (&p, &ival)) return (false) ;
         if (ival < 0 || ival > UINT32_MAX)
         {
             // entry out of range
@@ -267,37 +215,35 @@ static inline bool read_entry   // returns true if successful, false if failure
     else if (type == GrB_UINT64)
     {
         uint64_t uval = 1 ;
-        if (!structural && sscanf (p, "%" SCNu64, &uval) != 1) return (false) ;
+        if (!structural && !LG_scan_uint64 (&p, &uval)) return (false) ;
         uint64_t *result = (uint64_t *) x ;
         result [0] = (uint64_t) uval ;
     }
     else if (type == GrB_FP32)
     {
-        if (!structural && !read_double (p, &rval)) return (false) ;
+        if (!structural && !LG_scan_double (&p, &rval)) return (false) ;
         float *result = (float *) x ;
         result [0] = (float) rval ;
     }
     else if (type == GrB_FP64)
     {
-        if (!structural && !read_double (p, &rval)) return (false) ;
+        if (!structural && !LG_scan_double (&p, &rval)) return (false) ;
         double *result = (double *) x ;
         result [0] = rval ;
     }
 #if 0
     else if (type == GxB_FC32)
     {
-        if (!structural && !read_double (p, &rval)) return (false) ;
-        while (*p && !isspace (*p)) p++ ;   // skip real part
-        if (!structural && !read_double (p, &zval)) return (false) ;
+        if (!structural && !LG_scan_double (&p, &rval)) return (false) ;
+        if (!structural && !LG_scan_double (&p, &zval)) return (false) ;
         float *result = (float *) x ;
         result [0] = (float) rval ;     // real part
         result [1] = (float) zval ;     // imaginary part
     }
     else if (type == GxB_FC64)
     {
-        if (!structural && !read_double (p, &rval)) return (false) ;
-        while (*p && !isspace (*p)) p++ ;   // skip real part
-        if (!structural && !read_double (p, &zval)) return (false) ;
+        if (!structural && !LG_scan_double (&p, &rval)) return (false) ;
+        if (!structural && !LG_scan_double (&p, &zval)) return (false) ;
         double *result = (double *) x ;
         result [0] = rval ;     // real part
         result [1] = zval ;     // imaginary part
@@ -390,15 +336,485 @@ static inline void set_value
 }
 
 //------------------------------------------------------------------------------
-// LAGraph_MMRead
+// read_triplet: read a single (i,j,x) triplet from a line in coordinate format
 //------------------------------------------------------------------------------
 
-int LAGraph_MMRead
+// The line is a null-terminated string.  The indices i and j are returned as
+// 1-based.  No error messages are created here, since this method is used
+// inside a parallel region; the caller constructs the message instead.
+
+#define MM_TRIPLET_OK          0    // triplet is valid
+#define MM_TRIPLET_INDICES     1    // indices are invalid
+#define MM_TRIPLET_ROW         2    // row index out of range
+#define MM_TRIPLET_COL         3    // column index out of range
+#define MM_TRIPLET_VALUE       4    // entry value is invalid
+
+static inline int read_triplet
+(
+    char *p,                // null-terminated line containing the triplet
+    GrB_Type type,          // type of value to read
+    bool structural,        // if true, then the value is 1
+    GrB_Index nrows,        // # of rows of the matrix
+    GrB_Index ncols,        // # of columns of the matrix
+    GrB_Index *i,           // row index (1-based)
+    GrB_Index *j,           // column index (1-based)
+    uint8_t *x              // value read in
+)
+{
+    // read the row index and column index
+    char *q = p ;
+    if (!LG_scan_uint64 (&q, i) || !LG_scan_uint64 (&q, j))
+    {
+        return (MM_TRIPLET_INDICES) ;
+    }
+    // check the indices (they are 1-based in the MM file format)
+    if ((*i) < 1 || (*i) > nrows) return (MM_TRIPLET_ROW) ;
+    if ((*j) < 1 || (*j) > ncols) return (MM_TRIPLET_COL) ;
+    // advance p to the 3rd token to get the value of the entry
+    while (*p &&  isspace (*p)) p++ ;   // skip any leading spaces
+    while (*p && !isspace (*p)) p++ ;   // skip the row index
+    while (*p &&  isspace (*p)) p++ ;   // skip any spaces
+    while (*p && !isspace (*p)) p++ ;   // skip the column index
+    // read the value of the entry
+    if (!read_entry (p, type, structural, x))
+    {
+        return (MM_TRIPLET_VALUE) ;
+    }
+    return (MM_TRIPLET_OK) ;
+}
+
+//------------------------------------------------------------------------------
+// MM_target: where the entries of a coordinate file are saved
+//------------------------------------------------------------------------------
+
+// The entries of a matrix in coordinate format are either saved as triplets in
+// the I, J, and X arrays (MM_TRIPLETS), or placed directly into the CSR arrays
+// Ap, Aj, and Ax of the result.  The latter takes two passes over the file:
+// the first counts the entries in each row (MM_COUNT), and the second
+// scatters each entry into its row (MM_SCATTER).
+
+typedef enum
+{
+    MM_TRIPLETS = 0,        // save the triplets in I, J, X
+    MM_COUNT = 1,           // count the entries in each row in Ap
+    MM_SCATTER = 2          // place the entries into Ap, Aj, Ax
+}
+MM_phase_enum ;
+
+typedef struct
+{
+    MM_phase_enum phase ;
+    GrB_Type type ;             // type of the matrix
+    size_t typesize ;           // size of the type, in bytes
+    bool structural ;           // if true, all values are 1
+    bool iso ;                  // if true, Ax has size 1 (MM_SCATTER only)
+    MM_storage_enum storage ;   // general, symmetric, or skew-symmetric
+    GrB_Index nrows ;
+    GrB_Index ncols ;
+    GrB_Index *I ;              // triplets (MM_TRIPLETS only)
+    GrB_Index *J ;
+    uint8_t *X ;
+    GrB_Index *Ap ;             // CSR arrays (MM_COUNT and MM_SCATTER only)
+    GrB_Index *Aj ;
+    uint8_t *Ax ;
+}
+MM_target ;
+
+//------------------------------------------------------------------------------
+// save_entry: save a single entry A(i,j) = x
+//------------------------------------------------------------------------------
+
+// For MM_TRIPLETS, the entry is the kth triplet, and k is incremented.  For
+// MM_COUNT and MM_SCATTER, Ap [i] is incremented atomically, since the entries
+// of a single row can appear in any chunk of the file.
+
+static inline void save_entry
+(
+    MM_target *T,
+    GrB_Index i,
+    GrB_Index j,
+    uint8_t *x,             // scalar, an array of size at least typesize
+    GrB_Index *k            // # of triplets
+)
+{
+    if (T->phase == MM_TRIPLETS)
+    {
+        set_value (T->typesize, i, j, x, T->I, T->J, T->X, k) ;
+    }
+    else if (T->phase == MM_COUNT)
+    {
+        GrB_Index *Ap = T->Ap ;
+        #pragma omp atomic update
+        Ap [i]++ ;
+    }
+    else
+    {
+        GrB_Index *Ap = T->Ap ;
+        GrB_Index p ;
+        #pragma omp atomic capture
+        p = Ap [i]++ ;
+        T->Aj [p] = j ;
+        if (!T->iso)
+        {
+            memcpy (T->Ax + p * T->typesize, x, T->typesize) ;
+        }
+    }
+}
+
+//------------------------------------------------------------------------------
+// read_coordinate: read the entries of a matrix in coordinate format
+//------------------------------------------------------------------------------
+
+// The entries of a matrix in coordinate format are read in large blocks, with
+// LG_lines.  Each block is split into chunks of whole lines, which are parsed
+// in parallel: a first pass counts the entries in each chunk, a cumulative sum
+// gives each chunk its position in the I, J, and X arrays, and a second pass
+// parses the entries and saves them with save_entry.  For MM_TRIPLETS, the
+// resulting triplets are in the same order as a sequential read of the file,
+// so the matrix is identical.  In all phases, any error is reported for the
+// first invalid line in the file.
+
+#undef  LG_FREE_WORK
+#define LG_FREE_WORK                        \
+{                                           \
+    LG_lines_free (&L) ;                    \
+    LAGraph_Free ((void **) &Work, NULL) ;  \
+}
+
+#undef  LG_FREE_ALL
+#define LG_FREE_ALL LG_FREE_WORK
+
+static int read_coordinate
+(
+    // input/output:
+    MM_target *T,           // where to save the entries
+    GrB_Index *nvals2,      // # of triplets in T->I, T->J, T->X
+    int64_t *line,          // current line number of the file
+    // input:
+    LG_stream f,            // stream to read from, positioned at the entries
+    GrB_Index nvals,        // # of entries to read
+    char *msg
+)
+{
+    LG_lines L ;
+    memset (&L, 0, sizeof (LG_lines)) ;
+    int64_t *Work = NULL ;
+
+    #define BLOCK (64*1024*1024)
+    int nthreads = LG_nthreads_outer * LG_nthreads_inner ;
+    nthreads = LAGRAPH_MAX (nthreads, 1) ;
+    int ntasks_max = 4 * nthreads ;
+    int mult = (T->storage == MM_general) ? 1 : 2 ;
+
+    // The block buffer is large enough for all of the entries if the matrix
+    // is small (about 32 bytes per entry), and always holds at least a few
+    // lines.
+    size_t bufsize = (size_t) LAGRAPH_MIN (nvals, BLOCK / 32) * 32 ;
+    LG_TRY (LG_lines_init (&L, f, bufsize, ntasks_max, msg)) ;
+
+    // workspace for the tasks
+    LG_TRY (LAGraph_Malloc ((void **) &Work, 7 * (ntasks_max + 1),
+        sizeof (int64_t), msg)) ;
+    int64_t *Tcount  = Work ;                           // # entries
+    int64_t *Tlines  = Work +     (ntasks_max + 1) ;    // # lines
+    int64_t *Tnout   = Work + 2 * (ntasks_max + 1) ;    // # triplets
+    int64_t *Tstatus = Work + 3 * (ntasks_max + 1) ;    // error, if any
+    int64_t *Tline   = Work + 4 * (ntasks_max + 1) ;    // line of error
+    int64_t *Tindex  = Work + 5 * (ntasks_max + 1) ;    // index in error
+    int64_t *Tfirst  = Work + 6 * (ntasks_max + 1) ;    // first entry
+
+    GrB_Index nread = 0 ;       // # of entries read so far
+
+    while (nread < nvals)
+    {
+
+        //------------------------------------------------------------------
+        // read the next block of whole lines, split into chunks
+        //------------------------------------------------------------------
+
+        LG_TRY (LG_lines_next (&L, msg)) ;
+        LG_ASSERT_MSG (L.ntasks > 0, LAGRAPH_IO_ERROR, "premature EOF") ;
+        char *Buf = L.Buf ;
+        int64_t *Tstart = L.Tstart ;
+        int ntasks = L.ntasks ;
+
+        //------------------------------------------------------------------
+        // split each chunk into lines and count its entries
+        //------------------------------------------------------------------
+
+        int t ;
+        #pragma omp parallel for num_threads(nthreads) schedule(dynamic,1)
+        for (t = 0 ; t < ntasks ; t++)
+        {
+            int64_t count = 0, nlines = 0 ;
+            char *p = Buf + Tstart [t] ;
+            char *pend = Buf + Tstart [t+1] ;
+            while (p < pend)
+            {
+                // terminate the line with '\0' in place of '\n'
+                char *q = memchr (p, '\n', pend - p) ;
+                if (q == NULL) q = pend ;
+                (*q) = '\0' ;
+                nlines++ ;
+                if (!is_blank_line (p)) count++ ;
+                p = q + 1 ;
+            }
+            Tcount [t] = count ;
+            Tlines [t] = nlines ;
+        }
+
+        //------------------------------------------------------------------
+        // determine where each chunk places its entries
+        //------------------------------------------------------------------
+
+        // Only the first (nvals - nread) entries are needed; any lines
+        // that follow them are ignored.  Tcount [t] becomes the # of
+        // entries to read from chunk t.
+        int64_t remaining = nvals - nread ;
+        int64_t ecount = 0 ;
+        for (t = 0 ; t < ntasks ; t++)
+        {
+            int64_t c = LAGRAPH_MIN (Tcount [t], remaining - ecount) ;
+            Tcount [t] = c ;
+            Tfirst [t] = ecount ;
+            ecount += c ;
+        }
+
+        //------------------------------------------------------------------
+        // parse the triplets in each chunk
+        //------------------------------------------------------------------
+
+        #pragma omp parallel for num_threads(nthreads) schedule(dynamic,1)
+        for (t = 0 ; t < ntasks ; t++)
+        {
+            GrB_Index k = (*nvals2) + mult * Tfirst [t] ;
+            GrB_Index k1 = k ;
+            int64_t count = 0, nlines = 0 ;
+            int status = MM_TRIPLET_OK ;
+            GrB_Index ti = 0, tj = 0 ;
+            uint8_t x [MAXLINE] ;       // scalar value
+            char *p = Buf + Tstart [t] ;
+            char *pend = Buf + Tstart [t+1] ;
+            while (p < pend && count < Tcount [t])
+            {
+                size_t linelen = strlen (p) ;
+                nlines++ ;
+                if (!is_blank_line (p))
+                {
+                    count++ ;
+                    status = read_triplet (p, T->type, T->structural,
+                        T->nrows, T->ncols, &ti, &tj, x) ;
+                    if (status != MM_TRIPLET_OK) break ;
+                    // convert from 1-based to 0-based
+                    ti-- ;
+                    tj-- ;
+                    save_entry (T, ti, tj, x, &k) ;
+                    // also save the A(j,i) entry, if symmetric
+                    if (ti != tj && T->storage != MM_general)
+                    {
+                        if (T->storage == MM_skew_symmetric)
+                        {
+                            negate_scalar (T->type, x) ;
+                        }
+                        save_entry (T, tj, ti, x, &k) ;
+                    }
+                }
+                p += linelen + 1 ;
+            }
+            Tnout [t] = k - k1 ;
+            Tstatus [t] = status ;
+            Tline [t] = nlines ;
+            Tindex [t] = (status == MM_TRIPLET_ROW) ? ti : tj ;
+        }
+
+        //------------------------------------------------------------------
+        // report the first error, if any
+        //------------------------------------------------------------------
+
+        for (t = 0 ; t < ntasks ; t++)
+        {
+            int status = (int) Tstatus [t] ;
+            if (status != MM_TRIPLET_OK)
+            {
+                (*line) += Tline [t] ;
+                LG_ASSERT_MSGF (status != MM_TRIPLET_INDICES,
+                    LAGRAPH_IO_ERROR, "line %" PRId64 " of input file: "
+                    "indices invalid", *line) ;
+                LG_ASSERT_MSGF (status != MM_TRIPLET_ROW,
+                    GrB_INDEX_OUT_OF_BOUNDS,
+                    "line %" PRId64 " of input file: row index %" PRIu64
+                    " out of range (must be in range 1 to %" PRIu64")",
+                    *line, (GrB_Index) Tindex [t], T->nrows) ;
+                LG_ASSERT_MSGF (status != MM_TRIPLET_COL,
+                    GrB_INDEX_OUT_OF_BOUNDS,
+                    "line %" PRId64 " of input file: column index %" PRIu64
+                    " out of range (must be in range 1 to %" PRIu64")",
+                    *line, (GrB_Index) Tindex [t], T->ncols) ;
+                LG_ASSERT_MSGF (false, LAGRAPH_IO_ERROR, "entry value "
+                    "invalid on line %" PRId64 " of input file", *line) ;
+            }
+            (*line) += Tlines [t] ;
+        }
+
+        //------------------------------------------------------------------
+        // pack the triplets of the chunks together
+        //------------------------------------------------------------------
+
+        // For a general matrix, each chunk places exactly Tcount [t]
+        // entries, so the triplets are already contiguous.  Otherwise,
+        // each chunk reserves space for 2*Tcount [t] triplets, but
+        // diagonal entries take only one.
+
+        if (T->phase == MM_TRIPLETS)
+        {
+            GrB_Index kdest = (*nvals2) ;
+            size_t typesize = T->typesize ;
+            for (t = 0 ; t < ntasks ; t++)
+            {
+                GrB_Index ksrc = (*nvals2) + mult * Tfirst [t] ;
+                GrB_Index n = Tnout [t] ;
+                if (ksrc != kdest)
+                {
+                    memmove (T->I + kdest, T->I + ksrc,
+                        n * sizeof (GrB_Index)) ;
+                    memmove (T->J + kdest, T->J + ksrc,
+                        n * sizeof (GrB_Index)) ;
+                    memmove (T->X + kdest * typesize, T->X + ksrc * typesize,
+                        n * typesize) ;
+                }
+                kdest += n ;
+            }
+            (*nvals2) = kdest ;
+        }
+
+        nread += ecount ;
+        LG_ASSERT_MSG (nread == nvals || !L.eof, LAGRAPH_IO_ERROR,
+            "premature EOF") ;
+    }
+
+    //--------------------------------------------------------------------------
+    // free workspace and return result
+    //--------------------------------------------------------------------------
+
+    LG_FREE_WORK ;
+    return (GrB_SUCCESS) ;
+}
+
+//------------------------------------------------------------------------------
+// sort_row: sort the entries of a single row of a CSR matrix
+//------------------------------------------------------------------------------
+
+// The column indices Aj [0:n-1] of a single row are sorted in place with a
+// heapsort, and the values Ax [0:n-1] are permuted in the same way, unless the
+// matrix is iso.  No workspace is needed, and the rows are typically short.
+
+static inline void sift_down
+(
+    GrB_Index *Aj,
+    uint8_t *Ax,            // NULL if iso
+    size_t typesize,
+    int64_t k,              // root of the subtree
+    int64_t n               // size of the heap
+)
+{
+    uint8_t t [MAXLINE] ;
+    while (true)
+    {
+        int64_t c = 2 * k + 1 ;
+        if (c >= n) break ;
+        if (c + 1 < n && Aj [c+1] > Aj [c]) c++ ;
+        if (Aj [k] >= Aj [c]) break ;
+        GrB_Index j = Aj [k] ; Aj [k] = Aj [c] ; Aj [c] = j ;
+        if (Ax != NULL)
+        {
+            memcpy (t, Ax + k * typesize, typesize) ;
+            memcpy (Ax + k * typesize, Ax + c * typesize, typesize) ;
+            memcpy (Ax + c * typesize, t, typesize) ;
+        }
+        k = c ;
+    }
+}
+
+static void sort_row
+(
+    GrB_Index *Aj,          // column indices of the row, size n
+    uint8_t *Ax,            // values of the row, size n, or NULL if iso
+    size_t typesize,
+    int64_t n
+)
+{
+    // quick return if the row is already sorted
+    bool sorted = true ;
+    for (int64_t k = 1 ; sorted && k < n ; k++)
+    {
+        sorted = (Aj [k-1] <= Aj [k]) ;
+    }
+    if (sorted) return ;
+
+    // build the heap
+    for (int64_t k = n/2 - 1 ; k >= 0 ; k--)
+    {
+        sift_down (Aj, Ax, typesize, k, n) ;
+    }
+
+    // move the largest entry to the end, one at a time
+    uint8_t t [MAXLINE] ;
+    for (int64_t k = n - 1 ; k > 0 ; k--)
+    {
+        GrB_Index j = Aj [0] ; Aj [0] = Aj [k] ; Aj [k] = j ;
+        if (Ax != NULL)
+        {
+            memcpy (t, Ax, typesize) ;
+            memcpy (Ax, Ax + k * typesize, typesize) ;
+            memcpy (Ax + k * typesize, t, typesize) ;
+        }
+        sift_down (Aj, Ax, typesize, 0, k) ;
+    }
+}
+
+//------------------------------------------------------------------------------
+// LG_MMRead: read a matrix from a Matrix Market file
+//------------------------------------------------------------------------------
+
+// LG_MMRead is the same as LAGraph_MMRead, except for the low_memory option.
+// If true, a matrix in coordinate format is read in two passes over the file,
+// and its entries are placed directly in the CSR arrays of the result, which
+// is then created with GxB_Matrix_pack_CSR.  The I, J, and X triplet arrays
+// are not used, nor is the workspace of GrB_Matrix_build, so the peak memory
+// is the size of the result plus the block buffer for reading the file.  The
+// file must be seekable and not compressed; otherwise, or if
+// SuiteSparse:GraphBLAS is not in use, the matrix is read as if low_memory
+// were false.  If symmetric is not NULL, it is returned as true if the header
+// declares the matrix as symmetric, skew-symmetric, or Hermitian (in which
+// case both triangles of the result are present), or false otherwise.
+
+#undef  LG_FREE_WORK
+#define LG_FREE_WORK                        \
+{                                           \
+    LAGraph_Free ((void **) &I, NULL) ;     \
+    LAGraph_Free ((void **) &J, NULL) ;     \
+    LAGraph_Free ((void **) &X, NULL) ;     \
+    LAGraph_Free ((void **) &Ap, NULL) ;    \
+    LAGraph_Free ((void **) &Aj, NULL) ;    \
+    LAGraph_Free ((void **) &Ax, NULL) ;    \
+    LG_stream_close (&s) ;                  \
+}
+
+#undef  LG_FREE_ALL
+#define LG_FREE_ALL                         \
+{                                           \
+    LG_FREE_WORK ;                          \
+    GrB_free (A) ;                          \
+}
+
+int LG_MMRead
 (
     // output:
     GrB_Matrix *A,  // handle of matrix to create
     // input:
     FILE *f,        // file to read from, already open
+    bool low_memory,    // if true, do not use triplets for coordinate format
+    bool *symmetric,    // if not NULL, true if the header is not "general"
     char *msg
 )
 {
@@ -407,12 +823,17 @@ int LAGraph_MMRead
     // check inputs
     //--------------------------------------------------------------------------
 
-    GrB_Index *I = NULL, *J = NULL ;
-    uint8_t *X = NULL ;
+    GrB_Index *I = NULL, *J = NULL, *Ap = NULL, *Aj = NULL ;
+    uint8_t *X = NULL, *Ax = NULL ;
+    LG_stream s = NULL ;
     LG_CLEAR_MSG ;
     LG_ASSERT (A != NULL, GrB_NULL_POINTER) ;
     LG_ASSERT (f != NULL, GrB_NULL_POINTER) ;
     (*A) = NULL ;
+    if (symmetric != NULL) (*symmetric) = false ;
+
+    // the file may be compressed with gzip or zstd
+    LG_TRY (LG_stream_open (&s, f, msg)) ;
 
     //--------------------------------------------------------------------------
     // set the default properties
@@ -466,7 +887,7 @@ int LAGraph_MMRead
     bool got_first_data_line = false ;
     int64_t line ;
 
-    for (line = 1 ; get_line (f, buf) ; line++)
+    for (line = 1 ; get_line (s, buf) ; line++)
     {
 
         //----------------------------------------------------------------------
@@ -621,6 +1042,11 @@ int LAGraph_MMRead
                     "invalid MatrixMarket complex combination") ;
             }
 
+            if (symmetric != NULL)
+            {
+                (*symmetric) = (MM_storage != MM_general) ;
+            }
+
         }
         else if (got_mm_header && MATCH (buf, "%%graphblas", 11))
         {
@@ -844,8 +1270,125 @@ int LAGraph_MMRead
     if (nrows == 0 || ncols == 0 || nvals == 0)
     {
         // success: return an empty matrix.  This is not an error.
+        LG_FREE_WORK ;
+        return (GrB_SUCCESS) ;
+    }
+
+    //--------------------------------------------------------------------------
+    // low-memory method: place the entries directly in the CSR arrays
+    //--------------------------------------------------------------------------
+
+    bool structural = (MM_type == MM_pattern) ;
+    MM_target T ;
+    T.phase = MM_TRIPLETS ;
+    T.type = type ;
+    T.typesize = typesize ;
+    T.structural = structural ;
+    T.iso = false ;
+    T.storage = MM_storage ;
+    T.nrows = nrows ;
+    T.ncols = ncols ;
+    T.I = NULL ; T.J = NULL ; T.X = NULL ;
+    T.Ap = NULL ; T.Aj = NULL ; T.Ax = NULL ;
+
+    #if LAGRAPH_SUITESPARSE
+    fpos_t pos ;
+    if (low_memory && MM_fmt == MM_coordinate && LG_stream_getpos (s, &pos))
+    {
+
+        //----------------------------------------------------------------------
+        // pass 1: count the entries in each row
+        //----------------------------------------------------------------------
+
+        int64_t line1 = line ;
+        GrB_Index nvals2 = 0 ;
+        LG_TRY (LAGraph_Calloc ((void **) &Ap, nrows+1, sizeof (GrB_Index),
+            msg)) ;
+        T.phase = MM_COUNT ;
+        T.Ap = Ap ;
+        LG_TRY (read_coordinate (&T, &nvals2, &line, s, nvals, msg)) ;
+
+        // Ap [i] becomes the start of row i; pass 2 advances it as it fills
+        // the row, leaving it as the start of row i+1.
+        GrB_Index anz = 0 ;
+        for (GrB_Index i = 0 ; i < nrows ; i++)
+        {
+            GrB_Index rowcount = Ap [i] ;
+            Ap [i] = anz ;
+            anz += rowcount ;
+        }
+        Ap [nrows] = anz ;
+
+        //----------------------------------------------------------------------
+        // allocate the column indices and values
+        //----------------------------------------------------------------------
+
+        // a pattern matrix is iso-valued, with all entries equal to 1
+        bool iso = structural ;
+        GrB_Index Aj_len = LAGRAPH_MAX (anz, 1) ;
+        GrB_Index Ax_len = iso ? 1 : Aj_len ;
+        LG_TRY (LAGraph_Malloc ((void **) &Aj, Aj_len, sizeof (GrB_Index),
+            msg)) ;
+        LG_TRY (LAGraph_Malloc ((void **) &Ax, Ax_len, typesize, msg)) ;
+        if (iso)
+        {
+            read_entry ("", type, true, Ax) ;
+        }
+
+        //----------------------------------------------------------------------
+        // pass 2: place each entry in its row
+        //----------------------------------------------------------------------
+
+        LG_ASSERT_MSG (LG_stream_setpos (s, &pos), LAGRAPH_IO_ERROR,
+            "unable to rewind the input file") ;
+        line = line1 ;
+        nvals2 = 0 ;
+        T.phase = MM_SCATTER ;
+        T.iso = iso ;
+        T.Aj = Aj ;
+        T.Ax = Ax ;
+        LG_TRY (read_coordinate (&T, &nvals2, &line, s, nvals, msg)) ;
+
+        // Ap [i] is now the end of row i; shift it back to the start
+        for (GrB_Index i = nrows ; i > 0 ; i--)
+        {
+            Ap [i] = Ap [i-1] ;
+        }
+        Ap [0] = 0 ;
+
+        //----------------------------------------------------------------------
+        // sort each row and check for duplicates
+        //----------------------------------------------------------------------
+
+        int nthreads = LG_nthreads_outer * LG_nthreads_inner ;
+        int64_t ndupl = 0 ;
+        int64_t i ;
+        #pragma omp parallel for num_threads(nthreads) schedule(dynamic,1024) \
+            reduction(+:ndupl)
+        for (i = 0 ; i < (int64_t) nrows ; i++)
+        {
+            GrB_Index p = Ap [i] ;
+            int64_t n = (int64_t) (Ap [i+1] - p) ;
+            sort_row (Aj + p, iso ? NULL : (Ax + p * typesize), typesize, n) ;
+            for (int64_t k = 1 ; k < n ; k++)
+            {
+                if (Aj [p+k-1] == Aj [p+k]) ndupl++ ;
+            }
+        }
+        LG_ASSERT_MSG (ndupl == 0, GrB_INVALID_VALUE,
+            "duplicate entries in input file") ;
+
+        //----------------------------------------------------------------------
+        // pack the CSR arrays into the matrix
+        //----------------------------------------------------------------------
+
+        GRB_TRY (GxB_Matrix_pack_CSR (*A, &Ap, &Aj, (void **) &Ax,
+            (nrows+1) * sizeof (GrB_Index), Aj_len * sizeof (GrB_Index),
+            Ax_len * typesize, iso, false, NULL)) ;
+        LG_FREE_WORK ;
         return (GrB_SUCCESS) ;
     }
+    #endif
 
     //--------------------------------------------------------------------------
     // allocate space for the triplets
@@ -855,6 +1398,7 @@ int LAGraph_MMRead
     LG_TRY (LAGraph_Malloc ((void **) &I, nvals3, sizeof (GrB_Index), msg)) ;
     LG_TRY (LAGraph_Malloc ((void **) &J, nvals3, sizeof (GrB_Index), msg)) ;
     LG_TRY (LAGraph_Malloc ((void **) &X, nvals3, typesize, msg)) ;
+    T.I = I ; T.J = J ; T.X = X ;
 
     //--------------------------------------------------------------------------
     // read in the triplets
@@ -862,39 +1406,45 @@ int LAGraph_MMRead
 
     GrB_Index i = -1, j = 0 ;
     GrB_Index nvals2 = 0 ;
-    for (int64_t k = 0 ; k < nvals ; k++)
+
+    if (MM_fmt == MM_array)
     {
 
         //----------------------------------------------------------------------
-        // get the next triplet, skipping blank lines and comment lines
+        // array format: read the entries one line at a time
         //----------------------------------------------------------------------
 
-        uint8_t x [MAXLINE] ;       // scalar value
-
-        while (true)
+        for (int64_t k = 0 ; k < nvals ; k++)
         {
 
             //------------------------------------------------------------------
-            // read the file until finding the next triplet
+            // get the next entry, skipping blank lines and comment lines
             //------------------------------------------------------------------
 
-            bool ok = get_line (f, buf) ;
-            line++ ;
-            LG_ASSERT_MSG (ok, LAGRAPH_IO_ERROR, "premature EOF") ;
-            if (is_blank_line (buf))
+            uint8_t x [MAXLINE] ;       // scalar value
+
+            while (true)
             {
-                // blank line or comment
-                continue ;
-            }
 
-            //------------------------------------------------------------------
-            // get the row and column index
-            //------------------------------------------------------------------
+                //--------------------------------------------------------------
+                // read the file until finding the next entry
+                //--------------------------------------------------------------
+
+                bool ok = get_line (s, buf) ;
+                line++ ;
+                LG_ASSERT_MSG (ok || !LG_stream_error (s), LAGRAPH_IO_ERROR,
+                    "compressed input file is truncated or corrupted") ;
+                LG_ASSERT_MSG (ok, LAGRAPH_IO_ERROR, "premature EOF") ;
+                if (is_blank_line (buf))
+                {
+                    // blank line or comment
+                    continue ;
+                }
+
+                //--------------------------------------------------------------
+                // get the row and column index, in column major order
+                //--------------------------------------------------------------
 
-            char *p = buf ;
-            if (MM_fmt == MM_array)
-            {
-                // array format, column major order
                 i++ ;
                 if (i == nrows)
                 {
@@ -911,76 +1461,60 @@ int LAGraph_MMRead
                         i = j ;
                     }
                 }
-            }
-            else
-            {
-                // coordinate format; read the row index and column index
-                int inputs = sscanf (p, "%" SCNu64 " %" SCNu64, &i, &j) ;
-                LG_ASSERT_MSGF (inputs == 2, LAGRAPH_IO_ERROR,
-                    "line %" PRId64 " of input file: indices invalid", line) ;
-                // check the indices (they are 1-based in the MM file format)
-                LG_ASSERT_MSGF (i >= 1 && i <= nrows, GrB_INDEX_OUT_OF_BOUNDS,
-                    "line %" PRId64 " of input file: row index %" PRIu64
-                    " out of range (must be in range 1 to %" PRIu64")",
-                    line, i, nrows) ;
-                LG_ASSERT_MSGF (j >= 1 && j <= ncols, GrB_INDEX_OUT_OF_BOUNDS,
-                    "line %" PRId64 " of input file: column index %" PRIu64
-                    " out of range (must be in range 1 to %" PRIu64")",
-                    line, j, ncols) ;
-                // convert from 1-based to 0-based.
-                i-- ;
-                j-- ;
-                // advance p to the 3rd token to get the value of the entry
-                while (*p &&  isspace (*p)) p++ ;   // skip any leading spaces
-                while (*p && !isspace (*p)) p++ ;   // skip the row index
-                while (*p &&  isspace (*p)) p++ ;   // skip any spaces
-                while (*p && !isspace (*p)) p++ ;   // skip the column index
-            }
 
-            //------------------------------------------------------------------
-            // read the value of the entry
-            //------------------------------------------------------------------
-
-            while (*p && isspace (*p)) p++ ;        // skip any spaces
+                //--------------------------------------------------------------
+                // read the value of the entry
+                //--------------------------------------------------------------
 
-            ok = read_entry (p, type, MM_type == MM_pattern, x) ;
-            LG_ASSERT_MSGF (ok, LAGRAPH_IO_ERROR, "entry value invalid on line"
-                " %" PRId64 " of input file", line) ;
+                ok = read_entry (buf, type, structural, x) ;
+                LG_ASSERT_MSGF (ok, LAGRAPH_IO_ERROR, "entry value invalid on"
+                    " line %" PRId64 " of input file", line) ;
 
-            //------------------------------------------------------------------
-            // set the value in the matrix
-            //------------------------------------------------------------------
+                //--------------------------------------------------------------
+                // set the value in the matrix
+                //--------------------------------------------------------------
 
-            set_value (typesize, i, j, x, I, J, X, &nvals2) ;
+                set_value (typesize, i, j, x, I, J, X, &nvals2) ;
 
-            //------------------------------------------------------------------
-            // also set the A(j,i) entry, if symmetric
-            //------------------------------------------------------------------
+                //--------------------------------------------------------------
+                // also set the A(j,i) entry, if symmetric
+                //--------------------------------------------------------------
 
-            if (i != j && MM_storage != MM_general)
-            {
-                if (MM_storage == MM_symmetric)
+                if (i != j && MM_storage != MM_general)
                 {
-                    set_value (typesize, j, i, x, I, J, X, &nvals2) ;
-                }
-                else if (MM_storage == MM_skew_symmetric)
-                {
-                    negate_scalar (type, x) ;
-                    set_value (typesize, j, i, x, I, J, X, &nvals2) ;
-                }
-                #if 0
-                else if (MM_storage == MM_hermitian)
-                {
-                    double complex *value = (double complex *) x ;
-                    (*value) = conj (*value) ;
-                    set_value (typesize, j, i, x, I, J, X, &nvals2) ;
+                    if (MM_storage == MM_symmetric)
+                    {
+                        set_value (typesize, j, i, x, I, J, X, &nvals2) ;
+                    }
+                    else if (MM_storage == MM_skew_symmetric)
+                    {
+                        negate_scalar (type, x) ;
+                        set_value (typesize, j, i, x, I, J, X, &nvals2) ;
+                    }
+                    #if 0
+                    else if (MM_storage == MM_hermitian)
+                    {
+                        double complex *value = (double complex *) x ;
+                        (*value) = conj (*value) ;
+                        set_value (typesize, j, i, x, I, J, X, &nvals2) ;
+                    }
+                    #endif
                 }
-                #endif
-            }
 
-            // one more entry has been read in
-            break ;
+                // one more entry has been read in
+                break ;
+            }
         }
+
+    }
+    else
+    {
+
+        //----------------------------------------------------------------------
+        // coordinate format: read and parse the entries in parallel
+        //----------------------------------------------------------------------
+
+        LG_TRY (read_coordinate (&T, &nvals2, &line, s, nvals, msg)) ;
     }
 
     //--------------------------------------------------------------------------
@@ -1049,3 +1583,19 @@ int LAGraph_MMRead
     LG_FREE_WORK ;
     return (GrB_SUCCESS) ;
 }
+
+//------------------------------------------------------------------------------
+// LAGraph_MMRead
+//------------------------------------------------------------------------------
+
+int LAGraph_MMRead
+(
+    // output:
+    GrB_Matrix *A,  // handle of matrix to create
+    // input:
+    FILE *f,        // file to read from, already open
+    char *msg
+)
+{
+    return (LG_MMRead (A, f, false, NULL, msg)) ;
+}
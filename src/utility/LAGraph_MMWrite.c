@@ -29,38 +29,98 @@
 #include "LG_internal.h"
 
 #undef  LG_FREE_WORK
-#define LG_FREE_WORK                    \
-{                                       \
-    LAGraph_Free ((void **) &I, NULL) ; \
-    LAGraph_Free ((void **) &J, NULL) ; \
-    LAGraph_Free ((void **) &K, NULL) ; \
-    LAGraph_Free ((void **) &X, NULL) ; \
-    GrB_free (&AT) ;                    \
-    GrB_free (&M) ;                     \
-    GrB_free (&C) ;                     \
+#define LG_FREE_WORK                        \
+{                                           \
+    LAGraph_Free ((void **) &I, NULL) ;     \
+    LAGraph_Free ((void **) &J, NULL) ;     \
+    LAGraph_Free ((void **) &K, NULL) ;     \
+    LAGraph_Free ((void **) &X, NULL) ;     \
+    LAGraph_Free ((void **) &Buf, NULL) ;   \
+    LAGraph_Free ((void **) &Work, NULL) ;  \
+    GrB_free (&AT) ;                        \
+    GrB_free (&M) ;                         \
+    GrB_free (&C) ;                         \
 }
 
 #undef  LG_FREE_ALL
 #define LG_FREE_ALL LG_FREE_WORK
 
+// The entries are formatted in parallel, in rounds.  In each round, each task
+// formats up to CHUNK entries into its own part of the buffer, and then the
+// parts are written to the file in order, with one fwrite each.  A single
+// line is never longer than MAXENTRY bytes: two indices of up to 20 digits
+// each, and a value of at most 26 characters.
+#define CHUNK (64*1024)
+#define MAXENTRY 96
+
+//------------------------------------------------------------------------------
+// print_uint64, print_int64: print an integer to a string
+//------------------------------------------------------------------------------
+
+// These give the same result as sprintf with "%" PRIu64 or "%" PRId64, and
+// return a pointer to the end of the string (which is not null-terminated).
+
+static inline char *print_uint64
+(
+    char *p,        // string to print to
+    uint64_t x      // value to print
+)
+{
+    char t [24] ;
+    int n = 0 ;
+    do
+    {
+        t [n++] = (char) ('0' + (x % 10)) ;
+        x /= 10 ;
+    }
+    while (x > 0) ;
+    while (n > 0)
+    {
+        *(p++) = t [--n] ;
+    }
+    return (p) ;
+}
+
+static inline char *print_int64
+(
+    char *p,        // string to print to
+    int64_t x       // value to print
+)
+{
+    if (x < 0)
+    {
+        *(p++) = '-' ;
+        // this also works for INT64_MIN
+        return (print_uint64 (p, ((uint64_t) 0) - ((uint64_t) x))) ;
+    }
+    return (print_uint64 (p, (uint64_t) x)) ;
+}
+
 //------------------------------------------------------------------------------
 // print_double
 //------------------------------------------------------------------------------
 
-// Print a double value to the file, using the shortest format that ensures the
-// value is written precisely.  Returns true if successful, false if an I/O
-// error occurred.
+// Print a double value to a string, using the shortest format that ensures the
+// value is written precisely.  The value is printed with "%.*g", with the
+// smallest precision (of at least 6) that gives the same value when read back
+// in, and the exponent and any leading zero are then shortened.  Returns a
+// pointer to the end of the string (which is not null-terminated).
+
+// Values that are integers of magnitude less than 2^53 (such as the weights of
+// many graphs) are printed directly, without sprintf and strtod.  The number
+// of significant decimal digits of such a value is exact, and "%.*g" prints it
+// without a decimal point, unless its exponent is at least the precision.
 
-static bool print_double
+static char *print_double
 (
-    FILE *f,        // file to print to
+    char *p,        // string to print to, of size at least MAXENTRY
     double x        // value to print
 )
 {
 
-    char s [MAXLINE], *p ;
+    char s [MAXLINE], *q ;
     int64_t i, dest = 0, src = 0 ;
-    int width, ok ;
+    int width ;
 
     //--------------------------------------------------------------------------
     // handle Inf and NaN
@@ -68,11 +128,58 @@ static bool print_double
 
     if (isnan (x))
     {
-        return (fprintf (f, "nan") > 0) ;
+        memcpy (p, "nan", 3) ;
+        return (p + 3) ;
     }
     if (isinf (x))
     {
-        return (fprintf (f, (x < 0) ? "-inf" : "inf") > 0) ;
+        if (x < 0) *(p++) = '-' ;
+        memcpy (p, "inf", 3) ;
+        return (p + 3) ;
+    }
+
+    //--------------------------------------------------------------------------
+    // handle integers
+    //--------------------------------------------------------------------------
+
+    double ax = fabs (x) ;
+    if (ax < 9007199254740992.0 && ax == (double) ((int64_t) ax))
+    {
+        // get the decimal digits of the integer, in reverse order
+        uint64_t m = (uint64_t) ax ;
+        char t [24] ;
+        int ndigits = 0 ;
+        do
+        {
+            t [ndigits++] = (char) ('0' + (m % 10)) ;
+            m /= 10 ;
+        }
+        while (m > 0) ;
+        // find the number of significant digits
+        int nzeros = 0 ;
+        while (nzeros < ndigits - 1 && t [nzeros] == '0') nzeros++ ;
+        int nsig = ndigits - nzeros ;
+        width = LAGRAPH_MAX (nsig, 6) ;
+        int exponent = ndigits - 1 ;
+        if (signbit (x)) *(p++) = '-' ;
+        if (exponent < width)
+        {
+            // "%.*g" prints all the digits
+            for (int k = ndigits - 1 ; k >= 0 ; k--) *(p++) = t [k] ;
+        }
+        else
+        {
+            // "%.*g" prints the significant digits with an exponent
+            *(p++) = t [ndigits - 1] ;
+            if (nsig > 1)
+            {
+                *(p++) = '.' ;
+                for (int k = ndigits - 2 ; k >= nzeros ; k--) *(p++) = t [k] ;
+            }
+            *(p++) = 'e' ;
+            p = print_uint64 (p, (uint64_t) exponent) ;
+        }
+        return (p) ;
     }
 
     //--------------------------------------------------------------------------
@@ -81,9 +188,8 @@ static bool print_double
 
     for (width = 6 ; width < 20 ; width++)
     {
-        double y ;
-        sprintf (s, "%.*g", width, x) ;
-        sscanf (s, "%lg", &y) ;
+        snprintf (s, MAXLINE, "%.*g", width, x) ;
+        double y = strtod (s, NULL) ;
         if (x == y) break ;
     }
 
@@ -134,38 +240,65 @@ static bool print_double
     }
 
     // delete the leading "0" if present and not necessary
-    p = s ;
+    q = s ;
     s [MAXLINE-1] = '\0' ;
     i = strlen (s) ;
     if (i > 2 && s [0] == '0' && s [1] == '.')
     {
         // change "0.x" to ".x"
-        p = s + 1 ;
+        q = s + 1 ;
     }
     else if (i > 3 && s [0] == '-' && s [1] == '0' && s [2] == '.')
     {
         // change "-0.x" to "-.x"
         s [1] = '-' ;
-        p = s + 1 ;
+        q = s + 1 ;
     }
 
-#if 0
-    // double-check
-    i = sscanf (p, "%lg", &z) ;
-    if (i != 1 || y != z)
-    {
-        // oops! something went wrong in the "e+0" edit, above.
-        // this "cannot" happen
-        sprintf (s, "%.*g", width, x) ;
-        p = s ;
-    }
-#endif
-
     //--------------------------------------------------------------------------
-    // print the value to the file
+    // copy the value to the output string
     //--------------------------------------------------------------------------
 
-    return (fprintf (f, "%s", p) > 0) ;
+    size_t len = strlen (q) ;
+    memcpy (p, q, len) ;
+    return (p + len) ;
+}
+
+//------------------------------------------------------------------------------
+// print_value: print the kth entry of an array of values
+//------------------------------------------------------------------------------
+
+// The type of the array X is given by its position in this list:
+typedef enum
+{
+    MM_BOOL = 0, MM_INT8, MM_INT16, MM_INT32, MM_INT64, MM_UINT8,
+    MM_UINT16, MM_UINT32, MM_UINT64, MM_FP32, MM_FP64
+}
+MM_code_enum ;
+
+static inline char *print_value
+(
+    char *p,            // string to print to
+    MM_code_enum code,  // type of X
+    const void *X,      // array of values
+    GrB_Index k         // entry to print
+)
+{
+    switch (code)
+    {
+        case MM_BOOL  : return (print_uint64 (p, ((bool     *) X) [k])) ;
+        case MM_INT8  : return (print_int64  (p, ((int8_t   *) X) [k])) ;
+        case MM_INT16 : return (print_int64  (p, ((int16_t  *) X) [k])) ;
+        case MM_INT32 : return (print_int64  (p, ((int32_t  *) X) [k])) ;
+        case MM_INT64 : return (print_int64  (p, ((int64_t  *) X) [k])) ;
+        case MM_UINT8 : return (print_uint64 (p, ((uint8_t  *) X) [k])) ;
+        case MM_UINT16: return (print_uint64 (p, ((uint16_t *) X) [k])) ;
+        case MM_UINT32: return (print_uint64 (p, ((uint32_t *) X) [k])) ;
+        case MM_UINT64: return (print_uint64 (p, ((uint64_t *) X) [k])) ;
+        case MM_FP32  : return (print_double (p, ((float    *) X) [k])) ;
+        default:
+        case MM_FP64  : return (print_double (p, ((double   *) X) [k])) ;
+    }
 }
 
 //------------------------------------------------------------------------------
@@ -189,6 +322,8 @@ int LAGraph_MMWrite
     LG_CLEAR_MSG ;
     void *X = NULL ;
     GrB_Index *I = NULL, *J = NULL, *K = NULL ;
+    char *Buf = NULL ;
+    int64_t *Work = NULL ;
     GrB_Matrix M = NULL, AT = NULL, C = NULL ;
     LG_ASSERT (A != NULL, GrB_NULL_POINTER) ;
     LG_ASSERT (f != NULL, GrB_NULL_POINTER) ;
@@ -480,7 +615,7 @@ int LAGraph_MMWrite
     }
 
     //--------------------------------------------------------------------------
-    // extract and print tuples
+    // extract the tuples
     //--------------------------------------------------------------------------
 
     LG_TRY (LAGraph_Malloc ((void **) &I, nvals, sizeof (GrB_Index), msg)) ;
@@ -491,76 +626,103 @@ int LAGraph_MMWrite
         K [k] = k ;
     }
 
-    GrB_Index nvals_printed = 0 ;
-    bool coord = (MM_fmt == MM_coordinate) ;
+    MM_code_enum code = MM_FP64 ;
 
-    #define WRITE_TUPLES(ctype,is_unsigned,is_signed,is_real,is_complex)    \
+    #define EXTRACT_TUPLES(ctype,xcode)                                     \
     {                                                                       \
-        ctype *X = NULL ;                                                   \
         LG_TRY (LAGraph_Malloc ((void **) &X, nvals, sizeof (ctype), msg)) ;\
-        GRB_TRY (GrB_Matrix_extractTuples (I, J, X, &nvals, A)) ;           \
-        LG_TRY (LG_msort3 ((int64_t *) J, (int64_t *) I,                    \
-            (int64_t *) K, nvals, msg)) ;                                   \
-        for (int64_t k = 0 ; k < nvals ; k++)                               \
-        {                                                                   \
-            /* convert the row and column index to 1-based */               \
-            GrB_Index i = I [k] + 1 ;                                       \
-            GrB_Index j = J [k] + 1 ;                                       \
-            ctype     x = X [K [k]] ;                                       \
-            if (is_general || i >= j)                                       \
-            {                                                               \
-                /* print the row and column index of the tuple */           \
-                if (coord) FPRINTF (f, "%" PRIu64 " %" PRIu64 " ", i, j) ;  \
-                /* print the value of the tuple */                          \
-                if (is_structural)                                          \
-                {                                                           \
-                    /* print nothing */ ;                                   \
-                }                                                           \
-                else if (is_unsigned)                                       \
-                {                                                           \
-                    FPRINTF (f, "%" PRIu64, (uint64_t) x) ;                 \
-                }                                                           \
-                else if (is_signed)                                         \
-                {                                                           \
-                    FPRINTF (f, "%" PRId64, (int64_t) x) ;                  \
-                }                                                           \
-                else if (is_real)                                           \
-                {                                                           \
-                    LG_ASSERT_MSG (print_double (f, (double) x),            \
-                        LAGRAPH_IO_ERROR, "Unable to write to file") ;      \
-                }                                                           \
-            /*  else if (is_complex)                                 */     \
-            /*  {                                                    */     \
-            /*      LG_ASSERT_MSG (print_double (f, creal (x)),      */     \
-            /*          LAGRAPH_IO_ERROR,                            */     \
-            /*          "Unable to write to file") ;                 */     \
-            /*      FPRINTF (f, " ") ;                               */     \
-            /*      LG_ASSERT_MSG (print_double (f, cimag (x)),      */     \
-            /*          LAGRAPH_IO_ERROR,                            */     \
-            /*          "Unable to write to file") ;                 */     \
-            /*  }                                                    */     \
-                FPRINTF (f, "\n") ;                                         \
-            }                                                               \
-            nvals_printed++ ;                                               \
-        }                                                                   \
-        LG_TRY (LAGraph_Free ((void **) &X, NULL)) ;                        \
+        GRB_TRY (GrB_Matrix_extractTuples (I, J, (ctype *) X, &nvals, A)) ; \
+        code = xcode ;                                                      \
     }
 
-    if      (type == GrB_BOOL   ) WRITE_TUPLES (bool    , 1, 0, 0, 0)
-    else if (type == GrB_INT8   ) WRITE_TUPLES (int8_t  , 0, 1, 0, 0)
-    else if (type == GrB_INT16  ) WRITE_TUPLES (int16_t , 0, 1, 0, 0)
-    else if (type == GrB_INT32  ) WRITE_TUPLES (int32_t , 0, 1, 0, 0)
-    else if (type == GrB_INT64  ) WRITE_TUPLES (int64_t , 0, 1, 0, 0)
-    else if (type == GrB_UINT8  ) WRITE_TUPLES (uint8_t , 1, 0, 0, 0)
-    else if (type == GrB_UINT16 ) WRITE_TUPLES (uint16_t, 1, 0, 0, 0)
-    else if (type == GrB_UINT32 ) WRITE_TUPLES (uint32_t, 1, 0, 0, 0)
-    else if (type == GrB_UINT64 ) WRITE_TUPLES (uint64_t, 1, 0, 0, 0)
-    else if (type == GrB_FP32   ) WRITE_TUPLES (float   , 0, 0, 1, 0)
-    else if (type == GrB_FP64   ) WRITE_TUPLES (double  , 0, 0, 1, 0)
-    #if 0
-    else if (type == GxB_FC32   ) WRITE_TUPLES (GxB_FC32_t, 0, 0, 0, 1) ;
-    else if (type == GxB_FC64   ) WRITE_TUPLES (GxB_FC64_t, 0, 0, 0, 1) ;
-    #endif
+    if      (type == GrB_BOOL   ) EXTRACT_TUPLES (bool    , MM_BOOL  )
+    else if (type == GrB_INT8   ) EXTRACT_TUPLES (int8_t  , MM_INT8  )
+    else if (type == GrB_INT16  ) EXTRACT_TUPLES (int16_t , MM_INT16 )
+    else if (type == GrB_INT32  ) EXTRACT_TUPLES (int32_t , MM_INT32 )
+    else if (type == GrB_INT64  ) EXTRACT_TUPLES (int64_t , MM_INT64 )
+    else if (type == GrB_UINT8  ) EXTRACT_TUPLES (uint8_t , MM_UINT8 )
+    else if (type == GrB_UINT16 ) EXTRACT_TUPLES (uint16_t, MM_UINT16)
+    else if (type == GrB_UINT32 ) EXTRACT_TUPLES (uint32_t, MM_UINT32)
+    else if (type == GrB_UINT64 ) EXTRACT_TUPLES (uint64_t, MM_UINT64)
+    else if (type == GrB_FP32   ) EXTRACT_TUPLES (float   , MM_FP32  )
+    else if (type == GrB_FP64   ) EXTRACT_TUPLES (double  , MM_FP64  )
+
+    // sort the tuples by column, and by row within each column
+    LG_TRY (LG_msort3 ((int64_t *) J, (int64_t *) I, (int64_t *) K, nvals,
+        msg)) ;
+
+    //--------------------------------------------------------------------------
+    // print the tuples
+    //--------------------------------------------------------------------------
+
+    // each task formats its entries into its own part of Buf
+    int nthreads = LG_nthreads_outer * LG_nthreads_inner ;
+    nthreads = LAGRAPH_MAX (nthreads, 1) ;
+    int64_t chunk = LAGRAPH_MIN (CHUNK, nvals) ;
+    int64_t ntasks = LAGRAPH_MIN (nthreads, (nvals + chunk - 1) / chunk) ;
+    LG_TRY (LAGraph_Malloc ((void **) &Buf, ntasks * chunk, MAXENTRY, msg)) ;
+    LG_TRY (LAGraph_Malloc ((void **) &Work, 2 * ntasks, sizeof (int64_t),
+        msg)) ;
+    int64_t *Tlen = Work ;              // # of bytes formatted by each task
+    int64_t *Tprinted = Work + ntasks ; // # of entries printed by each task
+
+    GrB_Index nvals_printed = 0 ;
+    bool coord = (MM_fmt == MM_coordinate) ;
+
+    for (int64_t k0 = 0 ; k0 < nvals ; k0 += ntasks * chunk)
+    {
+
+        //----------------------------------------------------------------------
+        // format entries k0 to k0+ntasks*chunk-1 in parallel
+        //----------------------------------------------------------------------
+
+        int64_t t ;
+        #pragma omp parallel for num_threads(nthreads) schedule(static,1)
+        for (t = 0 ; t < ntasks ; t++)
+        {
+            int64_t kfirst = k0 + t * chunk ;
+            int64_t klast = LAGRAPH_MIN (kfirst + chunk, (int64_t) nvals) ;
+            char *pstart = Buf + t * chunk * MAXENTRY ;
+            char *p = pstart ;
+            int64_t printed = 0 ;
+            for (int64_t k = kfirst ; k < klast ; k++)
+            {
+                // convert the row and column index to 1-based
+                GrB_Index i = I [k] + 1 ;
+                GrB_Index j = J [k] + 1 ;
+                if (!(is_general || i >= j)) continue ;
+                // print the row and column index of the tuple
+                if (coord)
+                {
+                    p = print_uint64 (p, i) ;
+                    *(p++) = ' ' ;
+                    p = print_uint64 (p, j) ;
+                    *(p++) = ' ' ;
+                }
+                // print the value of the tuple, unless structural
+                if (!is_structural)
+                {
+                    p = print_value (p, code, X, K [k]) ;
+                }
+                *(p++) = '\n' ;
+                printed++ ;
+            }
+            Tlen [t] = p - pstart ;
+            Tprinted [t] = printed ;
+        }
+
+        //----------------------------------------------------------------------
+        // write the formatted entries to the file, in order
+        //----------------------------------------------------------------------
+
+        for (t = 0 ; t < ntasks ; t++)
+        {
+            size_t len = (size_t) Tlen [t] ;
+            LG_ASSERT_MSG (fwrite (Buf + t * chunk * MAXENTRY, sizeof (char),
+                len, f) == len, LAGRAPH_IO_ERROR, "Unable to write to file") ;
+            nvals_printed += Tprinted [t] ;
+        }
+    }
 
     ASSERT (nvals_to_print == nvals_printed) ;
 
@@ -0,0 +1,278 @@
+//------------------------------------------------------------------------------
+// LG_Cached_Budget: memory footprint and budget for cached properties
+//------------------------------------------------------------------------------
+
+// LAGraph, (c) 2019-2022 by The LAGraph Contributors, All Rights Reserved.
+// SPDX-License-Identifier: BSD-2-Clause
+//
+// For additional details (including references to third party source code and
+// other files) see the LICENSE file or contact permission@sei.cmu.edu. See
+// Contributors.txt for a full list of contributors. Created, in part, with
+// funding and support from the U.S. Government (see Acknowledgments.txt file).
+// DM22-0790
+
+//------------------------------------------------------------------------------
+
+// These are the internal methods behind LAGraph_Cached_Footprint,
+// LAGraph_Cached_Trim, and LAGraph_Cached_TrimToBudget in LAGraphX.h (see
+// experimental/utility/LAGraph_Cached_Budget.c for a description).  They are
+// in the core library so that LAGraph_Cached_AT, LAGraph_Cached_OutDegree, and
+// LAGraph_Cached_InDegree can apply the global budget, LG_cached_budget, once
+// they have computed their property:
+
+// LG_Cached_TrimToBudget (G, keep, msg): deletes cached properties of G, other
+//      than those in keep, until they hold no more than LG_cached_budget
+//      bytes.  It does nothing if there is no budget (LG_cached_budget is
+//      SIZE_MAX, the default).
+
+// It must be called only when G has just been modified, never on a path where
+// G is only read, so that a graph prepared by LAGraph_Freeze can still be
+// shared with no locking.
+
+//------------------------------------------------------------------------------
+
+#define LG_FREE_ALL ;
+
+#include "LG_internal.h"
+
+//------------------------------------------------------------------------------
+// LG_Cached_TrimToBudget: trim cached properties to the global budget
+//------------------------------------------------------------------------------
+
+int LG_Cached_TrimToBudget
+(
+    // input/output:
+    LAGraph_Graph G,        // graph whose cached properties are trimmed
+    // input:
+    int keep,               // bitmask of LAGRAPH_CACHE_* properties to keep
+    char *msg
+)
+{
+    LG_CLEAR_MSG_AND_BASIC_ASSERT (G, msg) ;
+    if (LG_cached_budget == SIZE_MAX)
+    {
+        // no budget
+        return (GrB_SUCCESS) ;
+    }
+    return (LG_Cached_Trim (G, LG_cached_budget, keep, msg)) ;
+}
+
+//------------------------------------------------------------------------------
+// matrix_bytes, vector_bytes, scalar_bytes: memory held by a GrB object
+//------------------------------------------------------------------------------
+
+// Without SuiteSparse:GraphBLAS, the memory is estimated as the size of a
+// sparse CSR matrix or sparse vector.
+
+static int matrix_bytes (size_t *bytes, GrB_Matrix A, char *msg)
+{
+    (*bytes) = 0 ;
+    if (A == NULL) return (GrB_SUCCESS) ;
+    #if LAGRAPH_SUITESPARSE
+    GRB_TRY (GxB_Matrix_memoryUsage (bytes, A)) ;
+    #else
+    GrB_Index nrows, nvals ;
+    size_t typesize ;
+    GrB_Type type ;
+    char type_name [LAGRAPH_MAX_NAME_LEN] ;
+    GRB_TRY (GrB_Matrix_nrows (&nrows, A)) ;
+    GRB_TRY (GrB_Matrix_nvals (&nvals, A)) ;
+    LG_TRY (LAGraph_Matrix_TypeName (type_name, A, msg)) ;
+    LG_TRY (LAGraph_TypeFromName (&type, type_name, msg)) ;
+    LG_TRY (LAGraph_SizeOfType (&typesize, type, msg)) ;
+    (*bytes) = (nrows + 1) * sizeof (GrB_Index) +
+        nvals * (sizeof (GrB_Index) + typesize) ;
+    #endif
+    return (GrB_SUCCESS) ;
+}
+
+static int vector_bytes (size_t *bytes, GrB_Vector v, char *msg)
+{
+    (*bytes) = 0 ;
+    if (v == NULL) return (GrB_SUCCESS) ;
+    #if LAGRAPH_SUITESPARSE
+    GRB_TRY (GxB_Vector_memoryUsage (bytes, v)) ;
+    #else
+    // all degree vectors are GrB_INT64
+    GrB_Index nvals ;
+    GRB_TRY (GrB_Vector_nvals (&nvals, v)) ;
+    (*bytes) = nvals * (sizeof (GrB_Index) + sizeof (int64_t)) ;
+    #endif
+    return (GrB_SUCCESS) ;
+}
+
+static int scalar_bytes (size_t *bytes, GrB_Scalar s, char *msg)
+{
+    (*bytes) = 0 ;
+    if (s == NULL) return (GrB_SUCCESS) ;
+    #if LAGRAPH_SUITESPARSE
+    GRB_TRY (GxB_Scalar_memoryUsage (bytes, s)) ;
+    #else
+    (*bytes) = sizeof (double) ;
+    #endif
+    return (GrB_SUCCESS) ;
+}
+
+//------------------------------------------------------------------------------
+// LG_Cached_Footprint: bytes held by a set of cached properties
+//------------------------------------------------------------------------------
+
+int LG_Cached_Footprint
+(
+    // output:
+    size_t *bytes,          // bytes held by the selected cached properties
+    // input:
+    const LAGraph_Graph G,
+    int properties,         // bitmask of LAGRAPH_CACHE_* properties to count
+    char *msg
+)
+{
+
+    //--------------------------------------------------------------------------
+    // check inputs
+    //--------------------------------------------------------------------------
+
+    LG_CLEAR_MSG_AND_BASIC_ASSERT (G, msg) ;
+    LG_ASSERT (bytes != NULL, GrB_NULL_POINTER) ;
+    (*bytes) = 0 ;
+
+    //--------------------------------------------------------------------------
+    // sum up the bytes held by each property
+    //--------------------------------------------------------------------------
+
+    // G->nself_edges, G->is_symmetric_structure, and G->sssp_delta are held
+    // in G itself, and so they take no memory of their own.
+
+    size_t b ;
+    if (properties & LAGRAPH_CACHE_AT)
+    {
+        LG_TRY (matrix_bytes (&b, G->AT, msg)) ;
+        (*bytes) += b ;
+    }
+    if (properties & LAGRAPH_CACHE_OUT_DEGREE)
+    {
+        LG_TRY (vector_bytes (&b, G->out_degree, msg)) ;
+        (*bytes) += b ;
+    }
+    if (properties & LAGRAPH_CACHE_IN_DEGREE)
+    {
+        LG_TRY (vector_bytes (&b, G->in_degree, msg)) ;
+        (*bytes) += b ;
+    }
+    if (properties & LAGRAPH_CACHE_EMIN)
+    {
+        LG_TRY (scalar_bytes (&b, G->emin, msg)) ;
+        (*bytes) += b ;
+    }
+    if (properties & LAGRAPH_CACHE_EMAX)
+    {
+        LG_TRY (scalar_bytes (&b, G->emax, msg)) ;
+        (*bytes) += b ;
+    }
+    return (GrB_SUCCESS) ;
+}
+
+//------------------------------------------------------------------------------
+// LG_Cached_Trim: delete cached properties to keep within a budget
+//------------------------------------------------------------------------------
+
+int LG_Cached_Trim
+(
+    // input/output:
+    LAGraph_Graph G,        // graph whose cached properties are trimmed
+    // input:
+    size_t budget,          // max bytes for all cached properties of G
+    int keep,               // bitmask of LAGRAPH_CACHE_* properties to keep
+    char *msg
+)
+{
+
+    //--------------------------------------------------------------------------
+    // check inputs
+    //--------------------------------------------------------------------------
+
+    LG_CLEAR_MSG_AND_BASIC_ASSERT (G, msg) ;
+    size_t total ;
+    LG_TRY (LG_Cached_Footprint (&total, G, LAGRAPH_CACHE_ALL, msg)) ;
+    if (total <= budget)
+    {
+        // nothing to do
+        return (GrB_SUCCESS) ;
+    }
+
+    GrB_Index n, nvals ;
+    GRB_TRY (GrB_Matrix_nrows (&n, G->A)) ;
+    GRB_TRY (GrB_Matrix_nvals (&nvals, G->A)) ;
+
+    //--------------------------------------------------------------------------
+    // delete properties until the budget is met
+    //--------------------------------------------------------------------------
+
+    while (total > budget)
+    {
+        // find the property with the most bytes per unit of recompute work
+        size_t b, victim_bytes = 0 ;
+        double victim_ratio = -1 ;
+        int victim = 0 ;
+
+        if (G->AT != NULL && !(keep & LAGRAPH_CACHE_AT))
+        {
+            LG_TRY (LG_Cached_Footprint (&b, G, LAGRAPH_CACHE_AT, msg)) ;
+            double ratio = ((double) b) / ((double) (nvals + n + 1)) ;
+            if (ratio > victim_ratio)
+            {
+                victim = LAGRAPH_CACHE_AT ;
+                victim_ratio = ratio ;
+                victim_bytes = b ;
+            }
+        }
+        if (G->out_degree != NULL && !(keep & LAGRAPH_CACHE_OUT_DEGREE))
+        {
+            LG_TRY (LG_Cached_Footprint (&b, G, LAGRAPH_CACHE_OUT_DEGREE,
+                msg)) ;
+            double ratio = ((double) b) / ((double) (n + 1)) ;
+            if (ratio > victim_ratio)
+            {
+                victim = LAGRAPH_CACHE_OUT_DEGREE ;
+                victim_ratio = ratio ;
+                victim_bytes = b ;
+            }
+        }
+        if (G->in_degree != NULL && !(keep & LAGRAPH_CACHE_IN_DEGREE))
+        {
+            LG_TRY (LG_Cached_Footprint (&b, G, LAGRAPH_CACHE_IN_DEGREE,
+                msg)) ;
+            double work = (double) ((G->AT != NULL) ? n : (nvals + n)) ;
+            double ratio = ((double) b) / (work + 1) ;
+            if (ratio > victim_ratio)
+            {
+                victim = LAGRAPH_CACHE_IN_DEGREE ;
+                victim_ratio = ratio ;
+                victim_bytes = b ;
+            }
+        }
+
+        if (victim == 0)
+        {
+            // no more properties can be deleted
+            break ;
+        }
+
+        // delete the property
+        if (victim == LAGRAPH_CACHE_AT)
+        {
+            GRB_TRY (GrB_free (&(G->AT))) ;
+        }
+        else if (victim == LAGRAPH_CACHE_OUT_DEGREE)
+        {
+            GRB_TRY (GrB_free (&(G->out_degree))) ;
+        }
+        else
+        {
+            GRB_TRY (GrB_free (&(G->in_degree))) ;
+        }
+        total -= LAGRAPH_MIN (total, victim_bytes) ;
+    }
+
+    return (GrB_SUCCESS) ;
+}
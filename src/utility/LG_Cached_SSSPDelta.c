@@ -0,0 +1,108 @@
+//------------------------------------------------------------------------------
+// LG_Cached_SSSPDelta: choose Delta for delta-stepping SSSP on a graph
+//------------------------------------------------------------------------------
+
+// LAGraph, (c) 2019-2022 by The LAGraph Contributors, All Rights Reserved.
+// SPDX-License-Identifier: BSD-2-Clause
+//
+// For additional details (including references to third party source code and
+// other files) see the LICENSE file or contact permission@sei.cmu.edu. See
+// Contributors.txt for a full list of contributors. Created, in part, with
+// funding and support from the U.S. Government (see Acknowledgments.txt file).
+// DM22-0790
+
+//------------------------------------------------------------------------------
+
+// LG_Cached_SSSPDelta computes G->sssp_delta, the Delta used by
+// LAGraph_SingleSourceShortestPath, which calls it (with LG_SSSP_DELTA_TRIALS
+// probes) when G->sssp_delta is not known.  It is also the computation behind
+// LAGraph_Cached_SSSPDelta in LAGraphX.h.  G->emin, G->emax, and
+// G->out_degree are computed first, if not present.
+
+// Delta is estimated from the mean edge weight, the mean out-degree, and the
+// number of levels of a level-only BFS (see LG_sssp_delta.c).  A single
+// source says little about the graph as a whole: a BFS from a leaf, or from a
+// node in a small component, finds only a few levels.  Instead, up to ntrials
+// sources are spread evenly over the nodes with at least one out-edge, and
+// the largest number of levels found from any of them is used.
+
+// G->out_degree, if computed here, may then be deleted to keep within the
+// budget for cached properties (see LG_Cached_Budget.c); no other cached
+// property of G is deleted.
+
+//------------------------------------------------------------------------------
+
+#define LG_FREE_ALL                                 \
+{                                                   \
+    LAGraph_Free ((void **) &sources, NULL) ;       \
+}
+
+#include "LG_internal.h"
+
+int LG_Cached_SSSPDelta
+(
+    // input/output:
+    LAGraph_Graph G,        // graph whose Delta is computed
+    // input:
+    int64_t ntrials,        // max # of BFS probes
+    char *msg
+)
+{
+
+    //--------------------------------------------------------------------------
+    // check inputs
+    //--------------------------------------------------------------------------
+
+    GrB_Index *sources = NULL ;
+    LG_CLEAR_MSG_AND_BASIC_ASSERT (G, msg) ;
+    LG_ASSERT_MSG (ntrials > 0, GrB_INVALID_VALUE, "ntrials must be > 0") ;
+
+    GrB_Index n ;
+    GRB_TRY (GrB_Matrix_nrows (&n, G->A)) ;
+
+    // only G->out_degree may be trimmed, and only if it is computed here
+    int keep = (G->out_degree == NULL) ?
+        (LAGRAPH_CACHE_ALL & ~LAGRAPH_CACHE_OUT_DEGREE) : LAGRAPH_CACHE_ALL ;
+
+    // compute G->emin, G->emax, and G->out_degree, if not present
+    LG_TRY (LAGraph_Cached_EMin (G, msg)) ;
+    LG_TRY (LAGraph_Cached_EMax (G, msg)) ;
+    // G->out_degree is not trimmed here, but by the trim below
+    LG_TRY (LG_Cached_OutDegree (G, LAGRAPH_CACHE_ALL, msg)) ;
+
+    //--------------------------------------------------------------------------
+    // choose the sources of the BFS probes
+    //--------------------------------------------------------------------------
+
+    LG_TRY (LAGraph_Malloc ((void **) &sources, ntrials, sizeof (GrB_Index),
+        msg)) ;
+    int64_t nsources = 0 ;
+    GrB_Index src = 0 ;
+    for (int64_t trial = 0 ; trial < ntrials ; trial++)
+    {
+        // the next source with an out-edge, at or after (trial*n)/ntrials
+        src = LAGRAPH_MAX (src, (trial * n) / ntrials) ;
+        int64_t d = 0 ;
+        for ( ; src < n ; src++)
+        {
+            GrB_Info info = GrB_Vector_extractElement (&d, G->out_degree, src) ;
+            GRB_TRY (info) ;
+            if (info == GrB_SUCCESS && d > 0) break ;
+        }
+        if (src >= n) break ;
+        sources [nsources++] = src++ ;
+    }
+
+    //--------------------------------------------------------------------------
+    // choose Delta from the probes
+    //--------------------------------------------------------------------------
+
+    double delta ;
+    int64_t nlevels ;
+    LG_TRY (LG_sssp_delta (&delta, &nlevels, G, sources, nsources, msg)) ;
+    G->sssp_delta = delta ;
+
+    LG_FREE_ALL ;
+    LG_TRY (LG_Cached_TrimToBudget (G, keep, msg)) ;
+    return (GrB_SUCCESS) ;
+}
@@ -349,6 +349,277 @@ MM_storage_enum ;
 #define MMLEN 1024
 #define MAXLINE MMLEN+6
 
+//------------------------------------------------------------------------------
+// text scanners
+//------------------------------------------------------------------------------
+
+// The LG_scan_* functions parse a single number from a null-terminated
+// string, in place of sscanf.  They skip leading white space and advance *p
+// past the number.  They return true if successful, or false if no number is
+// present (*p is not modified in that case).  White space is the same as
+// isspace in the "C" locale, and only decimal integers are recognized.
+
+#define LG_ISSPACE(c) ((c) == ' ' || ((c) >= '\t' && (c) <= '\r'))
+#define LG_ISDIGIT(c) ((c) >= '0' && (c) <= '9')
+
+// LG_scan_uint64: same as sscanf (s, "%" SCNu64, x).  On overflow, the result
+// is UINT64_MAX.  A leading minus sign negates the result modulo 2^64.
+static inline bool LG_scan_uint64
+(
+    char **p,           // string to parse; advanced past the number
+    uint64_t *x         // number read in
+)
+{
+    char *s = (*p) ;
+    while (LG_ISSPACE (*s)) s++ ;
+    bool negative = (*s == '-') ;
+    if (*s == '-' || *s == '+') s++ ;
+    if (!LG_ISDIGIT (*s)) return (false) ;
+    uint64_t v = 0 ;
+    bool overflow = false ;
+    for ( ; LG_ISDIGIT (*s) ; s++)
+    {
+        uint64_t d = (uint64_t) (*s - '0') ;
+        if (v > (UINT64_MAX - d) / 10)
+        {
+            overflow = true ;
+        }
+        else
+        {
+            v = 10 * v + d ;
+        }
+    }
+    (*x) = overflow ? UINT64_MAX : (negative ? (0 - v) : v) ;
+    (*p) = s ;
+    return (true) ;
+}
+
+// LG_scan_int64: same as sscanf (s, "%" SCNd64, x).  On overflow, the result
+// is INT64_MAX or INT64_MIN.
+static inline bool LG_scan_int64
+(
+    char **p,           // string to parse; advanced past the number
+    int64_t *x          // number read in
+)
+{
+    char *s = (*p) ;
+    while (LG_ISSPACE (*s)) s++ ;
+    bool negative = (*s == '-') ;
+    if (*s == '-' || *s == '+') s++ ;
+    if (!LG_ISDIGIT (*s)) return (false) ;
+    uint64_t v = 0 ;
+    for ( ; LG_ISDIGIT (*s) ; s++)
+    {
+        uint64_t d = (uint64_t) (*s - '0') ;
+        // saturate at 2^63, the largest magnitude of interest
+        v = (v > ((UINT64_C (1) << 63) - d) / 10) ?
+            (UINT64_C (1) << 63) : (10 * v + d) ;
+    }
+    if (negative)
+    {
+        (*x) = (v >= (UINT64_C (1) << 63)) ? INT64_MIN : (- (int64_t) v) ;
+    }
+    else
+    {
+        (*x) = (v >= (UINT64_C (1) << 63)) ? INT64_MAX : ((int64_t) v) ;
+    }
+    (*p) = s ;
+    return (true) ;
+}
+
+// LG_scan_double: same as sscanf (s, "%lg", x), except that inf, +inf, -inf,
+// and nan are also recognized, in any case.  Only the first 3 letters of inf*
+// or nan* are significant, and the rest are ignored.  Short decimal numbers
+// are converted directly; all others are converted with strtod, so the result
+// is always correctly rounded.
+bool LG_scan_double
+(
+    char **p,           // string to parse; advanced past the number
+    double *x           // number read in
+) ;
+
+//------------------------------------------------------------------------------
+// LG_stream: read from a file that may be compressed with gzip or zstd
+//------------------------------------------------------------------------------
+
+// An LG_stream reads from a FILE that is already open.  The format of the file
+// (plain, gzip, or zstd) is determined from its first few bytes, and
+// compressed data is decompressed by a separate thread, ahead of the reader.
+// LG_stream_close frees the stream but does not close the FILE.
+
+typedef struct LG_stream_struct *LG_stream ;
+
+LAGRAPH_PUBLIC
+int LG_stream_open
+(
+    // output:
+    LG_stream *stream,      // the stream
+    // input:
+    FILE *f,                // file to read from, already open
+    char *msg
+) ;
+
+LAGRAPH_PUBLIC
+void LG_stream_close
+(
+    LG_stream *stream
+) ;
+
+// LG_stream_read: same as fread (p, 1, n, f)
+LAGRAPH_PUBLIC
+size_t LG_stream_read       // returns # of bytes read
+(
+    void *p,                // output buffer of size n
+    size_t n,               // # of bytes to read
+    LG_stream s
+) ;
+
+// LG_stream_gets: same as fgets (buf, n, f)
+LAGRAPH_PUBLIC
+char *LG_stream_gets        // returns buf, or NULL if at the end of the file
+(
+    char *buf,              // output buffer of size n
+    int n,                  // size of buf
+    LG_stream s
+) ;
+
+// LG_stream_compressed: true if the file is compressed
+LAGRAPH_PUBLIC
+bool LG_stream_compressed (LG_stream s) ;
+
+// LG_stream_error: true if the end of valid compressed data has been reached
+// because the data is truncated or corrupted
+LAGRAPH_PUBLIC
+bool LG_stream_error (LG_stream s) ;
+
+// LG_stream_getpos and LG_stream_setpos: same as fgetpos and fsetpos, for a
+// plain file only.  Both return true if successful.
+LAGRAPH_PUBLIC
+bool LG_stream_getpos (LG_stream s, fpos_t *pos) ;
+LAGRAPH_PUBLIC
+bool LG_stream_setpos (LG_stream s, const fpos_t *pos) ;
+
+//------------------------------------------------------------------------------
+// LG_lines: read a text file in large blocks of whole lines
+//------------------------------------------------------------------------------
+
+// LG_lines reads a text file from an LG_stream in large blocks of whole lines,
+// and splits each block into chunks of whole lines that can be parsed in
+// parallel.  Chunk t of the current block is Buf [Tstart [t]:Tstart [t+1]-1].
+
+typedef struct
+{
+    LG_stream f ;           // stream to read from (owned by the caller)
+    char *Buf ;             // block buffer, of size bufsize+1
+    size_t bufsize ;        // size of Buf, not including the trailing byte
+    size_t len ;            // # of bytes held in Buf
+    size_t end ;            // Buf [0:end-1] is the current block
+    bool eof ;              // true if the end of the stream has been reached
+    int ntasks_max ;        // max # of chunks in a block
+    int ntasks ;            // # of chunks in the current block
+    int64_t *Tstart ;       // chunk boundaries, of size ntasks_max+1
+}
+LG_lines ;
+
+LAGRAPH_PUBLIC
+int LG_lines_init
+(
+    // output:
+    LG_lines *L,            // the lines of the stream
+    // input:
+    LG_stream f,            // stream to read from
+    size_t bufsize,         // initial size of the block buffer
+    int ntasks_max,         // max # of chunks in each block
+    char *msg
+) ;
+
+// LG_lines_next: read the next block; L->ntasks is zero at the end of the file
+LAGRAPH_PUBLIC
+int LG_lines_next
+(
+    LG_lines *L,            // the lines of the stream
+    char *msg
+) ;
+
+LAGRAPH_PUBLIC
+void LG_lines_free
+(
+    LG_lines *L
+) ;
+
+//------------------------------------------------------------------------------
+// LG_writer: write a sequence of buffers to a file, on a separate thread
+//------------------------------------------------------------------------------
+
+// An LG_writer writes each buffer given to LG_writer_put to a FILE that is
+// already open, and then frees it.  The write is done by a separate thread,
+// so the caller can compute the next buffer while the last one is written.
+// LG_writer_close waits for all writes to finish, but does not close the FILE.
+
+typedef struct LG_writer_struct *LG_writer ;
+
+LAGRAPH_PUBLIC
+int LG_writer_open
+(
+    // output:
+    LG_writer *writer_handle,   // the writer
+    // input:
+    FILE *f,                    // file to write to, already open
+    char *msg
+) ;
+
+LAGRAPH_PUBLIC
+int LG_writer_put
+(
+    LG_writer w,                // the writer
+    void **buf,                 // buffer to write; NULL on output
+    size_t size,                // size of the buffer, in bytes
+    char *msg
+) ;
+
+LAGRAPH_PUBLIC
+int LG_writer_close
+(
+    LG_writer *writer_handle,   // the writer; NULL on output
+    char *msg
+) ;
+
+//------------------------------------------------------------------------------
+// LG_ftell and LG_fseek: file positions beyond 2GB
+//------------------------------------------------------------------------------
+
+#if defined ( _WIN32 )
+#define LG_ftell(f)         ((int64_t) _ftelli64 (f))
+#define LG_fseek(f,pos,how) _fseeki64 (f, (__int64) (pos), how)
+#elif defined ( __linux__ ) || defined ( __APPLE__ ) || defined ( __unix__ )
+#define LG_ftell(f)         ((int64_t) ftello (f))
+#define LG_fseek(f,pos,how) fseeko (f, (off_t) (pos), how)
+#else
+#define LG_ftell(f)         ((int64_t) ftell (f))
+#define LG_fseek(f,pos,how) fseek (f, (long) (pos), how)
+#endif
+
+//------------------------------------------------------------------------------
+// LG_MMRead: read a matrix from a Matrix Market file
+//------------------------------------------------------------------------------
+
+// LG_MMRead is the same as LAGraph_MMRead, except that if low_memory is true,
+// a matrix in coordinate format is read in two passes over the file, directly
+// into the CSR arrays of the result, without the I, J, and X triplet arrays.
+// If symmetric is not NULL, it returns true if the Matrix Market header is
+// symmetric, skew-symmetric, or Hermitian.
+LAGRAPH_PUBLIC
+int LG_MMRead
+(
+    // output:
+    GrB_Matrix *A,      // handle of matrix to create
+    // input:
+    FILE *f,            // file to read from, already open
+    bool low_memory,    // if true, do not use triplets for coordinate format
+    bool *symmetric,    // if not NULL, true if the header is not "general"
+    char *msg
+) ;
+
 //------------------------------------------------------------------------------
 // LG_PART and LG_PARTITION: definitions for partitioning an index range
 //------------------------------------------------------------------------------
@@ -584,6 +855,128 @@ int LG_nself_edges
     char *msg               // error message
 ) ;
 
+//------------------------------------------------------------------------------
+// choose Delta for delta-stepping SSSP
+//------------------------------------------------------------------------------
+
+// LG_sssp_delta: choose Delta for LAGr_SingleSourceShortestPath, from the
+// mean edge weight and out-degree of G, and the number of BFS levels from a
+// set of sources.  G is not modified.  See src/utility/LG_sssp_delta.c.
+
+LAGRAPH_PUBLIC
+int LG_sssp_delta
+(
+    // output:
+    double *delta,              // Delta for delta stepping on G
+    int64_t *nlevels,           // max # of BFS levels from the sources
+    // input:
+    const LAGraph_Graph G,      // graph to search, not modified
+    const GrB_Index *sources,   // sources of the BFS probes
+    int64_t nsources,           // # of sources
+    char *msg
+) ;
+
+// LG_Cached_SSSPDelta: compute G->sssp_delta from up to ntrials BFS probes,
+// spread over the nodes of G with at least one out-edge.  G->emin, G->emax,
+// and G->out_degree are computed first, if not present; G->out_degree, if
+// computed here, may then be trimmed.  See src/utility/LG_Cached_SSSPDelta.c.
+
+LAGRAPH_PUBLIC
+int LG_Cached_SSSPDelta
+(
+    // input/output:
+    LAGraph_Graph G,        // graph whose Delta is computed
+    // input:
+    int64_t ntrials,        // max # of BFS probes
+    char *msg
+) ;
+
+// # of BFS probes used to compute G->sssp_delta, by
+// LAGraph_SingleSourceShortestPath and LAGraph_Cached_Ensure
+#define LG_SSSP_DELTA_TRIALS 8
+
+//------------------------------------------------------------------------------
+// memory budget for cached properties
+//------------------------------------------------------------------------------
+
+// See src/utility/LG_Cached_Budget.c.  The properties are given as a bitmask
+// of LAGRAPH_CACHE_* values (see LAGraph_Cached_Property in LAGraph.h).
+
+LAGRAPH_PUBLIC extern
+size_t LG_cached_budget ;   // max bytes for the cached properties of a graph.
+                            // Default: SIZE_MAX (no budget).
+
+// LG_Cached_Footprint: bytes held by a set of cached properties of G
+LAGRAPH_PUBLIC
+int LG_Cached_Footprint
+(
+    // output:
+    size_t *bytes,          // bytes held by the selected cached properties
+    // input:
+    const LAGraph_Graph G,
+    int properties,         // bitmask of LAGRAPH_CACHE_* properties to count
+    char *msg
+) ;
+
+// LG_Cached_Trim: delete cached properties of G, other than those in keep,
+// until they hold no more than budget bytes
+LAGRAPH_PUBLIC
+int LG_Cached_Trim
+(
+    // input/output:
+    LAGraph_Graph G,        // graph whose cached properties are trimmed
+    // input:
+    size_t budget,          // max bytes for all cached properties of G
+    int keep,               // bitmask of LAGRAPH_CACHE_* properties to keep
+    char *msg
+) ;
+
+// LG_Cached_TrimToBudget: LG_Cached_Trim with the budget LG_cached_budget;
+// does nothing if there is no budget
+LAGRAPH_PUBLIC
+int LG_Cached_TrimToBudget
+(
+    // input/output:
+    LAGraph_Graph G,        // graph whose cached properties are trimmed
+    // input:
+    int keep,               // bitmask of LAGRAPH_CACHE_* properties to keep
+    char *msg
+) ;
+
+// LG_Cached_AT, LG_Cached_OutDegree, LG_Cached_InDegree: as the
+// LAGraph_Cached_* methods of the same name, except that, once the property
+// is computed, the properties in keep are kept as well when G is trimmed to
+// the budget.
+LAGRAPH_PUBLIC
+int LG_Cached_AT
+(
+    // input/output:
+    LAGraph_Graph G,        // graph for which to compute G->AT
+    // input:
+    int keep,               // other properties to keep
+    char *msg
+) ;
+
+LAGRAPH_PUBLIC
+int LG_Cached_OutDegree
+(
+    // input/output:
+    LAGraph_Graph G,        // graph to determine G->out_degree
+    // input:
+    int keep,               // other properties to keep
+    char *msg
+) ;
+
+LAGRAPH_PUBLIC
+int LG_Cached_InDegree
+(
+    // input/output:
+    LAGraph_Graph G,        // graph to determine G->in_degree
+    // input:
+    int keep,               // other properties to keep
+    char *msg
+) ;
+
 //------------------------------------------------------------------------------
 // simple and portable random number generator (internal use only)
 //------------------------------------------------------------------------------
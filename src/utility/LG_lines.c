@@ -0,0 +1,175 @@
+//------------------------------------------------------------------------------
+// LG_lines: read a text file in large blocks of whole lines
+//------------------------------------------------------------------------------
+
+// LAGraph, (c) 2019-2022 by The LAGraph Contributors, All Rights Reserved.
+// SPDX-License-Identifier: BSD-2-Clause
+//
+// For additional details (including references to third party source code and
+// other files) see the LICENSE file or contact permission@sei.cmu.edu. See
+// Contributors.txt for a full list of contributors. Created, in part, with
+// funding and support from the U.S. Government (see Acknowledgments.txt file).
+// DM22-0790
+
+//------------------------------------------------------------------------------
+
+// LG_lines reads a text file from an LG_stream in large blocks, for parsing in
+// parallel.  Each block holds only whole lines: a partial line at the end of
+// the buffer is kept for the next block.  Each block is split into chunks of
+// whole lines, of roughly equal size, so that the chunks can be parsed by
+// separate tasks.  The lines are not modified; the caller may replace the
+// newline at the end of each line with '\0', for example.  The last line of
+// the file need not end with a newline; it is terminated with '\0'.
+
+// This is used by LAGraph_MMRead and LAGraph_EdgeListRead.
+
+#include "LG_internal.h"
+
+// minimum size of a chunk
+#define CHUNK (64*1024)
+
+//------------------------------------------------------------------------------
+// LG_lines_init: start reading the lines of a stream
+//------------------------------------------------------------------------------
+
+int LG_lines_init
+(
+    // output:
+    LG_lines *L,            // the lines of the stream
+    // input:
+    LG_stream f,            // stream to read from
+    size_t bufsize,         // initial size of the block buffer
+    int ntasks_max,         // max # of chunks in each block
+    char *msg
+)
+{
+    LG_CLEAR_MSG ;
+    LG_ASSERT (L != NULL && f != NULL, GrB_NULL_POINTER) ;
+    memset (L, 0, sizeof (LG_lines)) ;
+    L->f = f ;
+    L->bufsize = LAGRAPH_MAX (bufsize, 4 * MAXLINE) ;
+    L->ntasks_max = LAGRAPH_MAX (ntasks_max, 1) ;
+    LG_TRY (LAGraph_Malloc ((void **) &(L->Buf), L->bufsize + 1,
+        sizeof (char), msg)) ;
+    int status = LAGraph_Malloc ((void **) &(L->Tstart), L->ntasks_max + 1,
+        sizeof (int64_t), msg) ;
+    if (status != GrB_SUCCESS)
+    {
+        LG_lines_free (L) ;
+        return (status) ;
+    }
+    return (GrB_SUCCESS) ;
+}
+
+//------------------------------------------------------------------------------
+// LG_lines_next: read the next block of lines and split it into chunks
+//------------------------------------------------------------------------------
+
+// The prior block is discarded.  On output, L->ntasks is the number of chunks
+// in the block, and chunk t is L->Buf [L->Tstart [t] ... L->Tstart [t+1]-1].
+// L->ntasks is zero if the end of the stream has been reached.
+
+int LG_lines_next
+(
+    LG_lines *L,            // the lines of the stream
+    char *msg
+)
+{
+    LG_CLEAR_MSG ;
+
+    //--------------------------------------------------------------------------
+    // discard the prior block, but keep its partial last line
+    //--------------------------------------------------------------------------
+
+    L->len -= L->end ;
+    memmove (L->Buf, L->Buf + L->end, L->len) ;
+    L->end = 0 ;
+    L->ntasks = 0 ;
+
+    while (true)
+    {
+
+        //----------------------------------------------------------------------
+        // fill the rest of the buffer from the stream
+        //----------------------------------------------------------------------
+
+        if (!(L->eof))
+        {
+            size_t need = L->bufsize - L->len ;
+            size_t got = LG_stream_read (L->Buf + L->len, need, L->f) ;
+            L->len += got ;
+            L->eof = (got < need) ;
+            LG_ASSERT_MSG (!(L->eof && LG_stream_error (L->f)),
+                LAGRAPH_IO_ERROR,
+                "compressed input file is truncated or corrupted") ;
+        }
+        if (L->len == 0)
+        {
+            // end of the stream
+            return (GrB_SUCCESS) ;
+        }
+
+        //----------------------------------------------------------------------
+        // find the end of the last complete line in the buffer
+        //----------------------------------------------------------------------
+
+        if (L->eof)
+        {
+            // the last line in the file need not end with a newline
+            L->Buf [L->len] = '\0' ;
+            L->end = L->len ;
+            break ;
+        }
+        size_t end = L->len ;
+        while (end > 0 && L->Buf [end-1] != '\n') end-- ;
+        if (end > 0)
+        {
+            L->end = end ;
+            break ;
+        }
+
+        // the buffer holds part of a single line; enlarge it
+        LG_TRY (LAGraph_Realloc ((void **) &(L->Buf), 2 * L->bufsize + 1,
+            L->bufsize + 1, sizeof (char), msg)) ;
+        L->bufsize = 2 * L->bufsize ;
+    }
+
+    //--------------------------------------------------------------------------
+    // split the lines Buf [0:end-1] into chunks
+    //--------------------------------------------------------------------------
+
+    char *Buf = L->Buf ;
+    int64_t *Tstart = L->Tstart ;
+    size_t end = L->end ;
+    int ntasks = (int) LAGRAPH_MIN ((size_t) L->ntasks_max, end / CHUNK) ;
+    ntasks = LAGRAPH_MAX (ntasks, 1) ;
+    Tstart [0] = 0 ;
+    for (int t = 1 ; t < ntasks ; t++)
+    {
+        // chunk t starts at the first line starting at or after the nominal
+        // boundary
+        size_t k = (size_t) (((double) t) * ((double) end) / ntasks) ;
+        char *p = memchr (Buf + k - 1, '\n', end - k + 1) ;
+        int64_t start = (p == NULL) ? end : (p - Buf + 1) ;
+        Tstart [t] = LAGRAPH_MAX (start, Tstart [t-1]) ;
+    }
+    Tstart [ntasks] = end ;
+    L->ntasks = ntasks ;
+    return (GrB_SUCCESS) ;
+}
+
+//------------------------------------------------------------------------------
+// LG_lines_free: free the buffers of an LG_lines
+//------------------------------------------------------------------------------
+
+// The stream is not closed.
+
+void LG_lines_free
+(
+    LG_lines *L
+)
+{
+    if (L == NULL) return ;
+    LAGraph_Free ((void **) &(L->Buf), NULL) ;
+    LAGraph_Free ((void **) &(L->Tstart), NULL) ;
+}
@@ -0,0 +1,162 @@
+//------------------------------------------------------------------------------
+// LG_scan_double: parse a double from a string
+//------------------------------------------------------------------------------
+
+// LAGraph, (c) 2019-2022 by The LAGraph Contributors, All Rights Reserved.
+// SPDX-License-Identifier: BSD-2-Clause
+//
+// For additional details (including references to third party source code and
+// other files) see the LICENSE file or contact permission@sei.cmu.edu. See
+// Contributors.txt for a full list of contributors. Created, in part, with
+// funding and support from the U.S. Government (see Acknowledgments.txt file).
+// DM22-0790
+
+//------------------------------------------------------------------------------
+
+// LG_scan_double parses a double from a null-terminated string, in place of
+// sscanf (s, "%lg", x).  The tokens inf, +inf, -inf, and nan (in any case)
+// are also recognized.
+
+// Most values in Matrix Market files are short decimal numbers, such as 1,
+// -3.25, or 1.5e-3.  If the decimal significand has at most 19 digits and is
+// exactly representable as a double (<= 2^53), and the decimal exponent is in
+// the range -22 to 22, then the value is one exact double multiplied or
+// divided by another exact power of 10, and a single IEEE operation gives the
+// correctly rounded result (Clinger's fast path).  All other strings are
+// passed to strtod.  The fast path requires that double arithmetic is not
+// evaluated in extended precision (FLT_EVAL_METHOD == 0).
+
+#include <float.h>
+#include "LG_internal.h"
+
+#if defined ( FLT_EVAL_METHOD ) && ( FLT_EVAL_METHOD == 0 )
+#define LG_FAST_DOUBLE 1
+#else
+#define LG_FAST_DOUBLE 0
+#endif
+
+static const double LG_pow10 [23] =
+{
+    1e0,  1e1,  1e2,  1e3,  1e4,  1e5,  1e6,  1e7,  1e8,  1e9,  1e10, 1e11,
+    1e12, 1e13, 1e14, 1e15, 1e16, 1e17, 1e18, 1e19, 1e20, 1e21, 1e22
+} ;
+
+bool LG_scan_double
+(
+    char **p,           // string to parse; advanced past the number
+    double *x           // number read in
+)
+{
+
+    char *s = (*p) ;
+    while (LG_ISSPACE (*s)) s++ ;   // skip any spaces
+
+    //--------------------------------------------------------------------------
+    // check for inf, +inf, -inf, and nan
+    //--------------------------------------------------------------------------
+
+    char t [5] ;
+    int k = 0 ;
+    for ( ; k < 4 && s [k] != '\0' ; k++)
+    {
+        t [k] = tolower ((unsigned char) s [k]) ;
+    }
+    t [k] = '\0' ;
+
+    double value ;
+    int skip = 0 ;
+    if (MATCH (t, "inf", 3))
+    {
+        value = INFINITY ;
+        skip = 3 ;
+    }
+    else if (MATCH (t, "+inf", 4))
+    {
+        value = INFINITY ;
+        skip = 4 ;
+    }
+    else if (MATCH (t, "-inf", 4))
+    {
+        value = -INFINITY ;
+        skip = 4 ;
+    }
+    else if (MATCH (t, "nan", 3))
+    {
+        value = NAN ;
+        skip = 3 ;
+    }
+
+    if (skip > 0)
+    {
+        s += skip ;
+        while (isalpha ((unsigned char) (*s))) s++ ;
+        (*x) = value ;
+        (*p) = s ;
+        return (true) ;
+    }
+
+    //--------------------------------------------------------------------------
+    // fast path for short decimal numbers
+    //--------------------------------------------------------------------------
+
+    #if LG_FAST_DOUBLE
+    {
+        char *q = s ;
+        bool negative = (*q == '-') ;
+        if (*q == '-' || *q == '+') q++ ;
+        uint64_t m = 0 ;
+        int ndigits = 0, e = 0 ;
+        for ( ; LG_ISDIGIT (*q) && ndigits <= 19 ; q++, ndigits++)
+        {
+            m = 10 * m + (uint64_t) (*q - '0') ;
+        }
+        if (*q == '.')
+        {
+            for (q++ ; LG_ISDIGIT (*q) && ndigits <= 19 ; q++, ndigits++, e--)
+            {
+                m = 10 * m + (uint64_t) (*q - '0') ;
+            }
+        }
+        bool ok = (ndigits > 0 && ndigits <= 19) ;
+        if (ok && (*q == 'e' || *q == 'E'))
+        {
+            q++ ;
+            bool eneg = (*q == '-') ;
+            if (*q == '-' || *q == '+') q++ ;
+            ok = LG_ISDIGIT (*q) ;
+            int e2 = 0 ;
+            for ( ; ok && LG_ISDIGIT (*q) ; q++)
+            {
+                e2 = 10 * e2 + (*q - '0') ;
+                if (e2 > 1000) ok = false ;
+            }
+            e += eneg ? (-e2) : e2 ;
+        }
+        ok = ok && (*q == '\0' || LG_ISSPACE (*q))
+                && (m <= (UINT64_C (1) << 53)) && (e >= -22 && e <= 22) ;
+        if (ok)
+        {
+            value = (double) m ;
+            value = (e < 0) ? (value / LG_pow10 [-e]) : (value * LG_pow10 [e]) ;
+            (*x) = negative ? (-value) : value ;
+            (*p) = q ;
+            return (true) ;
+        }
+    }
+    #endif
+
+    //--------------------------------------------------------------------------
+    // all other numbers
+    //--------------------------------------------------------------------------
+
+    char *end = NULL ;
+    value = strtod (s, &end) ;
+    if (end == NULL || end == s)
+    {
+        // no number present
+        return (false) ;
+    }
+    (*x) = value ;
+    (*p) = end ;
+    return (true) ;
+}
@@ -0,0 +1,132 @@
+//------------------------------------------------------------------------------
+// LG_sssp_delta: choose Delta for delta-stepping SSSP
+//------------------------------------------------------------------------------
+
+// LAGraph, (c) 2019-2022 by The LAGraph Contributors, All Rights Reserved.
+// SPDX-License-Identifier: BSD-2-Clause
+//
+// For additional details (including references to third party source code and
+// other files) see the LICENSE file or contact permission@sei.cmu.edu. See
+// Contributors.txt for a full list of contributors. Created, in part, with
+// funding and support from the U.S. Government (see Acknowledgments.txt file).
+// DM22-0790
+
+//------------------------------------------------------------------------------
+
+// LG_sssp_delta chooses Delta for LAGr_SingleSourceShortestPath on the graph
+// G, from a given set of sources.  It is used by LG_Cached_SSSPDelta, with a
+// sample of sources, to set G->sssp_delta.  G is not modified.
+
+// Each step of delta stepping takes O(n) time in addition to the work on the
+// edges, since t and reach are bitmap vectors.  A Delta that is too small
+// leads to many steps that do little work each (the bad case for road
+// networks and meshes, with a large diameter and a low degree), and a Delta
+// that is too large makes each step a Bellman-Ford search, where a node may
+// be relaxed many times (the bad case for social networks, with a small
+// diameter and a high degree).  The number of steps is about maxdist/Delta,
+// where maxdist is the largest path length from the source, and the work on
+// the edges is at least m = n*d, with d the mean out-degree.  Delta is chosen
+// so that both are about the same, or Delta = maxdist/d.
+
+// maxdist is estimated with a level-only BFS from each of the given sources:
+// the largest number of levels L found from any of them is taken, and maxdist
+// is L times the mean edge weight.  Delta is then at least G->emin (if known
+// and positive), and is rounded down to an integer (but at least 1) if G->A
+// has an integer type.  nlevels is returned as zero if no source has any
+// out-edges, in which case the estimate says nothing about the graph.
+
+#define LG_FREE_ALL                 \
+{                                   \
+    GrB_free (&level) ;             \
+}
+
+#include "LG_internal.h"
+
+int LG_sssp_delta
+(
+    // output:
+    double *delta,              // Delta for delta stepping on G
+    int64_t *nlevels,           // max # of BFS levels from the sources
+    // input:
+    const LAGraph_Graph G,      // graph to search, not modified
+    const GrB_Index *sources,   // sources of the BFS probes
+    int64_t nsources,           // # of sources
+    char *msg
+)
+{
+
+    //--------------------------------------------------------------------------
+    // check inputs
+    //--------------------------------------------------------------------------
+
+    GrB_Vector level = NULL ;
+    LG_ASSERT (delta != NULL && nlevels != NULL, GrB_NULL_POINTER) ;
+    LG_ASSERT (sources != NULL || nsources == 0, GrB_NULL_POINTER) ;
+    (*delta) = 1 ;
+    (*nlevels) = 0 ;
+
+    GrB_Matrix A = G->A ;
+    GrB_Index n, nvals ;
+    GRB_TRY (GrB_Matrix_nrows (&n, A)) ;
+    GRB_TRY (GrB_Matrix_nvals (&nvals, A)) ;
+
+    //--------------------------------------------------------------------------
+    // mean edge weight and mean out-degree
+    //--------------------------------------------------------------------------
+
+    double emin = 0, emax = 1 ;
+    if (G->emin != NULL && G->emin_state != LAGRAPH_UNKNOWN)
+    {
+        GRB_TRY (GrB_Scalar_extractElement_FP64 (&emin, G->emin)) ;
+    }
+    if (G->emax != NULL && G->emax_state != LAGRAPH_UNKNOWN)
+    {
+        GRB_TRY (GrB_Scalar_extractElement_FP64 (&emax, G->emax)) ;
+    }
+
+    // mean edge weight, or emax if the weights do not have a positive mean
+    double wmean = 0 ;
+    if (nvals > 0)
+    {
+        GRB_TRY (GrB_reduce (&wmean, NULL, GrB_PLUS_MONOID_FP64, A, NULL)) ;
+        wmean = wmean / nvals ;
+    }
+    if (wmean <= 0) wmean = emax ;
+    if (wmean <= 0) wmean = 1 ;
+
+    double d = (n > 0) ? (((double) nvals) / ((double) n)) : 1 ;
+    d = LAGRAPH_MAX (d, 1) ;
+
+    //--------------------------------------------------------------------------
+    // probe: the largest number of BFS levels from any source
+    //--------------------------------------------------------------------------
+
+    int64_t maxlevels = 0 ;
+    for (int64_t k = 0 ; k < nsources ; k++)
+    {
+        int64_t L = 0 ;
+        LG_TRY (LAGr_BreadthFirstSearch (&level, NULL, G, sources [k], msg)) ;
+        GRB_TRY (GrB_reduce (&L, NULL, GrB_MAX_MONOID_INT64, level, NULL)) ;
+        GrB_free (&level) ;
+        maxlevels = LAGRAPH_MAX (maxlevels, L) ;
+    }
+
+    //--------------------------------------------------------------------------
+    // Delta = maxdist / d, but at least emin
+    //--------------------------------------------------------------------------
+
+    double x = LAGRAPH_MAX (maxlevels, 1) * wmean / d ;
+    if (emin > 0) x = LAGRAPH_MAX (x, emin) ;
+
+    // round Delta down to an integer, if the edge weights are integers
+    char typename [LAGRAPH_MAX_NAME_LEN] ;
+    LG_TRY (LAGraph_Matrix_TypeName (typename, A, msg)) ;
+    if (!MATCHNAME (typename, "float") && !MATCHNAME (typename, "double"))
+    {
+        x = LAGRAPH_MAX (floor (x), 1) ;
+    }
+
+    (*delta) = x ;
+    (*nlevels) = maxlevels ;
+    return (GrB_SUCCESS) ;
+}
@@ -0,0 +1,557 @@
+//------------------------------------------------------------------------------
+// LG_stream: read from a file that may be compressed
+//------------------------------------------------------------------------------
+
+// LAGraph, (c) 2019-2022 by The LAGraph Contributors, All Rights Reserved.
+// SPDX-License-Identifier: BSD-2-Clause
+//
+// For additional details (including references to third party source code and
+// other files) see the LICENSE file or contact permission@sei.cmu.edu. See
+// Contributors.txt for a full list of contributors. Created, in part, with
+// funding and support from the U.S. Government (see Acknowledgments.txt file).
+// DM22-0790
+
+//------------------------------------------------------------------------------
+
+// An LG_stream reads from a FILE that is already open, which may hold plain
+// data or data compressed with gzip or zstd.  The format is determined by the
+// first few bytes of the file (its magic number), so the FILE need not be
+// seekable: a pipe or stdin can be used.  The bytes read to determine the
+// format are returned first, for a plain file.
+
+// Compressed data is decompressed into a ring of large blocks by a separate
+// thread, which runs ahead of the reader.  Decompression thus overlaps with
+// the parsing of the data, and no uncompressed copy of the file is ever
+// written to disk.  If pthreads are not available, each block is decompressed
+// when the reader needs it.
+
+// gzip requires zlib (LAGRAPH_ZLIB), and zstd requires libzstd (LAGRAPH_ZSTD).
+// If a compressed file is found but the library is not available,
+// LG_stream_open returns GrB_NOT_IMPLEMENTED.
+
+#define LG_FREE_ALL LG_stream_close (&s) ;
+
+#include "LG_internal.h"
+
+#if defined ( LAGRAPH_ZLIB )
+#include <zlib.h>
+#endif
+
+#if defined ( LAGRAPH_ZSTD )
+#include <zstd.h>
+#endif
+
+#if defined ( LAGRAPH_PTHREADS ) && \
+    ( defined ( LAGRAPH_ZLIB ) || defined ( LAGRAPH_ZSTD ) )
+#include <pthread.h>
+#define LG_STREAM_THREAD 1
+#else
+#define LG_STREAM_THREAD 0
+#endif
+
+#define LG_STREAM_PLAIN 0
+#define LG_STREAM_GZIP  1
+#define LG_STREAM_ZSTD  2
+
+#define LG_STREAM_NBLOCKS 4                 // # of blocks in the ring
+#define LG_STREAM_BLOCK (4*1024*1024)       // size of each block
+#define LG_STREAM_INPUT (1024*1024)         // size of compressed input buffer
+
+struct LG_stream_struct
+{
+    FILE *f ;               // the file, owned by the caller
+    int kind ;              // LG_STREAM_PLAIN, _GZIP, or _ZSTD
+    uint8_t peek [4] ;      // first bytes of the file
+    int npeek ;             // # of bytes in peek
+    int peekpos ;           // # of bytes of peek returned so far
+    bool error ;            // true if the compressed data is invalid
+
+    // block being read by the reader (compressed files only)
+    uint8_t *out ;
+    size_t outlen ;
+    size_t outpos ;
+    bool holding ;          // true if the reader holds Block [head]
+
+    // ring of decompressed blocks, written by the decompressor
+    uint8_t *Block [LG_STREAM_NBLOCKS] ;
+    size_t Blocklen [LG_STREAM_NBLOCKS] ;
+    int head ;              // next block to read
+    int count ;             // # of blocks ready to read
+    bool done ;             // true if the decompressor has finished
+    bool stop ;             // true if the reader has closed the stream
+
+    // compressed input, read by the decompressor
+    uint8_t *in ;
+    size_t inlen ;
+    size_t inpos ;
+    bool ineof ;
+
+    #if defined ( LAGRAPH_ZLIB )
+    z_stream z ;
+    bool z_init ;
+    #endif
+    #if defined ( LAGRAPH_ZSTD )
+    ZSTD_DStream *zd ;
+    size_t zret ;           // last result of ZSTD_decompressStream
+    #endif
+    #if LG_STREAM_THREAD
+    pthread_t thread ;
+    pthread_mutex_t lock ;
+    pthread_cond_t cond ;
+    bool thread_started ;
+    #endif
+} ;
+
+//------------------------------------------------------------------------------
+// fill_input: refill the compressed input buffer, if empty
+//------------------------------------------------------------------------------
+
+static void fill_input (LG_stream s)
+{
+    if (s->inpos < s->inlen || s->ineof) return ;
+    s->inlen = fread (s->in, sizeof (uint8_t), LG_STREAM_INPUT, s->f) ;
+    s->inpos = 0 ;
+    s->ineof = (s->inlen == 0) ;
+}
+
+//------------------------------------------------------------------------------
+// decompress_block: decompress the next block of the file
+//------------------------------------------------------------------------------
+
+// Fills dest with up to LG_STREAM_BLOCK bytes.  Returns true if the end of the
+// data has been reached, or if an error occurred (in which case s->error is
+// set).
+
+static bool decompress_block (LG_stream s, uint8_t *dest, size_t *len)
+{
+    size_t n = 0 ;
+    bool finished = false ;
+
+    while (n < LG_STREAM_BLOCK && !finished)
+    {
+        fill_input (s) ;
+
+        #if defined ( LAGRAPH_ZLIB )
+        if (s->kind == LG_STREAM_GZIP)
+        {
+            if (s->ineof)
+            {
+                // the last gzip member is incomplete
+                s->error = (s->z.total_in > 0) ;
+                finished = true ;
+                break ;
+            }
+            s->z.next_in = s->in + s->inpos ;
+            s->z.avail_in = (uInt) (s->inlen - s->inpos) ;
+            s->z.next_out = dest + n ;
+            s->z.avail_out = (uInt) (LG_STREAM_BLOCK - n) ;
+            int status = inflate (&(s->z), Z_NO_FLUSH) ;
+            s->inpos = s->inlen - s->z.avail_in ;
+            n = LG_STREAM_BLOCK - s->z.avail_out ;
+            if (status == Z_STREAM_END)
+            {
+                // a gzip file can hold several members, one after another
+                fill_input (s) ;
+                finished = s->ineof ;
+                if (!finished) inflateReset (&(s->z)) ;
+            }
+            else if (status != Z_OK && status != Z_BUF_ERROR)
+            {
+                s->error = true ;
+                finished = true ;
+            }
+        }
+        #endif
+
+        #if defined ( LAGRAPH_ZSTD )
+        if (s->kind == LG_STREAM_ZSTD)
+        {
+            if (s->ineof)
+            {
+                // the last zstd frame must be complete
+                s->error = (s->zret != 0) ;
+                finished = true ;
+                break ;
+            }
+            ZSTD_inBuffer input = { s->in, s->inlen, s->inpos } ;
+            ZSTD_outBuffer output = { dest, LG_STREAM_BLOCK, n } ;
+            s->zret = ZSTD_decompressStream (s->zd, &output, &input) ;
+            if (ZSTD_isError (s->zret))
+            {
+                s->error = true ;
+                finished = true ;
+            }
+            s->inpos = input.pos ;
+            n = output.pos ;
+        }
+        #endif
+    }
+
+    (*len) = n ;
+    return (finished) ;
+}
+
+//------------------------------------------------------------------------------
+// decompressor: the thread that decompresses the file into the ring of blocks
+//------------------------------------------------------------------------------
+
+#if LG_STREAM_THREAD
+static void *decompressor (void *arg)
+{
+    LG_stream s = (LG_stream) arg ;
+    int tail = 0 ;
+    bool finished = false ;
+    while (!finished)
+    {
+        // wait for a free block
+        pthread_mutex_lock (&(s->lock)) ;
+        while (s->count == LG_STREAM_NBLOCKS && !s->stop)
+        {
+            pthread_cond_wait (&(s->cond), &(s->lock)) ;
+        }
+        bool stop = s->stop ;
+        pthread_mutex_unlock (&(s->lock)) ;
+        if (stop) break ;
+
+        // decompress the next block, without holding the lock
+        size_t len ;
+        finished = decompress_block (s, s->Block [tail], &len) ;
+
+        // give the block to the reader
+        pthread_mutex_lock (&(s->lock)) ;
+        s->Blocklen [tail] = len ;
+        s->count++ ;
+        s->done = finished ;
+        pthread_cond_broadcast (&(s->cond)) ;
+        pthread_mutex_unlock (&(s->lock)) ;
+        tail = (tail + 1) % LG_STREAM_NBLOCKS ;
+    }
+    return (NULL) ;
+}
+#endif
+
+//------------------------------------------------------------------------------
+// next_block: get the next block of decompressed data
+//------------------------------------------------------------------------------
+
+// Returns false if no data remains.
+
+static bool next_block (LG_stream s)
+{
+    #if LG_STREAM_THREAD
+    {
+        pthread_mutex_lock (&(s->lock)) ;
+        if (s->holding)
+        {
+            // release the block just read
+            s->head = (s->head + 1) % LG_STREAM_NBLOCKS ;
+            s->count-- ;
+            s->holding = false ;
+            pthread_cond_broadcast (&(s->cond)) ;
+        }
+        while (s->count == 0 && !s->done)
+        {
+            pthread_cond_wait (&(s->cond), &(s->lock)) ;
+        }
+        bool ok = (s->count > 0) ;
+        if (ok)
+        {
+            s->out = s->Block [s->head] ;
+            s->outlen = s->Blocklen [s->head] ;
+            s->outpos = 0 ;
+            s->holding = true ;
+        }
+        pthread_mutex_unlock (&(s->lock)) ;
+        return (ok) ;
+    }
+    #else
+    {
+        if (s->done) return (false) ;
+        s->done = decompress_block (s, s->Block [0], &(s->outlen)) ;
+        s->out = s->Block [0] ;
+        s->outpos = 0 ;
+        return (true) ;
+    }
+    #endif
+}
+
+//------------------------------------------------------------------------------
+// LG_stream_open: open a stream for reading from a file
+//------------------------------------------------------------------------------
+
+int LG_stream_open
+(
+    // output:
+    LG_stream *stream,      // the stream
+    // input:
+    FILE *f,                // file to read from, already open
+    char *msg
+)
+{
+
+    //--------------------------------------------------------------------------
+    // check inputs
+    //--------------------------------------------------------------------------
+
+    LG_stream s = NULL ;
+    LG_ASSERT (stream != NULL && f != NULL, GrB_NULL_POINTER) ;
+    (*stream) = NULL ;
+    LG_TRY (LAGraph_Calloc ((void **) &s, 1, sizeof (struct LG_stream_struct),
+        msg)) ;
+    s->f = f ;
+
+    //--------------------------------------------------------------------------
+    // determine the format of the file from its magic number
+    //--------------------------------------------------------------------------
+
+    s->npeek = (int) fread (s->peek, sizeof (uint8_t), 4, f) ;
+    if (s->npeek >= 2 && s->peek [0] == 0x1f && s->peek [1] == 0x8b)
+    {
+        s->kind = LG_STREAM_GZIP ;
+    }
+    else if (s->npeek == 4 && s->peek [0] == 0x28 && s->peek [1] == 0xb5 &&
+        s->peek [2] == 0x2f && s->peek [3] == 0xfd)
+    {
+        s->kind = LG_STREAM_ZSTD ;
+    }
+
+    if (s->kind == LG_STREAM_PLAIN)
+    {
+        // the bytes in peek are returned first
+        (*stream) = s ;
+        return (GrB_SUCCESS) ;
+    }
+
+    //--------------------------------------------------------------------------
+    // set up the decompressor
+    //--------------------------------------------------------------------------
+
+    #if !defined ( LAGRAPH_ZLIB )
+    LG_ASSERT_MSG (s->kind != LG_STREAM_GZIP, GrB_NOT_IMPLEMENTED,
+        "gzip-compressed input requires zlib") ;
+    #endif
+    #if !defined ( LAGRAPH_ZSTD )
+    LG_ASSERT_MSG (s->kind != LG_STREAM_ZSTD, GrB_NOT_IMPLEMENTED,
+        "zstd-compressed input requires libzstd") ;
+    #endif
+
+    LG_TRY (LAGraph_Malloc ((void **) &(s->in), LG_STREAM_INPUT,
+        sizeof (uint8_t), msg)) ;
+    for (int k = 0 ; k < LG_STREAM_NBLOCKS ; k++)
+    {
+        LG_TRY (LAGraph_Malloc ((void **) &(s->Block [k]), LG_STREAM_BLOCK,
+            sizeof (uint8_t), msg)) ;
+    }
+
+    // the magic number is the start of the compressed input
+    memcpy (s->in, s->peek, s->npeek) ;
+    s->inlen = s->npeek ;
+    s->npeek = 0 ;
+
+    #if defined ( LAGRAPH_ZLIB )
+    if (s->kind == LG_STREAM_GZIP)
+    {
+        // 15+16: gzip format with the largest window
+        LG_ASSERT_MSG (inflateInit2 (&(s->z), 15 + 16) == Z_OK,
+            GrB_OUT_OF_MEMORY, "out of memory") ;
+        s->z_init = true ;
+    }
+    #endif
+
+    #if defined ( LAGRAPH_ZSTD )
+    if (s->kind == LG_STREAM_ZSTD)
+    {
+        s->zd = ZSTD_createDStream ( ) ;
+        LG_ASSERT_MSG (s->zd != NULL, GrB_OUT_OF_MEMORY, "out of memory") ;
+        ZSTD_initDStream (s->zd) ;
+    }
+    #endif
+
+    #if LG_STREAM_THREAD
+    pthread_mutex_init (&(s->lock), NULL) ;
+    pthread_cond_init (&(s->cond), NULL) ;
+    s->thread_started = true ;
+    if (pthread_create (&(s->thread), NULL, decompressor, s) != 0)
+    {
+        s->thread_started = false ;
+        pthread_mutex_destroy (&(s->lock)) ;
+        pthread_cond_destroy (&(s->cond)) ;
+        LG_ASSERT_MSG (false, GrB_PANIC, "unable to start the decompressor") ;
+    }
+    #endif
+
+    (*stream) = s ;
+    return (GrB_SUCCESS) ;
+}
+
+//------------------------------------------------------------------------------
+// LG_stream_close: free a stream (but do not close its file)
+//------------------------------------------------------------------------------
+
+void LG_stream_close
+(
+    LG_stream *stream
+)
+{
+    if (stream == NULL || (*stream) == NULL) return ;
+    LG_stream s = (*stream) ;
+
+    #if LG_STREAM_THREAD
+    if (s->thread_started)
+    {
+        // tell the decompressor to stop, and wait for it
+        pthread_mutex_lock (&(s->lock)) ;
+        s->stop = true ;
+        pthread_cond_broadcast (&(s->cond)) ;
+        pthread_mutex_unlock (&(s->lock)) ;
+        pthread_join (s->thread, NULL) ;
+        pthread_mutex_destroy (&(s->lock)) ;
+        pthread_cond_destroy (&(s->cond)) ;
+    }
+    #endif
+
+    #if defined ( LAGRAPH_ZLIB )
+    if (s->z_init) inflateEnd (&(s->z)) ;
+    #endif
+    #if defined ( LAGRAPH_ZSTD )
+    if (s->zd != NULL) ZSTD_freeDStream (s->zd) ;
+    #endif
+
+    LAGraph_Free ((void **) &(s->in), NULL) ;
+    for (int k = 0 ; k < LG_STREAM_NBLOCKS ; k++)
+    {
+        LAGraph_Free ((void **) &(s->Block [k]), NULL) ;
+    }
+    LAGraph_Free ((void **) stream, NULL) ;
+}
+
+//------------------------------------------------------------------------------
+// LG_stream_read: read up to n bytes, like fread
+//------------------------------------------------------------------------------
+
+size_t LG_stream_read       // returns # of bytes read
+(
+    void *p,                // output buffer of size n
+    size_t n,               // # of bytes to read
+    LG_stream s
+)
+{
+    uint8_t *dest = (uint8_t *) p ;
+    size_t k = 0 ;
+
+    // return any bytes read to determine the format of a plain file
+    while (k < n && s->peekpos < s->npeek)
+    {
+        dest [k++] = s->peek [s->peekpos++] ;
+    }
+
+    if (s->kind == LG_STREAM_PLAIN)
+    {
+        return (k + fread (dest + k, sizeof (uint8_t), n - k, s->f)) ;
+    }
+
+    while (k < n)
+    {
+        if (s->outpos == s->outlen && !next_block (s)) break ;
+        size_t len = LAGRAPH_MIN (n - k, s->outlen - s->outpos) ;
+        memcpy (dest + k, s->out + s->outpos, len) ;
+        s->outpos += len ;
+        k += len ;
+    }
+    return (k) ;
+}
+
+//------------------------------------------------------------------------------
+// LG_stream_gets: read a line, like fgets
+//------------------------------------------------------------------------------
+
+char *LG_stream_gets        // returns buf, or NULL if at the end of the file
+(
+    char *buf,              // output buffer of size n
+    int n,                  // size of buf
+    LG_stream s
+)
+{
+    if (s->kind == LG_STREAM_PLAIN && s->peekpos == s->npeek)
+    {
+        return (fgets (buf, n, s->f)) ;
+    }
+
+    int k = 0 ;
+    while (k < n-1)
+    {
+        int c ;
+        if (s->peekpos < s->npeek)
+        {
+            c = s->peek [s->peekpos++] ;
+        }
+        else if (s->kind == LG_STREAM_PLAIN)
+        {
+            c = fgetc (s->f) ;
+            if (c == EOF) break ;
+        }
+        else
+        {
+            if (s->outpos == s->outlen && !next_block (s)) break ;
+            c = s->out [s->outpos++] ;
+        }
+        buf [k++] = (char) c ;
+        if (c == '\n') break ;
+    }
+    if (k == 0) return (NULL) ;
+    buf [k] = '\0' ;
+    return (buf) ;
+}
+
+//------------------------------------------------------------------------------
+// LG_stream_compressed: return true if the file is compressed
+//------------------------------------------------------------------------------
+
+bool LG_stream_compressed
+(
+    LG_stream s
+)
+{
+    return (s->kind != LG_STREAM_PLAIN) ;
+}
+
+//------------------------------------------------------------------------------
+// LG_stream_error: return true if the compressed data is invalid
+//------------------------------------------------------------------------------
+
+// The error is reported only after all valid data before it has been read.
+
+bool LG_stream_error
+(
+    LG_stream s
+)
+{
+    return (s->error) ;
+}
+
+//------------------------------------------------------------------------------
+// LG_stream_getpos, LG_stream_setpos: like fgetpos and fsetpos
+//------------------------------------------------------------------------------
+
+// The position can only be saved and restored for a plain file that is
+// seekable.  Both return true if successful.
+
+bool LG_stream_getpos
+(
+    LG_stream s,
+    fpos_t *pos
+)
+{
+    return (s->kind == LG_STREAM_PLAIN && s->peekpos == s->npeek &&
+        fgetpos (s->f, pos) == 0) ;
+}
+
+bool LG_stream_setpos
+(
+    LG_stream s,
+    const fpos_t *pos
+)
+{
+    return (s->kind == LG_STREAM_PLAIN && s->peekpos == s->npeek &&
+        fsetpos (s->f, pos) == 0) ;
+}
@@ -0,0 +1,222 @@
+//------------------------------------------------------------------------------
+// LG_writer: write a sequence of buffers to a file, on a separate thread
+//------------------------------------------------------------------------------
+
+// LAGraph, (c) 2019-2022 by The LAGraph Contributors, All Rights Reserved.
+// SPDX-License-Identifier: BSD-2-Clause
+//
+// For additional details (including references to third party source code and
+// other files) see the LICENSE file or contact permission@sei.cmu.edu. See
+// Contributors.txt for a full list of contributors. Created, in part, with
+// funding and support from the U.S. Government (see Acknowledgments.txt file).
+// DM22-0790
+
+//------------------------------------------------------------------------------
+
+// An LG_writer writes buffers to a FILE that is already open, in the order
+// they are given to LG_writer_put.  Each buffer is written by a separate
+// thread, and then freed, so that the caller can compute the next buffer
+// (serializing the next matrix, for example) while the last one is written.
+// At most one buffer is held by the writer: LG_writer_put waits until the
+// previous buffer has been written before it returns.  The caller must not
+// access the FILE until LG_writer_close has been called.
+
+// If pthreads are not available, LG_writer_put writes the buffer itself.
+
+#include "LG_internal.h"
+
+#if defined ( LAGRAPH_PTHREADS )
+#include <pthread.h>
+#define LG_WRITER_THREAD 1
+#else
+#define LG_WRITER_THREAD 0
+#endif
+
+struct LG_writer_struct
+{
+    FILE *f ;               // the file, owned by the caller
+    void *buf ;             // buffer to write, or NULL if none pending
+    size_t size ;           // size of buf, in bytes
+    bool error ;            // true if a write has failed
+    bool done ;             // true if no more buffers will be given
+    #if LG_WRITER_THREAD
+    pthread_t thread ;
+    pthread_mutex_t lock ;
+    pthread_cond_t cond ;
+    bool thread_started ;
+    #endif
+} ;
+
+//------------------------------------------------------------------------------
+// write_buffer: write a buffer to the file and free it
+//------------------------------------------------------------------------------
+
+static bool write_buffer (FILE *f, void **buf, size_t size)
+{
+    bool ok = (fwrite (*buf, sizeof (uint8_t), size, f) == size) ;
+    LAGraph_Free (buf, NULL) ;
+    return (ok) ;
+}
+
+//------------------------------------------------------------------------------
+// writer: the thread that writes each buffer to the file
+//------------------------------------------------------------------------------
+
+#if LG_WRITER_THREAD
+static void *writer (void *arg)
+{
+    LG_writer w = (LG_writer) arg ;
+    pthread_mutex_lock (&(w->lock)) ;
+    while (true)
+    {
+        // wait for a buffer to write
+        while (w->buf == NULL && !w->done)
+        {
+            pthread_cond_wait (&(w->cond), &(w->lock)) ;
+        }
+        if (w->buf == NULL) break ;
+
+        // write the buffer, without holding the lock
+        void *buf = w->buf ;
+        size_t size = w->size ;
+        pthread_mutex_unlock (&(w->lock)) ;
+        bool ok = write_buffer (w->f, &buf, size) ;
+        pthread_mutex_lock (&(w->lock)) ;
+
+        // tell LG_writer_put that the buffer has been written
+        w->buf = NULL ;
+        w->error = w->error || !ok ;
+        pthread_cond_broadcast (&(w->cond)) ;
+    }
+    pthread_mutex_unlock (&(w->lock)) ;
+    return (NULL) ;
+}
+#endif
+
+//------------------------------------------------------------------------------
+// LG_writer_open: start a writer for an open file
+//------------------------------------------------------------------------------
+
+int LG_writer_open
+(
+    // output:
+    LG_writer *writer_handle,   // the writer
+    // input:
+    FILE *f,                    // file to write to, already open
+    char *msg
+)
+{
+    LG_CLEAR_MSG ;
+    LG_writer w = NULL ;
+    LG_ASSERT (writer_handle != NULL && f != NULL, GrB_NULL_POINTER) ;
+    (*writer_handle) = NULL ;
+
+    LG_TRY (LAGraph_Calloc ((void **) &w, 1, sizeof (struct LG_writer_struct),
+        msg)) ;
+    w->f = f ;
+
+    #if LG_WRITER_THREAD
+    pthread_mutex_init (&(w->lock), NULL) ;
+    pthread_cond_init (&(w->cond), NULL) ;
+    w->thread_started = true ;
+    if (pthread_create (&(w->thread), NULL, writer, w) != 0)
+    {
+        // write each buffer in LG_writer_put instead
+        w->thread_started = false ;
+        pthread_mutex_destroy (&(w->lock)) ;
+        pthread_cond_destroy (&(w->cond)) ;
+    }
+    #endif
+
+    (*writer_handle) = w ;
+    return (GrB_SUCCESS) ;
+}
+
+//------------------------------------------------------------------------------
+// LG_writer_put: give the next buffer to the writer
+//------------------------------------------------------------------------------
+
+// The writer takes ownership of the buffer, which must have been allocated by
+// LAGraph_Malloc, and (*buf) is set to NULL.  The buffer is freed when it has
+// been written.  An error from any prior write is returned.
+
+int LG_writer_put
+(
+    LG_writer w,                // the writer
+    void **buf,                 // buffer to write; NULL on output
+    size_t size,                // size of the buffer, in bytes
+    char *msg
+)
+{
+    LG_CLEAR_MSG ;
+    LG_ASSERT (w != NULL && buf != NULL && (*buf) != NULL, GrB_NULL_POINTER) ;
+    void *p = (*buf) ;
+    (*buf) = NULL ;
+
+    #if LG_WRITER_THREAD
+    if (w->thread_started)
+    {
+        // wait for the prior buffer to be written, then give it this one
+        pthread_mutex_lock (&(w->lock)) ;
+        while (w->buf != NULL)
+        {
+            pthread_cond_wait (&(w->cond), &(w->lock)) ;
+        }
+        bool ok = !(w->error) ;
+        if (ok)
+        {
+            w->buf = p ;
+            w->size = size ;
+            pthread_cond_broadcast (&(w->cond)) ;
+        }
+        pthread_mutex_unlock (&(w->lock)) ;
+        if (!ok) LAGraph_Free (&p, NULL) ;
+        LG_ASSERT_MSG (ok, LAGRAPH_IO_ERROR, "file not written properly") ;
+        return (GrB_SUCCESS) ;
+    }
+    #endif
+
+    // write the buffer now
+    w->error = w->error || !write_buffer (w->f, &p, size) ;
+    LG_ASSERT_MSG (!(w->error), LAGRAPH_IO_ERROR, "file not written properly") ;
+    return (GrB_SUCCESS) ;
+}
+
+//------------------------------------------------------------------------------
+// LG_writer_close: wait for all buffers to be written, and free the writer
+//------------------------------------------------------------------------------
+
+// The FILE is not closed.  LAGRAPH_IO_ERROR is returned if any write failed.
+
+int LG_writer_close
+(
+    LG_writer *writer_handle,   // the writer; NULL on output
+    char *msg
+)
+{
+    LG_CLEAR_MSG ;
+    if (writer_handle == NULL || (*writer_handle) == NULL)
+    {
+        return (GrB_SUCCESS) ;
+    }
+    LG_writer w = (*writer_handle) ;
+
+    #if LG_WRITER_THREAD
+    if (w->thread_started)
+    {
+        // tell the writer to finish the last buffer, and wait for it
+        pthread_mutex_lock (&(w->lock)) ;
+        w->done = true ;
+        pthread_cond_broadcast (&(w->cond)) ;
+        pthread_mutex_unlock (&(w->lock)) ;
+        pthread_join (w->thread, NULL) ;
+        pthread_mutex_destroy (&(w->lock)) ;
+        pthread_cond_destroy (&(w->cond)) ;
+    }
+    #endif
+
+    bool ok = !(w->error) ;
+    LAGraph_Free ((void **) writer_handle, NULL) ;
+    LG_ASSERT_MSG (ok, LAGRAPH_IO_ERROR, "file not written properly") ;
+    return (GrB_SUCCESS) ;
+}